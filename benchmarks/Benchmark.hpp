@@ -0,0 +1,346 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_BENCHMARK_HPP
+#define EL_BENCHMARK_HPP
+
+#include "El.hpp"
+#if defined(__unix__) || defined(__APPLE__)
+# include <sys/resource.h>
+#endif
+
+// Shared machinery for the performance benchmarks. Every driver sweeps over
+// a range of problem sizes, process grid shapes, and algorithmic blocksizes,
+// records one Result per configuration, and (optionally) writes the results
+// to a CSV file and compares them against a previously-stored baseline.
+
+namespace El {
+namespace bench {
+
+struct Result
+{
+    string routine;
+    string variant;
+    string type;
+    Int m=0, n=0, k=0;
+    Int gridHeight=1, gridWidth=1;
+    Int blocksize=0;
+    double seconds=0;
+    double gflops=0;
+    double peakMB=0;
+};
+
+inline string CSVHeader()
+{
+    return "routine,variant,type,m,n,k,gridHeight,gridWidth,blocksize,"
+           "seconds,gflops,peakMB";
+}
+
+inline string ResultKey( const Result& res )
+{
+    ostringstream os;
+    os << res.routine << "," << res.variant << "," << res.type << ","
+       << res.m << "," << res.n << "," << res.k << ","
+       << res.gridHeight << "," << res.gridWidth << "," << res.blocksize;
+    return os.str();
+}
+
+inline string ResultLine( const Result& res )
+{
+    ostringstream os;
+    os << ResultKey(res) << ","
+       << res.seconds << "," << res.gflops << "," << res.peakMB;
+    return os.str();
+}
+
+template<typename T>
+inline string TypeName()
+{ return ( IsComplex<T>::val ? "z" : "d" ); }
+template<>
+inline string TypeName<float>() { return "s"; }
+template<>
+inline string TypeName<Complex<float>>() { return "c"; }
+
+// Reset the high-water mark of the resident set size so that the next call
+// to PeakMemoryMB only reflects the current configuration. This is only
+// supported by Linux (through /proc/self/clear_refs); elsewhere the peak is
+// that of the process lifetime.
+inline void ResetPeakMemory()
+{
+#ifdef __linux__
+    ofstream clearRefs( "/proc/self/clear_refs" );
+    if( clearRefs.is_open() )
+        clearRefs << "5" << endl;
+#endif
+}
+
+// The high-water mark of the resident set size (in MB) since the last call
+// to ResetPeakMemory, maximized over the processes in the communicator
+inline double PeakMemoryMB( mpi::Comm comm )
+{
+    double peakMB = 0;
+#ifdef __linux__
+    // VmHWM is reset by ResetPeakMemory (unlike ru_maxrss)
+    ifstream status( "/proc/self/status" );
+    string line;
+    while( std::getline( status, line ) )
+    {
+        if( line.compare( 0, 6, "VmHWM:" ) == 0 )
+        {
+            std::stringstream lineStream( line.substr(6) );
+            double peakKB;
+            if( lineStream >> peakKB )
+                peakMB = peakKB / 1024.;
+            break;
+        }
+    }
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+    if( peakMB == 0 )
+    {
+        struct rusage usage;
+        if( getrusage( RUSAGE_SELF, &usage ) == 0 )
+        {
+#ifdef __APPLE__
+            // Darwin reports the maximum resident set size in bytes
+            peakMB = double(usage.ru_maxrss) / (1024.*1024.);
+#else
+            // Linux reports the maximum resident set size in kilobytes
+            peakMB = double(usage.ru_maxrss) / 1024.;
+#endif
+        }
+    }
+#endif
+    return mpi::AllReduce( peakMB, mpi::MAX, comm );
+}
+
+// Command-line options shared by all of the drivers
+// =================================================
+// NOTE: The constructor registers the options with the global argument
+//       handler and must therefore be called before ProcessInput().
+struct Options
+{
+    Int minSize, maxSize;
+    double sizeFactor;
+    Int minBlocksize, maxBlocksize;
+    double blocksizeFactor;
+    bool sweepGrids;
+    Int gridHeight;
+    bool colMajor;
+    Int numReps;
+    bool warmup;
+    bool testComplex;
+    string output;
+    string baseline;
+    double tolerance;
+
+    Options( Int minSizeDef=500, Int maxSizeDef=2000, Int nbDef=96 )
+    {
+        minSize = Input("--minSize","smallest problem size",minSizeDef);
+        maxSize = Input("--maxSize","largest problem size",maxSizeDef);
+        sizeFactor = Input("--sizeFactor","growth factor for sizes",2.);
+        minBlocksize = Input("--minNb","smallest algorithmic blocksize",nbDef);
+        maxBlocksize = Input("--maxNb","largest algorithmic blocksize",nbDef);
+        blocksizeFactor = Input("--nbFactor","growth factor for blocksizes",2.);
+        sweepGrids = Input("--sweepGrids","try every process grid shape?",false);
+        gridHeight = Input("--r","height of process grid (0 for default)",0);
+        colMajor = Input("--colMajor","column-major ordering?",true);
+        numReps = Input("--numReps","number of timed repetitions",1);
+        warmup = Input("--warmup","perform an untimed warmup run?",false);
+        testComplex = Input("--complex","also benchmark complex data?",true);
+        output = Input("--output","CSV file for the results",string(""));
+        baseline = Input("--baseline","CSV file of baseline results",string(""));
+        tolerance =
+          Input("--tolerance","relative slowdown flagged as regression",0.1);
+    }
+
+    vector<Int> Sizes() const
+    {
+        vector<Int> sizes;
+        const double factor = Max(sizeFactor,1.01);
+        for( double size=minSize; Int(size)<=maxSize; size*=factor )
+            if( sizes.empty() || Int(size) != sizes.back() )
+                sizes.push_back( Int(size) );
+        return sizes;
+    }
+
+    vector<Int> Blocksizes() const
+    {
+        vector<Int> blocksizes;
+        const double factor = Max(blocksizeFactor,1.01);
+        for( double nb=minBlocksize; Int(nb)<=maxBlocksize; nb*=factor )
+            if( blocksizes.empty() || Int(nb) != blocksizes.back() )
+                blocksizes.push_back( Int(nb) );
+        return blocksizes;
+    }
+
+    vector<Int> GridHeights( mpi::Comm comm ) const
+    {
+        const Int commSize = mpi::Size( comm );
+        vector<Int> heights;
+        if( sweepGrids )
+        {
+            for( Int r=1; r<=commSize; ++r )
+                if( commSize % r == 0 )
+                    heights.push_back( r );
+        }
+        else if( gridHeight != 0 )
+            heights.push_back( gridHeight );
+        else
+            heights.push_back( Grid::FindFactor(commSize) );
+        return heights;
+    }
+
+    GridOrder Order() const
+    { return ( colMajor ? COLUMN_MAJOR : ROW_MAJOR ); }
+};
+
+// Return the minimum wall-clock time over the requested number of
+// repetitions. The 'setup' routine is called (untimed) before each run.
+template<typename SetupFunc,typename RunFunc>
+inline double Time
+( mpi::Comm comm, const Options& opts, SetupFunc setup, RunFunc run )
+{
+    if( opts.warmup )
+    {
+        setup();
+        run();
+    }
+    double minTime = std::numeric_limits<double>::max();
+    for( Int rep=0; rep<Max(opts.numReps,Int(1)); ++rep )
+    {
+        setup();
+        mpi::Barrier( comm );
+        const double startTime = mpi::Time();
+        run();
+        mpi::Barrier( comm );
+        minTime = Min( minTime, mpi::Time()-startTime );
+    }
+    return minTime;
+}
+
+// Collection, storage, and comparison of results
+// ==============================================
+class Reporter
+{
+public:
+    Reporter( mpi::Comm comm, const Options& opts )
+    : comm_(comm), opts_(opts)
+    {
+        if( mpi::Rank(comm_) == 0 )
+            cout << CSVHeader() << endl;
+        ResetPeakMemory();
+    }
+
+    // The peak memory is measured since the previous call (or construction)
+    void Add( const Result& res )
+    {
+        Result resMem( res );
+        resMem.peakMB = PeakMemoryMB( comm_ );
+        ResetPeakMemory();
+        results_.push_back( resMem );
+        if( mpi::Rank(comm_) == 0 )
+            cout << ResultLine(resMem) << endl;
+    }
+
+    // Write the results to disk and compare against the baseline (if one
+    // was given). The return value is the number of detected regressions,
+    // which is identical on every process.
+    Int Finish()
+    {
+        Int numRegressions = 0;
+        if( mpi::Rank(comm_) == 0 )
+        {
+            if( opts_.output != "" )
+                Write( opts_.output );
+            if( opts_.baseline != "" )
+                numRegressions = Compare( opts_.baseline );
+        }
+        mpi::Broadcast( numRegressions, 0, comm_ );
+        return numRegressions;
+    }
+
+private:
+    mpi::Comm comm_;
+    const Options& opts_;
+    vector<Result> results_;
+
+    void Write( const string& filename ) const
+    {
+        ofstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        file << CSVHeader() << "\n";
+        for( const auto& res : results_ )
+            file << ResultLine(res) << "\n";
+    }
+
+    Int Compare( const string& filename ) const
+    {
+        ifstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+
+        // Each baseline line is the key followed by seconds,gflops,peakMB
+        std::map<string,double> baseTimes;
+        string line;
+        while( std::getline( file, line ) )
+        {
+            if( line.empty() || line == CSVHeader() )
+                continue;
+            size_t pos = line.size();
+            for( Int field=0; field<3; ++field )
+            {
+                pos = line.rfind( ',', pos-1 );
+                if( pos == string::npos )
+                    break;
+            }
+            if( pos == string::npos )
+                continue;
+            const string key = line.substr( 0, pos );
+            std::stringstream valueStream( line.substr(pos+1) );
+            double seconds;
+            valueStream >> seconds;
+            baseTimes[key] = seconds;
+        }
+
+        Int numRegressions=0, numMatched=0;
+        cout << "\nComparison against " << filename << ":" << endl;
+        for( const auto& res : results_ )
+        {
+            auto it = baseTimes.find( ResultKey(res) );
+            if( it == baseTimes.end() )
+                continue;
+            ++numMatched;
+            const double baseSeconds = it->second;
+            const double ratio = res.seconds / baseSeconds;
+            if( ratio > 1+opts_.tolerance )
+            {
+                ++numRegressions;
+                cout << "  REGRESSION: " << ResultKey(res) << " took "
+                     << res.seconds << " vs. " << baseSeconds
+                     << " seconds (" << ratio << "x)" << endl;
+            }
+            else if( ratio < 1-opts_.tolerance )
+                cout << "  improvement: " << ResultKey(res) << " took "
+                     << res.seconds << " vs. " << baseSeconds
+                     << " seconds (" << ratio << "x)" << endl;
+        }
+        cout << "  " << numMatched << " of " << results_.size()
+             << " configurations matched the baseline, "
+             << numRegressions << " regressed by more than "
+             << 100*opts_.tolerance << "%" << endl;
+        return numRegressions;
+    }
+};
+
+} // namespace bench
+} // namespace El
+
+#endif // ifndef EL_BENCHMARK_HPP
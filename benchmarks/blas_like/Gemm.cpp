@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename T>
+void BenchmarkGemm
+( Orientation orientA, Orientation orientB,
+  Int n, Int nb, const Grid& g,
+  const bench::Options& opts, bench::Reporter& reporter )
+{
+    const Int m=n, k=n;
+    DistMatrix<T> A(g), B(g), COrig(g), C(g);
+    if( orientA == NORMAL )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( orientB == NORMAL )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Uniform( COrig, m, n );
+
+    vector<pair<GemmAlgorithm,string>> algs;
+    algs.push_back( std::make_pair(GEMM_DEFAULT,"default") );
+    algs.push_back( std::make_pair(GEMM_SUMMA_A,"SUMMA_A") );
+    algs.push_back( std::make_pair(GEMM_SUMMA_B,"SUMMA_B") );
+    algs.push_back( std::make_pair(GEMM_SUMMA_C,"SUMMA_C") );
+    if( orientA == NORMAL && orientB == NORMAL )
+    {
+        algs.push_back( std::make_pair(GEMM_SUMMA_DOT,"SUMMA_DOT") );
+        if( g.Height() == g.Width() )
+            algs.push_back( std::make_pair(GEMM_CANNON,"Cannon") );
+    }
+
+    const double realFlops = 2.*double(m)*double(n)*double(k);
+    const double flops = ( IsComplex<T>::val ? 4*realFlops : realFlops );
+    for( const auto& alg : algs )
+    {
+        const double seconds = bench::Time
+        ( g.Comm(), opts,
+          [&]() { C = COrig; },
+          [&]() { Gemm( orientA, orientB, T(3), A, B, T(4), C, alg.first ); } );
+
+        bench::Result res;
+        res.routine = "Gemm";
+        res.routine += OrientationToChar(orientA);
+        res.routine += OrientationToChar(orientB);
+        res.variant = alg.second;
+        res.type = bench::TypeName<T>();
+        res.m = m; res.n = n; res.k = k;
+        res.gridHeight = g.Height(); res.gridWidth = g.Width();
+        res.blocksize = nb;
+        res.seconds = seconds;
+        res.gflops = flops/(1.e9*seconds);
+        reporter.Add( res );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const char transA = Input("--transA","orientation of A: N/T/C",'N');
+        const char transB = Input("--transB","orientation of B: N/T/C",'N');
+        const bench::Options opts;
+        ProcessInput();
+        PrintInputReport();
+
+        const Orientation orientA = CharToOrientation( transA );
+        const Orientation orientB = CharToOrientation( transB );
+        ComplainIfDebug();
+
+        bench::Reporter reporter( comm, opts );
+        for( const Int r : opts.GridHeights(comm) )
+        {
+            const Grid g( comm, r, opts.Order() );
+            for( const Int nb : opts.Blocksizes() )
+            {
+                SetBlocksize( nb );
+                for( const Int n : opts.Sizes() )
+                {
+                    BenchmarkGemm<double>
+                    ( orientA, orientB, n, nb, g, opts, reporter );
+                    if( opts.testComplex )
+                        BenchmarkGemm<Complex<double>>
+                        ( orientA, orientB, n, nb, g, opts, reporter );
+                }
+            }
+        }
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
@@ -0,0 +1,91 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename T>
+void BenchmarkHerk
+( UpperOrLower uplo, Orientation orient,
+  Int n, Int k, Int nb, const Grid& g,
+  const bench::Options& opts, bench::Reporter& reporter )
+{
+    DistMatrix<T> A(g), COrig(g), C(g);
+    if( orient == NORMAL )
+        Uniform( A, n, k );
+    else
+        Uniform( A, k, n );
+    Uniform( COrig, n, n );
+
+    const double seconds = bench::Time
+    ( g.Comm(), opts,
+      [&]() { C = COrig; },
+      [&]() { Herk( uplo, orient, Base<T>(3), A, Base<T>(4), C ); } );
+
+    const double realFlops = double(n)*double(n)*double(k);
+    const double flops = ( IsComplex<T>::val ? 4*realFlops : realFlops );
+
+    bench::Result res;
+    res.routine = "Herk";
+    res.routine += UpperOrLowerToChar(uplo);
+    res.routine += OrientationToChar(orient);
+    res.variant = "default";
+    res.type = bench::TypeName<T>();
+    res.m = n; res.n = n; res.k = k;
+    res.gridHeight = g.Height(); res.gridWidth = g.Width();
+    res.blocksize = nb;
+    res.seconds = seconds;
+    res.gflops = flops/(1.e9*seconds);
+    reporter.Add( res );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const char transChar = Input("--trans","orientation: N/C",'N');
+        const Int kFixed = Input("--k","inner dimension (0 for n)",0);
+        const bench::Options opts;
+        ProcessInput();
+        PrintInputReport();
+
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        const Orientation orient = CharToOrientation( transChar );
+        ComplainIfDebug();
+
+        bench::Reporter reporter( comm, opts );
+        for( const Int r : opts.GridHeights(comm) )
+        {
+            const Grid g( comm, r, opts.Order() );
+            for( const Int nb : opts.Blocksizes() )
+            {
+                SetBlocksize( nb );
+                for( const Int n : opts.Sizes() )
+                {
+                    const Int k = ( kFixed == 0 ? n : kFixed );
+                    BenchmarkHerk<double>
+                    ( uplo, orient, n, k, nb, g, opts, reporter );
+                    if( opts.testComplex )
+                        BenchmarkHerk<Complex<double>>
+                        ( uplo, orient, n, k, nb, g, opts, reporter );
+                }
+            }
+        }
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
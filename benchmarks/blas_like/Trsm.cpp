@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkTrsm
+( LeftOrRight side, UpperOrLower uplo, Orientation orient,
+  Int n, Int numRHS, Int nb, const Grid& g,
+  const bench::Options& opts, bench::Reporter& reporter )
+{
+    // Keep the triangular matrix well-conditioned
+    DistMatrix<F> A(g), BOrig(g), B(g);
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(2*n) );
+    if( side == LEFT )
+        Uniform( BOrig, n, numRHS );
+    else
+        Uniform( BOrig, numRHS, n );
+
+    vector<pair<TrsmAlgorithm,string>> algs;
+    algs.push_back( std::make_pair(TRSM_DEFAULT,"default") );
+    algs.push_back( std::make_pair(TRSM_LARGE,"large") );
+    algs.push_back( std::make_pair(TRSM_MEDIUM,"medium") );
+    if( side == LEFT )
+        algs.push_back( std::make_pair(TRSM_SMALL,"small") );
+
+    const double realFlops = double(n)*double(n)*double(numRHS);
+    const double flops = ( IsComplex<F>::val ? 4*realFlops : realFlops );
+    for( const auto& alg : algs )
+    {
+        const double seconds = bench::Time
+        ( g.Comm(), opts,
+          [&]() { B = BOrig; },
+          [&]() { Trsm
+                  ( side, uplo, orient, NON_UNIT,
+                    F(1), A, B, false, alg.first ); } );
+
+        bench::Result res;
+        res.routine = "Trsm";
+        res.routine += LeftOrRightToChar(side);
+        res.routine += UpperOrLowerToChar(uplo);
+        res.routine += OrientationToChar(orient);
+        res.variant = alg.second;
+        res.type = bench::TypeName<F>();
+        res.m = n; res.n = numRHS;
+        res.gridHeight = g.Height(); res.gridWidth = g.Width();
+        res.blocksize = nb;
+        res.seconds = seconds;
+        res.gflops = flops/(1.e9*seconds);
+        reporter.Add( res );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const char sideChar = Input("--side","side to solve from: L/R",'L');
+        const char uploChar = Input("--uplo","lower or upper storage: L/U",'L');
+        const char transChar = Input
+            ("--trans","orientation of triangular matrix: N/T/C",'N');
+        const Int numRHS = Input
+            ("--numRHS","number of right-hand sides (0 for n)",0);
+        const bench::Options opts;
+        ProcessInput();
+        PrintInputReport();
+
+        const LeftOrRight side = CharToLeftOrRight( sideChar );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        const Orientation orient = CharToOrientation( transChar );
+        ComplainIfDebug();
+
+        bench::Reporter reporter( comm, opts );
+        for( const Int r : opts.GridHeights(comm) )
+        {
+            const Grid g( comm, r, opts.Order() );
+            for( const Int nb : opts.Blocksizes() )
+            {
+                SetBlocksize( nb );
+                for( const Int n : opts.Sizes() )
+                {
+                    const Int k = ( numRHS == 0 ? n : numRHS );
+                    BenchmarkTrsm<double>
+                    ( side, uplo, orient, n, k, nb, g, opts, reporter );
+                    if( opts.testComplex )
+                        BenchmarkTrsm<Complex<double>>
+                        ( side, uplo, orient, n, k, nb, g, opts, reporter );
+                }
+            }
+        }
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
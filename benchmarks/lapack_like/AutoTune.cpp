@@ -0,0 +1,69 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Empirically tune Elemental's parameters for this machine and process grid 
+// and save them as a profile which can be loaded at Initialize() time by
+// setting the EL_TUNING_PROFILE environment variable
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        Int r = Input("--r","height of process grid",0);
+        const Int minN = Input("--minN","smallest size for the blocksize",500);
+        const Int maxN = Input("--maxN","largest size for the blocksize",2000);
+        const Int localN = 
+          Input("--localN","size for tuning the local blocksizes",1000);
+        const Int gemmSize = 
+          Input("--gemmSize","size of C in the Gemm crossover tests",256);
+        const Int maxGemmRatio = 
+          Input("--maxGemmRatio","maximum ratio of k to size of C",32);
+        const Int numReps = Input("--numReps","number of repetitions",2);
+        const bool tuneSingle = 
+          Input("--tuneSingle","tune single-precision?",false);
+        const bool tuneComplex = Input("--tuneComplex","tune complex?",true);
+        const string filename = 
+          Input("--profile","tuning profile to write",string("El.tune"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        ComplainIfDebug();
+
+        TuneCtrl ctrl;
+        ctrl.sizes.clear();
+        for( Int n=minN; n<=maxN; n*=2 )
+            ctrl.sizes.push_back( n );
+        ctrl.localN = localN;
+        ctrl.gemmSize = gemmSize;
+        ctrl.maxGemmRatio = maxGemmRatio;
+        ctrl.numReps = numReps;
+        ctrl.tuneSingle = tuneSingle;
+        ctrl.tuneComplex = tuneComplex;
+        ctrl.progress = true;
+        AutoTune( g, ctrl );
+        SaveTuningProfile( filename );
+        if( mpi::Rank(comm) == 0 )
+            cout << "Wrote tuning profile to " << filename << endl;
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkCholesky
+( UpperOrLower uplo, Int n, Int nb, const Grid& g,
+  const bench::Options& opts, bench::Reporter& reporter )
+{
+    // Form a diagonally-dominant HPD matrix
+    DistMatrix<F> AOrig(g), A(g);
+    Uniform( AOrig, n, n );
+    MakeHermitian( uplo, AOrig );
+    ShiftDiagonal( AOrig, F(2*n) );
+
+    const double seconds = bench::Time
+    ( g.Comm(), opts,
+      [&]() { A = AOrig; },
+      [&]() { Cholesky( uplo, A ); } );
+
+    const double realFlops = 1./3.*double(n)*double(n)*double(n);
+    const double flops = ( IsComplex<F>::val ? 4*realFlops : realFlops );
+
+    bench::Result res;
+    res.routine = "Cholesky";
+    res.routine += UpperOrLowerToChar(uplo);
+    res.variant = "default";
+    res.type = bench::TypeName<F>();
+    res.m = n; res.n = n;
+    res.gridHeight = g.Height(); res.gridWidth = g.Width();
+    res.blocksize = nb;
+    res.seconds = seconds;
+    res.gflops = flops/(1.e9*seconds);
+    reporter.Add( res );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const bench::Options opts;
+        ProcessInput();
+        PrintInputReport();
+
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        ComplainIfDebug();
+
+        bench::Reporter reporter( comm, opts );
+        for( const Int r : opts.GridHeights(comm) )
+        {
+            const Grid g( comm, r, opts.Order() );
+            for( const Int nb : opts.Blocksizes() )
+            {
+                SetBlocksize( nb );
+                for( const Int n : opts.Sizes() )
+                {
+                    BenchmarkCholesky<double>( uplo, n, nb, g, opts, reporter );
+                    if( opts.testComplex )
+                        BenchmarkCholesky<Complex<double>>
+                        ( uplo, n, nb, g, opts, reporter );
+                }
+            }
+        }
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
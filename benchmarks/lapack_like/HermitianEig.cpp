@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkHermitianEig
+( UpperOrLower uplo, Int n, Int nb, const Grid& g, bool testSDC,
+  const bench::Options& opts, bench::Reporter& reporter )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> AOrig(g), A(g), Z(g);
+    DistMatrix<Real,VR,STAR> w(g);
+    Uniform( AOrig, n, n );
+    MakeHermitian( uplo, AOrig );
+
+    // NOTE: The rates are nominal; they are measured relative to the 
+    //       (4/3) n^3 flops of the tridiagonalization and, when vectors are
+    //       requested, the 2 n^3 flops of the back-transformation.
+    const double n3 = double(n)*double(n)*double(n);
+    const double valFlops = ( IsComplex<F>::val ? 4 : 1 )*(4./3.)*n3;
+    const double vecFlops = valFlops + ( IsComplex<F>::val ? 4 : 1 )*2.*n3;
+
+    bench::Result res;
+    res.routine = "HermitianEig";
+    res.routine += UpperOrLowerToChar(uplo);
+    res.type = bench::TypeName<F>();
+    res.m = n; res.n = n;
+    res.gridHeight = g.Height(); res.gridWidth = g.Width();
+    res.blocksize = nb;
+
+    HermitianEigSubset<Real> subset;
+    HermitianEigCtrl<F> ctrl;
+
+    res.variant = "values";
+    res.seconds = bench::Time
+    ( g.Comm(), opts, 
+      [&]() { A = AOrig; }, 
+      [&]() { HermitianEig( uplo, A, w, ASCENDING, subset, ctrl ); } );
+    res.gflops = valFlops/(1.e9*res.seconds);
+    reporter.Add( res );
+
+    res.variant = "vectors";
+    res.seconds = bench::Time
+    ( g.Comm(), opts, 
+      [&]() { A = AOrig; }, 
+      [&]() { HermitianEig( uplo, A, w, Z, ASCENDING, subset, ctrl ); } );
+    res.gflops = vecFlops/(1.e9*res.seconds);
+    reporter.Add( res );
+
+    if( testSDC )
+    {
+        ctrl.useSDC = true;
+        res.variant = "SDC-vectors";
+        res.seconds = bench::Time
+        ( g.Comm(), opts, 
+          [&]() { A = AOrig; }, 
+          [&]() { HermitianEig( uplo, A, w, Z, ASCENDING, subset, ctrl ); } );
+        res.gflops = vecFlops/(1.e9*res.seconds);
+        reporter.Add( res );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const bool testSDC = Input("--sdc","test spectral D&C?",false);
+        const bench::Options opts;
+        ProcessInput();
+        PrintInputReport();
+
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        ComplainIfDebug();
+
+        bench::Reporter reporter( comm, opts );
+        for( const Int r : opts.GridHeights(comm) )
+        {
+            const Grid g( comm, r, opts.Order() );
+            for( const Int nb : opts.Blocksizes() )
+            {
+                SetBlocksize( nb );
+                for( const Int n : opts.Sizes() )
+                {
+                    BenchmarkHermitianEig<double>
+                    ( uplo, n, nb, g, testSDC, opts, reporter );
+                    if( opts.testComplex )
+                        BenchmarkHermitianEig<Complex<double>>
+                        ( uplo, n, nb, g, testSDC, opts, reporter );
+                }
+            }
+        }
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
@@ -0,0 +1,92 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkLU
+( Int n, Int nb, const Grid& g, bool testFull,
+  const bench::Options& opts, bench::Reporter& reporter )
+{
+    // Diagonal dominance keeps the unpivoted variant stable
+    DistMatrix<F> AOrig(g), A(g);
+    DistMatrix<Int,VC,STAR> p(g), q(g);
+    Uniform( AOrig, n, n );
+    ShiftDiagonal( AOrig, F(2*n) );
+
+    const double realFlops = 2./3.*double(n)*double(n)*double(n);
+    const double flops = ( IsComplex<F>::val ? 4*realFlops : realFlops );
+
+    bench::Result res;
+    res.routine = "LU";
+    res.type = bench::TypeName<F>();
+    res.m = n; res.n = n;
+    res.gridHeight = g.Height(); res.gridWidth = g.Width();
+    res.blocksize = nb;
+
+    res.variant = "partial";
+    res.seconds = bench::Time
+    ( g.Comm(), opts, [&]() { A = AOrig; }, [&]() { LU( A, p ); } );
+    res.gflops = flops/(1.e9*res.seconds);
+    reporter.Add( res );
+
+    res.variant = "nopiv";
+    res.seconds = bench::Time
+    ( g.Comm(), opts, [&]() { A = AOrig; }, [&]() { LU( A ); } );
+    res.gflops = flops/(1.e9*res.seconds);
+    reporter.Add( res );
+
+    if( testFull )
+    {
+        res.variant = "full";
+        res.seconds = bench::Time
+        ( g.Comm(), opts, [&]() { A = AOrig; }, [&]() { LU( A, p, q ); } );
+        res.gflops = flops/(1.e9*res.seconds);
+        reporter.Add( res );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const bool testFull = Input("--full","test full pivoting?",false);
+        const bench::Options opts;
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+
+        bench::Reporter reporter( comm, opts );
+        for( const Int r : opts.GridHeights(comm) )
+        {
+            const Grid g( comm, r, opts.Order() );
+            for( const Int nb : opts.Blocksizes() )
+            {
+                SetBlocksize( nb );
+                for( const Int n : opts.Sizes() )
+                {
+                    BenchmarkLU<double>( n, nb, g, testFull, opts, reporter );
+                    if( opts.testComplex )
+                        BenchmarkLU<Complex<double>>
+                        ( n, nb, g, testFull, opts, reporter );
+                }
+            }
+        }
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
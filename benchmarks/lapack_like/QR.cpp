@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkQR
+( Int m, Int n, Int nb, const Grid& g, bool testPivoted,
+  const bench::Options& opts, bench::Reporter& reporter )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> AOrig(g), A(g);
+    DistMatrix<F,MD,STAR> t(g);
+    DistMatrix<Real,MD,STAR> d(g);
+    DistMatrix<Int,VR,STAR> p(g);
+    Uniform( AOrig, m, n );
+
+    // The standard count for a Householder QR factorization
+    const Int k = Min(m,n);
+    const double realFlops =
+      ( m >= n ? 2.*double(m)*double(n)*double(n) - 2./3.*double(n)*n*n
+               : 2.*double(n)*double(m)*double(m) - 2./3.*double(m)*m*m );
+    const double flops = ( IsComplex<F>::val ? 4*realFlops : realFlops );
+
+    bench::Result res;
+    res.routine = "QR";
+    res.type = bench::TypeName<F>();
+    res.m = m; res.n = n; res.k = k;
+    res.gridHeight = g.Height(); res.gridWidth = g.Width();
+    res.blocksize = nb;
+
+    res.variant = "householder";
+    res.seconds = bench::Time
+    ( g.Comm(), opts, [&]() { A = AOrig; }, [&]() { QR( A, t, d ); } );
+    res.gflops = flops/(1.e9*res.seconds);
+    reporter.Add( res );
+
+    if( testPivoted )
+    {
+        res.variant = "businger-golub";
+        res.seconds = bench::Time
+        ( g.Comm(), opts, [&]() { A = AOrig; }, [&]() { QR( A, t, d, p ); } );
+        res.gflops = flops/(1.e9*res.seconds);
+        reporter.Add( res );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const double aspect = 
+          Input("--aspect","ratio of the height to the width",1.);
+        const bool testPivoted =
+          Input("--pivoted","test column pivoting?",false);
+        const bench::Options opts;
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+
+        bench::Reporter reporter( comm, opts );
+        for( const Int r : opts.GridHeights(comm) )
+        {
+            const Grid g( comm, r, opts.Order() );
+            for( const Int nb : opts.Blocksizes() )
+            {
+                SetBlocksize( nb );
+                for( const Int n : opts.Sizes() )
+                {
+                    const Int m = Int(aspect*n);
+                    BenchmarkQR<double>
+                    ( m, n, nb, g, testPivoted, opts, reporter );
+                    if( opts.testComplex )
+                        BenchmarkQR<Complex<double>>
+                        ( m, n, nb, g, testPivoted, opts, reporter );
+                }
+            }
+        }
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkSVD
+( Int m, Int n, Int nb, const Grid& g,
+  const bench::Options& opts, bench::Reporter& reporter )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> AOrig(g), A(g), V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    Uniform( AOrig, m, n );
+
+    // NOTE: The rates are nominal; they are measured relative to the 
+    //       4 m n^2 - (4/3) n^3 flops of the bidiagonalization (for m >= n)
+    const double mMax = Max(m,n), nMin = Min(m,n);
+    const double realFlops = 4.*mMax*nMin*nMin - 4./3.*nMin*nMin*nMin;
+    const double flops = ( IsComplex<F>::val ? 4*realFlops : realFlops );
+
+    bench::Result res;
+    res.routine = "SVD";
+    res.type = bench::TypeName<F>();
+    res.m = m; res.n = n;
+    res.gridHeight = g.Height(); res.gridWidth = g.Width();
+    res.blocksize = nb;
+
+    res.variant = "values";
+    res.seconds = bench::Time
+    ( g.Comm(), opts, [&]() { A = AOrig; }, [&]() { SVD( A, s ); } );
+    res.gflops = flops/(1.e9*res.seconds);
+    reporter.Add( res );
+
+    res.variant = "vectors";
+    res.seconds = bench::Time
+    ( g.Comm(), opts, [&]() { A = AOrig; }, [&]() { SVD( A, s, V ); } );
+    res.gflops = flops/(1.e9*res.seconds);
+    reporter.Add( res );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const double aspect = 
+          Input("--aspect","ratio of the height to the width",1.);
+        const bench::Options opts;
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+
+        bench::Reporter reporter( comm, opts );
+        for( const Int r : opts.GridHeights(comm) )
+        {
+            const Grid g( comm, r, opts.Order() );
+            for( const Int nb : opts.Blocksizes() )
+            {
+                SetBlocksize( nb );
+                for( const Int n : opts.Sizes() )
+                {
+                    const Int m = Int(aspect*n);
+                    BenchmarkSVD<double>( m, n, nb, g, opts, reporter );
+                    if( opts.testComplex )
+                        BenchmarkSVD<Complex<double>>
+                        ( m, n, nb, g, opts, reporter );
+                }
+            }
+        }
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
@@ -0,0 +1,156 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Real problems are drawn from the negative 3D Laplacian and complex problems
+// from the shifted 3D Helmholtz operator
+template<typename F>
+void GenerateProblem( DistSparseMatrix<F>& A, Int n );
+
+template<>
+void GenerateProblem( DistSparseMatrix<double>& A, Int n )
+{
+    Laplacian( A, n, n, n );
+    A *= -1;
+}
+
+template<>
+void GenerateProblem( DistSparseMatrix<Complex<double>>& A, Int n )
+{ Helmholtz( A, n, n, n, Complex<double>(-1,0.1) ); }
+
+template<typename F>
+void BenchmarkSparseLDL
+( Int n, Int nb, bool natural, const BisectCtrl& ctrl, 
+  const vector<pair<LDLFrontType,string>>& frontTypes, Int numRHS,
+  const bench::Options& opts, bench::Reporter& reporter )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commSize = mpi::Size( comm );
+    const Int N = n*n*n;
+    DistSparseMatrix<F> A(comm);
+    GenerateProblem( A, n );
+
+    bench::Result res;
+    res.type = bench::TypeName<F>();
+    res.m = N; res.n = N; res.k = numRHS;
+    res.gridHeight = 1; res.gridWidth = commSize;
+    res.blocksize = nb;
+
+    // Symbolic analysis
+    // -----------------
+    const auto& graph = A.DistGraph();
+    ldl::DistNodeInfo info;
+    ldl::DistSeparator sep;
+    DistMap map, invMap;
+    res.routine = "SparseLDLAnalysis";
+    res.variant = ( natural ? "natural" : "bisect" );
+    res.seconds = bench::Time
+    ( comm, opts, 
+      [&]() { },
+      [&]()
+      {
+          if( natural )
+              ldl::NaturalNestedDissection
+              ( n, n, n, graph, map, sep, info, ctrl.cutoff );
+          else
+              ldl::NestedDissection( graph, map, sep, info, ctrl );
+      } );
+    res.gflops = 0;
+    reporter.Add( res );
+    InvertMap( map, invMap );
+
+    // Numeric factorization and solve for each front type
+    // ---------------------------------------------------
+    ldl::DistFront<F> front;
+    DistMultiVec<F> YOrig(comm), Y(comm);
+    Uniform( YOrig, N, numRHS );
+    for( const auto& frontType : frontTypes )
+    {
+        const bool selInv = SelInvFactorization( frontType.first );
+
+        res.routine = "SparseLDLFactor";
+        res.variant = frontType.second;
+        res.seconds = bench::Time
+        ( comm, opts,
+          [&]() { front.Pull( A, map, sep, info ); },
+          [&]() { LDL( info, front, frontType.first ); } );
+        const double factGFlops = 
+          mpi::AllReduce( front.LocalFactorGFlops(selInv), comm );
+        res.gflops = factGFlops / res.seconds;
+        reporter.Add( res );
+
+        res.routine = "SparseLDLSolve";
+        res.seconds = bench::Time
+        ( comm, opts,
+          [&]() { Y = YOrig; },
+          [&]() { ldl::SolveAfter( invMap, info, front, Y ); } );
+        const double solveGFlops = 
+          mpi::AllReduce( front.LocalSolveGFlops(numRHS), comm );
+        res.gflops = solveGFlops / res.seconds;
+        reporter.Add( res );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const Int numRHS = Input("--numRHS","number of right-hand sides",1);
+        const bool natural = Input("--natural","analytical nested-diss?",true);
+        const bool sequential = Input
+            ("--sequential","sequential partitions?",true);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const bool testSelInv = 
+            Input("--selInv","also test selective inversion?",false);
+        const bench::Options opts( 20, 40, 96 );
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+
+        BisectCtrl ctrl;
+        ctrl.sequential = sequential;
+        ctrl.cutoff = cutoff;
+
+        vector<pair<LDLFrontType,string>> frontTypes;
+        frontTypes.push_back( std::make_pair(LDL_1D,"LDL_1D") );
+        frontTypes.push_back( std::make_pair(LDL_2D,"LDL_2D") );
+        if( testSelInv )
+        {
+            frontTypes.push_back( std::make_pair(LDL_SELINV_1D,"LDL_SELINV_1D") );
+            frontTypes.push_back( std::make_pair(LDL_SELINV_2D,"LDL_SELINV_2D") );
+        }
+
+        // The problem size is the dimension of the cubic grid
+        bench::Reporter reporter( comm, opts );
+        for( const Int nb : opts.Blocksizes() )
+        {
+            SetBlocksize( nb );
+            for( const Int n : opts.Sizes() )
+            {
+                BenchmarkSparseLDL<double>
+                ( n, nb, natural, ctrl, frontTypes, numRHS, opts, reporter );
+                if( opts.testComplex )
+                    BenchmarkSparseLDL<Complex<double>>
+                    ( n, nb, natural, ctrl, frontTypes, numRHS, 
+                      opts, reporter );
+            }
+        }
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
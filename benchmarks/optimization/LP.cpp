@@ -0,0 +1,103 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Make a sparse matrix with the last column dense 
+// (see examples/interface/LPDirect.py)
+template<typename Real>
+void Rectang( DistSparseMatrix<Real>& A, Int height, Int width )
+{
+    A.Resize( height, width );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 5*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( i < width )
+            A.QueueLocalUpdate( iLoc, i, Real(11) );
+        if( i >= 1 && i-1 < width )
+            A.QueueLocalUpdate( iLoc, i-1, Real(-1) );
+        if( i+1 < width )
+            A.QueueLocalUpdate( iLoc, i+1, Real(2) );
+        if( i+height < width )
+            A.QueueLocalUpdate( iLoc, i+height, Real(4) );
+        A.QueueLocalUpdate( iLoc, width-1, Real(-5)/Real(height) );
+    }
+    A.ProcessQueues();
+}
+
+template<typename Real>
+void BenchmarkLP
+( Int n, const bench::Options& opts, bench::Reporter& reporter )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int m = n/2;
+    DistSparseMatrix<Real> A(comm);
+    Rectang( A, m, n );
+
+    // Generate a b which implies a primal feasible x
+    DistMultiVec<Real> xGen(comm), b(comm);
+    Uniform( xGen, n, 1, Real(1)/Real(2), Real(1)/Real(2) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xGen, Real(0), b );
+
+    // Generate a c which implies a dual feasible (y,z)
+    DistMultiVec<Real> yGen(comm), c(comm);
+    Gaussian( yGen, m, 1 );
+    Uniform( c, n, 1, Real(1)/Real(2), Real(1)/Real(2) );
+    Multiply( TRANSPOSE, Real(-1), A, yGen, Real(1), c );
+
+    bench::Result res;
+    res.routine = "LPDirect";
+    res.type = bench::TypeName<Real>();
+    res.m = m; res.n = n;
+    res.gridHeight = 1; res.gridWidth = mpi::Size(comm);
+
+    DistMultiVec<Real> x(comm), y(comm), z(comm);
+    lp::direct::Ctrl<Real> ctrl(true);
+
+    ctrl.approach = LP_MEHROTRA;
+    res.variant = "Mehrotra";
+    res.seconds = bench::Time
+    ( comm, opts, [&]() { }, [&]() { LP( A, b, c, x, y, z, ctrl ); } );
+    reporter.Add( res );
+
+    ctrl.approach = LP_IPF;
+    res.variant = "IPF";
+    res.seconds = bench::Time
+    ( comm, opts, [&]() { }, [&]() { LP( A, b, c, x, y, z, ctrl ); } );
+    reporter.Add( res );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const bench::Options opts( 1000, 4000 );
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+
+        // The problem size is the number of primal variables
+        bench::Reporter reporter( comm, opts );
+        for( const Int n : opts.Sizes() )
+            BenchmarkLP<double>( n, opts, reporter );
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
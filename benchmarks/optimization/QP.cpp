@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// The constraint matrix is the first 'height' rows of the (negated) 
+// 2D Laplacian over a square grid with 'width' points
+template<typename Real>
+void Constraints( DistSparseMatrix<Real>& A, Int height, Int width )
+{
+    const Int nx = Int(Sqrt(double(width)));
+    DistSparseMatrix<Real> L(A.Comm());
+    Laplacian( L, nx, width/nx );
+    L *= -1;
+    A = L( IR(0,height), IR(0,nx*(width/nx)) );
+}
+
+template<typename Real>
+void BenchmarkQP
+( Int n, const bench::Options& opts, bench::Reporter& reporter )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    // Q is the (positive semi-definite) negated 2D Laplacian
+    const Int nx = Int(Sqrt(double(n)));
+    n = nx*(n/nx);
+    const Int m = n/2;
+    DistSparseMatrix<Real> Q(comm), A(comm);
+    Laplacian( Q, nx, n/nx );
+    Q *= -1;
+    Constraints( A, m, n );
+
+    // Generate a b which implies a primal feasible x
+    DistMultiVec<Real> xGen(comm), b(comm);
+    Uniform( xGen, n, 1, Real(1)/Real(2), Real(1)/Real(2) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xGen, Real(0), b );
+
+    // Generate a c which implies a dual feasible (y,z)
+    DistMultiVec<Real> yGen(comm), c(comm);
+    Gaussian( yGen, m, 1 );
+    Uniform( c, n, 1, Real(1)/Real(2), Real(1)/Real(2) );
+    Multiply( NORMAL, Real(-1), Q, xGen, Real(1), c );
+    Multiply( TRANSPOSE, Real(-1), A, yGen, Real(1), c );
+
+    bench::Result res;
+    res.routine = "QPDirect";
+    res.type = bench::TypeName<Real>();
+    res.m = m; res.n = n;
+    res.gridHeight = 1; res.gridWidth = mpi::Size(comm);
+
+    DistMultiVec<Real> x(comm), y(comm), z(comm);
+    qp::direct::Ctrl<Real> ctrl;
+
+    ctrl.approach = QP_MEHROTRA;
+    res.variant = "Mehrotra";
+    res.seconds = bench::Time
+    ( comm, opts, [&]() { }, [&]() { QP( Q, A, b, c, x, y, z, ctrl ); } );
+    reporter.Add( res );
+
+    ctrl.approach = QP_IPF;
+    res.variant = "IPF";
+    res.seconds = bench::Time
+    ( comm, opts, [&]() { }, [&]() { QP( Q, A, b, c, x, y, z, ctrl ); } );
+    reporter.Add( res );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Int numRegressions = 0;
+
+    try
+    {
+        const bench::Options opts( 1024, 4096 );
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+
+        // The problem size is the number of primal variables
+        bench::Reporter reporter( comm, opts );
+        for( const Int n : opts.Sizes() )
+            BenchmarkQP<double>( n, opts, reporter );
+        numRegressions = reporter.Finish();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return ( numRegressions == 0 ? 0 : 1 );
+}
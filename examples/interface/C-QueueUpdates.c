@@ -0,0 +1,320 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Build an unsymmetric tridiagonal matrix through each of the array-based
+   C interfaces (QueueUpdates, QueueLocalUpdates, and ImportLocalCSR) and
+   check every locally-stored entry. The program aborts on any mismatch. */
+
+double Entry( ElInt i, ElInt j )
+{
+    if( j == i )
+        return i+2.;
+    else if( j == i-1 )
+        return -1.;
+    else
+        return 0.5;
+}
+
+ElInt Max( ElInt a, ElInt b )
+{ return ( a > b ? a : b ); }
+
+ElInt NumInRow( ElInt i, ElInt n )
+{ return 1 + (i > 0) + (i+1 < n); }
+
+/* Fill the columns and values of row i in increasing column order */
+ElInt FillRow( ElInt i, ElInt n, ElInt* cols, double* values )
+{
+    ElInt k = 0, j;
+    for( j=i-1; j<=i+1; ++j )
+    {
+        if( j < 0 || j >= n )
+            continue;
+        cols[k] = j;
+        values[k] = Entry(i,j);
+        ++k;
+    }
+    return k;
+}
+
+void Check( int numWrong, const char* msg )
+{
+    int totalWrong;
+    MPI_Allreduce
+    ( &numWrong, &totalWrong, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD );
+    int commRank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &commRank );
+    if( commRank == 0 )
+        printf("%s: %d incorrect entries\n",msg,totalWrong);
+    if( totalWrong != 0 )
+        MPI_Abort( MPI_COMM_WORLD, 1 );
+}
+
+int CheckDistSparse( ElConstDistSparseMatrix_d A, ElInt n )
+{
+    ElError error;
+    ElInt firstLocalRow, localHeight, numLocalEntries, iLoc, e;
+    error = ElDistSparseMatrixFirstLocalRow_d( A, &firstLocalRow );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistSparseMatrixLocalHeight_d( A, &localHeight );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistSparseMatrixNumLocalEntries_d( A, &numLocalEntries );
+    EL_ABORT_ON_ERROR( error );
+
+    ElInt numExpected = 0;
+    for( iLoc=0; iLoc<localHeight; ++iLoc )
+        numExpected += NumInRow( firstLocalRow+iLoc, n );
+    if( numLocalEntries != numExpected )
+        return 1;
+
+    int numWrong = 0;
+    for( e=0; e<numLocalEntries; ++e )
+    {
+        ElInt i, j;
+        double value;
+        error = ElDistSparseMatrixRow_d( A, e, &i );
+        EL_ABORT_ON_ERROR( error );
+        error = ElDistSparseMatrixCol_d( A, e, &j );
+        EL_ABORT_ON_ERROR( error );
+        error = ElDistSparseMatrixValue_d( A, e, &value );
+        EL_ABORT_ON_ERROR( error );
+        if( j < i-1 || j > i+1 || value != Entry(i,j) )
+            ++numWrong;
+    }
+    return numWrong;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    ElError error = ElInitialize( &argc, &argv );
+    if( error != EL_SUCCESS )
+        MPI_Abort( MPI_COMM_WORLD, 1 );
+    int commRank, commSize;
+    MPI_Comm_rank( MPI_COMM_WORLD, &commRank );
+    MPI_Comm_size( MPI_COMM_WORLD, &commSize );
+
+    ElInt n, width;
+    error = ElInput_I("--n","matrix size",100,&n);
+    EL_ABORT_ON_ERROR( error );
+    error = ElInput_I("--width","width of dense matrices",3,&width);
+    EL_ABORT_ON_ERROR( error );
+    error = ElProcessInput();
+    EL_ABORT_ON_ERROR( error );
+    error = ElPrintInputReport();
+    EL_ABORT_ON_ERROR( error );
+
+    ElInt i, j, k, e, iLoc;
+    const ElInt maxEntries = Max( 4*n, n*width );
+    ElInt* rows = malloc( maxEntries*sizeof(ElInt) );
+    ElInt* cols = malloc( maxEntries*sizeof(ElInt) );
+    double* values = malloc( maxEntries*sizeof(double) );
+
+    /* Sequential sparse matrix, with the rows queued in reverse order and an
+       extra (zero) update of each diagonal entry which must be combined */
+    ElSparseMatrix_d ASeq;
+    error = ElSparseMatrixCreate_d( &ASeq );
+    EL_ABORT_ON_ERROR( error );
+    error = ElSparseMatrixResize_d( ASeq, n, n );
+    EL_ABORT_ON_ERROR( error );
+    ElInt numEntries = 0;
+    for( i=n-1; i>=0; --i )
+    {
+        ElInt num = FillRow( i, n, &cols[numEntries], &values[numEntries] );
+        for( k=0; k<num; ++k )
+            rows[numEntries+k] = i;
+        numEntries += num;
+        rows[numEntries] = i;
+        cols[numEntries] = i;
+        values[numEntries] = 0.;
+        ++numEntries;
+    }
+    error = ElSparseMatrixQueueUpdates_d
+    ( ASeq, numEntries, rows, cols, values );
+    EL_ABORT_ON_ERROR( error );
+    error = ElSparseMatrixProcessQueues_d( ASeq );
+    EL_ABORT_ON_ERROR( error );
+    {
+        ElInt numSeqEntries;
+        error = ElSparseMatrixNumEntries_d( ASeq, &numSeqEntries );
+        EL_ABORT_ON_ERROR( error );
+        int numWrong = ( numSeqEntries != 3*n-2 );
+        for( e=0; e<numSeqEntries && !numWrong; ++e )
+        {
+            double value;
+            error = ElSparseMatrixRow_d( ASeq, e, &i );
+            EL_ABORT_ON_ERROR( error );
+            error = ElSparseMatrixCol_d( ASeq, e, &j );
+            EL_ABORT_ON_ERROR( error );
+            error = ElSparseMatrixValue_d( ASeq, e, &value );
+            EL_ABORT_ON_ERROR( error );
+            if( value != Entry(i,j) )
+                ++numWrong;
+        }
+        Check( numWrong, "ElSparseMatrixQueueUpdates" );
+    }
+    error = ElSparseMatrixDestroy_d( ASeq );
+    EL_ABORT_ON_ERROR( error );
+
+    /* Distributed sparse matrix, with each process queueing the rows
+       congruent to its rank, most of which are owned by other processes */
+    ElDistSparseMatrix_d A;
+    error = ElDistSparseMatrixCreate_d( &A, MPI_COMM_WORLD );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistSparseMatrixResize_d( A, n, n );
+    EL_ABORT_ON_ERROR( error );
+    numEntries = 0;
+    for( i=commRank; i<n; i+=commSize )
+    {
+        ElInt num = FillRow( i, n, &cols[numEntries], &values[numEntries] );
+        for( k=0; k<num; ++k )
+            rows[numEntries+k] = i;
+        numEntries += num;
+    }
+    error = ElDistSparseMatrixQueueUpdates_d
+    ( A, numEntries, rows, cols, values, false );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistSparseMatrixProcessQueues_d( A );
+    EL_ABORT_ON_ERROR( error );
+    Check( CheckDistSparse( A, n ), "ElDistSparseMatrixQueueUpdates" );
+
+    /* The same matrix from local updates */
+    ElInt firstLocalRow, localHeight;
+    error = ElDistSparseMatrixEmpty_d( A );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistSparseMatrixResize_d( A, n, n );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistSparseMatrixFirstLocalRow_d( A, &firstLocalRow );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistSparseMatrixLocalHeight_d( A, &localHeight );
+    EL_ABORT_ON_ERROR( error );
+    numEntries = 0;
+    for( iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        i = firstLocalRow + iLoc;
+        ElInt num = FillRow( i, n, &cols[numEntries], &values[numEntries] );
+        for( k=0; k<num; ++k )
+            rows[numEntries+k] = iLoc;
+        numEntries += num;
+    }
+    error = ElDistSparseMatrixQueueLocalUpdates_d
+    ( A, numEntries, rows, cols, values );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistSparseMatrixProcessQueues_d( A );
+    EL_ABORT_ON_ERROR( error );
+    Check( CheckDistSparse( A, n ), "ElDistSparseMatrixQueueLocalUpdates" );
+
+    /* The same matrix imported as a local CSR block (which reuses the local
+       column and value arrays from above, since they are already in CSR
+       order) */
+    ElInt* localRowOffsets = malloc( (localHeight+1)*sizeof(ElInt) );
+    localRowOffsets[0] = 0;
+    for( iLoc=0; iLoc<localHeight; ++iLoc )
+        localRowOffsets[iLoc+1] =
+          localRowOffsets[iLoc] + NumInRow( firstLocalRow+iLoc, n );
+    error = ElDistSparseMatrixEmpty_d( A );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistSparseMatrixResize_d( A, n, n );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistSparseMatrixImportLocalCSR_d
+    ( A, localRowOffsets, cols, values );
+    EL_ABORT_ON_ERROR( error );
+    Check( CheckDistSparse( A, n ), "ElDistSparseMatrixImportLocalCSR" );
+
+    free( localRowOffsets );
+    error = ElDistSparseMatrixDestroy_d( A );
+    EL_ABORT_ON_ERROR( error );
+
+    /* Dense distributed objects, with the same rows congruent to each rank */
+    numEntries = 0;
+    for( i=commRank; i<n; i+=commSize )
+    {
+        for( j=0; j<width; ++j )
+        {
+            rows[numEntries] = i;
+            cols[numEntries] = j;
+            values[numEntries] = i + n*j;
+            ++numEntries;
+        }
+    }
+
+    ElDistMultiVec_d X;
+    error = ElDistMultiVecCreate_d( &X, MPI_COMM_WORLD );
+    EL_ABORT_ON_ERROR( error );
+    error = ElZerosDistMultiVec_d( X, n, width );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistMultiVecQueueUpdates_d( X, numEntries, rows, cols, values );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistMultiVecProcessQueues_d( X );
+    EL_ABORT_ON_ERROR( error );
+    {
+        int numWrong = 0;
+        error = ElDistMultiVecFirstLocalRow_d( X, &firstLocalRow );
+        EL_ABORT_ON_ERROR( error );
+        error = ElDistMultiVecLocalHeight_d( X, &localHeight );
+        EL_ABORT_ON_ERROR( error );
+        for( iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            for( j=0; j<width; ++j )
+            {
+                double value;
+                error = ElDistMultiVecGetLocal_d( X, iLoc, j, &value );
+                EL_ABORT_ON_ERROR( error );
+                if( value != firstLocalRow+iLoc + n*j )
+                    ++numWrong;
+            }
+        }
+        Check( numWrong, "ElDistMultiVecQueueUpdates" );
+    }
+    error = ElDistMultiVecDestroy_d( X );
+    EL_ABORT_ON_ERROR( error );
+
+    ElGrid grid;
+    error = ElGridCreate( MPI_COMM_WORLD, EL_COLUMN_MAJOR, &grid );
+    EL_ABORT_ON_ERROR( error );
+    ElDistMatrix_d B;
+    error = ElDistMatrixCreate_d( grid, &B );
+    EL_ABORT_ON_ERROR( error );
+    error = ElZerosDist_d( B, n, width );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistMatrixQueueUpdates_d( B, numEntries, rows, cols, values );
+    EL_ABORT_ON_ERROR( error );
+    error = ElDistMatrixProcessQueues_d( B );
+    EL_ABORT_ON_ERROR( error );
+    {
+        int numWrong = 0;
+        for( j=0; j<width; ++j )
+        {
+            for( i=0; i<n; ++i )
+            {
+                double value;
+                error = ElDistMatrixGet_d( B, i, j, &value );
+                EL_ABORT_ON_ERROR( error );
+                if( value != i + n*j )
+                    ++numWrong;
+            }
+        }
+        Check( numWrong, "ElDistMatrixQueueUpdates" );
+    }
+    error = ElDistMatrixDestroy_d( B );
+    EL_ABORT_ON_ERROR( error );
+    error = ElGridDestroy( grid );
+    EL_ABORT_ON_ERROR( error );
+
+    free( rows );
+    free( cols );
+    free( values );
+
+    error = ElFinalize();
+    if( error != EL_SUCCESS )
+        MPI_Abort( MPI_COMM_WORLD, 1 );
+    return 0;
+}
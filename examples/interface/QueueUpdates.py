@@ -0,0 +1,142 @@
+#
+#  Copyright (c) 2009-2015, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+import El
+
+# Build an unsymmetric tridiagonal matrix through each of the array-based
+# interfaces (QueueUpdates, QueueLocalUpdates, and ImportLocalCSR) and check
+# every locally-stored entry
+n = 100
+width = 3
+worldSize = El.mpi.WorldSize()
+worldRank = El.mpi.WorldRank()
+
+def Entry(i,j):
+  if j == i:
+    return i+2.
+  elif j == i-1:
+    return -1.
+  else:
+    return 0.5
+
+def RowEntries(i):
+  return [(j,Entry(i,j)) for j in xrange(max(i-1,0),min(i+2,n))]
+
+# Every process must fail if any of them found an incorrect entry
+def Check(numWrong,msg):
+  counts = El.DistMatrix()
+  El.Zeros(counts,worldSize,1)
+  counts.QueueUpdates([worldRank],[0],[numWrong])
+  counts.ProcessQueues()
+  maxWrong = El.MaxNorm(counts)
+  if worldRank == 0:
+    print msg, ": at most", int(maxWrong), "incorrect entries per process"
+  if maxWrong != 0:
+    raise Exception(msg+' was incorrect')
+
+def CheckDistSparse(A):
+  numExpected = 0
+  for iLoc in xrange(A.LocalHeight()):
+    numExpected += len(RowEntries(A.GlobalRow(iLoc)))
+  if A.NumLocalEntries() != numExpected:
+    return 1
+  numWrong = 0
+  for e in xrange(A.NumLocalEntries()):
+    i = A.Row(e)
+    j = A.Col(e)
+    if abs(j-i) > 1 or A.Value(e) != Entry(i,j):
+      numWrong += 1
+  return numWrong
+
+# Sequential sparse matrix, with the rows queued in reverse order
+ASeq = El.SparseMatrix()
+ASeq.Resize(n,n)
+rows, cols, values = [], [], []
+for i in reversed(xrange(n)):
+  for (j,value) in RowEntries(i):
+    rows.append(i)
+    cols.append(j)
+    values.append(value)
+ASeq.QueueUpdates(rows,cols,values)
+ASeq.ProcessQueues()
+numWrong = 0
+if ASeq.NumEntries() != 3*n-2:
+  numWrong = 1
+else:
+  for e in xrange(ASeq.NumEntries()):
+    if ASeq.Value(e) != Entry(ASeq.Row(e),ASeq.Col(e)):
+      numWrong += 1
+Check(numWrong,'SparseMatrix.QueueUpdates')
+
+# Distributed sparse matrix, with each process queueing the rows congruent
+# to its rank, most of which are owned by other processes
+A = El.DistSparseMatrix()
+A.Resize(n,n)
+rows, cols, values = [], [], []
+for i in xrange(worldRank,n,worldSize):
+  for (j,value) in RowEntries(i):
+    rows.append(i)
+    cols.append(j)
+    values.append(value)
+A.QueueUpdates(rows,cols,values,passive=False)
+A.ProcessQueues()
+Check(CheckDistSparse(A),'DistSparseMatrix.QueueUpdates')
+
+# The same matrix from local updates
+A.Empty()
+A.Resize(n,n)
+localRowOffsets = [0]
+localRows, cols, values = [], [], []
+for iLoc in xrange(A.LocalHeight()):
+  entries = RowEntries(A.GlobalRow(iLoc))
+  for (j,value) in entries:
+    localRows.append(iLoc)
+    cols.append(j)
+    values.append(value)
+  localRowOffsets.append(localRowOffsets[-1]+len(entries))
+A.QueueLocalUpdates(localRows,cols,values)
+A.ProcessQueues()
+Check(CheckDistSparse(A),'DistSparseMatrix.QueueLocalUpdates')
+
+# The same matrix imported as a local CSR block
+A.Empty()
+A.Resize(n,n)
+A.ImportLocalCSR(localRowOffsets,cols,values)
+Check(CheckDistSparse(A),'DistSparseMatrix.ImportLocalCSR')
+
+# Dense distributed objects, with the same rows congruent to each rank
+rows, cols, values = [], [], []
+for i in xrange(worldRank,n,worldSize):
+  for j in xrange(width):
+    rows.append(i)
+    cols.append(j)
+    values.append(i+n*j)
+
+X = El.DistMultiVec()
+El.Zeros(X,n,width)
+X.QueueUpdates(rows,cols,values)
+X.ProcessQueues()
+numWrong = 0
+for iLoc in xrange(X.LocalHeight()):
+  for j in xrange(width):
+    if X.GetLocal(iLoc,j) != X.FirstLocalRow()+iLoc+n*j:
+      numWrong += 1
+Check(numWrong,'DistMultiVec.QueueUpdates')
+
+B = El.DistMatrix()
+El.Zeros(B,n,width)
+B.QueueUpdates(rows,cols,values)
+B.ProcessQueues()
+numWrong = 0
+for j in xrange(width):
+  for i in xrange(n):
+    if B.Get(i,j) != i+n*j:
+      numWrong += 1
+Check(numWrong,'DistMatrix.QueueUpdates')
+
+El.Finalize()
@@ -876,6 +876,8 @@ CReflect( const HermitianTridiagCtrl<F>& ctrl )
     ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.order = CReflect(ctrl.order);
     ctrlC.symvCtrl = CReflect(ctrl.symvCtrl);
+    ctrlC.twoStage = ctrl.twoStage;
+    ctrlC.bandwidth = ctrl.bandwidth;
     return ctrlC;
 }
 
@@ -887,6 +889,8 @@ CReflect( const ElHermitianTridiagCtrl& ctrlC )
     ctrl.approach = CReflect(ctrlC.approach);
     ctrl.order = CReflect(ctrlC.order);
     ctrl.symvCtrl = CReflect<F>(ctrlC.symvCtrl);
+    ctrl.twoStage = ctrlC.twoStage;
+    ctrl.bandwidth = ctrlC.bandwidth;
     return ctrl;
 }
 
@@ -947,6 +951,57 @@ inline HermitianSDCCtrl<double> CReflect( const ElHermitianSDCCtrl_d& ctrlC )
     return ctrl;
 }
 
+/* HermitianSubspaceCtrl */
+inline ElHermitianSubspaceCtrl_s CReflect
+( const HermitianSubspaceCtrl<float>& ctrl )
+{
+    ElHermitianSubspaceCtrl_s ctrlC;
+    ctrlC.degree = ctrl.degree;
+    ctrlC.numGuard = ctrl.numGuard;
+    ctrlC.maxWidthRatio = ctrl.maxWidthRatio;
+    ctrlC.maxIts = ctrl.maxIts;
+    ctrlC.tol = ctrl.tol;
+    ctrlC.progress = ctrl.progress;
+    return ctrlC;
+}
+inline ElHermitianSubspaceCtrl_d CReflect
+( const HermitianSubspaceCtrl<double>& ctrl )
+{
+    ElHermitianSubspaceCtrl_d ctrlC;
+    ctrlC.degree = ctrl.degree;
+    ctrlC.numGuard = ctrl.numGuard;
+    ctrlC.maxWidthRatio = ctrl.maxWidthRatio;
+    ctrlC.maxIts = ctrl.maxIts;
+    ctrlC.tol = ctrl.tol;
+    ctrlC.progress = ctrl.progress;
+    return ctrlC;
+}
+
+inline HermitianSubspaceCtrl<float> CReflect
+( const ElHermitianSubspaceCtrl_s& ctrlC )
+{
+    HermitianSubspaceCtrl<float> ctrl;
+    ctrl.degree = ctrlC.degree;
+    ctrl.numGuard = ctrlC.numGuard;
+    ctrl.maxWidthRatio = ctrlC.maxWidthRatio;
+    ctrl.maxIts = ctrlC.maxIts;
+    ctrl.tol = ctrlC.tol;
+    ctrl.progress = ctrlC.progress;
+    return ctrl;
+}
+inline HermitianSubspaceCtrl<double> CReflect
+( const ElHermitianSubspaceCtrl_d& ctrlC )
+{
+    HermitianSubspaceCtrl<double> ctrl;
+    ctrl.degree = ctrlC.degree;
+    ctrl.numGuard = ctrlC.numGuard;
+    ctrl.maxWidthRatio = ctrlC.maxWidthRatio;
+    ctrl.maxIts = ctrlC.maxIts;
+    ctrl.tol = ctrlC.tol;
+    ctrl.progress = ctrlC.progress;
+    return ctrl;
+}
+
 /* HermitianEigSubset */
 inline ElHermitianEigSubset_s CReflect
 ( const HermitianEigSubset<float>& subset )
@@ -1004,7 +1059,9 @@ inline ElHermitianEigCtrl_s CReflect( const HermitianEigCtrl<float>& ctrl )
     ElHermitianEigCtrl_s ctrlC;
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.subspaceCtrl = CReflect( ctrl.subspaceCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useSubspace = ctrl.useSubspace;
     return ctrlC;
 }
 
@@ -1013,7 +1070,9 @@ inline ElHermitianEigCtrl_d CReflect( const HermitianEigCtrl<double>& ctrl )
     ElHermitianEigCtrl_d ctrlC;
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.subspaceCtrl = CReflect( ctrl.subspaceCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useSubspace = ctrl.useSubspace;
     return ctrlC;
 }
 inline ElHermitianEigCtrl_c 
@@ -1022,7 +1081,9 @@ CReflect( const HermitianEigCtrl<Complex<float>>& ctrl )
     ElHermitianEigCtrl_c ctrlC;
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.subspaceCtrl = CReflect( ctrl.subspaceCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useSubspace = ctrl.useSubspace;
     return ctrlC;
 }
 inline ElHermitianEigCtrl_z
@@ -1031,7 +1092,9 @@ CReflect( const HermitianEigCtrl<Complex<double>>& ctrl )
     ElHermitianEigCtrl_z ctrlC;
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.subspaceCtrl = CReflect( ctrl.subspaceCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useSubspace = ctrl.useSubspace;
     return ctrlC;
 }
 
@@ -1040,7 +1103,9 @@ inline HermitianEigCtrl<float> CReflect( const ElHermitianEigCtrl_s& ctrlC )
     HermitianEigCtrl<float> ctrl;
     ctrl.tridiagCtrl = CReflect<float>( ctrlC.tridiagCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.subspaceCtrl = CReflect( ctrlC.subspaceCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useSubspace = ctrlC.useSubspace;
     return ctrl;
 }
 inline HermitianEigCtrl<double> CReflect( const ElHermitianEigCtrl_d& ctrlC )
@@ -1048,7 +1113,9 @@ inline HermitianEigCtrl<double> CReflect( const ElHermitianEigCtrl_d& ctrlC )
     HermitianEigCtrl<double> ctrl;
     ctrl.tridiagCtrl = CReflect<double>( ctrlC.tridiagCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.subspaceCtrl = CReflect( ctrlC.subspaceCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useSubspace = ctrlC.useSubspace;
     return ctrl;
 }
 inline HermitianEigCtrl<Complex<float>> 
@@ -1057,7 +1124,9 @@ CReflect( const ElHermitianEigCtrl_c& ctrlC )
     HermitianEigCtrl<Complex<float>> ctrl;
     ctrl.tridiagCtrl = CReflect<Complex<float>>( ctrlC.tridiagCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.subspaceCtrl = CReflect( ctrlC.subspaceCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useSubspace = ctrlC.useSubspace;
     return ctrl;
 }
 inline HermitianEigCtrl<Complex<double>> 
@@ -1066,7 +1135,9 @@ CReflect( const ElHermitianEigCtrl_z& ctrlC )
     HermitianEigCtrl<Complex<double>> ctrl;
     ctrl.tridiagCtrl = CReflect<Complex<double>>( ctrlC.tridiagCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.subspaceCtrl = CReflect( ctrlC.subspaceCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useSubspace = ctrlC.useSubspace;
     return ctrl;
 }
 
@@ -1147,6 +1218,9 @@ inline ElHessQRCtrl CReflect( const HessQRCtrl& ctrl )
     ctrlC.distAED = ctrl.distAED;
     ctrlC.blockHeight = ctrl.blockHeight;
     ctrlC.blockWidth = ctrl.blockWidth;
+    ctrlC.minMultishiftSize = ctrl.minMultishiftSize;
+    ctrlC.numShifts = ctrl.numShifts;
+    ctrlC.deflationSize = ctrl.deflationSize;
     return ctrlC;
 }
 
@@ -1156,6 +1230,9 @@ inline HessQRCtrl CReflect( const ElHessQRCtrl& ctrlC )
     ctrl.distAED = ctrlC.distAED;
     ctrl.blockHeight = ctrlC.blockHeight;
     ctrl.blockWidth = ctrlC.blockWidth;
+    ctrl.minMultishiftSize = ctrlC.minMultishiftSize;
+    ctrl.numShifts = ctrlC.numShifts;
+    ctrl.deflationSize = ctrlC.deflationSize;
     return ctrl;
 }
 
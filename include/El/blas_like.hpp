@@ -53,6 +53,14 @@ template<> Int LocalTrr2kBlocksize<double>();
 template<> Int LocalTrr2kBlocksize<Complex<float>>();
 template<> Int LocalTrr2kBlocksize<Complex<double>>();
 
+// The GEMM_DEFAULT heuristic uses the stationary-B (or A) SUMMA variant when
+// weightTowardsC*min(m,n) <= k and the dot-product variant when 
+// weightAwayFromDot*max(m,n) <= k
+template<typename T> 
+void SetGemmCrossoverWeights( double weightTowardsC, double weightAwayFromDot );
+template<typename T> double GemmWeightTowardsC();
+template<typename T> double GemmWeightAwayFromDot();
+
 template<typename T>
 struct SymvCtrl 
 {
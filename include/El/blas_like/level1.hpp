@@ -1137,6 +1137,8 @@ template<typename T>
 ValueInt<Base<T>> VectorMaxAbs( const Matrix<T>& x );
 template<typename T>
 ValueInt<Base<T>> VectorMaxAbs( const AbstractDistMatrix<T>& x );
+template<typename T>
+ValueInt<Base<T>> VectorMaxAbs( const DistMultiVec<T>& x );
 
 template<typename T>
 Entry<Base<T>> MaxAbs( const Matrix<T>& A );
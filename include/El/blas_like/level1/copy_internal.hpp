@@ -200,6 +200,18 @@ void Scatter
 ( const BlockDistMatrix<T,CIRC,CIRC>& A,
         BlockDistMatrix<T,STAR,STAR>& B );
 
+// An arbitrary redistribution between two matrices whose grids share a
+// viewing communicator, performed with a single all-to-all exchange.
+// The communication pattern is cached for each pair of distributions.
+template<typename T>
+void GeneralPurpose
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B );
+
+// Free the cached patterns involving the given grid (or all of them if the
+// grid is null)
+void ClearGeneralPurposePlans( const Grid* grid=nullptr );
+
 } // namespace copy
 
 } // namespace El
@@ -48,6 +48,14 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// Native implementation for [MC,MR] block-cyclic distributions
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractBlockDistMatrix<T>& A,
+           const AbstractBlockDistMatrix<T>& B,
+  T beta,        AbstractBlockDistMatrix<T>& C );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -95,6 +103,13 @@ void Herk
 ( UpperOrLower uplo, Orientation orientation,
   Base<T> alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C );
 
+// Native implementation for [MC,MR] block-cyclic distributions
+template<typename T>
+void Herk
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const AbstractBlockDistMatrix<T>& A,
+  Base<T> beta,        AbstractBlockDistMatrix<T>& C );
+
 template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
@@ -430,6 +445,14 @@ void Trsm
   F alpha, const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
 
+// Native implementation for [MC,MR] block-cyclic distributions
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const AbstractBlockDistMatrix<F>& A,
+                 AbstractBlockDistMatrix<F>& B );
+
 template<typename F>
 void LocalTrsm
 ( LeftOrRight side, UpperOrLower uplo,
@@ -572,6 +595,68 @@ void LocalTrr2k
   T beta,  const AbstractDistMatrix<T>& C, const AbstractDistMatrix<T>& D,
   T gamma,       AbstractDistMatrix<T>& E );
 
+// Batched kernels
+// ===============
+// Apply the same operation to many small, independent matrices without
+// paying the per-call overhead of Matrix<T> and BLAS for each of them.
+// The loop over the batch is threaded (when OpenMP is enabled).
+//
+// Equal-sized batches are described by a MatrixBatch, whose matrices are
+// either stored one after another, with matrix b beginning at
+// buffer+b*stride (BATCH_STRIDED), or interleaved, so that entry (i,j) of
+// matrix b is stored at buffer[b+(i+j*ldim)*batchSize] (BATCH_INTERLEAVED).
+// The kernels vectorize across interleaved matrices. Every batch passed to a
+// single routine must use the same layout.
+//
+// Variable-sized batches are given as arrays of pointers to matrices. Any
+// matrix of dimension greater than 32 is handled by the standard blocked
+// routine after the small matrices have been processed.
+
+namespace BatchLayoutNS {
+enum BatchLayout {
+  BATCH_STRIDED,
+  BATCH_INTERLEAVED
+};
+}
+using namespace BatchLayoutNS;
+
+template<typename T>
+struct MatrixBatch
+{
+    Int batchSize=0;
+    Int height=0, width=0, ldim=1;
+    Int stride=0; // only used by BATCH_STRIDED
+    BatchLayout layout=BATCH_STRIDED;
+    T* buffer=nullptr;
+};
+
+namespace batched {
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const MatrixBatch<T>& A, const MatrixBatch<T>& B,
+  T beta,        MatrixBatch<T>& C );
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<const Matrix<T>*>& A,
+           const vector<const Matrix<T>*>& B,
+  T beta,  const vector<Matrix<T>*>& C );
+
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const MatrixBatch<F>& A, MatrixBatch<F>& B );
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const vector<const Matrix<F>*>& A, const vector<Matrix<F>*>& B );
+
+} // namespace batched
+
 } // namespace El
 
 #endif // ifndef EL_BLAS3_HPP
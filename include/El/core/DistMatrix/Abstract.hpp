@@ -240,8 +240,19 @@ public:
     void Reserve( Int numRemoteEntries );
     void QueueUpdate( const Entry<T>& entry );
     void QueueUpdate( Int i, Int j, T value );
+    void QueueUpdates
+    ( Int numEntries, const Int* rows, const Int* cols, const T* values );
     void ProcessQueues();
 
+    // Batch reading of remote entries
+    // -------------------------------
+    // NOTE: Every process in the viewing communicator must call
+    //       ProcessPullQueue, which returns the queued entries in the order
+    //       in which they were requested
+    void ReservePulls( Int numPulls ) const;
+    void QueuePull( Int i, Int j ) const;
+    void ProcessPullQueue( vector<T>& pullBuf ) const;
+
     // Local entry manipulation
     // ------------------------
     // NOTE: Clearly each of the following routines could instead be performed
@@ -303,6 +314,10 @@ protected:
     // --------------
     vector<Entry<T>> remoteUpdates_;
 
+    // Remote pulls
+    // ------------
+    mutable vector<pair<Int,Int>> remotePulls_;
+
     // Private constructors
     // ====================
     // Create a 0 x 0 distributed matrix
@@ -102,8 +102,18 @@ public:
     void Reserve( Int numRemoteEntries );
     void QueueUpdate( const Entry<T>& entry );
     void QueueUpdate( Int i, Int j, T value );
+    void QueueUpdates
+    ( Int numEntries, const Int* rows, const Int* cols, const T* values );
     void ProcessQueues();
 
+    // Batch reading of remote entries
+    // -------------------------------
+    // NOTE: Every process in the communicator must call ProcessPullQueue,
+    //       which returns the queued entries in the order they were requested
+    void ReservePulls( Int numPulls ) const;
+    void QueuePull( Int i, Int j ) const;
+    void ProcessPullQueue( vector<T>& pullBuf ) const;
+
 private:
     Int height_, width_;
 
@@ -118,6 +128,10 @@ private:
     // --------------
     vector<Entry<T>> remoteUpdates_;
 
+    // Remote pulls
+    // ------------
+    mutable vector<pair<Int,Int>> remotePulls_;
+
     void InitializeLocalData();
 };
 
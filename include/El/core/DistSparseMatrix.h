@@ -188,6 +188,76 @@ EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdate_c
 EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdate_z
 ( ElDistSparseMatrix_z A, ElInt localRow, ElInt col, complex_double value );
 
+/* void DistSparseMatrix<T>::QueueUpdates
+   ( Int numEntries, const Int* rows, const Int* cols, const T* values,
+     bool passive )
+   -------------------------------------------------------------------- */
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_i
+( ElDistSparseMatrix_i A,
+  ElInt numEntries, const ElInt* rows, const ElInt* cols,
+  const ElInt* values, bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_s
+( ElDistSparseMatrix_s A,
+  ElInt numEntries, const ElInt* rows, const ElInt* cols,
+  const float* values, bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_d
+( ElDistSparseMatrix_d A,
+  ElInt numEntries, const ElInt* rows, const ElInt* cols,
+  const double* values, bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_c
+( ElDistSparseMatrix_c A,
+  ElInt numEntries, const ElInt* rows, const ElInt* cols,
+  const complex_float* values, bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_z
+( ElDistSparseMatrix_z A,
+  ElInt numEntries, const ElInt* rows, const ElInt* cols,
+  const complex_double* values, bool passive );
+
+/* void DistSparseMatrix<T>::QueueLocalUpdates
+   ( Int numEntries, const Int* localRows, const Int* cols, const T* values )
+   -------------------------------------------------------------------------- */
+EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdates_i
+( ElDistSparseMatrix_i A,
+  ElInt numEntries, const ElInt* localRows, const ElInt* cols,
+  const ElInt* values );
+EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdates_s
+( ElDistSparseMatrix_s A,
+  ElInt numEntries, const ElInt* localRows, const ElInt* cols,
+  const float* values );
+EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdates_d
+( ElDistSparseMatrix_d A,
+  ElInt numEntries, const ElInt* localRows, const ElInt* cols,
+  const double* values );
+EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdates_c
+( ElDistSparseMatrix_c A,
+  ElInt numEntries, const ElInt* localRows, const ElInt* cols,
+  const complex_float* values );
+EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdates_z
+( ElDistSparseMatrix_z A,
+  ElInt numEntries, const ElInt* localRows, const ElInt* cols,
+  const complex_double* values );
+
+/* void DistSparseMatrix<T>::ImportLocalCSR
+   ( const Int* localRowOffsets, const Int* cols, const T* values )
+   ---------------------------------------------------------------- */
+EL_EXPORT ElError ElDistSparseMatrixImportLocalCSR_i
+( ElDistSparseMatrix_i A,
+  const ElInt* localRowOffsets, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElDistSparseMatrixImportLocalCSR_s
+( ElDistSparseMatrix_s A,
+  const ElInt* localRowOffsets, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElDistSparseMatrixImportLocalCSR_d
+( ElDistSparseMatrix_d A,
+  const ElInt* localRowOffsets, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElDistSparseMatrixImportLocalCSR_c
+( ElDistSparseMatrix_c A,
+  const ElInt* localRowOffsets, const ElInt* cols,
+  const complex_float* values );
+EL_EXPORT ElError ElDistSparseMatrixImportLocalCSR_z
+( ElDistSparseMatrix_z A,
+  const ElInt* localRowOffsets, const ElInt* cols,
+  const complex_double* values );
+
 /* void DistSparseMatrix<T>::QueueZero( Int row, Int col, bool passive )
    --------------------------------------------------------------------- */
 EL_EXPORT ElError ElDistSparseMatrixQueueZero_i
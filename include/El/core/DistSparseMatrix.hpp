@@ -109,6 +109,23 @@ public:
     void ProcessQueues();
     void ProcessLocalQueues();
 
+    // Array-based versions of QueueUpdate and QueueLocalUpdate which
+    // queue the updates A(rows[k],cols[k]) += values[k], 0 <= k < numEntries
+    void QueueUpdates
+    ( Int numEntries, const Int* rows, const Int* cols, const T* values,
+      bool passive=true );
+    void QueueLocalUpdates
+    ( Int numEntries, const Int* localRows, const Int* cols, const T* values );
+
+    // Overwrite the local rows with a CSR block whose column indices are
+    // sorted and unique within each row. The block is copied directly into
+    // the local storage without any queueing, sorting, or compression. Any
+    // updates and removals queued by this process beforehand are discarded.
+    // If the sparsity is frozen, the block must match the existing pattern
+    // and only the values are overwritten.
+    void ImportLocalCSR
+    ( const Int* localRowOffsets, const Int* cols, const T* values );
+
     // Operator overloading
     // ====================
 
@@ -123,6 +123,30 @@ EL_EXPORT ElError ElSparseMatrixQueueUpdate_c
 EL_EXPORT ElError ElSparseMatrixQueueUpdate_z
 ( ElSparseMatrix_z A, ElInt row, ElInt col, complex_double value );
 
+/* void SparseMatrix<T>::QueueUpdates
+   ( Int numEntries, const Int* rows, const Int* cols, const T* values )
+   --------------------------------------------------------------------- */
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_i
+( ElSparseMatrix_i A,
+  ElInt numEntries, const ElInt* rows, const ElInt* cols,
+  const ElInt* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_s
+( ElSparseMatrix_s A,
+  ElInt numEntries, const ElInt* rows, const ElInt* cols,
+  const float* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_d
+( ElSparseMatrix_d A,
+  ElInt numEntries, const ElInt* rows, const ElInt* cols,
+  const double* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_c
+( ElSparseMatrix_c A,
+  ElInt numEntries, const ElInt* rows, const ElInt* cols,
+  const complex_float* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_z
+( ElSparseMatrix_z A,
+  ElInt numEntries, const ElInt* rows, const ElInt* cols,
+  const complex_double* values );
+
 /* void SparseMatrix<T>::QueueZero( Int row, Int col )
    --------------------------------------------------- */
 EL_EXPORT ElError ElSparseMatrixQueueZero_i
@@ -60,6 +60,10 @@ public:
     void QueueZero( Int row, Int col );
     void ProcessQueues();
 
+    // Queue the updates A(rows[k],cols[k]) += values[k] for 0 <= k < numEntries
+    void QueueUpdates
+    ( Int numEntries, const Int* rows, const Int* cols, const T* values );
+
     // Operator overloading
     // ====================
 
@@ -80,15 +80,48 @@ void PrintInputReport();
 Int Blocksize();
 void SetBlocksize( Int blocksize );
 
+// Set the blocksize chosen by AutoTune or a tuning profile, which is ignored
+// if SetBlocksize was called
+void SetTunedBlocksize( Int blocksize );
+
 // For manipulating the algorithmic blocksize as a stack
 void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 
+// Push a blocksize for the lifetime of the object, so that it is popped even
+// if an exception is thrown
+class BlocksizeStackEntry
+{
+public:
+    explicit BlocksizeStackEntry( Int blocksize )
+    { PushBlocksizeStack( blocksize ); }
+    ~BlocksizeStackEntry() { PopBlocksizeStack(); }
+private:
+    BlocksizeStackEntry( const BlocksizeStackEntry& );
+    const BlocksizeStackEntry& operator=( const BlocksizeStackEntry& );
+};
+
+// Size-dependent algorithmic blocksizes (e.g., those chosen by AutoTune).
+// A problem of size n uses the blocksize of the regime with the smallest
+// bound which is at least n (or of the last regime if n exceeds every bound).
+// The regimes are ignored if there are none, if a blocksize was explicitly
+// pushed onto the stack, or if SetBlocksize was called (in which case the
+// blocksize of a tuning profile is ignored as well).
+void SetBlocksizeRegime( Int maxSize, Int blocksize );
+void ClearBlocksizeRegimes();
+Int RegimeBlocksize( Int n );
+
 Int DefaultBlockHeight();
 Int DefaultBlockWidth();
 void SetDefaultBlockHeight( Int blockHeight );
 void SetDefaultBlockWidth( Int blockWidth );
 
+// For loading and saving the tuning parameters (e.g., those chosen by
+// AutoTune). If the environment variable EL_TUNING_PROFILE is set, then
+// Initialize() loads the profile which it names.
+void LoadTuningProfile( const string& filename );
+void SaveTuningProfile( const string& filename );
+
 std::mt19937& Generator();
 
 template<typename T>
@@ -59,6 +59,8 @@ void UpdateMaxImagWindowVal( double maxVal );
 # include "El/io/ComplexDisplayWindow-premoc.hpp"
 #endif // ifdef EL_HAVE_QT5
 
+#include "El/io/Checkpoint.hpp"
+
 namespace El {
 
 // Color maps
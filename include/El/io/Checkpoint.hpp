@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_IO_CHECKPOINT_HPP
+#define EL_IO_CHECKPOINT_HPP
+
+namespace El {
+namespace checkpoint {
+
+// Every process reads and writes its own file, '<basename>-<rank>.bin', so
+// that checkpoints of distributed data are written in parallel and without
+// any communication. A short header records the number of processes and the
+// width of the integers so that restarts from an incompatible run can be
+// detected.
+//
+// The rank in the filename is only taken from the communicator if it spans
+// every process; otherwise (e.g., for sequential checkpoints over
+// mpi::COMM_SELF) it is the rank within mpi::COMM_WORLD so that the files of
+// different processes do not collide.
+//
+// Checkpoints are written to '<filename>.tmp' and only renamed over the
+// previous checkpoint by Close once every write has succeeded, so that a
+// failure part of the way through leaves the previous checkpoint intact.
+
+const Int magic = 0x456c436b; // "ElCk"
+
+inline string Filename( const string& basename, mpi::Comm comm )
+{
+    const int rank =
+      ( mpi::Size(comm) == mpi::Size(mpi::COMM_WORLD) ? mpi::Rank(comm)
+                                                      : mpi::WorldRank() );
+    ostringstream os;
+    os << basename << "-" << rank << "." << FileExtension(BINARY);
+    return os.str();
+}
+
+template<typename T>
+inline void Write( ofstream& file, const T& value )
+{ file.write( (const char*)&value, sizeof(T) ); }
+
+template<typename T>
+inline void Write( ofstream& file, const vector<T>& vec )
+{
+    const Int size = vec.size();
+    Write( file, size );
+    file.write( (const char*)vec.data(), size*sizeof(T) );
+}
+
+template<typename T>
+inline void Write( ofstream& file, const Matrix<T>& A )
+{
+    const Int height = A.Height();
+    const Int width = A.Width();
+    Write( file, height );
+    Write( file, width );
+    for( Int j=0; j<width; ++j )
+        file.write( (const char*)A.LockedBuffer(0,j), height*sizeof(T) );
+}
+
+template<typename T>
+inline void Read( ifstream& file, T& value )
+{
+    file.read( (char*)&value, sizeof(T) );
+    if( !file )
+        RuntimeError("Checkpoint file was truncated");
+}
+
+template<typename T>
+inline void Read( ifstream& file, vector<T>& vec )
+{
+    Int size;
+    Read( file, size );
+    vec.resize( size );
+    file.read( (char*)vec.data(), size*sizeof(T) );
+    if( !file )
+        RuntimeError("Checkpoint file was truncated");
+}
+
+template<typename T>
+inline void Read( ifstream& file, Matrix<T>& A )
+{
+    Int height, width;
+    Read( file, height );
+    Read( file, width );
+    A.Resize( height, width );
+    for( Int j=0; j<width; ++j )
+        file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
+    if( !file )
+        RuntimeError("Checkpoint file was truncated");
+}
+
+inline void Open( ofstream& file, const string& basename, mpi::Comm comm )
+{
+    const string tmpFilename = Filename( basename, comm ) + ".tmp";
+    file.open( tmpFilename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",tmpFilename);
+    const Int commSize = mpi::Size( comm );
+    const Int intSize = sizeof(Int);
+    Write( file, magic );
+    Write( file, commSize );
+    Write( file, intSize );
+}
+
+inline void Close( ofstream& file, const string& basename, mpi::Comm comm )
+{
+    const string filename = Filename( basename, comm );
+    const string tmpFilename = filename + ".tmp";
+    file.close();
+    if( !file )
+    {
+        std::remove( tmpFilename.c_str() );
+        RuntimeError("Could not write ",tmpFilename);
+    }
+    if( std::rename( tmpFilename.c_str(), filename.c_str() ) != 0 )
+        RuntimeError("Could not rename ",tmpFilename," to ",filename);
+}
+
+inline void Open( ifstream& file, const string& basename, mpi::Comm comm )
+{
+    const string filename = Filename( basename, comm );
+    file.open( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    Int fileMagic, commSize, intSize;
+    Read( file, fileMagic );
+    if( fileMagic != magic )
+        RuntimeError(filename," is not a checkpoint file");
+    Read( file, commSize );
+    Read( file, intSize );
+    if( commSize != mpi::Size(comm) )
+        RuntimeError
+        (filename," was written by ",commSize," processes but ",
+         mpi::Size(comm)," are reading it");
+    if( intSize != Int(sizeof(Int)) )
+        RuntimeError(filename," was written with ",8*intSize,"-bit integers");
+}
+
+} // namespace checkpoint
+} // namespace El
+
+#endif // ifndef EL_IO_CHECKPOINT_HPP
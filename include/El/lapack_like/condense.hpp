@@ -84,8 +84,37 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<F> symvCtrl;
+
+    // Reduce to a band with BLAS-3 updates before chasing the band down to
+    // tridiagonal form (a bandwidth of zero selects the algorithmic
+    // blocksize). The grid approach is ignored by the two-stage reduction.
+    // Since its bulge-chasing reflectors cannot be returned through (A,t),
+    // HermitianTridiag( uplo, A, t, ctrl ) falls back to the one-stage
+    // reduction; HermitianEig honors it.
+    bool twoStage=false;
+    Int bandwidth=0;
 };
 
+namespace herm_tridiag {
+
+// The reflectors generated while chasing a band down to tridiagonal form.
+// Reflector k is I - tau(k) v_k v_k^H, where v_k is stored (with its unit
+// leading entry) in column k of V, and the reflectors of sweep j, which
+// reduces column j, are indexed from sweepOffsets[j]. The i'th reflector
+// of sweep j acts upon rows j+1+i*bandwidth onward, and their product, in
+// the order they were generated, is the unitary matrix of the reduction.
+template<typename F>
+struct BulgeChase
+{
+    Int height=0;
+    Int bandwidth=0;
+    Matrix<F> V;
+    Matrix<F> tau;
+    vector<Int> sweepOffsets;
+};
+
+} // namespace herm_tridiag
+
 template<typename F>
 void HermitianTridiag( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& t );
 template<typename F>
@@ -93,6 +122,19 @@ void HermitianTridiag
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& t,
   const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
 
+// Two-stage reduction: the Householder vectors of the reduction to banded
+// form are stored beneath the band of A (with their scalars in t), the
+// tridiagonal matrix overwrites the main and first sub/super-diagonals, and
+// the remainder of the band is zeroed
+template<typename F>
+void HermitianTridiag
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& t,
+  herm_tridiag::BulgeChase<F>& chase, Int bandwidth=0 );
+template<typename F>
+void HermitianTridiag
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& t,
+  herm_tridiag::BulgeChase<F>& chase, Int bandwidth=0 );
+
 namespace herm_tridiag {
 
 template<typename F>
@@ -112,6 +154,17 @@ void ApplyQ
   const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t, 
         AbstractDistMatrix<F>& B );
 
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const Matrix<F>& A, const Matrix<F>& t, const BulgeChase<F>& chase,
+  Matrix<F>& B );
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t,
+  const BulgeChase<F>& chase, AbstractDistMatrix<F>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
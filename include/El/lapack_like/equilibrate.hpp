@@ -82,25 +82,29 @@ template<typename F>
 void SymmetricRuizEquil
 ( Matrix<F>& A,
   Matrix<Base<F>>& d,
-  bool progress=false );
+  bool progress=false,
+  bool warmStart=false );
 
 template<typename F>
 void SymmetricRuizEquil
 ( AbstractDistMatrix<F>& A,
   AbstractDistMatrix<Base<F>>& d,
-  bool progress=false );
+  bool progress=false,
+  bool warmStart=false );
 
 template<typename F>
 void SymmetricRuizEquil
 ( SparseMatrix<F>& A,
   Matrix<Base<F>>& d,
-  bool progress=false );
+  bool progress=false,
+  bool warmStart=false );
 
 template<typename F>
 void SymmetricRuizEquil
 ( DistSparseMatrix<F>& A,
   DistMultiVec<Base<F>>& d,
-  bool progress=false );
+  bool progress=false,
+  bool warmStart=false );
 
 // Geometric rescaling (ala Fourer, which led to Saunders's gmscale.m)
 // ===================================================================
@@ -50,6 +50,15 @@ struct LeastSquaresCtrl
     Real alpha=Pow(Epsilon<Real>(),Real(0.25));
 
     RegQSDCtrl<Real> qsdCtrl;
+
+    // If the (oriented) matrix has at least as many rows as columns, solve
+    // with a sparse multifrontal QR factorization rather than with the
+    // regularized augmented system, which avoids iterative refinement and
+    // does not square the condition number. A must have full column rank.
+    // Since the factorization is not yet distributed, this is only supported
+    // for sequential sparse matrices (a LogicError is thrown otherwise).
+    bool useQR=false;
+
     bool equilibrate=true;
     bool progress=false;
     bool time=false;
@@ -17,12 +17,16 @@ namespace El {
 
 // Cholesky
 // ========
+// A NonHPDMatrixException is thrown if A is not numerically HPD
 template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A );
 template<typename F>
 void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A );
 template<typename F>
 void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A );
+// Native implementation for [MC,MR] block-cyclic distributions
+template<typename F>
+void Cholesky( UpperOrLower uplo, AbstractBlockDistMatrix<F>& A );
 
 template<typename F>
 void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A );
@@ -153,6 +157,23 @@ void LDL
 ( const ldl::DistNodeInfo& info, ldl::DistFront<F>& L, 
   LDLFrontType newType=LDL_2D );
 
+// Factor within a memory budget (see ldl::FactorMemoryCtrl)
+template<typename F>
+void LDL
+( const ldl::NodeInfo& info, ldl::Front<F>& L,
+  LDLFrontType newType, const ldl::FactorMemoryCtrl& ctrl );
+template<typename F>
+void LDL
+( const ldl::DistNodeInfo& info, ldl::DistFront<F>& L,
+  LDLFrontType newType, const ldl::FactorMemoryCtrl& ctrl );
+
+// Selectively invert the distributed fronts if it is predicted to pay off
+// over the expected number of solves (see ldl::SelInvCtrl)
+template<typename F>
+void LDL
+( const ldl::DistNodeInfo& info, ldl::DistFront<F>& L,
+  LDLFrontType newType, const ldl::SelInvCtrl& ctrl );
+
 namespace ldl {
 
 // Compute the inertia triplet of a Hermitian matrix's LDL^H factorization
@@ -369,6 +390,9 @@ template<typename F>
 void LU( Matrix<F>& A, Matrix<Int>& p );
 template<typename F>
 void LU( AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p );
+// Native implementation for [MC,MR] block-cyclic distributions
+template<typename F>
+void LU( AbstractBlockDistMatrix<F>& A, AbstractDistMatrix<Int>& p );
 
 // LU with full pivoting
 // ---------------------
@@ -392,8 +416,76 @@ void LUMod
   const AbstractDistMatrix<F>& u, const AbstractDistMatrix<F>& v, 
   bool conjugate=true, Base<F> tau=0.1 );
 
+// Sparse LU with static pivoting
+// ------------------------------
+// A multifrontal factorization A = L D U of a sparse matrix which has been
+// reordered with nested dissection on the graph of A + A^T. The unit-lower
+// factor L (along with the diagonal D) and the transpose of the unit-upper
+// factor U are each stored as a tree of unit-lower LDL fronts so that the
+// sparse LDL solves can be reused. Rather than exchanging rows, pivots with
+// magnitude less than 'pivotTol' times the max-norm of A are replaced with
+// that value (keeping their phase), and the perturbation is corrected with
+// iterative refinement. The number of replaced pivots is returned.
+template<typename Real>
+struct LUStaticPivotCtrl
+{
+    Real pivotTol;
+    Real minReductionFactor;
+    Int maxRefineIts;
+
+    LUStaticPivotCtrl()
+    : pivotTol(Sqrt(Epsilon<Real>())), minReductionFactor(2), maxRefineIts(10)
+    { }
+};
+
+template<typename F>
+Int LU
+( const ldl::NodeInfo& info, ldl::Front<F>& L, ldl::Front<F>& U,
+  const LUStaticPivotCtrl<Base<F>>& ctrl=LUStaticPivotCtrl<Base<F>>() );
+template<typename F>
+Int LU
+( const ldl::DistNodeInfo& info, ldl::DistFront<F>& L, ldl::DistFront<F>& U,
+  const LUStaticPivotCtrl<Base<F>>& ctrl=LUStaticPivotCtrl<Base<F>>() );
+
 namespace lu {
 
+// Fill the fronts of a sparse LU factorization with the entries of A
+// ------------------------------------------------------------------
+template<typename F>
+void Pull
+( const SparseMatrix<F>& A, const vector<Int>& reordering,
+  const ldl::NodeInfo& info, ldl::Front<F>& L, ldl::Front<F>& U );
+template<typename F>
+void Pull
+( const DistSparseMatrix<F>& A, const DistMap& reordering,
+  const ldl::DistSeparator& rootSep, const ldl::DistNodeInfo& info,
+  ldl::DistFront<F>& L, ldl::DistFront<F>& U );
+
+// Solve linear systems using a sparse LU factorization
+// ----------------------------------------------------
+template<typename F>
+void SolveAfter
+( const vector<Int>& invMap, const ldl::NodeInfo& info,
+  const ldl::Front<F>& L, const ldl::Front<F>& U, Matrix<F>& X );
+template<typename F>
+void SolveAfter
+( const DistMap& invMap, const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& L, const ldl::DistFront<F>& U,
+  DistMultiVec<F>& X );
+
+template<typename F>
+Int SolveWithIterativeRefinement
+( const SparseMatrix<F>& A,
+  const vector<Int>& invMap, const ldl::NodeInfo& info,
+  const ldl::Front<F>& L, const ldl::Front<F>& U, Matrix<F>& y,
+  Base<F> minReductionFactor, Int maxRefineIts );
+template<typename F>
+Int SolveWithIterativeRefinement
+( const DistSparseMatrix<F>& A,
+  const DistMap& invMap, const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& L, const ldl::DistFront<F>& U, DistMultiVec<F>& y,
+  Base<F> minReductionFactor, Int maxRefineIts );
+
 // Solve linear systems using an implicit unpivoted LU factorization
 // -----------------------------------------------------------------
 template<typename F>
@@ -673,8 +765,82 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData );
 
 } // namespace ts
 
+// Sparse multifrontal QR
+// ----------------------
+// The columns of A are reordered with nested dissection on the graph of A^H A
+// and each row of A is assembled into the front which contains its leading
+// column. Each front, along with the upper-trapezoidal updates of its
+// children, is then reduced with a dense Householder QR, and the trailing
+// portion of its R factor is stacked into its parent. Q is kept in the
+// implicit form of each front.
+template<typename F>
+struct SparseFront
+{
+    // The rows of A which were assembled into this front
+    vector<Int> rows;
+
+    // The Householder vectors (below the diagonal), the R factor (on and above
+    // the diagonal), and the scalings of the reflectors
+    Matrix<F> QR;
+    Matrix<F> t;
+    Matrix<Base<F>> d;
+
+    // The update matrix passed to the parent during the factorization
+    Matrix<F> work;
+
+    SparseFront<F>* parent;
+    vector<SparseFront<F>*> children;
+
+    SparseFront( SparseFront<F>* parentNode=nullptr )
+    : parent(parentNode)
+    { }
+
+    ~SparseFront()
+    {
+        for( const SparseFront<F>* child : children )
+            delete child;
+    }
+};
+
+// Reorder the columns of A with nested dissection on the graph of A^H A
+template<typename F>
+void NestedDissection
+( const SparseMatrix<F>& A,
+        vector<Int>& map,
+        ldl::Separator& rootSep,
+        ldl::NodeInfo& info,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// Form the first n entries of Q^H B, in the reordering of the columns
+template<typename F>
+void ApplyQAdjoint
+( const ldl::NodeInfo& info, const SparseFront<F>& front,
+  const Matrix<F>& B, Matrix<F>& C );
+
+// Overwrite X (in the reordering of the columns) with inv(R) X
+template<typename F>
+void SolveR
+( const ldl::NodeInfo& info, const SparseFront<F>& front, Matrix<F>& X );
+
+// Solve the least squares problem min_X || A X - B ||_F
+template<typename F>
+void SolveAfter
+( const vector<Int>& invMap, const ldl::NodeInfo& info,
+  const SparseFront<F>& front, const Matrix<F>& B, Matrix<F>& X );
+
+// Return R, in the reordering of the columns
+template<typename F>
+void ExplicitTriang
+( const ldl::NodeInfo& info, const SparseFront<F>& front,
+  SparseMatrix<F>& R );
+
 } // namespace qr
 
+template<typename F>
+void QR
+( const SparseMatrix<F>& A, const vector<Int>& map,
+  const ldl::NodeInfo& info, qr::SparseFront<F>& front );
+
 // RQ
 // ==
 template<typename F>
@@ -804,6 +970,26 @@ void Skeleton
   AbstractDistMatrix<Int>& pR, AbstractDistMatrix<Int>& pC,
   AbstractDistMatrix<F>& Z, const QRCtrl<Base<F>> ctrl=QRCtrl<Base<F>>() );
 
+// Batched factorizations
+// ======================
+// See the discussion of batched kernels in blas_like/level3.hpp. Column b of
+// the pivot matrix of a batched LU holds the permutation of matrix b in the
+// same format as LU(A,p). Exceptions are only thrown after the entire batch
+// has been processed.
+namespace batched {
+
+template<typename F>
+void Cholesky( UpperOrLower uplo, MatrixBatch<F>& A );
+template<typename F>
+void Cholesky( UpperOrLower uplo, const vector<Matrix<F>*>& A );
+
+template<typename F>
+void LU( MatrixBatch<F>& A, Matrix<Int>& p );
+template<typename F>
+void LU( const vector<Matrix<F>*>& A, vector<Matrix<Int>>& p );
+
+} // namespace batched
+
 } // namespace El
 
 #endif // ifndef EL_FACTOR_HPP
@@ -184,6 +184,9 @@ struct DistMatrixNode
 template<typename F>
 struct DistFront;
 
+template<typename F>
+class FrontStore;
+
 template<typename F>
 struct Front
 {
@@ -202,6 +205,12 @@ struct Front
     vector<Front<F>*> children;
     DistFront<F>* duplicate;
 
+    // If the factored fronts are kept out of core, every front of the tree
+    // points to the store which loads them during the solves, and the root
+    // of the tree owns it (and thereby the scratch file)
+    FrontStore<F>* store;
+    shared_ptr<FrontStore<F>> storeOwner;
+
     Front( Front<F>* parentNode=nullptr );
     Front( DistFront<F>* dupNode );
     Front
@@ -274,6 +283,10 @@ struct DistFront
     DistFront<F>* child;
     Front<F>* duplicate;
 
+    // The out-of-core store of the sequential subtree is owned by the root of
+    // the distributed tree so that the scratch file is removed along with it
+    shared_ptr<FrontStore<F>> storeOwner;
+
     DistFront( DistFront<F>* parentNode=nullptr );
 
     DistFront
@@ -317,6 +330,80 @@ struct DistFront
     ( const DistNodeInfo& info, bool computeRecvInds ) const;
 };
 
+// Estimates of the number of bytes required on this process by the
+// multifrontal factorization of an elimination tree into fronts of the given
+// type. The estimates account for the fronts, their diagonals and pivots, the
+// update matrices and the buffers used to exchange them, and the dominant
+// temporaries of the dense front factorizations, but not for allocator
+// overhead or small metadata, and so they are not exact.
+struct FactorMemory
+{
+    double initial;      // the unfactored fronts
+    double factor;       // the factored fronts (including diagonals and pivots)
+    double update;       // the peak usage of update matrices and buffers
+    double peak;         // the peak usage during the factorization
+    double streamedPeak; // the peak if completed fronts are streamed to disk
+};
+
+template<typename F>
+FactorMemory PredictMemory( const NodeInfo& info, LDLFrontType type=LDL_2D );
+template<typename F>
+FactorMemory PredictMemory
+( const DistNodeInfo& info, LDLFrontType type=LDL_2D );
+
+// If the predicted peak memory usage of a factorization exceeds 'budget'
+// bytes on any process, the completed fronts of the sequential subtrees are
+// streamed to a scratch file, '<scratchBase>-<rank>-<pid>-<count>.bin', which
+// is unique to the factorization, and read back in afterwards. A budget of
+// zero disables the check.
+//
+// If 'outOfCore' is true, the completed fronts of the sequential subtrees
+// (other than their roots) are always streamed and are left on disk after
+// the factorization; the solves and multiplies then read each front just
+// before it is needed (while the next front is read in the background) and
+// free it afterwards. Out-of-core fronts may not be copied or unpacked.
+struct FactorMemoryCtrl
+{
+    double budget;
+    string scratchBase;
+    bool outOfCore;
+
+    FactorMemoryCtrl() : budget(0), scratchBase("fronts"), outOfCore(false) { }
+};
+
+// Selectively inverting the diagonal blocks of the distributed fronts costs
+// an extra triangular inversion of each block but replaces each of the
+// (latency-bound) blocked triangular solves against them with a single
+// parallel Gemm. When 'numSolves' solves, each against 'numRHS' right-hand
+// sides, are expected per factorization, selective inversion is chosen if the
+// predicted latency savings pay for the inversions. 'latencyFlops' is the
+// cost of a message latency in units of flops (e.g., 10 microseconds at
+// 10 GFlop/s).
+//
+// This is a separate hint for the LDL overload which accepts it: the solve
+// controls (e.g., RegQSDCtrl) do not carry it, and no routine within the
+// library, including the Interior Point Methods, currently calls that
+// overload, so that callers which know their solve pattern must opt in.
+struct SelInvCtrl
+{
+    Int numSolves;
+    Int numRHS;
+    double latencyFlops;
+    bool progress;
+
+    SelInvCtrl()
+    : numSolves(1), numRHS(1), latencyFlops(1e5), progress(false) { }
+};
+
+// The predicted number of solves after which selective inversion pays for
+// itself (or -1 if it is never predicted to)
+Int SelInvBreakEven( const DistNodeInfo& info, const SelInvCtrl& ctrl );
+
+// Append selective inversion to 'type' if the expected number of solves is
+// at least the predicted break-even point
+LDLFrontType SelInvFrontType
+( const DistNodeInfo& info, LDLFrontType type, const SelInvCtrl& ctrl );
+
 template<typename F>
 void ChangeFrontType( Front<F>& front, LDLFrontType type, bool recurse=true );
 template<typename F>
@@ -67,9 +67,28 @@ void NaturalNestedDissection
         Int cutoff=128,
         bool storeFactRecvInds=false );
 
+// Merge fronts of the sequential portion of the elimination tree according to
+// the relaxation parameters of the BisectCtrl and order the children of each
+// front so that the peak size of the stack of update matrices is minimized
+void Amalgamate
+( Separator& rootSep, Node& rootNode, const BisectCtrl& ctrl=BisectCtrl() );
+void Amalgamate
+( DistSeparator& rootSep, DistNode& rootNode,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 void BuildMap( const Separator& rootSep, vector<Int>& map );
 void BuildMap( const DistSeparator& rootSep, DistMap& map );
 
+// Each process stores its portion of the result of a nested dissection so that
+// a restarted computation can avoid recomputing it
+void SaveAnalysis
+( const string& basename,
+  const DistMap& map, const DistSeparator& rootSep, const DistNodeInfo& rootInfo );
+void LoadAnalysis
+( const string& basename, mpi::Comm comm,
+  DistMap& map, DistSeparator& rootSep, DistNodeInfo& rootInfo,
+  bool storeFactRecvInds=false );
+
 } // namespace ldl
 } // namespace El
 
@@ -35,9 +35,14 @@ struct NodeInfo
     vector<Int> origLowerRelInds;
     // (maps from the child update indices to our frontal indices).
     vector<vector<Int>> childRelInds;
+    // The child which is processed before the update matrix of this front is
+    // allocated, chosen so that the peak number of update-matrix entries
+    // alive while processing this subtree, 'updatePeak', is minimized
+    Int firstChild;
+    double updatePeak;
 
     NodeInfo( NodeInfo* parentNode=nullptr )
-    : parent(parentNode), duplicate(nullptr)
+    : parent(parentNode), duplicate(nullptr), firstChild(0), updatePeak(0)
     { }
 
     NodeInfo( DistNodeInfo* duplicateNode );
@@ -56,6 +61,42 @@ struct NodeInfo
     }
 };
 
+// The pattern for redistributing a DistMultiVec to and from the [VC,* ]
+// distribution of the elimination tree. It only depends upon the tree, the
+// inverse map from the same analysis, and the height of the DistMultiVec (but
+// not its width), and so it is computed by the first Pull or Push and then
+// reused by every subsequent solve against the tree. The send and receive
+// roles are from the point of view of a Pull and reverse for a Push.
+struct MultiVecNodeMeta
+{
+    bool ready;
+    // The pattern is only valid for DistMultiVec's of this height which are
+    // distributed over a communicator of this size
+    Int height;
+    int commSize;
+    // The indices of the locally-owned nodal rows (in the original ordering)
+    vector<Int> mappedInds;
+    // The locally-owned rows of the DistMultiVec which are sent to each process
+    vector<Int> sendInds;
+    vector<int> sendSizes, sendOffs,
+                recvSizes, recvOffs;
+
+    MultiVecNodeMeta() : ready(false), height(0), commSize(0) { }
+
+    void Clear()
+    {
+        ready = false;
+        height = 0;
+        commSize = 0;
+        SwapClear( mappedInds );
+        SwapClear( sendInds );
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+    }
+};
+
 struct DistNodeInfo
 {
     // Known before analysis
@@ -83,6 +124,9 @@ struct DistNodeInfo
     // submatrices of the child updates.
     vector<vector<Int>> childRelInds;
 
+    // Only used by the root of the tree
+    mutable MultiVecNodeMeta multiVecMeta;
+
     DistNodeInfo( DistNodeInfo* parentNode=nullptr )
     : comm(mpi::COMM_WORLD), 
       parent(parentNode), child(nullptr), duplicate(nullptr),
@@ -108,7 +152,7 @@ struct DistNodeInfo
 };
 
 inline NodeInfo::NodeInfo( DistNodeInfo* duplicateNode )
-: parent(nullptr), duplicate(duplicateNode)
+: parent(nullptr), duplicate(duplicateNode), firstChild(0), updatePeak(0)
 {
     size = duplicate->size;
     off = duplicate->off;
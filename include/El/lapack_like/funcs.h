@@ -27,6 +27,7 @@ typedef struct {
   float tol;
   float power;
   ElSignScaling scaling;
+  bool newtonSchulz;
   bool progress;
 } ElSignCtrl_s;
 EL_EXPORT ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl );
@@ -36,6 +37,7 @@ typedef struct {
   double tol;
   double power;
   ElSignScaling scaling;
+  bool newtonSchulz;
   bool progress;
 } ElSignCtrl_d;
 EL_EXPORT ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl );
@@ -24,6 +24,8 @@ enum SignScaling {
 }
 using namespace SignScalingNS;
 
+// If 'newtonSchulz' is true, the (scaled) Newton iteration is abandoned for
+// the inversion-free Newton-Schulz iteration once || I - X^2 ||_1 < 1
 template<typename Real>
 struct SignCtrl 
 {
@@ -31,6 +33,7 @@ struct SignCtrl
     Real tol=0;
     Real power=1;
     SignScaling scaling=SIGN_SCALE_FROB;
+    bool newtonSchulz=false;
     bool progress=false;
 };
 
@@ -44,6 +44,75 @@ Base<F> TwoCondition( const Matrix<F>& A );
 template<typename F>
 Base<F> TwoCondition( const AbstractDistMatrix<F>& A );
 
+// Condition number estimates from an existing factorization
+// ---------------------------------------------------------
+// Rather than explicitly inverting A, the norm of inv(A) is estimated with
+// Higham's variant of Hager's algorithm, which only requires a handful of
+// solves with A and A^H, i.e., O(n^2) work given a dense factorization.
+// Since the factorization typically overwrites A, the norm of A must be
+// provided by the caller.
+
+namespace lu {
+
+// Partially-pivoted LU factorizations, as returned by LU( A, p )
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA, const Matrix<F>& A, const Matrix<Int>& p );
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA,
+  const AbstractDistMatrix<F>& A, const AbstractDistMatrix<Int>& p );
+
+template<typename F>
+Base<F> InfinityConditionEstimate
+( Base<F> infNormA, const Matrix<F>& A, const Matrix<Int>& p );
+template<typename F>
+Base<F> InfinityConditionEstimate
+( Base<F> infNormA,
+  const AbstractDistMatrix<F>& A, const AbstractDistMatrix<Int>& p );
+
+} // namespace lu
+
+// NOTE: The one and infinity condition numbers of symmetric and Hermitian
+//       matrices coincide, so only the former is provided below
+
+namespace cholesky {
+
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA, UpperOrLower uplo, const Matrix<F>& A );
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA, UpperOrLower uplo, const AbstractDistMatrix<F>& A );
+
+} // namespace cholesky
+
+namespace ldl {
+
+// Pivoted dense factorizations, as returned by LDL( A, dSub, p, conjugate )
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA, const Matrix<F>& A, const Matrix<F>& dSub,
+  const Matrix<Int>& p, bool conjugated );
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA,
+  const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& dSub,
+  const AbstractDistMatrix<Int>& p, bool conjugated );
+
+// Sparse-direct factorizations
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA,
+  const vector<Int>& invMap, const NodeInfo& info, const Front<F>& front );
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA,
+  const DistMap& invMap, const DistNodeInfo& info,
+  const DistFront<F>& front );
+
+} // namespace ldl
+
 // Determinant
 // ===========
 template<typename F>
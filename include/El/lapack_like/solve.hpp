@@ -31,6 +31,17 @@ void LinearSolve
 ( const DistSparseMatrix<F>& A, DistMultiVec<F>& B, 
   const LeastSquaresCtrl<Base<F>>& ctrl=LeastSquaresCtrl<Base<F>>() );
 
+// Solve with a sparse LU factorization (with static pivoting) rather than
+// with the augmented system used by LeastSquares
+template<typename F>
+void LinearSolve
+( const SparseMatrix<F>& A, Matrix<F>& B,
+  const LUStaticPivotCtrl<Base<F>>& ctrl );
+template<typename F>
+void LinearSolve
+( const DistSparseMatrix<F>& A, DistMultiVec<F>& B,
+  const LUStaticPivotCtrl<Base<F>>& ctrl );
+
 namespace lin_solve {
 
 template<typename F>
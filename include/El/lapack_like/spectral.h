@@ -174,32 +174,63 @@ typedef struct {
 } ElHermitianSDCCtrl_d;
 EL_EXPORT ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl );
 
+/* HermitianSubspaceCtrl */
+typedef struct {
+  ElInt degree;
+  ElInt numGuard;
+  float maxWidthRatio;
+  ElInt maxIts;
+  float tol;
+  bool progress;
+} ElHermitianSubspaceCtrl_s;
+EL_EXPORT ElError ElHermitianSubspaceCtrlDefault_s
+( ElHermitianSubspaceCtrl_s* ctrl );
+
+typedef struct {
+  ElInt degree;
+  ElInt numGuard;
+  double maxWidthRatio;
+  ElInt maxIts;
+  double tol;
+  bool progress;
+} ElHermitianSubspaceCtrl_d;
+EL_EXPORT ElError ElHermitianSubspaceCtrlDefault_d
+( ElHermitianSubspaceCtrl_d* ctrl );
+
 /* HermitianEigCtrl */
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianSDCCtrl_s sdcCtrl;
+  ElHermitianSubspaceCtrl_s subspaceCtrl;
   bool useSDC;
+  bool useSubspace;
 } ElHermitianEigCtrl_s;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl );
 
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianSDCCtrl_d sdcCtrl;
+  ElHermitianSubspaceCtrl_d subspaceCtrl;
   bool useSDC;
+  bool useSubspace;
 } ElHermitianEigCtrl_d;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl );
 
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianSDCCtrl_s sdcCtrl;
+  ElHermitianSubspaceCtrl_s subspaceCtrl;
   bool useSDC;
+  bool useSubspace;
 } ElHermitianEigCtrl_c;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_c( ElHermitianEigCtrl_c* ctrl );
 
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianSDCCtrl_d sdcCtrl;
+  ElHermitianSubspaceCtrl_d subspaceCtrl;
   bool useSDC;
+  bool useSubspace;
 } ElHermitianEigCtrl_z;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_z( ElHermitianEigCtrl_z* ctrl );
 
@@ -719,6 +750,9 @@ EL_EXPORT ElError ElHermitianPolarDecompDist_z
 typedef struct {
   bool distAED;
   ElInt blockHeight, blockWidth;
+  ElInt minMultishiftSize;
+  ElInt numShifts;
+  ElInt deflationSize;
 } ElHessQRCtrl;
 EL_EXPORT ElError ElHessQRCtrlDefault( ElHessQRCtrl* ctrl );
 
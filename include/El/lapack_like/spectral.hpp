@@ -34,12 +34,32 @@ struct HermitianSDCCtrl
     bool progress=false;
 };
 
+// Chebyshev-filtered subspace iteration for (distributed) subset
+// computations; a zero number of guard vectors selects a default based upon
+// the size of the window, and a zero tolerance selects n epsilon (relative
+// to the one norm of A). Since the iteration costs a multiple of a dense
+// reduction once the basis is a sizable fraction of the matrix, the
+// tridiagonal approach is used when the basis would be wider than
+// 'maxWidthRatio' times the height of A.
+template<typename Real>
+struct HermitianSubspaceCtrl
+{
+    Int degree=10;
+    Int numGuard=0;
+    Real maxWidthRatio=0.25;
+    Int maxIts=100;
+    Real tol=0;
+    bool progress=false;
+};
+
 template<typename F>
 struct HermitianEigCtrl
 {
     HermitianTridiagCtrl<F> tridiagCtrl;
     HermitianSDCCtrl<Base<F>> sdcCtrl;
+    HermitianSubspaceCtrl<Base<F>> subspaceCtrl;
     bool useSDC=false;
+    bool useSubspace=false;
     bool timeStages=false;
 };
 
@@ -238,6 +258,14 @@ struct HessQRCtrl
 {
     bool distAED=false;
     Int blockHeight=DefaultBlockHeight(), blockWidth=DefaultBlockWidth();
+
+    // Only used by the native (ScaLAPACK-free) implementation: active blocks
+    // of at most 'minMultishiftSize' rows are handled redundantly, and zero
+    // values of 'numShifts' and 'deflationSize' select defaults based upon
+    // the size of the active block
+    Int minMultishiftSize=75;
+    Int numShifts=0;
+    Int deflationSize=0;
 };
 
 template<typename Real>
@@ -521,7 +549,9 @@ enum PseudospecNorm {
 };
 
 // Configurations for how often and what format numerical (num) and image (img)
-// snapshots of the pseudospectral estimates should be saved
+// snapshots of the pseudospectral estimates should be saved, as well as how
+// often the full state of the iteration should be checkpointed (chkpt) so that
+// an interrupted computation can be resumed
 struct SnapshotCtrl
 {
     Int realSize=0, imagSize=0;
@@ -532,11 +562,16 @@ struct SnapshotCtrl
     FileFormat imgFormat=PNG, numFormat=ASCII_MATLAB;
     bool itCounts=true;
 
+    Int chkptFreq=-1, chkptCount=0;
+    string chkptBase="ps-chkpt";
+    bool resume=false;
+
     void ResetCounts()
     {
         imgSaveCount = 0;
         numSaveCount = 0;
         imgDispCount = 0;
+        chkptCount = 0;
     }
     void Iterate()
     {
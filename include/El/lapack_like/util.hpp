@@ -14,17 +14,31 @@ namespace El {
 
 // Graph reordering
 // ================
+// If 'native' is true (or if the requested (Par)METIS routine is not
+// available), the built-in multilevel partitioner is used instead of METIS
+// and ParMETIS
 struct BisectCtrl
 {
     bool sequential;
+    bool native;
     Int numDistSeps;
     Int numSeqSeps;
     Int cutoff;
     bool storeFactRecvInds;
 
+    // Relaxed supernode amalgamation of the resulting elimination tree: a
+    // child is merged into its parent if doing so introduces no explicit
+    // zeros, if the merged front has at most 'relaxSize' pivots, or if the
+    // fraction of explicit zeros in the merged front is at most 'relaxFill'.
+    // Since this changes the ordering, it must be explicitly requested.
+    bool amalgamate;
+    Int relaxSize;
+    double relaxFill;
+
     BisectCtrl()
-    : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(128),
-      storeFactRecvInds(false)
+    : sequential(true), native(false), numDistSeps(1), numSeqSeps(1),
+      cutoff(128), storeFactRecvInds(false),
+      amalgamate(false), relaxSize(16), relaxFill(0.05)
     { }
 };
 
@@ -43,6 +57,23 @@ Int Bisect
         bool& onLeft,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// A native multilevel vertex-separator partitioner (parallel heavy-edge
+// matching, graph growing on the coarsest graph, and parallel greedy
+// refinement of the separator). The return value is the separator size, and
+// the separator is ordered after the left and right parts.
+Int MultilevelBisect
+( const Graph& graph,
+        vector<Int>& perm,
+        Int& leftChildSize,
+        Int& rightChildSize,
+  const BisectCtrl& ctrl=BisectCtrl() );
+Int MultilevelBisect
+( const DistGraph& graph,
+        DistMap& perm,
+        Int& leftChildSize,
+        Int& rightChildSize,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 Int NaturalBisect
 ( Int nx, Int ny, Int nz,
   const Graph& graph,
@@ -91,6 +122,44 @@ template<typename Real>
 vector<ValueInt<Real>> TaggedSort
 ( const AbstractDistMatrix<Real>& x, SortType sort=ASCENDING );
 
+// Empirical tuning
+// ================
+// Run short micro-benchmarks on the given process grid and set the
+// algorithmic blocksize regimes (see RegimeBlocksize), the local
+// Symv/Trrk/Trr2k blocksizes, and the GEMM_DEFAULT crossover weights to the
+// best observed values. The results
+// can be persisted with SaveTuningProfile and reloaded with 
+// LoadTuningProfile (or via the EL_TUNING_PROFILE environment variable).
+struct TuneCtrl
+{
+    // The problem sizes used for tuning the algorithmic blocksize regimes
+    // (the default blocksize is that of the largest size)
+    vector<Int> sizes;
+    vector<Int> blocksizes;
+
+    // The problem size used for tuning the local blocksizes
+    Int localN=1000;
+    vector<Int> localBlocksizes;
+
+    // The Gemm crossovers are measured for m = n = gemmSize and 
+    // k = ratio*gemmSize, with ratio = 1, 2, 4, ..., maxGemmRatio
+    Int gemmSize=256;
+    Int maxGemmRatio=32;
+
+    Int numReps=2;
+    bool tuneSingle=false;
+    bool tuneComplex=true;
+    bool progress=false;
+
+    TuneCtrl()
+    : sizes({500,1000,2000}),
+      blocksizes({32,48,64,96,128,160,192,256}),
+      localBlocksizes({16,32,64,128,256})
+    { }
+};
+
+void AutoTune( const Grid& g, const TuneCtrl& ctrl=TuneCtrl() );
+
 } // namespace El
 
 #endif // ifndef EL_UTIL_HPP
@@ -487,9 +487,14 @@ struct RPCACtrl
 {
     bool useALM=true;
     bool usePivQR=false;
+    // Use a randomized partial SVT which is warm-started with the singular
+    // vectors retained in the previous iteration (overrides 'usePivQR')
+    bool useRandSVT=false;
     bool progress=true;
 
     Int numPivSteps=75;
+    Int randOversample=10;
+    Int numPowerIts=1;
     Int maxIts=1000;
 
     Real tau=0;
@@ -118,6 +118,18 @@ Int PivotedQR
 template<typename F>
 Int TSQR( AbstractDistMatrix<F>& A, Base<F> rho, bool relative=false );
 
+// Randomized partial SVT which is warm-started with (and returns) the
+// retained right singular vectors in V; intended for iterative schemes where
+// the rank of the thresholded matrix is small and varies slowly
+template<typename F>
+Int Randomized
+( Matrix<F>& A, Base<F> rho, Matrix<F>& V,
+  Int oversample=10, Int numPowerIts=1, bool relative=false );
+template<typename F>
+Int Randomized
+( AbstractDistMatrix<F>& A, Base<F> rho, AbstractDistMatrix<F>& V,
+  Int oversample=10, Int numPowerIts=1, bool relative=false );
+
 } // namespace svt
 
 // Soft-thresholding
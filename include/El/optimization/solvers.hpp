@@ -79,6 +79,15 @@ struct MehrotraCtrl
     bool print=false;
     bool time=false;
 
+    // If 'checkpointFreq' is positive, the (distributed sparse) solvers store
+    // the nested dissection of the KKT system to '<checkpointBase>-analysis'
+    // and, every 'checkpointFreq' iterations, the current iterate to
+    // '<checkpointBase>-iterate'. If 'resume' is true, both are read back in
+    // and the solve continues from the stored iterate.
+    Int checkpointFreq=0;
+    string checkpointBase="ipm";
+    bool resume=false;
+
     // TODO: Add a user-definable (muAff,mu) -> sigma function to replace
     //       the default, (muAff/mu)^3 
 };
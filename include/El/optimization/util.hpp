@@ -26,6 +26,32 @@ void Covariance( const Matrix<F>& D, Matrix<F>& S );
 template<typename F>
 void Covariance( const AbstractDistMatrix<F>& D, AbstractDistMatrix<F>& S );
 
+// Interior Point Method checkpoints
+// =================================
+// Each process writes (or reads) its portion of the iterate, as well as the
+// iteration number, to (or from) '<basename>-<rank>.bin'
+template<typename Real>
+void SaveIPMIterate
+( const string& basename, Int numIts,
+  const DistMultiVec<Real>& x, const DistMultiVec<Real>& y,
+  const DistMultiVec<Real>& z );
+template<typename Real>
+void SaveIPMIterate
+( const string& basename, Int numIts,
+  const DistMultiVec<Real>& x, const DistMultiVec<Real>& y,
+  const DistMultiVec<Real>& z, const DistMultiVec<Real>& s );
+
+// The returned value is the iteration number of the checkpoint
+template<typename Real>
+Int LoadIPMIterate
+( const string& basename,
+  DistMultiVec<Real>& x, DistMultiVec<Real>& y, DistMultiVec<Real>& z );
+template<typename Real>
+Int LoadIPMIterate
+( const string& basename,
+  DistMultiVec<Real>& x, DistMultiVec<Real>& y,
+  DistMultiVec<Real>& z, DistMultiVec<Real>& s );
+
 // Log barrier
 // ===========
 template<typename F>
@@ -1667,6 +1667,27 @@ class DistMatrix(object):
     elif self.tag == zTag: lib.ElDistMatrixQueueUpdate_z(*args)
     else: DataExcept()
 
+  lib.ElDistMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueUpdates(self,rows,cols,values):
+    arrays, rowsPtr, colsPtr, valuesPtr = \
+      NumPyTriplets(rows,cols,values,self.tag)
+    args = [self.obj,arrays[0].size,rowsPtr,colsPtr,valuesPtr]
+    if   self.tag == iTag: lib.ElDistMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
   lib.ElDistMatrixProcessQueues_i.argtypes = \
   lib.ElDistMatrixProcessQueues_s.argtypes = \
   lib.ElDistMatrixProcessQueues_d.argtypes = \
@@ -324,6 +324,27 @@ class DistMultiVec(object):
     elif self.tag == zTag: lib.ElDistMultiVecQueueUpdate_z(*args)
     else: DataExcept()
 
+  lib.ElDistMultiVecQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistMultiVecQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistMultiVecQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistMultiVecQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistMultiVecQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueUpdates(self,rows,cols,values):
+    arrays, rowsPtr, colsPtr, valuesPtr = \
+      NumPyTriplets(rows,cols,values,self.tag)
+    args = [self.obj,arrays[0].size,rowsPtr,colsPtr,valuesPtr]
+    if   self.tag == iTag: lib.ElDistMultiVecQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistMultiVecQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistMultiVecQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistMultiVecQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistMultiVecQueueUpdates_z(*args)
+    else: DataExcept()
+
   lib.ElDistMultiVecProcessQueues_i.argtypes = \
   lib.ElDistMultiVecProcessQueues_s.argtypes = \
   lib.ElDistMultiVecProcessQueues_d.argtypes = \
@@ -206,6 +206,75 @@ class DistSparseMatrix(object):
     elif self.tag == zTag: lib.ElDistSparseMatrixQueueLocalUpdate_z(*args)
     else: DataExcept()
 
+  lib.ElDistSparseMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType),bType]
+  def QueueUpdates(self,rows,cols,values,passive=True):
+    arrays, rowsPtr, colsPtr, valuesPtr = \
+      NumPyTriplets(rows,cols,values,self.tag)
+    args = [self.obj,arrays[0].size,rowsPtr,colsPtr,valuesPtr,passive]
+    if   self.tag == iTag: lib.ElDistSparseMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
+  lib.ElDistSparseMatrixQueueLocalUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueLocalUpdates(self,localRows,cols,values):
+    arrays, rowsPtr, colsPtr, valuesPtr = \
+      NumPyTriplets(localRows,cols,values,self.tag)
+    args = [self.obj,arrays[0].size,rowsPtr,colsPtr,valuesPtr]
+    if   self.tag == iTag: lib.ElDistSparseMatrixQueueLocalUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixQueueLocalUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixQueueLocalUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixQueueLocalUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixQueueLocalUpdates_z(*args)
+    else: DataExcept()
+
+  lib.ElDistSparseMatrixImportLocalCSR_i.argtypes = \
+    [c_void_p,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistSparseMatrixImportLocalCSR_s.argtypes = \
+    [c_void_p,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistSparseMatrixImportLocalCSR_d.argtypes = \
+    [c_void_p,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistSparseMatrixImportLocalCSR_c.argtypes = \
+    [c_void_p,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistSparseMatrixImportLocalCSR_z.argtypes = \
+    [c_void_p,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def ImportLocalCSR(self,localRowOffsets,cols,values):
+    localRowOffsets, offsetsPtr = NumPyPointer(localRowOffsets,iTag)
+    cols, colsPtr = NumPyPointer(cols,iTag)
+    values, valuesPtr = NumPyPointer(values,self.tag)
+    if localRowOffsets.size != self.LocalHeight()+1:
+      raise Exception('Expected one more row offset than local rows')
+    numLocalEntries = localRowOffsets[-1]
+    if cols.size != numLocalEntries or values.size != numLocalEntries:
+      raise Exception('Column and value arrays do not match the offsets')
+    args = [self.obj,offsetsPtr,colsPtr,valuesPtr]
+    if   self.tag == iTag: lib.ElDistSparseMatrixImportLocalCSR_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixImportLocalCSR_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixImportLocalCSR_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixImportLocalCSR_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixImportLocalCSR_z(*args)
+    else: DataExcept()
+
   lib.ElDistSparseMatrixQueueZero_i.argtypes = \
   lib.ElDistSparseMatrixQueueZero_s.argtypes = \
   lib.ElDistSparseMatrixQueueZero_d.argtypes = \
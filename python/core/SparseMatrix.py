@@ -136,6 +136,27 @@ class SparseMatrix(object):
     elif self.tag == zTag: lib.ElSparseMatrixQueueUpdate_z(*args)
     else: DataExcept()
 
+  lib.ElSparseMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElSparseMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElSparseMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElSparseMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElSparseMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueUpdates(self,rows,cols,values):
+    arrays, rowsPtr, colsPtr, valuesPtr = \
+      NumPyTriplets(rows,cols,values,self.tag)
+    args = [self.obj,arrays[0].size,rowsPtr,colsPtr,valuesPtr]
+    if   self.tag == iTag: lib.ElSparseMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElSparseMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElSparseMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElSparseMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElSparseMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
   lib.ElSparseMatrixQueueZero_i.argtypes = \
   lib.ElSparseMatrixQueueZero_s.argtypes = \
   lib.ElSparseMatrixQueueZero_d.argtypes = \
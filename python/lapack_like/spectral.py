@@ -693,7 +693,9 @@ class SignCtrl_s(ctypes.Structure):
   _fields_ = [("maxIts",iType),
               ("tol",sType),
               ("power",sType),
-              ("scaling",c_uint)]
+              ("scaling",c_uint),
+              ("newtonSchulz",bType),
+              ("progress",bType)]
   def __init__(self):
     lib.ElSignCtrlDefault_s(pointer(self))
 
@@ -702,14 +704,19 @@ class SignCtrl_d(ctypes.Structure):
   _fields_ = [("maxIts",iType),
               ("tol",dType),
               ("power",dType),
-              ("scaling",c_uint)]
+              ("scaling",c_uint),
+              ("newtonSchulz",bType),
+              ("progress",bType)]
   def __init__(self):
     lib.ElSignCtrlDefault_d(pointer(self))
 
 lib.ElHessQRCtrlDefault.argtypes = [c_void_p]
 class HessQRCtrl(ctypes.Structure):
   _fields_ = [("distAED",bType),
-              ("blockHeight",iType),("blockWidth",iType)]
+              ("blockHeight",iType),("blockWidth",iType),
+              ("minMultishiftSize",iType),
+              ("numShifts",iType),
+              ("deflationSize",iType)]
   def __init__(self):
     lib.ElHessQRCtrlDefault(pointer(self))
 
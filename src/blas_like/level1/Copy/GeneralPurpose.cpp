@@ -0,0 +1,296 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include "El/blas_like/level1/copy_internal.hpp"
+
+namespace El {
+namespace copy {
+
+namespace {
+
+// Everything about a redistribution which does not depend upon the data
+// itself. Each entry of A is sent by a single owner (the first member of
+// its redundant communicator) to every owner of that entry in B, and both
+// sides traverse their local entries in column-major order, so that no
+// indices need to be communicated.
+struct GeneralPurposePlan
+{
+    // Indexed by the ranks within the viewing communicator of A's grid
+    vector<int> sendSizes, sendOffs, recvSizes, recvOffs;
+    Int totalSend, totalRecv;
+
+    // The owner of each of our local rows and columns of A within the
+    // column and row communicators of B (and vice versa)
+    vector<int> destRowOwners, destColOwners;
+    vector<int> sourceRowOwners, sourceColOwners;
+
+    // The viewing ranks that own each (row owner, column owner) pair of B,
+    // and the viewing rank which sends each such pair of A
+    int colStrideA, colStrideB;
+    vector<vector<int>> receivers;
+    vector<int> senders;
+};
+
+struct PlanKey
+{
+    DistData distA, distB;
+    Int height, width;
+};
+
+inline bool operator<( const DistData& a, const DistData& b )
+{
+    if( a.colDist != b.colDist ) return a.colDist < b.colDist;
+    if( a.rowDist != b.rowDist ) return a.rowDist < b.rowDist;
+    if( a.colAlign != b.colAlign ) return a.colAlign < b.colAlign;
+    if( a.rowAlign != b.rowAlign ) return a.rowAlign < b.rowAlign;
+    if( a.root != b.root ) return a.root < b.root;
+    return std::less<const Grid*>()( a.grid, b.grid );
+}
+
+inline bool operator<( const PlanKey& a, const PlanKey& b )
+{
+    if( a.height != b.height ) return a.height < b.height;
+    if( a.width != b.width ) return a.width < b.width;
+    if( a.distA < b.distA ) return true;
+    if( b.distA < a.distA ) return false;
+    return a.distB < b.distB;
+}
+
+// Since a miss requires an AllGather over the viewing communicator of A,
+// every member of that communicator must agree on whether a plan is cached.
+// Each viewing communicator therefore has its own cache, which is only
+// modified by redistributions over that communicator (and by destroying one
+// of its grids), so that teams working on different subgrids cannot evict
+// each other's plans.
+const size_t maxNumPlans = 64;
+typedef std::map<PlanKey,GeneralPurposePlan> PlanCache;
+std::map<MPI_Comm,PlanCache> planCaches;
+
+template<typename T>
+GeneralPurposePlan
+BuildPlan( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CSE cse("copy::BuildPlan"))
+    GeneralPurposePlan plan;
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const int commSize = mpi::Size( comm );
+
+    // Determine which viewing ranks send and receive each portion
+    const bool sending = A.Participating() && A.RedundantRank() == 0;
+    const bool receiving = B.Participating();
+    int myInfo[4];
+    myInfo[0] = ( sending ? A.ColRank() : -1 );
+    myInfo[1] = ( sending ? A.RowRank() : -1 );
+    myInfo[2] = ( receiving ? B.ColRank() : -1 );
+    myInfo[3] = ( receiving ? B.RowRank() : -1 );
+    vector<int> info( 4*commSize );
+    mpi::AllGather( myInfo, 4, info.data(), 4, comm );
+
+    plan.colStrideA = A.ColStride();
+    plan.colStrideB = B.ColStride();
+    const Int numPortionsA = A.ColStride()*A.RowStride();
+    const Int numPortionsB = B.ColStride()*B.RowStride();
+    plan.senders.resize( numPortionsA, -1 );
+    plan.receivers.resize( numPortionsB );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( info[4*q+0] >= 0 )
+            plan.senders[info[4*q+0]+info[4*q+1]*plan.colStrideA] = q;
+        if( info[4*q+2] >= 0 )
+            plan.receivers[info[4*q+2]+info[4*q+3]*plan.colStrideB]
+              .push_back( q );
+    }
+
+    // Count the entries sent to each process by binning our rows and columns
+    // by their owners in B; the portion (s,t) of B is owned by the s'th
+    // process in its column communicator and the t'th in its row communicator
+    plan.sendSizes.resize( commSize, 0 );
+    if( sending )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        plan.destRowOwners.resize( localHeight );
+        plan.destColOwners.resize( localWidth );
+        vector<Int> rowBins( B.ColStride(), 0 ), colBins( B.RowStride(), 0 );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            plan.destRowOwners[iLoc] = B.RowOwner( A.GlobalRow(iLoc) );
+            ++rowBins[plan.destRowOwners[iLoc]];
+        }
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            plan.destColOwners[jLoc] = B.ColOwner( A.GlobalCol(jLoc) );
+            ++colBins[plan.destColOwners[jLoc]];
+        }
+        for( Int t=0; t<B.RowStride(); ++t )
+            for( Int s=0; s<B.ColStride(); ++s )
+                for( int q : plan.receivers[s+t*plan.colStrideB] )
+                    plan.sendSizes[q] += rowBins[s]*colBins[t];
+    }
+
+    // Count the entries received from each process
+    plan.recvSizes.resize( commSize, 0 );
+    if( receiving )
+    {
+        const Int localHeight = B.LocalHeight();
+        const Int localWidth = B.LocalWidth();
+        plan.sourceRowOwners.resize( localHeight );
+        plan.sourceColOwners.resize( localWidth );
+        vector<Int> rowBins( A.ColStride(), 0 ), colBins( A.RowStride(), 0 );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            plan.sourceRowOwners[iLoc] = A.RowOwner( B.GlobalRow(iLoc) );
+            ++rowBins[plan.sourceRowOwners[iLoc]];
+        }
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            plan.sourceColOwners[jLoc] = A.ColOwner( B.GlobalCol(jLoc) );
+            ++colBins[plan.sourceColOwners[jLoc]];
+        }
+        for( Int t=0; t<A.RowStride(); ++t )
+        {
+            for( Int s=0; s<A.ColStride(); ++s )
+            {
+                const int q = plan.senders[s+t*plan.colStrideA];
+                const Int numEntries = rowBins[s]*colBins[t];
+                if( numEntries == 0 )
+                    continue;
+                DEBUG_ONLY(
+                  if( q < 0 )
+                      LogicError("No process owns a portion of the source");
+                )
+                plan.recvSizes[q] += numEntries;
+            }
+        }
+    }
+
+    plan.totalSend = Scan( plan.sendSizes, plan.sendOffs );
+    plan.totalRecv = Scan( plan.recvSizes, plan.recvOffs );
+    return plan;
+}
+
+template<typename T>
+const GeneralPurposePlan&
+GetPlan( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    PlanKey key;
+    key.distA = A.DistData();
+    key.distB = B.DistData();
+    key.height = A.Height();
+    key.width = A.Width();
+    PlanCache& planCache = planCaches[A.Grid().ViewingComm().comm];
+    auto it = planCache.find( key );
+    if( it != planCache.end() )
+        return it->second;
+    if( planCache.size() >= maxNumPlans )
+        planCache.clear();
+    auto entry = planCache.insert( std::make_pair(key,BuildPlan(A,B)) );
+    return entry.first->second;
+}
+
+} // anonymous namespace
+
+template<typename T>
+void GeneralPurpose
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(
+      CSE cse("copy::GeneralPurpose");
+      if( !mpi::Congruent
+          ( A.Grid().ViewingComm(), B.Grid().ViewingComm() ) )
+          LogicError("Grids must have congruent viewing communicators");
+    )
+    B.Resize( A.Height(), A.Width() );
+    const GeneralPurposePlan& plan = GetPlan( A, B );
+    mpi::Comm comm = A.Grid().ViewingComm();
+
+    // Pack
+    vector<T> sendBuf( plan.totalSend );
+    if( plan.totalSend > 0 )
+    {
+        auto offs = plan.sendOffs;
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const T* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const int colOwner = plan.destColOwners[jLoc];
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const T& alpha = ABuf[iLoc+jLoc*ALDim];
+                for( int q : plan.receivers[plan.destRowOwners[iLoc]+
+                                            colOwner*plan.colStrideB] )
+                    sendBuf[offs[q]++] = alpha;
+            }
+        }
+    }
+
+    // Exchange
+    vector<T> recvBuf( plan.totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), plan.sendSizes.data(), plan.sendOffs.data(),
+      recvBuf.data(), plan.recvSizes.data(), plan.recvOffs.data(), comm );
+    SwapClear( sendBuf );
+
+    // Unpack
+    if( plan.totalRecv > 0 )
+    {
+        auto offs = plan.recvOffs;
+        const Int localHeight = B.LocalHeight();
+        const Int localWidth = B.LocalWidth();
+        T* BBuf = B.Buffer();
+        const Int BLDim = B.LDim();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const int colOwner = plan.sourceColOwners[jLoc];
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int q = plan.senders[plan.sourceRowOwners[iLoc]+
+                                           colOwner*plan.colStrideA];
+                BBuf[iLoc+jLoc*BLDim] = recvBuf[offs[q]++];
+            }
+        }
+    }
+}
+
+void ClearGeneralPurposePlans( const Grid* grid )
+{
+    DEBUG_ONLY(CSE cse("copy::ClearGeneralPurposePlans"))
+    if( grid == nullptr )
+    {
+        planCaches.clear();
+        return;
+    }
+    // Every grid duplicates its viewing communicator, so the handle may be
+    // reused once the grid is destroyed
+    planCaches.erase( grid->ViewingComm().comm );
+    for( auto& cacheEntry : planCaches )
+    {
+        PlanCache& planCache = cacheEntry.second;
+        for( auto it=planCache.begin(); it!=planCache.end(); )
+        {
+            if( it->first.distA.grid == grid || it->first.distB.grid == grid )
+                it = planCache.erase( it );
+            else
+                ++it;
+        }
+    }
+}
+
+#define PROTO(T) \
+  template void GeneralPurpose \
+  ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+
+#define EL_ENABLE_QUAD
+#include "El/macros/Instantiate.h"
+
+} // namespace copy
+} // namespace El
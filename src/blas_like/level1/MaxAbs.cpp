@@ -126,6 +126,39 @@ ValueInt<Base<T>> VectorMaxAbs( const AbstractDistMatrix<T>& x )
     return pivot;
 }
 
+template<typename T>
+ValueInt<Base<T>> VectorMaxAbs( const DistMultiVec<T>& x )
+{
+    DEBUG_ONLY(
+      CSE cse("VectorMaxAbs");
+      if( x.Width() != 1 )
+          LogicError("Input should have been a vector");
+    )
+    typedef Base<T> Real;
+    ValueInt<Real> pivot;
+    if( x.Height() == 0 )
+    {
+        pivot.value = 0;
+        pivot.index = -1;
+        return pivot;
+    }
+
+    ValueInt<Real> localPivot;
+    localPivot.value = 0;
+    localPivot.index = 0;
+    const Int localHeight = x.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real absVal = Abs(x.GetLocal(iLoc,0));
+        if( absVal > localPivot.value )
+        {
+            localPivot.value = absVal;
+            localPivot.index = x.GlobalRow(iLoc);
+        }
+    }
+    return mpi::AllReduce( localPivot, mpi::MaxLocOp<Real>(), x.Comm() );
+}
+
 template<typename T>
 Entry<Base<T>> MaxAbs( const Matrix<T>& A )
 {
@@ -485,6 +518,7 @@ Entry<Base<T>> SymmetricMaxAbs
 #define PROTO(T) \
   template ValueInt<Base<T>> VectorMaxAbs( const Matrix<T>& x ); \
   template ValueInt<Base<T>> VectorMaxAbs( const AbstractDistMatrix<T>& x ); \
+  template ValueInt<Base<T>> VectorMaxAbs( const DistMultiVec<T>& x ); \
   template Entry<Base<T>> MaxAbs( const Matrix<T>& x ); \
   template Entry<Base<T>> MaxAbs( const AbstractDistMatrix<T>& x ); \
   template Entry<Base<T>> MaxAbs( const SparseMatrix<T>& x ); \
@@ -0,0 +1,207 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "./Batched/Util.hpp"
+#include "./Batched/Gemm.hpp"
+#include "./Batched/Trsm.hpp"
+
+namespace El {
+namespace batched {
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const MatrixBatch<T>& A, const MatrixBatch<T>& B,
+  T beta,        MatrixBatch<T>& C )
+{
+    DEBUG_ONLY(
+      CSE cse("batched::Gemm");
+      AssertValidBatch( A );
+      AssertValidBatch( B );
+      AssertValidBatch( C );
+      AssertSameLayouts( A, C );
+      AssertSameLayouts( B, C );
+      const Int mA = ( orientA == NORMAL ? A.height : A.width );
+      const Int kA = ( orientA == NORMAL ? A.width : A.height );
+      const Int kB = ( orientB == NORMAL ? B.height : B.width );
+      const Int nB = ( orientB == NORMAL ? B.width : B.height );
+      if( mA != C.height || nB != C.width || kA != kB )
+          LogicError("Nonconformal batched Gemm");
+    )
+    const Int m = C.height;
+    const Int n = C.width;
+    const Int k = ( orientA == NORMAL ? A.width : A.height );
+    const Strides sA = GetStrides( A );
+    const Strides sB = GetStrides( B );
+    const Strides sC = GetStrides( C );
+    ForEachChunk
+    ( C.batchSize, C.layout,
+      [&]( Int offset, Int count )
+      {
+          GemmChunk
+          ( orientA, orientB, m, n, k,
+            alpha, &A.buffer[offset*sA.batchStride], sA,
+                   &B.buffer[offset*sB.batchStride], sB,
+            beta,  &C.buffer[offset*sC.batchStride], sC, count );
+      } );
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<const Matrix<T>*>& A,
+           const vector<const Matrix<T>*>& B,
+  T beta,  const vector<Matrix<T>*>& C )
+{
+    DEBUG_ONLY(
+      CSE cse("batched::Gemm");
+      if( A.size() != C.size() || B.size() != C.size() )
+          LogicError("Batches were of different sizes");
+      for( size_t b=0; b<C.size(); ++b )
+      {
+          const Int mA = ( orientA == NORMAL ? A[b]->Height() : A[b]->Width() );
+          const Int kA = ( orientA == NORMAL ? A[b]->Width() : A[b]->Height() );
+          const Int kB = ( orientB == NORMAL ? B[b]->Height() : B[b]->Width() );
+          const Int nB = ( orientB == NORMAL ? B[b]->Width() : B[b]->Height() );
+          if( mA != C[b]->Height() || nB != C[b]->Width() || kA != kB )
+              LogicError("Nonconformal batched Gemm");
+      }
+    )
+    const Int batchSize = C.size();
+    auto isSmall = [&]( Int b )
+      {
+          return C[b]->Height() <= maxSmallSize &&
+                 C[b]->Width() <= maxSmallSize &&
+                 A[b]->Height() <= maxSmallSize &&
+                 A[b]->Width() <= maxSmallSize;
+      };
+
+    EL_OUTER_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+    {
+        if( !isSmall(b) )
+            continue;
+        const Matrix<T>& ABatch = *A[b];
+        const Matrix<T>& BBatch = *B[b];
+        Matrix<T>& CBatch = *C[b];
+        GemmChunk
+        ( orientA, orientB,
+          CBatch.Height(), CBatch.Width(),
+          ( orientA == NORMAL ? ABatch.Width() : ABatch.Height() ),
+          alpha, ABatch.LockedBuffer(), GetStrides(ABatch),
+                 BBatch.LockedBuffer(), GetStrides(BBatch),
+          beta,  CBatch.Buffer(),       GetStrides(CBatch), 1 );
+    }
+
+    for( Int b=0; b<batchSize; ++b )
+        if( !isSmall(b) )
+            El::Gemm( orientA, orientB, alpha, *A[b], *B[b], beta, *C[b] );
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const MatrixBatch<F>& A, MatrixBatch<F>& B )
+{
+    DEBUG_ONLY(
+      CSE cse("batched::Trsm");
+      AssertValidBatch( A );
+      AssertValidBatch( B );
+      AssertSameLayouts( A, B );
+      if( A.height != A.width )
+          LogicError("Triangular matrices must be square");
+      if( A.height != (side==LEFT ? B.height : B.width) )
+          LogicError("Nonconformal batched Trsm");
+    )
+    const Strides sA = GetStrides( A );
+    const Strides sB = GetStrides( B );
+    ForEachChunk
+    ( B.batchSize, B.layout,
+      [&]( Int offset, Int count )
+      {
+          TrsmChunk
+          ( side, uplo, orientation, diag, B.height, B.width, alpha,
+            &A.buffer[offset*sA.batchStride], sA,
+            &B.buffer[offset*sB.batchStride], sB, count );
+      } );
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const vector<const Matrix<F>*>& A, const vector<Matrix<F>*>& B )
+{
+    DEBUG_ONLY(
+      CSE cse("batched::Trsm");
+      if( A.size() != B.size() )
+          LogicError("Batches were of different sizes");
+      for( size_t b=0; b<B.size(); ++b )
+      {
+          if( A[b]->Height() != A[b]->Width() )
+              LogicError("Triangular matrices must be square");
+          if( A[b]->Height() != (side==LEFT ? B[b]->Height() : B[b]->Width()) )
+              LogicError("Nonconformal batched Trsm");
+      }
+    )
+    const Int batchSize = B.size();
+    auto isSmall = [&]( Int b )
+      {
+          return B[b]->Height() <= maxSmallSize &&
+                 B[b]->Width() <= maxSmallSize;
+      };
+
+    EL_OUTER_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+    {
+        if( !isSmall(b) )
+            continue;
+        const Matrix<F>& ABatch = *A[b];
+        Matrix<F>& BBatch = *B[b];
+        TrsmChunk
+        ( side, uplo, orientation, diag,
+          BBatch.Height(), BBatch.Width(), alpha,
+          ABatch.LockedBuffer(), GetStrides(ABatch),
+          BBatch.Buffer(),       GetStrides(BBatch), 1 );
+    }
+
+    for( Int b=0; b<batchSize; ++b )
+        if( !isSmall(b) )
+            El::Trsm( side, uplo, orientation, diag, alpha, *A[b], *B[b] );
+}
+
+#define PROTO_INT(T) \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const MatrixBatch<T>& A, const MatrixBatch<T>& B, \
+    T beta,        MatrixBatch<T>& C ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const vector<const Matrix<T>*>& A, \
+             const vector<const Matrix<T>*>& B, \
+    T beta,  const vector<Matrix<T>*>& C );
+
+#define PROTO(F) \
+  PROTO_INT(F) \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    F alpha, const MatrixBatch<F>& A, MatrixBatch<F>& B ); \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    F alpha, const vector<const Matrix<F>*>& A, \
+             const vector<Matrix<F>*>& B );
+
+#include "El/macros/Instantiate.h"
+
+} // namespace batched
+} // namespace El
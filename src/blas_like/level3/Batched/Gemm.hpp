@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_BATCHED_GEMM_HPP
+#define EL_BATCHED_GEMM_HPP
+
+namespace El {
+namespace batched {
+
+// C := alpha A B + beta C for each of the 'count' matrices in a chunk, where
+// A and B have already been implicitly transposed via their strides and are
+// optionally conjugated. The batch index is innermost so that the updates
+// vectorize over interleaved matrices.
+template<Int N,bool ConjA,bool ConjB,typename T>
+inline void GemmKernel
+( Int mDyn, Int nDyn, Int kDyn,
+  T alpha, const T* A, const Strides& sA,
+           const T* B, const Strides& sB,
+  T beta,        T* C, const Strides& sC, Int count )
+{
+    const Int m = FixedOr<N>( mDyn );
+    const Int n = FixedOr<N>( nDyn );
+    const Int k = FixedOr<N>( kDyn );
+    const Int aBS = sA.batchStride;
+    const Int bBS = sB.batchStride;
+    const Int cBS = sC.batchStride;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            T* c = &C[i*sC.rowStride+j*sC.colStride];
+            if( beta == T(0) )
+            {
+                for( Int t=0; t<count; ++t )
+                    c[t*cBS] = 0;
+            }
+            else if( beta != T(1) )
+            {
+                for( Int t=0; t<count; ++t )
+                    c[t*cBS] *= beta;
+            }
+        }
+        for( Int l=0; l<k; ++l )
+        {
+            const T* b = &B[l*sB.rowStride+j*sB.colStride];
+            for( Int i=0; i<m; ++i )
+            {
+                const T* a = &A[i*sA.rowStride+l*sA.colStride];
+                T* c = &C[i*sC.rowStride+j*sC.colStride];
+                for( Int t=0; t<count; ++t )
+                {
+                    const T aVal = ( ConjA ? Conj(a[t*aBS]) : a[t*aBS] );
+                    const T bVal = ( ConjB ? Conj(b[t*bBS]) : b[t*bBS] );
+                    c[t*cBS] += alpha*aVal*bVal;
+                }
+            }
+        }
+    }
+}
+
+template<bool ConjA,bool ConjB,typename T>
+struct GemmCall
+{
+    Int m, n, k;
+    T alpha; const T* A; Strides sA;
+             const T* B; Strides sB;
+    T beta;        T* C; Strides sC;
+    Int count;
+
+    template<Int N>
+    void Run() const
+    {
+        GemmKernel<N,ConjA,ConjB>
+        ( m, n, k, alpha, A, sA, B, sB, beta, C, sC, count );
+    }
+};
+
+template<bool ConjA,bool ConjB,typename T>
+inline void GemmChunk
+( Int m, Int n, Int k,
+  T alpha, const T* A, const Strides& sA,
+           const T* B, const Strides& sB,
+  T beta,        T* C, const Strides& sC, Int count )
+{
+    const GemmCall<ConjA,ConjB,T> call =
+      { m, n, k, alpha, A, sA, B, sB, beta, C, sC, count };
+    if( m == n && n == k )
+        DispatchSize( n, call );
+    else
+        call.template Run<0>();
+}
+
+// Orientations are converted into stride swaps and conjugation flags
+template<typename T>
+inline void GemmChunk
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Strides sA,
+           const T* B, Strides sB,
+  T beta,        T* C, const Strides& sC, Int count )
+{
+    if( orientA != NORMAL )
+        sA.Transpose();
+    if( orientB != NORMAL )
+        sB.Transpose();
+    const bool conjA = ( orientA == ADJOINT );
+    const bool conjB = ( orientB == ADJOINT );
+    if( conjA && conjB )
+        GemmChunk<true,true>
+        ( m, n, k, alpha, A, sA, B, sB, beta, C, sC, count );
+    else if( conjA )
+        GemmChunk<true,false>
+        ( m, n, k, alpha, A, sA, B, sB, beta, C, sC, count );
+    else if( conjB )
+        GemmChunk<false,true>
+        ( m, n, k, alpha, A, sA, B, sB, beta, C, sC, count );
+    else
+        GemmChunk<false,false>
+        ( m, n, k, alpha, A, sA, B, sB, beta, C, sC, count );
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_GEMM_HPP
@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_BATCHED_TRSM_HPP
+#define EL_BATCHED_TRSM_HPP
+
+namespace El {
+namespace batched {
+
+// Overwrite each B with alpha inv(A) B, where A is m x m and triangular and
+// has already been implicitly transposed via its strides (and is optionally
+// conjugated), so that all orientations and sides reduce to this case.
+template<Int N,bool Conjugate,typename F>
+inline void TrsmKernel
+( UpperOrLower uplo, UnitOrNonUnit diag,
+  Int mDyn, Int n, F alpha,
+  const F* A, const Strides& sA,
+        F* B, const Strides& sB, Int count )
+{
+    const Int m = FixedOr<N>( mDyn );
+    const Int aBS = sA.batchStride;
+    const Int bBS = sB.batchStride;
+    for( Int j=0; j<n; ++j )
+    {
+        F* bCol = &B[j*sB.colStride];
+        if( alpha != F(1) )
+            for( Int i=0; i<m; ++i )
+                for( Int t=0; t<count; ++t )
+                    bCol[i*sB.rowStride+t*bBS] *= alpha;
+
+        for( Int kStep=0; kStep<m; ++kStep )
+        {
+            const Int k = ( uplo == LOWER ? kStep : m-1-kStep );
+            F* beta1 = &bCol[k*sB.rowStride];
+            if( diag == NON_UNIT )
+            {
+                const F* delta = &A[k*(sA.rowStride+sA.colStride)];
+                for( Int t=0; t<count; ++t )
+                {
+                    const F deltaVal =
+                      ( Conjugate ? Conj(delta[t*aBS]) : delta[t*aBS] );
+                    beta1[t*bBS] /= deltaVal;
+                }
+            }
+            const Int iBeg = ( uplo == LOWER ? k+1 : 0 );
+            const Int iEnd = ( uplo == LOWER ? m   : k );
+            for( Int i=iBeg; i<iEnd; ++i )
+            {
+                const F* a = &A[i*sA.rowStride+k*sA.colStride];
+                F* b = &bCol[i*sB.rowStride];
+                for( Int t=0; t<count; ++t )
+                {
+                    const F aVal = ( Conjugate ? Conj(a[t*aBS]) : a[t*aBS] );
+                    b[t*bBS] -= aVal*beta1[t*bBS];
+                }
+            }
+        }
+    }
+}
+
+template<bool Conjugate,typename F>
+struct TrsmCall
+{
+    UpperOrLower uplo;
+    UnitOrNonUnit diag;
+    Int m, n;
+    F alpha;
+    const F* A; Strides sA;
+          F* B; Strides sB;
+    Int count;
+
+    template<Int N>
+    void Run() const
+    {
+        TrsmKernel<N,Conjugate>
+        ( uplo, diag, m, n, alpha, A, sA, B, sB, count );
+    }
+};
+
+// Solve op(A) X = alpha B or X op(A) = alpha B, where B is m x n. The right
+// side is handled by solving op(A)^T X^T = alpha B^T instead.
+template<typename F>
+inline void TrsmChunk
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n, F alpha,
+  const F* A, Strides sA,
+        F* B, Strides sB, Int count )
+{
+    bool transposeA = ( orientation != NORMAL );
+    bool conjugate = ( orientation == ADJOINT );
+    if( side == RIGHT )
+    {
+        sB.Transpose();
+        std::swap( m, n );
+        transposeA = !transposeA;
+    }
+    if( transposeA )
+    {
+        sA.Transpose();
+        uplo = ( uplo == LOWER ? UPPER : LOWER );
+    }
+    if( conjugate )
+    {
+        const TrsmCall<true,F> call =
+          { uplo, diag, m, n, alpha, A, sA, B, sB, count };
+        DispatchSize( m, call );
+    }
+    else
+    {
+        const TrsmCall<false,F> call =
+          { uplo, diag, m, n, alpha, A, sA, B, sB, count };
+        DispatchSize( m, call );
+    }
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_TRSM_HPP
@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_BATCHED_UTIL_HPP
+#define EL_BATCHED_UTIL_HPP
+
+namespace El {
+namespace batched {
+
+// Matrices in variable-sized batches whose dimensions are all at most this
+// size are handled by the unblocked kernels below; the rest are handed to
+// the standard (blocked, BLAS-backed) routines outside of the threaded loop
+const Int maxSmallSize = 32;
+
+// The number of interleaved matrices which each thread sweeps over within
+// the innermost loops of the kernels
+const Int interleavedChunkSize = 64;
+
+// Every kernel accesses entry (i,j) of the t'th matrix of a chunk of the
+// batch at offset t*batchStride + i*rowStride + j*colStride, so that the
+// strided and interleaved layouts (as well as implicit transposes, which
+// simply swap rowStride and colStride) share a single implementation
+struct Strides
+{
+    Int rowStride, colStride, batchStride;
+
+    void Transpose() { std::swap( rowStride, colStride ); }
+};
+
+template<typename T>
+inline Strides GetStrides( const MatrixBatch<T>& A )
+{
+    Strides strides;
+    if( A.layout == BATCH_STRIDED )
+    {
+        strides.rowStride = 1;
+        strides.colStride = A.ldim;
+        strides.batchStride = A.stride;
+    }
+    else
+    {
+        strides.rowStride = A.batchSize;
+        strides.colStride = A.ldim*A.batchSize;
+        strides.batchStride = 1;
+    }
+    return strides;
+}
+
+template<typename T>
+inline Strides GetStrides( const Matrix<T>& A )
+{
+    Strides strides;
+    strides.rowStride = 1;
+    strides.colStride = A.LDim();
+    strides.batchStride = 0;
+    return strides;
+}
+
+template<typename T>
+inline void AssertValidBatch( const MatrixBatch<T>& A )
+{
+    if( A.batchSize < 0 || A.height < 0 || A.width < 0 )
+        LogicError("Batch dimensions must be non-negative");
+    if( A.ldim < Max(A.height,Int(1)) )
+        LogicError("Leading dimension of batch was too small");
+    if( A.layout == BATCH_STRIDED && A.batchSize > 1 &&
+        A.stride < A.ldim*A.width )
+        LogicError("Stride of batch was too small");
+    if( A.buffer == nullptr && A.batchSize*A.height*A.width != 0 )
+        LogicError("Batch buffer was null");
+}
+
+template<typename T>
+inline void AssertSameLayouts
+( const MatrixBatch<T>& A, const MatrixBatch<T>& B )
+{
+    if( A.batchSize != B.batchSize )
+        LogicError("Batches were of different sizes");
+    if( A.layout != B.layout )
+        LogicError("Batches must have the same layout");
+}
+
+// Allow the kernels to be instantiated with a fixed dimension so that the
+// compiler can fully unroll the loops over tiny matrices (N=0 denotes a
+// dimension only known at runtime)
+template<Int N>
+inline Int FixedOr( Int n ) { return N > 0 ? N : n; }
+
+template<typename Kernel>
+inline void DispatchSize( Int n, const Kernel& kernel )
+{
+    switch( n )
+    {
+    case 1: kernel.template Run<1>(); break;
+    case 2: kernel.template Run<2>(); break;
+    case 3: kernel.template Run<3>(); break;
+    case 4: kernel.template Run<4>(); break;
+    case 5: kernel.template Run<5>(); break;
+    case 6: kernel.template Run<6>(); break;
+    case 7: kernel.template Run<7>(); break;
+    case 8: kernel.template Run<8>(); break;
+    default: kernel.template Run<0>(); break;
+    }
+}
+
+// Apply 'kernel(offset,count)' to contiguous chunks of a batch, where the
+// chunks consist of single matrices for the strided layout and of
+// 'interleavedChunkSize' matrices for the interleaved layout
+template<typename Kernel>
+inline void ForEachChunk
+( Int batchSize, BatchLayout layout, const Kernel& kernel )
+{
+    const Int chunkSize =
+      ( layout == BATCH_STRIDED ? 1 : interleavedChunkSize );
+    const Int numChunks = (batchSize+chunkSize-1) / chunkSize;
+    EL_OUTER_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int offset = chunk*chunkSize;
+        kernel( offset, Min(chunkSize,batchSize-offset) );
+    }
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_UTIL_HPP
@@ -0,0 +1,216 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "./BlockCyclic/Util.hpp"
+
+namespace El {
+
+// These routines work directly upon the local storage of [MC,MR] block
+// distributions, stepping through the inner (or triangular) dimension one
+// block at a time so that every panel is owned by a single process row or
+// column. Operands whose distributions match the output are communicated
+// with a single broadcast per panel; any other operand is gathered.
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractBlockDistMatrix<T>& A,
+           const AbstractBlockDistMatrix<T>& B,
+  T beta,        AbstractBlockDistMatrix<T>& C )
+{
+    DEBUG_ONLY(
+      CSE cse("Gemm");
+      AssertSameGrids( A, B, C );
+      const Int mA = ( orientA == NORMAL ? A.Height() : A.Width() );
+      const Int kA = ( orientA == NORMAL ? A.Width() : A.Height() );
+      const Int kB = ( orientB == NORMAL ? B.Height() : B.Width() );
+      const Int nB = ( orientB == NORMAL ? B.Width() : B.Height() );
+      if( mA != C.Height() || nB != C.Width() || kA != kB )
+          LogicError("Nonconformal block-cyclic Gemm");
+    )
+    block::AssertMCMR( A );
+    block::AssertMCMR( B );
+    block::AssertMCMR( C );
+    const block::Layout rows = block::ColLayout( C );
+    const block::Layout cols = block::RowLayout( C );
+    const block::Layout innerA =
+      ( orientA == NORMAL ? block::RowLayout(A) : block::ColLayout(A) );
+    const block::Layout innerB =
+      ( orientB == NORMAL ? block::ColLayout(B) : block::RowLayout(B) );
+    const Int k = innerA.n;
+
+    Scale( beta, C.Matrix() );
+    Matrix<T> A1, B1;
+    for( Int k0=0; k0<k; )
+    {
+        const Int k1 = Min( innerA.BlockEnd(k0), innerB.BlockEnd(k0) );
+        block::ColPanel( orientA, A, k0, k1, rows, 0, rows.n, A1 );
+        block::RowPanel( orientB, B, k0, k1, cols, 0, cols.n, B1 );
+        Gemm( NORMAL, NORMAL, alpha, A1, B1, T(1), C.Matrix() );
+        k0 = k1;
+    }
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const AbstractBlockDistMatrix<F>& A,
+                 AbstractBlockDistMatrix<F>& B )
+{
+    DEBUG_ONLY(
+      CSE cse("Trsm");
+      AssertSameGrids( A, B );
+      if( A.Height() != A.Width() )
+          LogicError("Triangular matrix must be square");
+      if( A.Height() != (side==LEFT ? B.Height() : B.Width()) )
+          LogicError("Nonconformal block-cyclic Trsm");
+    )
+    block::AssertMCMR( A );
+    block::AssertMCMR( B );
+    const block::Layout rows = block::ColLayout( B );
+    const block::Layout cols = block::RowLayout( B );
+    const block::Layout rowsA = block::ColLayout( A );
+    const block::Layout colsA = block::RowLayout( A );
+    const block::Layout& solve = ( side==LEFT ? rows : cols );
+    const Int n = A.Height();
+    Matrix<F>& BLoc = B.Matrix();
+    Scale( alpha, BLoc );
+
+    // op(A) is lower triangular if exactly one of (uplo==LOWER) and
+    // (orientation==NORMAL) is false; the blocks of X are found in order
+    // from its first row (column) when op(A) (op(A)^T) is lower triangular
+    const bool lowerOpA = ( (uplo==LOWER) == (orientation==NORMAL) );
+    const bool forward = ( side==LEFT ? lowerOpA : !lowerOpA );
+
+    Matrix<F> A11, X1, Z;
+    Int k0 = ( forward ? 0 : n ), k1 = k0;
+    while( forward ? k1 < n : k0 > 0 )
+    {
+        if( forward )
+        {
+            k0 = k1;
+            k1 = Min( solve.BlockEnd(k0),
+                 Min( rowsA.BlockEnd(k0), colsA.BlockEnd(k0) ) );
+        }
+        else
+        {
+            k1 = k0;
+            k0 = Max( solve.BlockBeg(k1-1),
+                 Max( rowsA.BlockBeg(k1-1), colsA.BlockBeg(k1-1) ) );
+        }
+        const Int restBeg = ( forward ? k1 : 0 );
+        const Int restEnd = ( forward ? n : k0 );
+
+        if( side == LEFT )
+        {
+            // Solve against the block row owned by a single process row,
+            // which is the only one which needs the diagonal block of A
+            block::BlockBroadcast
+            ( A, k0, k1, k0, k1, true, rows.Owner(k0), A11 );
+            if( B.ColRank() == rows.Owner(k0) )
+            {
+                auto B1 = View( BLoc, rows.Offset(k0), 0, k1-k0, BLoc.Width() );
+                Trsm( LEFT, uplo, orientation, diag, F(1), A11, B1 );
+            }
+            block::ColBroadcast( B, k0, k1, 0, BLoc.Width(), X1 );
+
+            // B(rest,:) -= op(A)(rest,k0:k1) X1
+            block::ColPanel
+            ( orientation, A, k0, k1, rows, restBeg, restEnd, Z );
+            auto B2 =
+              View
+              ( BLoc, rows.Offset(restBeg), 0,
+                rows.Offset(restEnd)-rows.Offset(restBeg), BLoc.Width() );
+            Gemm( NORMAL, NORMAL, F(-1), Z, X1, F(1), B2 );
+        }
+        else
+        {
+            // Solve against the block column owned by a single process column
+            block::BlockBroadcast
+            ( A, k0, k1, k0, k1, false, cols.Owner(k0), A11 );
+            if( B.RowRank() == cols.Owner(k0) )
+            {
+                auto B1 =
+                  View( BLoc, 0, cols.Offset(k0), BLoc.Height(), k1-k0 );
+                Trsm( RIGHT, uplo, orientation, diag, F(1), A11, B1 );
+            }
+            block::RowBroadcast( B, k0, k1, 0, BLoc.Height(), X1 );
+
+            // B(:,rest) -= X1 op(A)(k0:k1,rest)
+            block::RowPanel
+            ( orientation, A, k0, k1, cols, restBeg, restEnd, Z );
+            auto B2 =
+              View
+              ( BLoc, 0, cols.Offset(restBeg),
+                BLoc.Height(), cols.Offset(restEnd)-cols.Offset(restBeg) );
+            Gemm( NORMAL, NORMAL, F(-1), X1, Z, F(1), B2 );
+        }
+    }
+}
+
+template<typename T>
+void Herk
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const AbstractBlockDistMatrix<T>& A,
+  Base<T> beta,        AbstractBlockDistMatrix<T>& C )
+{
+    DEBUG_ONLY(
+      CSE cse("Herk");
+      AssertSameGrids( A, C );
+      if( orientation == TRANSPOSE )
+          LogicError("Herk accepts NORMAL and ADJOINT orientations");
+      const Int mA = ( orientation == NORMAL ? A.Height() : A.Width() );
+      if( C.Height() != C.Width() || mA != C.Height() )
+          LogicError("Nonconformal block-cyclic Herk");
+    )
+    block::AssertMCMR( A );
+    block::AssertMCMR( C );
+    const block::Layout rows = block::ColLayout( C );
+    const block::Layout cols = block::RowLayout( C );
+    const block::Layout inner =
+      ( orientation == NORMAL ? block::RowLayout(A) : block::ColLayout(A) );
+    Matrix<T>& CLoc = C.Matrix();
+    block::ScaleTriangle( uplo, rows, cols, T(beta), CLoc );
+
+    // Each panel of op(A) is formed in the row distribution of C and then
+    // transposed into its column distribution within each process column
+    Matrix<T> X1, Z1, Y1;
+    for( Int k0=0; k0<inner.n; )
+    {
+        const Int k1 = inner.BlockEnd(k0);
+        block::ColPanel( orientation, A, k0, k1, rows, 0, rows.n, X1 );
+        block::TransposeRows( X1, rows, cols, 0, C.ColComm(), Z1 );
+        Adjoint( Z1, Y1 );
+        block::TriangularUpdate( uplo, rows, cols, 0, T(alpha), X1, Y1, CLoc );
+        k0 = k1;
+    }
+}
+
+#define PROTO(T) \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const AbstractBlockDistMatrix<T>& A, \
+             const AbstractBlockDistMatrix<T>& B, \
+    T beta,        AbstractBlockDistMatrix<T>& C ); \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    T alpha, const AbstractBlockDistMatrix<T>& A, \
+                   AbstractBlockDistMatrix<T>& B ); \
+  template void Herk \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Base<T> alpha, const AbstractBlockDistMatrix<T>& A, \
+    Base<T> beta,        AbstractBlockDistMatrix<T>& C );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -0,0 +1,530 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_BLOCKCYCLIC_UTIL_HPP
+#define EL_BLOCKCYCLIC_UTIL_HPP
+
+namespace El {
+namespace block {
+
+// The distribution of one dimension of an [MC,MR] block-cyclic matrix over
+// the corresponding dimension of the process grid: index i lies in block
+// (i+cut)/bsize, and block b is owned by process (b+align) mod stride.
+// A process's local indices are its global indices in increasing order.
+struct Layout
+{
+    Int n, bsize, cut;
+    int align, stride, rank;
+
+    int Owner( Int i ) const
+    { return int(((i+cut)/bsize+align) % stride); }
+
+    // The number of indices in [0,i) which are owned by process q
+    Int Offset( Int i, int q ) const
+    { return BlockedLength_( i, Shift_(q,align,stride), bsize, cut, stride ); }
+    Int Offset( Int i ) const { return Offset( i, rank ); }
+
+    Int Global( Int iLoc, int q ) const
+    {
+        return GlobalBlockedIndex
+               ( iLoc, Shift_(q,align,stride), bsize, cut, stride );
+    }
+    Int Global( Int iLoc ) const { return Global( iLoc, rank ); }
+
+    // The first index of, and one past the last index of, the block
+    // containing index i
+    Int BlockBeg( Int i ) const
+    { return Max( Int(0), ((i+cut)/bsize)*bsize-cut ); }
+    Int BlockEnd( Int i ) const
+    { return Min( n, ((i+cut)/bsize+1)*bsize-cut ); }
+};
+
+inline bool operator==( const Layout& a, const Layout& b )
+{
+    return a.n == b.n && a.bsize == b.bsize && a.cut == b.cut &&
+           a.align == b.align && a.stride == b.stride && a.rank == b.rank;
+}
+inline bool operator!=( const Layout& a, const Layout& b )
+{ return !(a == b); }
+
+// The distribution of the row indices (i.e., of each column)
+template<typename T>
+inline Layout ColLayout( const AbstractBlockDistMatrix<T>& A )
+{
+    Layout layout;
+    layout.n = A.Height();
+    layout.bsize = A.BlockHeight();
+    layout.cut = A.ColCut();
+    layout.align = A.ColAlign();
+    layout.stride = A.ColStride();
+    layout.rank = A.ColRank();
+    return layout;
+}
+
+// The distribution of the column indices (i.e., of each row)
+template<typename T>
+inline Layout RowLayout( const AbstractBlockDistMatrix<T>& A )
+{
+    Layout layout;
+    layout.n = A.Width();
+    layout.bsize = A.BlockWidth();
+    layout.cut = A.RowCut();
+    layout.align = A.RowAlign();
+    layout.stride = A.RowStride();
+    layout.rank = A.RowRank();
+    return layout;
+}
+
+// A layout which assigns every index to every process
+inline Layout Replicated( Int n )
+{
+    Layout layout;
+    layout.n = n;
+    layout.bsize = Max( n, Int(1) );
+    layout.cut = 0;
+    layout.align = 0;
+    layout.stride = 1;
+    layout.rank = 0;
+    return layout;
+}
+
+template<typename T>
+inline void AssertMCMR( const AbstractBlockDistMatrix<T>& A )
+{
+    if( A.ColDist() != MC || A.RowDist() != MR )
+        LogicError("Only [MC,MR] block distributions are supported");
+}
+
+// Panel communication
+// ===================
+
+// Broadcast the local rows [iLocBeg,iLocEnd) of the columns [j0,j1) of A,
+// which must lie within a single block column, within each process row
+template<typename T>
+inline void RowBroadcast
+( const AbstractBlockDistMatrix<T>& A, Int j0, Int j1,
+  Int iLocBeg, Int iLocEnd, Matrix<T>& X )
+{
+    DEBUG_ONLY(CSE cse("block::RowBroadcast"))
+    const Layout cols = RowLayout( A );
+    const int owner = cols.Owner( j0 );
+    const Int height = iLocEnd - iLocBeg;
+    const Int width = j1 - j0;
+    X.Resize( height, width, Max(height,Int(1)) );
+    if( A.RowRank() == owner )
+        copy::util::InterleaveMatrix
+        ( height, width,
+          A.LockedBuffer(iLocBeg,cols.Offset(j0)), 1, A.LDim(),
+          X.Buffer(),                              1, X.LDim() );
+    mpi::Broadcast( X.Buffer(), height*width, owner, A.RowComm() );
+}
+
+// Broadcast the local columns [jLocBeg,jLocEnd) of the rows [i0,i1) of A,
+// which must lie within a single block row, within each process column
+template<typename T>
+inline void ColBroadcast
+( const AbstractBlockDistMatrix<T>& A, Int i0, Int i1,
+  Int jLocBeg, Int jLocEnd, Matrix<T>& X )
+{
+    DEBUG_ONLY(CSE cse("block::ColBroadcast"))
+    const Layout rows = ColLayout( A );
+    const int owner = rows.Owner( i0 );
+    const Int height = i1 - i0;
+    const Int width = jLocEnd - jLocBeg;
+    X.Resize( height, width, Max(height,Int(1)) );
+    if( A.ColRank() == owner )
+        copy::util::InterleaveMatrix
+        ( height, width,
+          A.LockedBuffer(rows.Offset(i0),jLocBeg), 1, A.LDim(),
+          X.Buffer(),                              1, X.LDim() );
+    mpi::Broadcast( X.Buffer(), height*width, owner, A.ColComm() );
+}
+
+// Form a copy of A(i0:i1,j0:j1), which must lie within a single block, on
+// every process of process row 'team' (if 'toRow') or of process column
+// 'team' (otherwise). The block is first relayed within the owner's process
+// column (row), so that only one process row and one process column take
+// part; the remaining processes return immediately with 'P' untouched.
+template<typename T>
+inline void BlockBroadcast
+( const AbstractBlockDistMatrix<T>& A, Int i0, Int i1, Int j0, Int j1,
+  bool toRow, int team, Matrix<T>& P )
+{
+    DEBUG_ONLY(CSE cse("block::BlockBroadcast"))
+    const Layout rows = ColLayout( A );
+    const Layout cols = RowLayout( A );
+    const int ownerRow = rows.Owner( i0 );
+    const int ownerCol = cols.Owner( j0 );
+    const bool relay =
+      ( toRow ? A.RowRank() == ownerCol : A.ColRank() == ownerRow );
+    const bool member = ( toRow ? A.ColRank() == team : A.RowRank() == team );
+    if( !relay && !member )
+        return;
+
+    const Int height = i1 - i0;
+    const Int width = j1 - j0;
+    P.Resize( height, width, Max(height,Int(1)) );
+    if( A.ColRank() == ownerRow && A.RowRank() == ownerCol )
+        copy::util::InterleaveMatrix
+        ( height, width,
+          A.LockedBuffer(rows.Offset(i0),cols.Offset(j0)), 1, A.LDim(),
+          P.Buffer(),                                      1, P.LDim() );
+    if( toRow )
+    {
+        if( relay && ownerRow != team )
+            mpi::Broadcast( P.Buffer(), height*width, ownerRow, A.ColComm() );
+        if( member )
+            mpi::Broadcast( P.Buffer(), height*width, ownerCol, A.RowComm() );
+    }
+    else
+    {
+        if( relay && ownerCol != team )
+            mpi::Broadcast( P.Buffer(), height*width, ownerCol, A.RowComm() );
+        if( member )
+            mpi::Broadcast( P.Buffer(), height*width, ownerRow, A.ColComm() );
+    }
+}
+
+// Form a full copy of A(i0:i1,j0:j1) on every process in the grid. This is
+// the fallback for operands whose distributions do not match the output.
+template<typename T>
+inline void GatherPanel
+( const AbstractBlockDistMatrix<T>& A,
+  Int i0, Int i1, Int j0, Int j1, Matrix<T>& P )
+{
+    DEBUG_ONLY(CSE cse("block::GatherPanel"))
+    const Layout rows = ColLayout( A );
+    const Layout cols = RowLayout( A );
+    const Int iLocBeg = rows.Offset(i0);
+    const Int jLocBeg = cols.Offset(j0);
+    const Int localHeight = rows.Offset(i1) - iLocBeg;
+    const Int localWidth = cols.Offset(j1) - jLocBeg;
+    vector<T> sendBuf( localHeight*localWidth );
+    copy::util::InterleaveMatrix
+    ( localHeight, localWidth,
+      A.LockedBuffer(iLocBeg,jLocBeg), 1, A.LDim(),
+      sendBuf.data(),                  1, localHeight );
+
+    // The VC rank of process (s,t) of the grid is s + t*gridHeight
+    const int numProcs = rows.stride*cols.stride;
+    vector<int> recvSizes( numProcs );
+    for( int q=0; q<numProcs; ++q )
+    {
+        const int s = q % rows.stride;
+        const int t = q / rows.stride;
+        recvSizes[q] = (rows.Offset(i1,s)-rows.Offset(i0,s))*
+                       (cols.Offset(j1,t)-cols.Offset(j0,t));
+    }
+    vector<int> recvOffs;
+    const Int totalRecv = Scan( recvSizes, recvOffs );
+    vector<T> recvBuf( totalRecv );
+    mpi::AllGather
+    ( sendBuf.data(), localHeight*localWidth,
+      recvBuf.data(), recvSizes.data(), recvOffs.data(),
+      A.Grid().VCComm() );
+
+    P.Resize( i1-i0, j1-j0 );
+    for( int q=0; q<numProcs; ++q )
+    {
+        const int s = q % rows.stride;
+        const int t = q / rows.stride;
+        const Int iLocBegQ = rows.Offset(i0,s);
+        const Int jLocBegQ = cols.Offset(j0,t);
+        const Int heightQ = rows.Offset(i1,s) - iLocBegQ;
+        const Int widthQ = cols.Offset(j1,t) - jLocBegQ;
+        const T* buf = &recvBuf[recvOffs[q]];
+        for( Int jj=0; jj<widthQ; ++jj )
+        {
+            const Int j = cols.Global( jLocBegQ+jj, t );
+            for( Int ii=0; ii<heightQ; ++ii )
+            {
+                const Int i = rows.Global( iLocBegQ+ii, s );
+                P.Set( i-i0, j-j0, buf[ii+jj*heightQ] );
+            }
+        }
+    }
+}
+
+// 'X' holds the rows, with global indices in [beg,from.n), that this
+// process owns under the distribution 'from' over 'comm'. Each process of
+// 'comm' receives, in order, the rows which 'to' assigns to it, so that
+// a panel held in the row distribution of a matrix can be moved to its
+// column distribution (and vice versa) by exchanging only along one
+// dimension of the grid. Every process in 'comm' must share the same
+// rank under 'to'.
+template<typename T>
+inline void TransposeRows
+( const Matrix<T>& X, const Layout& from, const Layout& to, Int beg,
+  mpi::Comm comm, Matrix<T>& Y )
+{
+    DEBUG_ONLY(CSE cse("block::TransposeRows"))
+    const Int n = from.n;
+    const Int width = X.Width();
+    vector<int> recvSizes( from.stride, 0 );
+    Int numRecv = 0;
+    for( Int i=beg; i<n; ++i )
+    {
+        if( to.Owner(i) == to.rank )
+        {
+            ++recvSizes[from.Owner(i)];
+            ++numRecv;
+        }
+    }
+
+    // Pack our contribution row by row
+    const Int iLocBeg = from.Offset(beg);
+    const int sendSize = recvSizes[from.rank]*width;
+    vector<T> sendBuf( sendSize );
+    Int offset = 0;
+    for( Int ii=0; ii<X.Height(); ++ii )
+    {
+        if( to.Owner(from.Global(iLocBeg+ii)) == to.rank )
+        {
+            for( Int t=0; t<width; ++t )
+                sendBuf[offset++] = X.Get(ii,t);
+        }
+    }
+
+    for( int q=0; q<from.stride; ++q )
+        recvSizes[q] *= width;
+    vector<int> recvOffs;
+    const Int totalRecv = Scan( recvSizes, recvOffs );
+    vector<T> recvBuf( totalRecv );
+    mpi::AllGather
+    ( sendBuf.data(), sendSize,
+      recvBuf.data(), recvSizes.data(), recvOffs.data(), comm );
+
+    // Merge the contributions in global order
+    Y.Resize( numRecv, width );
+    Int k = 0;
+    for( Int i=beg; i<n; ++i )
+    {
+        if( to.Owner(i) == to.rank )
+        {
+            const int q = from.Owner(i);
+            const T* row = &recvBuf[recvOffs[q]];
+            for( Int t=0; t<width; ++t )
+                Y.Set( k, t, row[t] );
+            recvOffs[q] += width;
+            ++k;
+        }
+    }
+}
+
+// Apply, to the local columns of a matrix whose rows are distributed by
+// 'rows' over the column communicator 'comm', the permutation of the rows
+// [beg,n) which moves row beg+perm[i] into position beg+i. Only the rows
+// which move are exchanged.
+template<typename T>
+inline void PermuteRows
+( Matrix<T>& ALoc, const Layout& rows, Int beg, const Int* perm,
+  mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("block::PermuteRows"))
+    const Int width = ALoc.Width();
+    vector<int> sendSizes( rows.stride, 0 ), recvSizes( rows.stride, 0 );
+    for( Int i=0; i<rows.n-beg; ++i )
+    {
+        if( perm[i] == i )
+            continue;
+        const int destOwner = rows.Owner( beg+i );
+        const int sourceOwner = rows.Owner( beg+perm[i] );
+        if( sourceOwner == rows.rank )
+            sendSizes[destOwner] += width;
+        if( destOwner == rows.rank )
+            recvSizes[sourceOwner] += width;
+    }
+    vector<int> sendOffs, recvOffs;
+    const Int totalSend = Scan( sendSizes, sendOffs );
+    const Int totalRecv = Scan( recvSizes, recvOffs );
+
+    vector<T> sendBuf( totalSend );
+    auto offs = sendOffs;
+    for( Int i=0; i<rows.n-beg; ++i )
+    {
+        const Int source = beg + perm[i];
+        if( perm[i] == i || rows.Owner(source) != rows.rank )
+            continue;
+        const int destOwner = rows.Owner( beg+i );
+        const Int iLoc = rows.Offset( source );
+        for( Int jLoc=0; jLoc<width; ++jLoc )
+            sendBuf[offs[destOwner]++] = ALoc.Get(iLoc,jLoc);
+    }
+
+    vector<T> recvBuf( totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), sendSizes.data(), sendOffs.data(),
+      recvBuf.data(), recvSizes.data(), recvOffs.data(), comm );
+
+    for( Int i=0; i<rows.n-beg; ++i )
+    {
+        const Int dest = beg + i;
+        if( perm[i] == i || rows.Owner(dest) != rows.rank )
+            continue;
+        const int sourceOwner = rows.Owner( beg+perm[i] );
+        const Int iLoc = rows.Offset( dest );
+        for( Int jLoc=0; jLoc<width; ++jLoc )
+            ALoc.Set( iLoc, jLoc, recvBuf[recvOffs[sourceOwner]++] );
+    }
+}
+
+// Form op(A)(I,k0:k1) for the local indices I of [iBeg,iEnd) under 'rows'.
+// When op(A)=A and A is distributed like 'rows', this is a single broadcast
+// within each process row of the block column containing [k0,k1).
+template<typename T>
+inline void ColPanel
+( Orientation orient, const AbstractBlockDistMatrix<T>& A,
+  Int k0, Int k1, const Layout& rows, Int iBeg, Int iEnd, Matrix<T>& X )
+{
+    DEBUG_ONLY(CSE cse("block::ColPanel"))
+    const Int iLocBeg = rows.Offset(iBeg);
+    const Int iLocEnd = rows.Offset(iEnd);
+    if( orient == NORMAL && ColLayout(A) == rows )
+    {
+        RowBroadcast( A, k0, k1, iLocBeg, iLocEnd, X );
+        return;
+    }
+
+    Matrix<T> P;
+    if( orient == NORMAL )
+        GatherPanel( A, iBeg, iEnd, k0, k1, P );
+    else
+        GatherPanel( A, k0, k1, iBeg, iEnd, P );
+    const bool conjugate = ( orient == ADJOINT );
+    X.Resize( iLocEnd-iLocBeg, k1-k0 );
+    for( Int ii=0; ii<iLocEnd-iLocBeg; ++ii )
+    {
+        const Int i = rows.Global(iLocBeg+ii) - iBeg;
+        for( Int t=0; t<k1-k0; ++t )
+        {
+            if( orient == NORMAL )
+                X.Set( ii, t, P.Get(i,t) );
+            else
+                X.Set( ii, t, conjugate ? Conj(P.Get(t,i)) : P.Get(t,i) );
+        }
+    }
+}
+
+// Form op(A)(k0:k1,J) for the local indices J of [jBeg,jEnd) under 'cols'
+template<typename T>
+inline void RowPanel
+( Orientation orient, const AbstractBlockDistMatrix<T>& A,
+  Int k0, Int k1, const Layout& cols, Int jBeg, Int jEnd, Matrix<T>& Y )
+{
+    DEBUG_ONLY(CSE cse("block::RowPanel"))
+    const Int jLocBeg = cols.Offset(jBeg);
+    const Int jLocEnd = cols.Offset(jEnd);
+    if( orient == NORMAL && RowLayout(A) == cols )
+    {
+        ColBroadcast( A, k0, k1, jLocBeg, jLocEnd, Y );
+        return;
+    }
+
+    Matrix<T> P;
+    if( orient == NORMAL )
+        GatherPanel( A, k0, k1, jBeg, jEnd, P );
+    else
+        GatherPanel( A, jBeg, jEnd, k0, k1, P );
+    const bool conjugate = ( orient == ADJOINT );
+    Y.Resize( k1-k0, jLocEnd-jLocBeg );
+    for( Int jj=0; jj<jLocEnd-jLocBeg; ++jj )
+    {
+        const Int j = cols.Global(jLocBeg+jj) - jBeg;
+        for( Int t=0; t<k1-k0; ++t )
+        {
+            if( orient == NORMAL )
+                Y.Set( t, jj, P.Get(t,j) );
+            else
+                Y.Set( t, jj, conjugate ? Conj(P.Get(j,t)) : P.Get(j,t) );
+        }
+    }
+}
+
+// Local updates
+// =============
+
+// Scale the local entries of C in the 'uplo' triangle by beta
+template<typename T>
+inline void ScaleTriangle
+( UpperOrLower uplo, const Layout& rows, const Layout& cols,
+  T beta, Matrix<T>& C )
+{
+    if( beta == T(1) )
+        return;
+    const Int localHeight = C.Height();
+    for( Int jLoc=0; jLoc<C.Width(); ++jLoc )
+    {
+        const Int j = cols.Global(jLoc);
+        const Int iLocBeg = ( uplo==LOWER ? rows.Offset(j) : 0 );
+        const Int iLocEnd = ( uplo==LOWER ? localHeight : rows.Offset(j+1) );
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            C.Set( iLoc, jLoc, beta*C.Get(iLoc,jLoc) );
+    }
+}
+
+// C(I,J) += alpha X Y over the 'uplo' triangle, where I and J are the local
+// indices (under 'rows' and 'cols') of [beg,n). Each block column of C is
+// updated with one GEMM, apart from the few rows which it shares with the
+// diagonal.
+template<typename T>
+inline void TriangularUpdate
+( UpperOrLower uplo, const Layout& rows, const Layout& cols, Int beg,
+  T alpha, const Matrix<T>& X, const Matrix<T>& Y, Matrix<T>& C )
+{
+    DEBUG_ONLY(CSE cse("block::TriangularUpdate"))
+    const Int iLocBeg = rows.Offset(beg);
+    const Int jLocBeg = cols.Offset(beg);
+    const Int height = X.Height();
+    const Int width = Y.Width();
+    const Int k = X.Width();
+    Matrix<T> Z;
+    for( Int jj=0; jj<width; )
+    {
+        const Int j0 = cols.Global(jLocBeg+jj);
+        const Int nb = cols.BlockEnd(j0) - j0;
+        const Int iiDiagBeg = rows.Offset(j0) - iLocBeg;
+        const Int iiDiagEnd = rows.Offset(j0+nb) - iLocBeg;
+        auto Y1 = LockedView( Y, 0, jj, k, nb );
+
+        // The rows lying entirely within the triangle
+        const Int iiBeg = ( uplo==LOWER ? iiDiagEnd : 0 );
+        const Int iiEnd = ( uplo==LOWER ? height : iiDiagBeg );
+        if( iiEnd > iiBeg )
+        {
+            auto X1 = LockedView( X, iiBeg, 0, iiEnd-iiBeg, k );
+            auto C1 = View( C, iLocBeg+iiBeg, jLocBeg+jj, iiEnd-iiBeg, nb );
+            Gemm( NORMAL, NORMAL, alpha, X1, Y1, T(1), C1 );
+        }
+
+        // The rows which intersect the diagonal
+        if( iiDiagEnd > iiDiagBeg )
+        {
+            auto X1 = LockedView( X, iiDiagBeg, 0, iiDiagEnd-iiDiagBeg, k );
+            Gemm( NORMAL, NORMAL, alpha, X1, Y1, Z );
+            for( Int jSub=0; jSub<nb; ++jSub )
+            {
+                for( Int iSub=0; iSub<iiDiagEnd-iiDiagBeg; ++iSub )
+                {
+                    const Int i = rows.Global(iLocBeg+iiDiagBeg+iSub);
+                    const Int j = j0 + jSub;
+                    if( (uplo==LOWER && i >= j) || (uplo==UPPER && i <= j) )
+                        C.Update
+                        ( iLocBeg+iiDiagBeg+iSub, jLocBeg+jj+jSub,
+                          Z.Get(iSub,jSub) );
+                }
+            }
+        }
+        jj += nb;
+    }
+}
+
+} // namespace block
+} // namespace El
+
+#endif // ifndef EL_BLOCKCYCLIC_UTIL_HPP
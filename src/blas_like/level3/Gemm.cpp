@@ -90,6 +90,9 @@ void Gemm
 {
     DEBUG_ONLY(CSE cse("Gemm"))
     C *= beta;
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    BlocksizeStackEntry bse
+    ( RegimeBlocksize(Max(Max(C.Height(),C.Width()),k)) );
     if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
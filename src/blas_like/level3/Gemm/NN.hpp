@@ -341,8 +341,8 @@ SUMMA_NN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
+    const double weightTowardsC = GemmWeightTowardsC<T>();
+    const double weightAwayFromDot = GemmWeightAwayFromDot<T>();
 
     switch( alg )
     {
@@ -181,7 +181,7 @@ SUMMA_NT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int k = A.Width();
-    const double weightTowardsC = 2.;
+    const double weightTowardsC = GemmWeightTowardsC<T>();
 
     switch( alg )
     {
@@ -174,7 +174,7 @@ SUMMA_TN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int k = A.Height();
-    const double weightTowardsC = 2.;
+    const double weightTowardsC = GemmWeightTowardsC<T>();
 
     switch( alg )
     {
@@ -187,7 +187,7 @@ SUMMA_TT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
+    const double weightTowardsC = GemmWeightTowardsC<T>();
 
     switch( alg )
     {
@@ -10,37 +10,84 @@
 namespace El {
 namespace mstrsm {
 
+// Solve against a single shifted triangular matrix, op(T - mu I), without
+// modifying T so that the shifts may be processed simultaneously
+template<typename F>
+inline void
+ShiftedTrsv
+( UpperOrLower uplo, Orientation orientation,
+  Int n, const F* T, Int ldim, F mu, F* x )
+{
+    if( orientation == NORMAL )
+    {
+        if( uplo == UPPER )
+        {
+            for( Int i=n-1; i>=0; --i )
+            {
+                x[i] /= T[i+i*ldim] - mu;
+                blas::Axpy( i, -x[i], &T[i*ldim], 1, x, 1 );
+            }
+        }
+        else
+        {
+            for( Int i=0; i<n; ++i )
+            {
+                x[i] /= T[i+i*ldim] - mu;
+                blas::Axpy
+                ( n-(i+1), -x[i], &T[(i+1)+i*ldim], 1, &x[i+1], 1 );
+            }
+        }
+    }
+    else
+    {
+        // The i'th row of op(T) is the (conjugated) i'th column of T
+        const bool conjugate = ( orientation == ADJOINT );
+        if( uplo == UPPER )
+        {
+            for( Int i=0; i<n; ++i )
+            {
+                const F* t = &T[i*ldim];
+                const F gamma = 
+                  ( conjugate ? blas::Dot( i, t, 1, x, 1 )
+                              : blas::Dotu( i, t, 1, x, 1 ) );
+                const F delta = T[i+i*ldim] - mu;
+                x[i] = (x[i]-gamma) / ( conjugate ? Conj(delta) : delta );
+            }
+        }
+        else
+        {
+            for( Int i=n-1; i>=0; --i )
+            {
+                const F* t = &T[(i+1)+i*ldim];
+                const F gamma = 
+                  ( conjugate ? blas::Dot( n-(i+1), t, 1, &x[i+1], 1 )
+                              : blas::Dotu( n-(i+1), t, 1, &x[i+1], 1 ) );
+                const F delta = T[i+i*ldim] - mu;
+                x[i] = (x[i]-gamma) / ( conjugate ? Conj(delta) : delta );
+            }
+        }
+    }
+}
+
 template<typename F>
 inline void
 LeftUnb
 ( UpperOrLower uplo, Orientation orientation,
-  Matrix<F>& T, const Matrix<F>& shifts, Matrix<F>& X ) 
+  const Matrix<F>& T, const Matrix<F>& shifts, Matrix<F>& X ) 
 {
     DEBUG_ONLY(
         CSE cse("mstrsm::LeftUnb");
         if( shifts.Height() != X.Width() )
             LogicError("Incompatible number of shifts");
     )
-    const char uploChar = ( uplo==LOWER ? 'L' : 'U' );
-    char orientChar; 
-    switch( orientation )
-    {
-    case NORMAL:    orientChar = 'N'; break;
-    case TRANSPOSE: orientChar = 'T'; break;
-    default:        orientChar = 'C';
-    }
-    auto diag = GetDiagonal(T);
     const Int n = T.Height();
     const Int ldim = T.LDim();
     const Int numShifts = shifts.Height();
+    const F* TBuf = T.LockedBuffer();
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
-    {
-        ShiftDiagonal( T, -shifts.Get(j,0) );
-        blas::Trsv
-        ( uploChar, orientChar, 'N', n, 
-          T.LockedBuffer(), ldim, X.Buffer(0,j), 1 );
-        SetDiagonal( T, diag );
-    }
+        ShiftedTrsv
+        ( uplo, orientation, n, TBuf, ldim, shifts.Get(j,0), X.Buffer(0,j) );
 }
 
 template<typename F>
@@ -433,6 +433,13 @@ extern "C" {
   ElError ElDistMatrixQueueUpdate_ ## SIG \
   ( ElDistMatrix_ ## SIG A, ElInt i, ElInt j, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->QueueUpdate(i,j,CReflect(value)) ) } \
+  /* void QueueUpdates \
+     ( Int numEntries, const Int* rows, const Int* cols, const T* values ) */ \
+  ElError ElDistMatrixQueueUpdates_ ## SIG \
+  ( ElDistMatrix_ ## SIG A, ElInt numEntries, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      CReflect(A)->QueueUpdates(numEntries,rows,cols,CReflect(values)) ) } \
   /* void ProcessQueues() */ \
   ElError ElDistMatrixProcessQueues_ ## SIG( ElDistMatrix_ ## SIG A ) \
   { EL_TRY( CReflect(A)->ProcessQueues() ) } \
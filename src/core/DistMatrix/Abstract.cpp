@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "../PullQueue.hpp"
 
 namespace El {
 
@@ -1016,6 +1017,27 @@ template<typename T>
 void AbstractDistMatrix<T>::QueueUpdate( Int i, Int j, T value )
 { QueueUpdate( Entry<T>{i,j,value} ); }
 
+template<typename T>
+void AbstractDistMatrix<T>::QueueUpdates
+( Int numEntries, const Int* rows, const Int* cols, const T* values )
+{
+    DEBUG_ONLY(CSE cse("AbstractDistMatrix::QueueUpdates"))
+    // Reserve space for the remote portion of the batch up front, but grow
+    // geometrically so that repeatedly queueing small batches remains
+    // linear-time
+    Int numRemote = 0;
+    for( Int k=0; k<numEntries; ++k )
+        if( !IsLocal(rows[k],cols[k]) )
+            ++numRemote;
+    const Int capacity = remoteUpdates_.capacity();
+    const Int numNeeded = remoteUpdates_.size() + numRemote;
+    if( numNeeded > capacity )
+        Reserve( Max(numNeeded,2*capacity) );
+
+    for( Int k=0; k<numEntries; ++k )
+        QueueUpdate( Entry<T>{rows[k],cols[k],values[k]} );
+}
+
 template<typename T>
 void AbstractDistMatrix<T>::ProcessQueues()
 {
@@ -1063,6 +1085,44 @@ void AbstractDistMatrix<T>::ProcessQueues()
         Update( entry );
 }
 
+// Batch remote pulls
+// ------------------
+template<typename T>
+void AbstractDistMatrix<T>::ReservePulls( Int numPulls ) const
+{
+    DEBUG_ONLY(CSE cse("AbstractDistMatrix::ReservePulls"))
+    remotePulls_.reserve( numPulls );
+}
+
+template<typename T>
+void AbstractDistMatrix<T>::QueuePull( Int i, Int j ) const
+{
+    DEBUG_ONLY(
+      CSE cse("AbstractDistMatrix::QueuePull");
+      AssertValidEntry( i, j );
+    )
+    remotePulls_.push_back( pair<Int,Int>(i,j) );
+}
+
+template<typename T>
+void AbstractDistMatrix<T>::ProcessPullQueue( vector<T>& pullBuf ) const
+{
+    DEBUG_ONLY(CSE cse("AbstractDistMatrix::ProcessPullQueue"))
+    const auto& g = Grid();
+    ProcessPulls
+    ( remotePulls_, pullBuf,
+      [&]( Int i, Int j )
+      {
+          if( IsLocal(i,j) )
+              return -1;
+          return g.VCToViewing
+                 ( g.CoordsToVC(ColDist(),RowDist(),Owner(i,j),Root()) );
+      },
+      [&]( Int i, Int j ) { return GetLocal( LocalRow(i), LocalCol(j) ); },
+      g.ViewingComm() );
+    SwapClear( remotePulls_ );
+}
+
 // Local entry manipulation
 // ------------------------
 
@@ -27,9 +27,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [MC,MR]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -37,9 +35,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [MC,STAR]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -47,9 +43,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [STAR,MR]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -57,9 +51,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [STAR,MD]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -67,9 +59,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [MR,MC]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -77,9 +67,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [MR,STAR]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -87,9 +75,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [STAR,MC]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -97,9 +83,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [VC,STAR]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -107,9 +91,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [STAR,VC]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -117,9 +99,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [VR,STAR]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -127,9 +107,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 {
     DEBUG_ONLY(CSE cse("[MD,STAR] = [STAR,VR]"))
-    // TODO: More efficient implementation?
-    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    copy::GeneralPurpose( A, *this );
     return *this;
 }
 
@@ -83,6 +83,13 @@ extern "C" {
   ElError ElDistMultiVecQueueUpdate_ ## SIG \
   ( ElDistMultiVec_ ## SIG A, ElInt i, ElInt j, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->QueueUpdate(i,j,CReflect(value)) ) } \
+  /* void QueueUpdates \
+     ( Int numEntries, const Int* rows, const Int* cols, const T* values ) */ \
+  ElError ElDistMultiVecQueueUpdates_ ## SIG \
+  ( ElDistMultiVec_ ## SIG A, ElInt numEntries, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      CReflect(A)->QueueUpdates(numEntries,rows,cols,CReflect(values)) ) } \
   /* void ProcessQueues() */ \
   ElError ElDistMultiVecProcessQueues_ ## SIG( ElDistMultiVec_ ## SIG A ) \
   { EL_TRY( CReflect(A)->ProcessQueues() ) }
@@ -9,6 +9,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "./PullQueue.hpp"
 
 namespace El {
 
@@ -330,6 +331,19 @@ template<typename T>
 void DistMultiVec<T>::QueueUpdate( Int i, Int j, T value )
 { QueueUpdate( Entry<T>{i,j,value} ); }
 
+template<typename T>
+void DistMultiVec<T>::QueueUpdates
+( Int numEntries, const Int* rows, const Int* cols, const T* values )
+{
+    DEBUG_ONLY(CSE cse("DistMultiVec::QueueUpdates"))
+    const Int capacity = remoteUpdates_.capacity();
+    const Int numNeeded = remoteUpdates_.size() + numEntries;
+    if( numNeeded > capacity )
+        Reserve( Max(numNeeded,2*capacity) );
+    for( Int k=0; k<numEntries; ++k )
+        remoteUpdates_.push_back( Entry<T>{rows[k],cols[k],values[k]} );
+}
+
 template<typename T>
 void DistMultiVec<T>::ProcessQueues()
 {
@@ -357,6 +371,40 @@ void DistMultiVec<T>::ProcessQueues()
         Update( entry );
 }
 
+// Batch remote pulls
+// ------------------
+template<typename T>
+void DistMultiVec<T>::ReservePulls( Int numPulls ) const
+{
+    DEBUG_ONLY(CSE cse("DistMultiVec::ReservePulls"))
+    remotePulls_.reserve( numPulls );
+}
+
+template<typename T>
+void DistMultiVec<T>::QueuePull( Int i, Int j ) const
+{
+    DEBUG_ONLY(
+      CSE cse("DistMultiVec::QueuePull");
+      if( i < 0 || i >= height_ || j < 0 || j >= width_ )
+          LogicError
+          ("Entry (",i,",",j,") is out of bounds of ",height_," x ",width_,
+           " DistMultiVec");
+    )
+    remotePulls_.push_back( pair<Int,Int>(i,j) );
+}
+
+template<typename T>
+void DistMultiVec<T>::ProcessPullQueue( vector<T>& pullBuf ) const
+{
+    DEBUG_ONLY(CSE cse("DistMultiVec::ProcessPullQueue"))
+    ProcessPulls
+    ( remotePulls_, pullBuf,
+      [&]( Int i, Int j ) { return ( IsLocal(i,j) ? -1 : Owner(i,j) ); },
+      [&]( Int i, Int j ) { return GetLocal( LocalRow(i), j ); },
+      comm_ );
+    SwapClear( remotePulls_ );
+}
+
 #define PROTO(T) template class DistMultiVec<T>;
 
 #define EL_ENABLE_QUAD
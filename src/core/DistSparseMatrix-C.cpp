@@ -53,6 +53,25 @@ extern "C" {
   ( ElDistSparseMatrix_ ## SIG A, \
     ElInt localRow, ElInt col, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->QueueLocalUpdate(localRow,col,CReflect(value)) ) } \
+  ElError ElDistSparseMatrixQueueUpdates_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt numEntries, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values, \
+    bool passive ) \
+  { EL_TRY( \
+      CReflect(A)->QueueUpdates \
+      (numEntries,rows,cols,CReflect(values),passive) ) } \
+  ElError ElDistSparseMatrixQueueLocalUpdates_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt numEntries, \
+    const ElInt* localRows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      CReflect(A)->QueueLocalUpdates \
+      (numEntries,localRows,cols,CReflect(values)) ) } \
+  ElError ElDistSparseMatrixImportLocalCSR_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, \
+    const ElInt* localRowOffsets, const ElInt* cols, \
+    const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      CReflect(A)->ImportLocalCSR(localRowOffsets,cols,CReflect(values)) ) } \
   ElError ElDistSparseMatrixQueueZero_ ## SIG \
   ( ElDistSparseMatrix_ ## SIG A, ElInt row, ElInt col, bool passive ) \
   { EL_TRY( CReflect(A)->QueueZero(row,col,passive) ) } \
@@ -72,6 +72,9 @@ void DistSparseMatrix<T>::Empty( bool clearMemory )
 template<typename T>
 void DistSparseMatrix<T>::Resize( Int height, Int width )
 {
+    DEBUG_ONLY(CSE cse("DistSparseMatrix::Resize"))
+    if( Height() == height && Width() == width )
+        return;
     distGraph_.Resize( height, width );
     vals_.resize( 0 );
 }
@@ -219,6 +222,123 @@ void DistSparseMatrix<T>::QueueLocalZero( Int localRow, Int col )
     }
 }
 
+template<typename T>
+void DistSparseMatrix<T>::QueueUpdates
+( Int numEntries, const Int* rows, const Int* cols, const T* values,
+  bool passive )
+{
+    DEBUG_ONLY(CSE cse("DistSparseMatrix::QueueUpdates"))
+    if( !FrozenSparsity() )
+    {
+        // Reserve space for the whole batch up front, but grow geometrically
+        // so that repeatedly queueing small batches remains linear-time
+        const Int firstLocalRow = FirstLocalRow();
+        const Int localHeight = LocalHeight();
+        Int numLocal = 0;
+        for( Int k=0; k<numEntries; ++k )
+            if( rows[k] >= firstLocalRow &&
+                rows[k] < firstLocalRow+localHeight )
+                ++numLocal;
+        const Int numRemote = ( passive ? 0 : numEntries-numLocal );
+        const Int localCapacity = vals_.capacity();
+        const Int remoteCapacity = remoteVals_.capacity();
+        const Int numLocalNeeded = vals_.size() + numLocal;
+        const Int numRemoteNeeded = remoteVals_.size() + numRemote;
+        if( numLocalNeeded > localCapacity || numRemoteNeeded > remoteCapacity )
+            Reserve
+            ( ( numLocalNeeded > localCapacity ?
+                Max(numLocalNeeded,2*localCapacity) : localCapacity ),
+              ( numRemoteNeeded > remoteCapacity ?
+                Max(numRemoteNeeded,2*remoteCapacity) : remoteCapacity ) );
+    }
+    for( Int k=0; k<numEntries; ++k )
+        QueueUpdate( rows[k], cols[k], values[k], passive );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::QueueLocalUpdates
+( Int numEntries, const Int* localRows, const Int* cols, const T* values )
+{
+    DEBUG_ONLY(CSE cse("DistSparseMatrix::QueueLocalUpdates"))
+    if( !FrozenSparsity() )
+    {
+        const Int capacity = vals_.capacity();
+        const Int numNeeded = vals_.size() + numEntries;
+        if( numNeeded > capacity )
+            Reserve( Max(numNeeded,2*capacity), remoteVals_.capacity() );
+    }
+    for( Int k=0; k<numEntries; ++k )
+        QueueLocalUpdate( localRows[k], cols[k], values[k] );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::ImportLocalCSR
+( const Int* localRowOffsets, const Int* cols, const T* values )
+{
+    DEBUG_ONLY(CSE cse("DistSparseMatrix::ImportLocalCSR"))
+    const Int firstLocalRow = FirstLocalRow();
+    const Int localHeight = LocalHeight();
+    if( localRowOffsets[0] != 0 )
+        LogicError("The first local row offset must be zero");
+    const Int numLocalEntries = localRowOffsets[localHeight];
+
+    if( FrozenSparsity() )
+    {
+        // Only the values may change, so the block must have exactly the
+        // existing sparsity pattern
+        const auto& offsets = distGraph_.localSourceOffsets_;
+        const auto& targets = distGraph_.targets_;
+        if( !distGraph_.locallyConsistent_ ||
+            Int(offsets.size()) != localHeight+1 ||
+            numLocalEntries != Int(targets.size()) ||
+            !std::equal( localRowOffsets, localRowOffsets+localHeight+1,
+                         offsets.begin() ) ||
+            !std::equal( cols, cols+numLocalEntries, targets.begin() ) )
+            LogicError
+            ("Imported CSR block did not match the frozen sparsity pattern");
+        vals_.assign( values, values+numLocalEntries );
+        return;
+    }
+
+    // Invalid columns would silently corrupt every subsequent operation, so
+    // they are checked (before anything is overwritten) even in release builds
+    const Int width = Width();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int rowBeg = localRowOffsets[iLoc];
+        const Int rowEnd = localRowOffsets[iLoc+1];
+        if( rowEnd < rowBeg )
+            LogicError("Local row offsets were not non-decreasing");
+        for( Int e=rowBeg; e<rowEnd; ++e )
+        {
+            if( cols[e] < 0 || cols[e] >= width )
+                LogicError("Column ",cols[e]," was not in [0,",width,")");
+            if( e > rowBeg && cols[e] <= cols[e-1] )
+                LogicError
+                ("Columns of local row ",iLoc," were not sorted and unique");
+        }
+    }
+
+    auto& sources = distGraph_.sources_;
+    sources.resize( numLocalEntries );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        for( Int e=localRowOffsets[iLoc]; e<localRowOffsets[iLoc+1]; ++e )
+            sources[e] = firstLocalRow + iLoc;
+    distGraph_.targets_.assign( cols, cols+numLocalEntries );
+    vals_.assign( values, values+numLocalEntries );
+    distGraph_.localSourceOffsets_.assign
+    ( localRowOffsets, localRowOffsets+localHeight+1 );
+
+    // Discard any updates and removals which were queued before the import
+    SwapClear( distGraph_.markedForRemoval_ );
+    SwapClear( distGraph_.remoteSources_ );
+    SwapClear( distGraph_.remoteTargets_ );
+    SwapClear( distGraph_.remoteRemovals_ );
+    SwapClear( remoteVals_ );
+    distGraph_.locallyConsistent_ = true;
+    multMeta.ready = false;
+}
+
 template<typename T>
 void DistSparseMatrix<T>::ProcessQueues()
 {
@@ -8,6 +8,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "El/blas_like/level1/copy_internal.hpp"
 
 namespace El {
 
@@ -177,6 +178,8 @@ void Grid::SetUpGrid()
 
 Grid::~Grid()
 {
+    // Redistribution patterns are keyed on the address of the grid
+    copy::ClearGeneralPurposePlans( this );
     if( !mpi::Finalized() )
     {
         if( InGrid() )
@@ -297,13 +300,15 @@ int Grid::CoordsToVC
     else if( (colDist == MC && rowDist == STAR) || 
              (rowDist == MC && colDist == STAR) )
     {
-        return distRank + redundantRank*Width();
+        return distRank + redundantRank*Height();
     }
     else if( (colDist == MD && rowDist == STAR) ||
              (rowDist == MD && colDist == STAR) )
     {
-        const int row =         DiagRank()  % Height();
-        const int col = (Diag()+DiagRank()) % Width();
+        // The distRank'th process along the diagonal which begins at
+        // (0,crossRank)
+        const int row =            distRank  % Height();
+        const int col = (crossRank+distRank) % Width();
         return row + col*Height();
     }
     else if( colDist == MR && rowDist == MC )
@@ -313,7 +318,7 @@ int Grid::CoordsToVC
     else if( (colDist == MR && rowDist == STAR) ||
              (rowDist == MR && colDist == STAR) )
     {
-        return redundantRank + distRank*Width();
+        return redundantRank + distRank*Height();
     }
     else if( colDist == STAR && rowDist == STAR )
     {
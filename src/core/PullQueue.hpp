@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CORE_PULLQUEUE_HPP
+#define EL_CORE_PULLQUEUE_HPP
+
+namespace El {
+
+// Answer a queue of requested (i,j) entries in the order in which they were
+// queued. 'remoteOwner(i,j)' should return the rank within 'comm' of the
+// process to request the entry from, or -1 if the entry is local, and
+// 'getLocal(i,j)' should return a locally-stored entry. The remote requests
+// are answered with one exchange of counts, one of indices, and one of values.
+template<typename T,typename OwnerFunctor,typename GetFunctor>
+inline void ProcessPulls
+( const vector<pair<Int,Int>>& pulls, vector<T>& pullBuf,
+  OwnerFunctor remoteOwner, GetFunctor getLocal, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("ProcessPulls"))
+    const int commSize = mpi::Size( comm );
+    const Int numPulls = pulls.size();
+    pullBuf.resize( numPulls );
+
+    // Answer the local requests and count the remote ones
+    // ===================================================
+    vector<int> owners(numPulls), sendCounts(commSize,0);
+    for( Int k=0; k<numPulls; ++k )
+    {
+        const Int i = pulls[k].first;
+        const Int j = pulls[k].second;
+        owners[k] = remoteOwner( i, j );
+        if( owners[k] < 0 )
+            pullBuf[k] = getLocal( i, j );
+        else
+            ++sendCounts[owners[k]];
+    }
+    vector<int> recvCounts(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    vector<int> sendOffs, recvOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+
+    // Pack and exchange the requested indices
+    // =======================================
+    vector<Int> sendInds(2*totalSend);
+    auto offs = sendOffs;
+    for( Int k=0; k<numPulls; ++k )
+    {
+        if( owners[k] >= 0 )
+        {
+            const Int s = offs[owners[k]]++;
+            sendInds[2*s  ] = pulls[k].first;
+            sendInds[2*s+1] = pulls[k].second;
+        }
+    }
+    vector<int> sendIndCounts(commSize), sendIndOffs(commSize),
+                recvIndCounts(commSize), recvIndOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendIndCounts[q] = 2*sendCounts[q];
+        sendIndOffs[q] = 2*sendOffs[q];
+        recvIndCounts[q] = 2*recvCounts[q];
+        recvIndOffs[q] = 2*recvOffs[q];
+    }
+    vector<Int> recvInds(2*totalRecv);
+    mpi::AllToAll
+    ( sendInds.data(), sendIndCounts.data(), sendIndOffs.data(),
+      recvInds.data(), recvIndCounts.data(), recvIndOffs.data(), comm );
+    SwapClear( sendInds );
+
+    // Answer the requests and return the results
+    // ==========================================
+    vector<T> sendVals(totalRecv);
+    for( Int s=0; s<totalRecv; ++s )
+        sendVals[s] = getLocal( recvInds[2*s], recvInds[2*s+1] );
+    SwapClear( recvInds );
+    vector<T> recvVals(totalSend);
+    mpi::AllToAll
+    ( sendVals.data(), recvCounts.data(), recvOffs.data(),
+      recvVals.data(), sendCounts.data(), sendOffs.data(), comm );
+
+    // Unpack in the order in which the entries were queued
+    // ====================================================
+    offs = sendOffs;
+    for( Int k=0; k<numPulls; ++k )
+        if( owners[k] >= 0 )
+            pullBuf[k] = recvVals[offs[owners[k]]++];
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_PULLQUEUE_HPP
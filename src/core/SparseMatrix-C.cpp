@@ -34,6 +34,11 @@ extern "C" {
   ElError ElSparseMatrixQueueUpdate_ ## SIG \
   ( ElSparseMatrix_ ## SIG A, ElInt row, ElInt col, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->QueueUpdate(row,col,CReflect(value)) ) } \
+  ElError ElSparseMatrixQueueUpdates_ ## SIG \
+  ( ElSparseMatrix_ ## SIG A, ElInt numEntries, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      CReflect(A)->QueueUpdates(numEntries,rows,cols,CReflect(values)) ) } \
   ElError ElSparseMatrixQueueZero_ ## SIG \
   ( ElSparseMatrix_ ## SIG A, ElInt row, ElInt col ) \
   { EL_TRY( CReflect(A)->QueueZero(row,col) ) } \
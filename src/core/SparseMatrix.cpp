@@ -314,6 +314,23 @@ template<typename T>
 bool SparseMatrix<T>::CompareEntries( const Entry<T>& a, const Entry<T>& b )
 { return a.i < b.i || (a.i == b.i && a.j < b.j); }
 
+template<typename T>
+void SparseMatrix<T>::QueueUpdates
+( Int numEntries, const Int* rows, const Int* cols, const T* values )
+{
+    DEBUG_ONLY(CSE cse("SparseMatrix::QueueUpdates"))
+    if( !FrozenSparsity() )
+    {
+        // Grow geometrically so that queueing many small batches stays cheap
+        const Int capacity = Capacity();
+        const Int numNeeded = NumEntries() + numEntries;
+        if( numNeeded > capacity )
+            Reserve( Max(numNeeded,2*capacity) );
+    }
+    for( Int k=0; k<numEntries; ++k )
+        QueueUpdate( rows[k], cols[k], values[k] );
+}
+
 template<typename T>
 void SparseMatrix<T>::ProcessQueues()
 {
@@ -8,6 +8,8 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "El/blas_like/level1/copy_internal.hpp"
+#include <map>
 #ifdef EL_HAVE_QT5
  #include <QApplication>
 #endif
@@ -19,6 +21,9 @@ Int numElemInits = 0;
 bool elemInitializedMpi = false;
 
 std::stack<Int> blocksizeStack;
+std::map<Int,Int> blocksizeRegimes;
+// Whether the blocksize was explicitly set with SetBlocksize
+bool blocksizeSet = false;
 Grid* defaultGrid = 0;
 Args* args = 0;
 
@@ -58,6 +63,16 @@ Int localTrrkDoubleBlocksize = 64;
 Int localTrrkComplexFloatBlocksize = 64;
 Int localTrrkComplexDoubleBlocksize = 64;
 
+// Crossover weights for the GEMM_DEFAULT choice between the SUMMA variants
+template<typename T>
+struct GemmWeights
+{
+    static double towardsC;
+    static double awayFromDot;
+};
+template<typename T> double GemmWeights<T>::towardsC = 2.;
+template<typename T> double GemmWeights<T>::awayFromDot = 10.;
+
 // Qt5
 ColorMap colorMap=RED_BLACK_GREEN;
 Int numDiscreteColors = 15;
@@ -349,6 +364,8 @@ void Initialize( int& argc, char**& argv )
     while( ! ::blocksizeStack.empty() )
         ::blocksizeStack.pop();
     ::blocksizeStack.push( 128 );
+    ::blocksizeRegimes.clear();
+    ::blocksizeSet = false;
 
     // Build the default grid
     defaultGrid = new Grid( mpi::COMM_WORLD );
@@ -363,6 +380,11 @@ void Initialize( int& argc, char**& argv )
     const long seed = (secs<<16) | (rank & 0xFFFF);
     ::generator.seed( seed );
     srand( seed );
+
+    // Load an empirically-tuned profile if one was requested
+    const char* profile = std::getenv("EL_TUNING_PROFILE");
+    if( profile != nullptr && profile[0] != '\0' )
+        LoadTuningProfile( profile );
 }
 
 void Finalize()
@@ -385,7 +407,8 @@ void Finalize()
         // Destroy the types and ops
         mpi::DestroyCustom();
 
-        // Delete the default grid
+        // Delete the cached redistribution patterns and the default grid
+        copy::ClearGeneralPurposePlans();
         delete ::defaultGrid;
         ::defaultGrid = 0;
 
@@ -436,6 +459,18 @@ void SetBlocksize( Int blocksize )
           LogicError("Attempted to set blocksize at top of empty stack");
     )
     ::blocksizeStack.top() = blocksize; 
+    ::blocksizeSet = true;
+}
+
+void SetTunedBlocksize( Int blocksize )
+{
+    DEBUG_ONLY(
+      if( ::blocksizeStack.empty() )
+          LogicError("Attempted to set blocksize at top of empty stack");
+    )
+    // An explicitly-set blocksize takes precedence
+    if( !::blocksizeSet )
+        ::blocksizeStack.top() = blocksize;
 }
 
 void PushBlocksizeStack( Int blocksize )
@@ -450,6 +485,23 @@ void PopBlocksizeStack()
     ::blocksizeStack.pop();
 }
 
+void SetBlocksizeRegime( Int maxSize, Int blocksize )
+{ ::blocksizeRegimes[maxSize] = blocksize; }
+
+void ClearBlocksizeRegimes()
+{ ::blocksizeRegimes.clear(); }
+
+Int RegimeBlocksize( Int n )
+{
+    if( ::blocksizeRegimes.empty() || ::blocksizeStack.size() > 1 ||
+        ::blocksizeSet )
+        return Blocksize();
+    auto it = ::blocksizeRegimes.lower_bound( n );
+    if( it == ::blocksizeRegimes.end() )
+        --it;
+    return it->second;
+}
+
 const Grid& DefaultGrid()
 {
     DEBUG_ONLY(
@@ -657,6 +709,205 @@ template<>
 Int LocalTrrkBlocksize<Complex<double>>()
 { return ::localTrrkComplexDoubleBlocksize; }
 
+template<typename T>
+void SetGemmCrossoverWeights( double weightTowardsC, double weightAwayFromDot )
+{
+    ::GemmWeights<T>::towardsC = weightTowardsC;
+    ::GemmWeights<T>::awayFromDot = weightAwayFromDot;
+}
+
+template<typename T>
+double GemmWeightTowardsC()
+{ return ::GemmWeights<T>::towardsC; }
+
+template<typename T>
+double GemmWeightAwayFromDot()
+{ return ::GemmWeights<T>::awayFromDot; }
+
+// Tuning profiles
+// ===============
+// A profile is a plain-text file with one 'name value' pair per line, e.g.,
+//
+//   # Elemental tuning profile
+//   blocksize 128
+//   localTrrkBlocksize.d 64
+//   gemmWeightTowardsC.z 4
+//
+// where the suffix of the type-specific parameters is one of 'i', 's', 'd',
+// 'c', or 'z'. Blank lines and lines beginning with '#' are ignored.
+
+namespace {
+
+template<typename T>
+void WriteGemmWeights( ostream& os, const string& suffix )
+{
+    os << "gemmWeightTowardsC." << suffix << " " 
+       << GemmWeightTowardsC<T>() << "\n"
+       << "gemmWeightAwayFromDot." << suffix << " " 
+       << GemmWeightAwayFromDot<T>() << "\n";
+}
+
+template<typename T>
+bool ReadGemmWeight
+( const string& name, const string& suffix, std::istream& is )
+{
+    if( name == "gemmWeightTowardsC."+suffix )
+    {
+        double weight;
+        is >> weight;
+        SetGemmCrossoverWeights<T>( weight, GemmWeightAwayFromDot<T>() );
+        return true;
+    }
+    if( name == "gemmWeightAwayFromDot."+suffix )
+    {
+        double weight;
+        is >> weight;
+        SetGemmCrossoverWeights<T>( GemmWeightTowardsC<T>(), weight );
+        return true;
+    }
+    return false;
+}
+
+template<typename T>
+bool ReadLocalBlocksizes
+( const string& name, const string& suffix, std::istream& is )
+{
+    Int blocksize;
+    if( name == "localTrrkBlocksize."+suffix )
+    {
+        is >> blocksize;
+        SetLocalTrrkBlocksize<T>( blocksize );
+        return true;
+    }
+    if( name == "localTrr2kBlocksize."+suffix )
+    {
+        is >> blocksize;
+        SetLocalTrr2kBlocksize<T>( blocksize );
+        return true;
+    }
+    if( name == "localSymvBlocksize."+suffix )
+    {
+        is >> blocksize;
+        SetLocalSymvBlocksize<T>( blocksize );
+        return true;
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+void LoadTuningProfile( const string& filename )
+{
+    DEBUG_ONLY(CSE cse("LoadTuningProfile"))
+    // Read the profile on the root process and broadcast it so that every
+    // process is guaranteed to make identical algorithmic choices
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    string contents;
+    Int length = 0;
+    if( commRank == 0 )
+    {
+        ifstream file( filename.c_str() );
+        if( file.is_open() )
+        {
+            ostringstream os;
+            os << file.rdbuf();
+            contents = os.str();
+            length = contents.size();
+        }
+        else
+            length = -1;
+    }
+    mpi::Broadcast( length, 0, comm );
+    if( length < 0 )
+        RuntimeError("Could not open tuning profile ",filename);
+    vector<byte> buffer( length+1, 0 );
+    if( commRank == 0 )
+        MemCopy( buffer.data(), (const byte*)contents.data(), length );
+    mpi::Broadcast( buffer.data(), length, 0, comm );
+    std::istringstream is( string((const char*)buffer.data()) );
+
+    string line;
+    while( std::getline( is, line ) )
+    {
+        std::istringstream lineStream( line );
+        string name;
+        if( !(lineStream >> name) || name[0] == '#' )
+            continue;
+
+        if( name == "blocksize" )
+        {
+            Int blocksize;
+            lineStream >> blocksize;
+            SetTunedBlocksize( blocksize );
+        }
+        else if( name == "blocksizeRegime" )
+        {
+            Int maxSize, blocksize;
+            lineStream >> maxSize >> blocksize;
+            SetBlocksizeRegime( maxSize, blocksize );
+        }
+        else if( name == "localSymvBlocksize.i" )
+        {
+            Int blocksize;
+            lineStream >> blocksize;
+            SetLocalSymvBlocksize<Int>( blocksize );
+        }
+        else if( ReadLocalBlocksizes<float>(name,"s",lineStream) ||
+                 ReadLocalBlocksizes<double>(name,"d",lineStream) ||
+                 ReadLocalBlocksizes<Complex<float>>(name,"c",lineStream) ||
+                 ReadLocalBlocksizes<Complex<double>>(name,"z",lineStream) ||
+                 ReadGemmWeight<Int>(name,"i",lineStream) ||
+                 ReadGemmWeight<float>(name,"s",lineStream) ||
+                 ReadGemmWeight<double>(name,"d",lineStream) ||
+                 ReadGemmWeight<Complex<float>>(name,"c",lineStream) ||
+                 ReadGemmWeight<Complex<double>>(name,"z",lineStream) )
+            continue;
+        else if( commRank == 0 )
+            cerr << "Ignoring unknown tuning parameter " << name << endl;
+    }
+}
+
+void SaveTuningProfile( const string& filename )
+{
+    DEBUG_ONLY(CSE cse("SaveTuningProfile"))
+    if( mpi::Rank(mpi::COMM_WORLD) != 0 )
+        return;
+    ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    file << "# Elemental tuning profile\n"
+         << "blocksize " << Blocksize() << "\n";
+    for( const auto& regime : ::blocksizeRegimes )
+        file << "blocksizeRegime " << regime.first << " " << regime.second
+             << "\n";
+    file << "localSymvBlocksize.i " << LocalSymvBlocksize<Int>() << "\n"
+         << "localSymvBlocksize.s " << LocalSymvBlocksize<float>() << "\n"
+         << "localSymvBlocksize.d " << LocalSymvBlocksize<double>() << "\n"
+         << "localSymvBlocksize.c " 
+         << LocalSymvBlocksize<Complex<float>>() << "\n"
+         << "localSymvBlocksize.z " 
+         << LocalSymvBlocksize<Complex<double>>() << "\n"
+         << "localTrrkBlocksize.s " << LocalTrrkBlocksize<float>() << "\n"
+         << "localTrrkBlocksize.d " << LocalTrrkBlocksize<double>() << "\n"
+         << "localTrrkBlocksize.c " 
+         << LocalTrrkBlocksize<Complex<float>>() << "\n"
+         << "localTrrkBlocksize.z " 
+         << LocalTrrkBlocksize<Complex<double>>() << "\n"
+         << "localTrr2kBlocksize.s " << LocalTrr2kBlocksize<float>() << "\n"
+         << "localTrr2kBlocksize.d " << LocalTrr2kBlocksize<double>() << "\n"
+         << "localTrr2kBlocksize.c " 
+         << LocalTrr2kBlocksize<Complex<float>>() << "\n"
+         << "localTrr2kBlocksize.z " 
+         << LocalTrr2kBlocksize<Complex<double>>() << "\n";
+    WriteGemmWeights<Int>( file, "i" );
+    WriteGemmWeights<float>( file, "s" );
+    WriteGemmWeights<double>( file, "d" );
+    WriteGemmWeights<Complex<float>>( file, "c" );
+    WriteGemmWeights<Complex<double>>( file, "z" );
+}
+
 template<typename T>
 bool IsSorted( const vector<T>& x )
 {
@@ -737,11 +988,19 @@ Int Find( const vector<Int>& sortedInds, Int index, string msg )
     return it - sortedInds.cbegin();
 }
 
+#define PROTO(T) \
+  template void SetGemmCrossoverWeights<T> \
+  ( double weightTowardsC, double weightAwayFromDot ); \
+  template double GemmWeightTowardsC<T>(); \
+  template double GemmWeightAwayFromDot<T>();
+#define EL_ENABLE_QUAD
+#include "El/macros/Instantiate.h"
+
+#undef PROTO
 #define EL_NO_COMPLEX_PROTO
 #define PROTO(T) \
   template bool IsSorted( const vector<T>& x ); \
   template bool IsStrictlySorted( const vector<T>& x );
-#define EL_ENABLE_QUAD
 #include "El/macros/Instantiate.h"
 
 } // namespace El
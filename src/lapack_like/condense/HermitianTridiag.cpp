@@ -15,6 +15,8 @@
 
 #include "./HermitianTridiag/ApplyQ.hpp"
 
+#include "./HermitianTridiag/TwoStage.hpp"
+
 namespace El {
 
 template<typename F>
@@ -33,6 +35,10 @@ void HermitianTridiag
   const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianTridiag"))
+    // NOTE: A two-stage reduction cannot be represented by (A,t) alone, so
+    //       'ctrl.twoStage' is ignored here in favor of the one-stage
+    //       reduction; the overload which returns a BulgeChase must be used
+    //       to obtain a two-stage reduction.
 
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr;
     auto tPtr = WriteProxy<F,STAR,STAR>( &tPre ); auto& t = *tPtr;
@@ -112,6 +118,24 @@ void HermitianTridiag
     }
 }
 
+template<typename F>
+void HermitianTridiag
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& t,
+  herm_tridiag::BulgeChase<F>& chase, Int bandwidth )
+{
+    DEBUG_ONLY(CSE cse("HermitianTridiag"))
+    herm_tridiag::TwoStage( uplo, A, t, chase, bandwidth, true );
+}
+
+template<typename F>
+void HermitianTridiag
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& t,
+  herm_tridiag::BulgeChase<F>& chase, Int bandwidth )
+{
+    DEBUG_ONLY(CSE cse("HermitianTridiag"))
+    herm_tridiag::TwoStage( uplo, A, t, chase, bandwidth, true );
+}
+
 namespace herm_tridiag {
 
 template<typename F>
@@ -134,7 +158,14 @@ void ExplicitCondensed
 {
     DEBUG_ONLY(CSE cse("herm_tridiag::ExplicitCondensed"))
     DistMatrix<F,STAR,STAR> t(A.Grid());
-    HermitianTridiag( uplo, A, t, ctrl );
+    if( ctrl.twoStage )
+    {
+        // The bulge-chasing reflectors are not needed
+        BulgeChase<F> chase;
+        TwoStage( uplo, A, t, chase, ctrl.bandwidth, false );
+    }
+    else
+        HermitianTridiag( uplo, A, t, ctrl );
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -160,7 +191,21 @@ void ExplicitCondensed
   template void herm_tridiag::ApplyQ \
   ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t, \
-          AbstractDistMatrix<F>& B );
+          AbstractDistMatrix<F>& B ); \
+  template void HermitianTridiag \
+  ( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& t, \
+    herm_tridiag::BulgeChase<F>& chase, Int bandwidth ); \
+  template void HermitianTridiag \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& t, \
+    herm_tridiag::BulgeChase<F>& chase, Int bandwidth ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
+    const Matrix<F>& A, const Matrix<F>& t, \
+    const herm_tridiag::BulgeChase<F>& chase, Matrix<F>& B ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
+    const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t, \
+    const herm_tridiag::BulgeChase<F>& chase, AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
 #include "El/macros/Instantiate.h"
@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANTRIDIAG_BAND_HPP
+#define EL_HERMITIANTRIDIAG_BAND_HPP
+
+#include "../../reflect/ApplyPacked/Util.hpp"
+
+namespace El {
+namespace herm_tridiag {
+
+// Reduce the lower triangle of A to a band with the given number of
+// subdiagonals. Each panel below the band is factored with a Householder QR,
+// and, if Q = I - V S^{-1} V^H, the trailing matrix is updated as
+//
+//   Q^H A22 Q = A22 - V Y^H - Y V^H,
+//
+// where W = A22 V S^{-1} and Y = W - V (S^{-H} V^H W) / 2, so that all of
+// the work on the trailing matrix is a Hemm and a Her2k.
+
+template<typename F>
+void Band( Matrix<F>& A, Matrix<F>& t, Int bandwidth )
+{
+    DEBUG_ONLY(
+      CSE cse("herm_tridiag::Band");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    t.Resize( Max(n-b,Int(0)), 1 );
+
+    Matrix<F> t1, V, S, W, X;
+    Matrix<Base<F>> d1;
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Range<Int> ind1( k, k+b ), ind2( k+b, n );
+        auto APan = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        const Int nb = Min(b,n-k-b);
+
+        // Fold the sign normalization of the QR factorization into R so
+        // that the reflectors alone define the transformation
+        QR( APan, t1, d1 );
+        auto RPan = APan( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, d1, RPan );
+        auto tk = t( IR(k,k+nb), ALL );
+        tk = t1;
+
+        V = APan( ALL, IR(0,nb) );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        Herk( UPPER, ADJOINT, Base<F>(1), V, S );
+        FixDiagonal( CONJUGATED, t1, S );
+
+        Zeros( W, n-k-b, nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), W );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), S, W );
+        Gemm( ADJOINT, NORMAL, F(1), V, W, X );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), S, X );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, X, F(1), W );
+        Her2k( LOWER, NORMAL, F(-1), V, W, Base<F>(1), A22 );
+    }
+}
+
+template<typename F>
+void Band( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t, Int bandwidth )
+{
+    DEBUG_ONLY(
+      CSE cse("herm_tridiag::Band");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    const Grid& g = A.Grid();
+    t.Resize( Max(n-b,Int(0)), 1 );
+
+    DistMatrix<F> V(g), W(g);
+    DistMatrix<F,VC,STAR> V_VC_STAR(g), W_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> t1(g), S(g), X(g);
+    DistMatrix<Base<F>,STAR,STAR> d1(g);
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Range<Int> ind1( k, k+b ), ind2( k+b, n );
+        auto APan = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        const Int nb = Min(b,n-k-b);
+
+        // Fold the sign normalization of the QR factorization into R so
+        // that the reflectors alone define the transformation
+        QR( APan, t1, d1 );
+        auto RPan = APan( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, d1, RPan );
+        auto tk = t( IR(k,k+nb), ALL );
+        tk = t1;
+
+        V.AlignWith( A22 );
+        V = APan( ALL, IR(0,nb) );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        V_VC_STAR = V;
+        Zeros( S, nb, nb );
+        Herk
+        ( UPPER, ADJOINT,
+          Base<F>(1), V_VC_STAR.LockedMatrix(),
+          Base<F>(0), S.Matrix() );
+        El::AllReduce( S, V_VC_STAR.ColComm() );
+        FixDiagonal( CONJUGATED, t1, S );
+
+        W.AlignWith( A22 );
+        Zeros( W, n-k-b, nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), W );
+        W_VC_STAR.AlignWith( V_VC_STAR );
+        W_VC_STAR = W;
+        Trsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT,
+          F(1), S.LockedMatrix(), W_VC_STAR.Matrix() );
+        Zeros( X, nb, nb );
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), V_VC_STAR.LockedMatrix(), W_VC_STAR.LockedMatrix(),
+          F(0), X.Matrix() );
+        El::AllReduce( X, V_VC_STAR.ColComm() );
+        Trsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT,
+          F(1), S.LockedMatrix(), X.Matrix() );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(-1)/F(2), V_VC_STAR.LockedMatrix(), X.LockedMatrix(),
+          F(1),       W_VC_STAR.Matrix() );
+        W = W_VC_STAR;
+        Her2k( LOWER, NORMAL, F(-1), V, W, Base<F>(1), A22 );
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_BAND_HPP
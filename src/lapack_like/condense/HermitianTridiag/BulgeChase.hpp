@@ -0,0 +1,221 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANTRIDIAG_BULGECHASE_HPP
+#define EL_HERMITIANTRIDIAG_BULGECHASE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// The band is stored with the entry in row i and column j of the Hermitian
+// matrix kept in entry (i-j,j) of AB, which must have twice as many rows as
+// the bandwidth so that there is room for the bulges.
+
+template<typename F>
+inline void GetBandBlock
+( const Matrix<F>& AB, Int i0, Int i1, Int j0, Int j1, Matrix<F>& B )
+{
+    B.Resize( i1-i0, j1-j0 );
+    for( Int j=j0; j<j1; ++j )
+        for( Int i=Max(i0,j); i<i1; ++i )
+            B.Set( i-i0, j-j0, AB.Get(i-j,j) );
+}
+
+template<typename F>
+inline void PutBandBlock
+( const Matrix<F>& B, Int i0, Int j0, Matrix<F>& AB )
+{
+    const Int i1 = i0 + B.Height();
+    const Int j1 = j0 + B.Width();
+    for( Int j=j0; j<j1; ++j )
+        for( Int i=Max(i0,j); i<i1; ++i )
+            AB.Set( i-j, j, B.Get(i-i0,j-j0) );
+}
+
+// The number of reflectors in the sweep which reduces column j: the first
+// reflector reduces the column, and each subsequent one annihilates the
+// first column of the bulge introduced by its predecessor (only the last
+// row of the band is free of bulges)
+inline Int NumChaseSteps( Int n, Int bandwidth, Int j )
+{ return 1 + ( n-3-j >= 0 ? (n-3-j)/bandwidth : 0 ); }
+
+template<typename F>
+void ChaseBand
+( Matrix<F>& AB, Int bandwidth, BulgeChase<F>& chase, bool storeReflectors )
+{
+    DEBUG_ONLY(
+      CSE cse("herm_tridiag::ChaseBand");
+      if( AB.Height() != 2*bandwidth )
+          LogicError("Band storage must have room for the bulges");
+    )
+    const Int n = AB.Width();
+    const Int b = bandwidth;
+    const Int numSweeps = Max(n-1,Int(0));
+    chase.height = n;
+    chase.bandwidth = b;
+    chase.sweepOffsets.resize( numSweeps+1 );
+    chase.sweepOffsets[0] = 0;
+    for( Int j=0; j<numSweeps; ++j )
+        chase.sweepOffsets[j+1] =
+          chase.sweepOffsets[j] + NumChaseSteps( n, b, j );
+    const Int numReflectors = chase.sweepOffsets[numSweeps];
+    if( storeReflectors )
+    {
+        Zeros( chase.V, b, numReflectors );
+        Zeros( chase.tau, numReflectors, 1 );
+    }
+    else
+    {
+        chase.V.Resize( b, 0 );
+        chase.tau.Resize( 0, 1 );
+    }
+
+    Matrix<F> x, v, B, D, E, y, w;
+    for( Int j=0; j<numSweeps; ++j )
+    {
+        const Int numSteps = NumChaseSteps( n, b, j );
+        for( Int step=0; step<numSteps; ++step )
+        {
+            // Reflect rows [s,e) so that column c is reduced below row s
+            const Int s = j+1+step*b;
+            const Int e = Min(s+b,n);
+            const Int c = ( step==0 ? j : s-b );
+
+            GetBandBlock( AB, s, e, c, c+1, x );
+            auto chi = x( IR(0),     ALL );
+            auto xB  = x( IR(1,END), ALL );
+            const F tau = LeftReflector( chi, xB );
+            v = x;
+            v.Set( 0, 0, F(1) );
+            xB *= 0;
+            PutBandBlock( x, s, c, AB );
+
+            // B := H B for the remainder of the bulge
+            if( c+1 < s )
+            {
+                GetBandBlock( AB, s, e, c+1, s, B );
+                Gemv( ADJOINT, F(1), B, v, y );
+                Ger( -tau, v, y, B );
+                PutBandBlock( B, s, c+1, AB );
+            }
+
+            // D := H D H^H for the diagonal block
+            GetBandBlock( AB, s, e, s, e, D );
+            Zeros( w, e-s, 1 );
+            Hemv( LOWER, Conj(tau), D, v, F(0), w );
+            const F alpha = -Conj(tau)*Dot( w, v )/F(2);
+            Axpy( alpha, v, w );
+            Her2( LOWER, F(-1), v, w, D );
+            PutBandBlock( D, s, s, AB );
+
+            // E := E H^H for the block beneath, which introduces a bulge
+            if( e < n )
+            {
+                GetBandBlock( AB, e, Min(e+b,n), s, e, E );
+                Gemv( NORMAL, F(1), E, v, y );
+                Ger( -Conj(tau), y, v, E );
+                PutBandBlock( E, e, s, AB );
+            }
+
+            if( storeReflectors )
+            {
+                const Int k = chase.sweepOffsets[j]+step;
+                auto vStore = chase.V( IR(0,e-s), IR(k) );
+                vStore = v;
+                chase.tau.Set( k, 0, Conj(tau) );
+            }
+        }
+    }
+}
+
+// The reflectors of a sweep act upon disjoint sets of rows, and the i'th
+// reflector of a sweep only overlaps with those of later sweeps which have
+// index at most i. The product of the reflectors from a contiguous set of
+// sweeps can therefore be reordered so that, from the last step to the
+// first, the i'th reflectors of each sweep are applied together. Each such
+// group is a trapezoidal set of vectors applied with the UT transform.
+template<typename F>
+void ApplyChase
+( LeftOrRight side, Orientation orientation,
+  const BulgeChase<F>& chase, Matrix<F>& B )
+{
+    DEBUG_ONLY(
+      CSE cse("herm_tridiag::ApplyChase");
+      if( (side==LEFT ? B.Height() : B.Width()) != chase.height )
+          LogicError("B is not conformal with the reduction");
+      if( chase.V.Width() != chase.tau.Height() )
+          LogicError("The reflectors of the reduction were not stored");
+    )
+    const Int n = chase.height;
+    const Int b = chase.bandwidth;
+    const Int numSweeps = Max(n-1,Int(0));
+    const bool onLeft = ( side == LEFT );
+    const bool normal = ( orientation == NORMAL );
+    const bool reverse = ( onLeft == normal );
+    const Orientation sOrient = ( normal ? NORMAL : ADJOINT );
+
+    const Int groupSize = b;
+    const Int numGroups = (numSweeps+groupSize-1) / groupSize;
+    Matrix<F> V, S, Z;
+    for( Int groupIter=0; groupIter<numGroups; ++groupIter )
+    {
+        const Int group = ( reverse ? numGroups-1-groupIter : groupIter );
+        const Int j0 = group*groupSize;
+        const Int j1 = Min(j0+groupSize,numSweeps);
+        const Int numSteps = NumChaseSteps( n, b, j0 );
+        for( Int stepIter=0; stepIter<numSteps; ++stepIter )
+        {
+            const Int step = ( reverse ? stepIter : numSteps-1-stepIter );
+
+            // Later sweeps may have fewer steps
+            Int jEnd = j0;
+            while( jEnd < j1 && step < NumChaseSteps(n,b,jEnd) )
+                ++jEnd;
+            const Int numRefl = jEnd - j0;
+            const Int s0 = j0+1+step*b;
+            const Int s1 = Min(jEnd+step*b+b,n);
+
+            Zeros( V, s1-s0, numRefl );
+            for( Int t=0; t<numRefl; ++t )
+            {
+                const Int k = chase.sweepOffsets[j0+t]+step;
+                const Int length = Min(b,s1-(s0+t));
+                auto vSrc = chase.V( IR(0,length), IR(k) );
+                auto vDst = V( IR(t,t+length), IR(t) );
+                vDst = vSrc;
+            }
+            Herk( UPPER, ADJOINT, Base<F>(1), V, S );
+            for( Int t=0; t<numRefl; ++t )
+            {
+                const Int k = chase.sweepOffsets[j0+t]+step;
+                S.Set( t, t, F(1)/chase.tau.Get(k,0) );
+            }
+
+            if( onLeft )
+            {
+                auto BWin = B( IR(s0,s1), ALL );
+                Gemm( ADJOINT, NORMAL, F(1), V, BWin, Z );
+                Trsm( LEFT, UPPER, sOrient, NON_UNIT, F(1), S, Z );
+                Gemm( NORMAL, NORMAL, F(-1), V, Z, F(1), BWin );
+            }
+            else
+            {
+                auto BWin = B( ALL, IR(s0,s1) );
+                Gemm( NORMAL, NORMAL, F(1), BWin, V, Z );
+                Trsm( RIGHT, UPPER, sOrient, NON_UNIT, F(1), S, Z );
+                Gemm( NORMAL, ADJOINT, F(-1), Z, V, F(1), BWin );
+            }
+        }
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_BULGECHASE_HPP
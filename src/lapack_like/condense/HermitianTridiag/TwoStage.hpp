@@ -0,0 +1,278 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+#include "./Band.hpp"
+#include "./BulgeChase.hpp"
+
+namespace El {
+namespace herm_tridiag {
+
+// The two-stage reductions only work with lower-triangular storage; the
+// upper-triangular case is handled by reducing the adjoint.
+
+template<typename F>
+void TwoStageLower
+( Matrix<F>& A, Matrix<F>& t, BulgeChase<F>& chase, Int bandwidth,
+  bool storeReflectors )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::TwoStageLower"))
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    Band( A, t, b );
+
+    Matrix<F> AB;
+    Zeros( AB, 2*b, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(j+b+1,n); ++i )
+            AB.Set( i-j, j, A.Get(i,j) );
+
+    ChaseBand( AB, b, chase, storeReflectors );
+
+    for( Int j=0; j<n; ++j )
+    {
+        A.Set( j, j, AB.GetRealPart(0,j) );
+        if( j+1 < n )
+            A.Set( j+1, j, AB.GetRealPart(1,j) );
+        for( Int i=j+2; i<Min(j+b+1,n); ++i )
+            A.Set( i, j, F(0) );
+    }
+}
+
+// Every process receives a copy of the band of A
+template<typename F>
+void GatherBand( const DistMatrix<F>& A, Int bandwidth, Matrix<F>& AB )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::GatherBand"))
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    const Int localWidth = A.LocalWidth();
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+
+    vector<F> sendBuf;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(j+b+1,n));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            sendBuf.push_back( A.GetLocal(iLoc,jLoc) );
+    }
+
+    mpi::Comm comm = A.Grid().VCComm();
+    const int commSize = mpi::Size( comm );
+    const int sendSize = sendBuf.size();
+    vector<int> recvSizes( commSize ), recvOffs;
+    mpi::AllGather( &sendSize, 1, recvSizes.data(), 1, comm );
+    const int totalRecv = Scan( recvSizes, recvOffs );
+    vector<F> recvBuf( totalRecv );
+    mpi::AllGather
+    ( sendBuf.data(), sendSize,
+      recvBuf.data(), recvSizes.data(), recvOffs.data(), comm );
+
+    // Process q of the VC communicator owns the entries in the q % colStride
+    // process row and the q / colStride process column
+    Zeros( AB, 2*b, n );
+    for( int q=0; q<commSize; ++q )
+    {
+        const Int colShift = Shift( q % colStride, A.ColAlign(), colStride );
+        const Int rowShift = Shift( q / colStride, A.RowAlign(), rowStride );
+        const F* recvData = &recvBuf[recvOffs[q]];
+        for( Int j=rowShift; j<n; j+=rowStride )
+        {
+            Int i = colShift;
+            if( i < j )
+                i += ((j-colShift+colStride-1)/colStride)*colStride;
+            for( ; i<Min(j+b+1,n); i+=colStride )
+                AB.Set( i-j, j, *recvData++ );
+        }
+    }
+}
+
+template<typename F>
+void TwoStageLower
+( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t, BulgeChase<F>& chase,
+  Int bandwidth, bool storeReflectors )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::TwoStageLower"))
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    Band( A, t, b );
+
+    // The band is small enough that every process redundantly chases it
+    Matrix<F> AB;
+    GatherBand( A, b, AB );
+    ChaseBand( AB, b, chase, storeReflectors );
+
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(j+b+1,n));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i-j <= 1 )
+                A.SetLocal( iLoc, jLoc, AB.GetRealPart(i-j,j) );
+            else
+                A.SetLocal( iLoc, jLoc, F(0) );
+        }
+    }
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& t, BulgeChase<F>& chase,
+  Int bandwidth, bool storeReflectors )
+{
+    DEBUG_ONLY(
+      CSE cse("herm_tridiag::TwoStage");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( bandwidth < 0 )
+          LogicError("The bandwidth must be non-negative");
+    )
+    const Int b = ( bandwidth==0 ? Blocksize() : bandwidth );
+    if( uplo == LOWER )
+        TwoStageLower( A, t, chase, b, storeReflectors );
+    else
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        TwoStageLower( AAdj, t, chase, b, storeReflectors );
+        Adjoint( AAdj, A );
+    }
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo, AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& tPre,
+  BulgeChase<F>& chase, Int bandwidth, bool storeReflectors )
+{
+    DEBUG_ONLY(
+      CSE cse("herm_tridiag::TwoStage");
+      AssertSameGrids( APre, tPre );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( bandwidth < 0 )
+          LogicError("The bandwidth must be non-negative");
+    )
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr;
+    auto tPtr = WriteProxy<F,STAR,STAR>( &tPre ); auto& t = *tPtr;
+
+    const Int b = ( bandwidth==0 ? Blocksize() : bandwidth );
+    if( uplo == LOWER )
+        TwoStageLower( A, t, chase, b, storeReflectors );
+    else
+    {
+        DistMatrix<F> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+        TwoStageLower( AAdj, t, chase, b, storeReflectors );
+        Adjoint( AAdj, A );
+    }
+}
+
+template<typename F>
+void ApplyBandQ
+( LeftOrRight side, Orientation orientation, Int bandwidth,
+  const Matrix<F>& A, const Matrix<F>& t, Matrix<F>& B )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::ApplyBandQ"))
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -bandwidth, A, t, B );
+}
+
+template<typename F>
+void ApplyBandQ
+( LeftOrRight side, Orientation orientation, Int bandwidth,
+  const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t,
+        AbstractDistMatrix<F>& B )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::ApplyBandQ"))
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -bandwidth, A, t, B );
+}
+
+// Q = Q1 Q2, where Q1 is from the reduction to banded form and Q2 is from
+// the bulge chasing
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const Matrix<F>& A, const Matrix<F>& t, const BulgeChase<F>& chase,
+  Matrix<F>& B )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::ApplyQ"))
+    const bool bandFirst = ( (orientation==NORMAL) != (side==LEFT) );
+    Matrix<F> AAdj;
+    if( uplo == UPPER )
+        Adjoint( A, AAdj );
+    const Matrix<F>& ALower = ( uplo==LOWER ? A : AAdj );
+
+    if( bandFirst )
+        ApplyBandQ( side, orientation, chase.bandwidth, ALower, t, B );
+    ApplyChase( side, orientation, chase, B );
+    if( !bandFirst )
+        ApplyBandQ( side, orientation, chase.bandwidth, ALower, t, B );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const AbstractDistMatrix<F>& APre, const AbstractDistMatrix<F>& t,
+  const BulgeChase<F>& chase, AbstractDistMatrix<F>& B )
+{
+    DEBUG_ONLY(
+      CSE cse("herm_tridiag::ApplyQ");
+      AssertSameGrids( APre, t, B );
+    )
+    const bool bandFirst = ( (orientation==NORMAL) != (side==LEFT) );
+    auto APtr = ReadProxy<F,MC,MR>( &APre ); auto& A = *APtr;
+    DistMatrix<F> AAdj(A.Grid());
+    if( uplo == UPPER )
+        Adjoint( A, AAdj );
+    const DistMatrix<F>& ALower = ( uplo==LOWER ? A : AAdj );
+
+    if( bandFirst )
+        ApplyBandQ( side, orientation, chase.bandwidth, ALower, t, B );
+
+    // The bulge-chasing reflectors are applied to whole columns (rows) of B
+    // without any further communication
+    if( side == LEFT )
+    {
+        DistMatrix<F,STAR,VR> B_STAR_VR( B );
+        ApplyChase( side, orientation, chase, B_STAR_VR.Matrix() );
+        Copy( B_STAR_VR, B );
+    }
+    else
+    {
+        DistMatrix<F,VC,STAR> B_VC_STAR( B );
+        ApplyChase( side, orientation, chase, B_VC_STAR.Matrix() );
+        Copy( B_VC_STAR, B );
+    }
+
+    if( !bandFirst )
+        ApplyBandQ( side, orientation, chase.bandwidth, ALower, t, B );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
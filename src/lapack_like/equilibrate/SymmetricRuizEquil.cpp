@@ -26,11 +26,47 @@ inline Real SquareRootScaling( Real alpha )
     return Sqrt(alpha);
 }
 
+// Since A is symmetric, the maximum norm of each column is the maximum norm
+// of the corresponding row, and so each sweep only requires a single pass over
+// the locally-owned rows. Each sweep is stopped early once every (nonzero)
+// row has a maximum norm within a factor of 1+tol of one, and, since the
+// KKT systems within the Interior Point Methods only change within their
+// diagonal blocks between iterations, the previous scaling may be used as a
+// starting point by setting 'warmStart'.
+
+template<typename F>
+inline void RowMaxNormsLocal
+( Int numRows, const Int* offsetBuf, const F* valBuf, Base<F>* rowMaxBuf )
+{
+    typedef Base<F> Real;
+    EL_PARALLEL_FOR
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        Real rowMax = 0;
+        const Int eEnd = offsetBuf[iLoc+1];
+        for( Int e=offsetBuf[iLoc]; e<eEnd; ++e )
+            rowMax = Max( rowMax, Abs(valBuf[e]) );
+        rowMaxBuf[iLoc] = rowMax;
+    }
+}
+
+// Return the maximum of |1 - alpha| over the nonzero entries
+template<typename Real>
+inline Real ScalingDeviation( Int numEntries, const Real* buf )
+{
+    Real deviation = 0;
+    for( Int i=0; i<numEntries; ++i )
+        if( buf[i] != Real(0) )
+            deviation = Max( deviation, Abs(Real(1)-buf[i]) );
+    return deviation;
+}
+
 template<typename F>
 void SymmetricRuizEquil
 ( Matrix<F>& A, 
   Matrix<Base<F>>& d, 
-  bool progress )
+  bool progress, 
+  bool warmStart )
 {
     DEBUG_ONLY(CSE cse("SymmetricRuizEquil"))
     LogicError("This routine is not yet written");
@@ -40,7 +76,8 @@ template<typename F>
 void SymmetricRuizEquil
 ( AbstractDistMatrix<F>& APre, 
   AbstractDistMatrix<Base<F>>& dPre,
-  bool progress )
+  bool progress,
+  bool warmStart )
 {
     DEBUG_ONLY(CSE cse("SymmetricRuizEquil"))
     typedef Base<F> Real;
@@ -51,16 +88,24 @@ void SymmetricRuizEquil
     control.colAlign = 0;
     control.rowAlign = 0;
     auto APtr     = ReadWriteProxy<F,MC,MR>(&APre,control);
-    auto dPtr = WriteProxy<Real,MC,STAR>(&dPre,control); 
+    auto dPtr = ReadWriteProxy<Real,MC,STAR>(&dPre,control); 
     auto& A = *APtr;
     auto& d = *dPtr;
 
     const Int n = A.Height();
-    Ones( d, n, 1 );
+    if( warmStart && d.Height() == n && d.Width() == 1 )
+    {
+        DistMatrix<Real,MR,STAR> d_MR_STAR( d );
+        DiagonalSolve( RIGHT, NORMAL, d_MR_STAR, A );
+        DiagonalSolve( LEFT, NORMAL, d, A );
+    }
+    else
+        Ones( d, n, 1 );
 
     // TODO: Expose these as control parameters
-    // For now, simply hard-code the number of iterations
+    // For now, simply hard-code the number of iterations and the tolerance
     const Int maxIter = 4; 
+    const Real tol = Real(1)/Real(10);
 
     DistMatrix<Real,MR,STAR> scales(A.Grid());
     const Int indent = PushIndent();
@@ -69,6 +114,15 @@ void SymmetricRuizEquil
         // Rescale the columns (and rows)
         // ------------------------------
         ColumnMaxNorms( A, scales );
+        const Real deviation = 
+          mpi::AllReduce
+          ( ScalingDeviation
+            ( scales.LocalHeight(), scales.LockedBuffer() ),
+            mpi::MAX, A.Grid().Comm() );
+        if( progress && A.Grid().Rank() == 0 )
+            Output("Ruiz sweep ",iter,": max row-norm deviation = ",deviation);
+        if( deviation <= tol )
+            break;
         EntrywiseMap( scales, function<Real(Real)>(DampScaling<Real>) );
         EntrywiseMap( scales, function<Real(Real)>(SquareRootScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, scales, d );
@@ -83,29 +137,57 @@ template<typename F>
 void SymmetricRuizEquil
 ( SparseMatrix<F>& A, 
   Matrix<Base<F>>& d,
-  bool progress )
+  bool progress,
+  bool warmStart )
 {
     DEBUG_ONLY(CSE cse("SymmetricRuizEquil"))
     typedef Base<F> Real;
     const Int n = A.Height();
-    Ones( d, n, 1 );
+    if( warmStart && d.Height() == n && d.Width() == 1 )
+    {
+        DiagonalSolve( RIGHT, NORMAL, d, A );
+        DiagonalSolve( LEFT, NORMAL, d, A );
+    }
+    else
+        Ones( d, n, 1 );
 
     // TODO: Expose these as control parameters
-    // For now, simply hard-code the number of iterations
+    // For now, simply hard-code the number of iterations and the tolerance
     const Int maxIter = 4; 
+    const Real tol = Real(1)/Real(10);
 
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    Real* dBuf = d.Buffer();
     Matrix<Real> scales;
+    Zeros( scales, n, 1 );
+    Real* scaleBuf = scales.Buffer();
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Rescale the columns (and rows)
         // ------------------------------
-        ColumnMaxNorms( A, scales );
-        EntrywiseMap( scales, function<Real(Real)>(DampScaling<Real>) );
-        EntrywiseMap( scales, function<Real(Real)>(SquareRootScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, d );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
+        RowMaxNormsLocal( n, offsetBuf, A.LockedValueBuffer(), scaleBuf );
+        const Real deviation = ScalingDeviation( n, scaleBuf );
+        if( progress )
+            Output("Ruiz sweep ",iter,": max row-norm deviation = ",deviation);
+        if( deviation <= tol )
+            break;
+        for( Int i=0; i<n; ++i )
+        {
+            scaleBuf[i] = SquareRootScaling(DampScaling(scaleBuf[i]));
+            dBuf[i] *= scaleBuf[i];
+        }
+
+        // Apply both diagonal solves in a single pass over the entries
+        F* valBuf = A.ValueBuffer();
+        EL_PARALLEL_FOR
+        for( Int i=0; i<n; ++i )
+        {
+            const Int eEnd = offsetBuf[i+1];
+            for( Int e=offsetBuf[i]; e<eEnd; ++e )
+                valBuf[e] /= scaleBuf[i]*scaleBuf[colBuf[e]];
+        }
     }
     SetIndent( indent );
 }
@@ -114,31 +196,80 @@ template<typename F>
 void SymmetricRuizEquil
 ( DistSparseMatrix<F>& A, 
   DistMultiVec<Base<F>>& d, 
-  bool progress )
+  bool progress,
+  bool warmStart )
 {
     DEBUG_ONLY(CSE cse("SymmetricRuizEquil"))
     typedef Base<F> Real;
     const Int n = A.Height();
     mpi::Comm comm = A.Comm();
-    d.SetComm( comm );
-    Ones( d, n, 1 );
+    const int commRank = mpi::Rank( comm );
+    if( warmStart && d.Height() == n && d.Width() == 1 && 
+        mpi::Congruent( d.Comm(), comm ) )
+    {
+        DiagonalSolve( RIGHT, NORMAL, d, A );
+        DiagonalSolve( LEFT, NORMAL, d, A );
+    }
+    else
+    {
+        d.SetComm( comm );
+        Ones( d, n, 1 );
+    }
 
     // TODO: Expose to control structure
-    // For, simply hard-code a small number of iterations
+    // For, simply hard-code a small number of iterations and the tolerance
     const Int maxIter = 4;
+    const Real tol = Real(1)/Real(10);
 
-    DistMultiVec<Real> scales(comm);
+    // Each sweep requires a single scalar reduction and a single exchange of
+    // the scalings of the nonlocal columns of the local rows
+    A.InitializeMultMeta();
+    const auto& meta = A.multMeta;
+    const Int numSendInds = meta.sendInds.size();
+    vector<Real> sendScales( numSendInds ), recvScales( meta.numRecvInds );
+
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    Real* dBuf = d.Matrix().Buffer();
+    vector<Real> scales( localHeight );
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Rescale the columns (and rows)
         // ------------------------------
-        ColumnMaxNorms( A, scales );
-        EntrywiseMap( scales, function<Real(Real)>(DampScaling<Real>) );
-        EntrywiseMap( scales, function<Real(Real)>(SquareRootScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, d );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
+        RowMaxNormsLocal
+        ( localHeight, offsetBuf, A.LockedValueBuffer(), scales.data() );
+        const Real deviation = 
+          mpi::AllReduce
+          ( ScalingDeviation( localHeight, scales.data() ), mpi::MAX, comm );
+        if( progress && commRank == 0 )
+            Output("Ruiz sweep ",iter,": max row-norm deviation = ",deviation);
+        if( deviation <= tol )
+            break;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            scales[iLoc] = SquareRootScaling(DampScaling(scales[iLoc]));
+            dBuf[iLoc] *= scales[iLoc];
+        }
+
+        // Exchange the scalings of the columns of the local rows
+        for( Int s=0; s<numSendInds; ++s )
+            sendScales[s] = scales[meta.sendInds[s]-firstLocalRow];
+        mpi::AllToAll
+        ( sendScales.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+          recvScales.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+          comm );
+
+        // Apply both diagonal solves in a single pass over the entries
+        F* valBuf = A.ValueBuffer();
+        EL_PARALLEL_FOR
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int eEnd = offsetBuf[iLoc+1];
+            for( Int e=offsetBuf[iLoc]; e<eEnd; ++e )
+                valBuf[e] /= scales[iLoc]*recvScales[meta.colOffs[e]];
+        }
     }
     SetIndent( indent );
 }
@@ -147,19 +278,23 @@ void SymmetricRuizEquil
   template void SymmetricRuizEquil \
   ( Matrix<F>& A, \
     Matrix<Base<F>>& d, \
-    bool progress ); \
+    bool progress, \
+    bool warmStart ); \
   template void SymmetricRuizEquil \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<Base<F>>& d, \
-    bool progress ); \
+    bool progress, \
+    bool warmStart ); \
   template void SymmetricRuizEquil \
   ( SparseMatrix<F>& A, \
     Matrix<Base<F>>& d, \
-    bool progress ); \
+    bool progress, \
+    bool warmStart ); \
   template void SymmetricRuizEquil \
   ( DistSparseMatrix<F>& A, \
     DistMultiVec<Base<F>>& d, \
-    bool progress );
+    bool progress, \
+    bool warmStart );
 
 #define EL_NO_INT_PROTO
 #include "El/macros/Instantiate.h"
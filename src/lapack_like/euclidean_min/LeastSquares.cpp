@@ -261,6 +261,22 @@ inline void Equilibrated
     }
 }
 
+template<typename F>
+inline void EquilibratedQR
+( const SparseMatrix<F>& A, const Matrix<F>& B, Matrix<F>& X )
+{
+    DEBUG_ONLY(CSE cse("ls::EquilibratedQR"))
+    vector<Int> map, invMap;
+    ldl::NodeInfo info;
+    ldl::Separator rootSep;
+    qr::NestedDissection( A, map, rootSep, info );
+    InvertMap( map, invMap );
+
+    qr::SparseFront<F> front;
+    QR( A, map, info, front );
+    qr::SolveAfter( invMap, info, front, B, X );
+}
+
 } // namespace ls
 
 template<typename F>
@@ -328,7 +344,10 @@ void LeastSquares
 
     // Solve the equilibrated least squares problem
     // ============================================
-    ls::Equilibrated( ABar, BBar, X, ctrl.alpha, ctrl.qsdCtrl );
+    if( ctrl.useQR && m >= n )
+        ls::EquilibratedQR( ABar, BBar, X );
+    else
+        ls::Equilibrated( ABar, BBar, X, ctrl.alpha, ctrl.qsdCtrl );
 
     // Unequilibrate the solution
     // ==========================
@@ -562,6 +581,9 @@ void LeastSquares
   const LeastSquaresCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("LeastSquares"))
+    // TODO: Distribute the sparse QR factorization
+    if( ctrl.useQR )
+        LogicError("Sparse QR is not yet supported for distributed matrices");
     typedef Base<F> Real;
     mpi::Comm comm = A.Comm();
     const int commRank = mpi::Rank(comm);
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "../../blas_like/level3/Batched/Util.hpp"
+#include "./Batched/Cholesky.hpp"
+#include "./Batched/LU.hpp"
+
+namespace El {
+namespace batched {
+
+template<typename F>
+void Cholesky( UpperOrLower uplo, MatrixBatch<F>& A )
+{
+    DEBUG_ONLY(
+      CSE cse("batched::Cholesky");
+      AssertValidBatch( A );
+      if( A.height != A.width )
+          LogicError("Batched matrices must be square");
+    )
+    const Strides sA = GetStrides( A );
+    vector<byte> failed( A.batchSize, 0 );
+    ForEachChunk
+    ( A.batchSize, A.layout,
+      [&]( Int offset, Int count )
+      {
+          CholeskyChunk
+          ( uplo, A.height, &A.buffer[offset*sA.batchStride], sA, count,
+            &failed[offset] );
+      } );
+    for( Int b=0; b<A.batchSize; ++b )
+        if( failed[b] )
+            throw NonHPDMatrixException();
+}
+
+template<typename F>
+void Cholesky( UpperOrLower uplo, const vector<Matrix<F>*>& A )
+{
+    DEBUG_ONLY(
+      CSE cse("batched::Cholesky");
+      for( size_t b=0; b<A.size(); ++b )
+          if( A[b]->Height() != A[b]->Width() )
+              LogicError("Batched matrices must be square");
+    )
+    const Int batchSize = A.size();
+    vector<byte> failed( batchSize, 0 );
+
+    EL_OUTER_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<F>& ABatch = *A[b];
+        if( ABatch.Height() <= maxSmallSize )
+            CholeskyChunk
+            ( uplo, ABatch.Height(), ABatch.Buffer(), GetStrides(ABatch), 1,
+              &failed[b] );
+    }
+
+    for( Int b=0; b<batchSize; ++b )
+    {
+        if( A[b]->Height() <= maxSmallSize )
+            continue;
+        try { El::Cholesky( uplo, *A[b] ); }
+        catch( const NonHPDMatrixException& e ) { failed[b] = 1; }
+    }
+    for( Int b=0; b<batchSize; ++b )
+        if( failed[b] )
+            throw NonHPDMatrixException();
+}
+
+template<typename F>
+void LU( MatrixBatch<F>& A, Matrix<Int>& p )
+{
+    DEBUG_ONLY(
+      CSE cse("batched::LU");
+      AssertValidBatch( A );
+    )
+    const Strides sA = GetStrides( A );
+    p.Resize( A.height, A.batchSize );
+    vector<byte> failed( A.batchSize, 0 );
+    ForEachChunk
+    ( A.batchSize, A.layout,
+      [&]( Int offset, Int count )
+      {
+          LUChunk
+          ( A.height, A.width, &A.buffer[offset*sA.batchStride], sA,
+            p.Buffer(0,offset), p.LDim(), count, &failed[offset] );
+      } );
+    for( Int b=0; b<A.batchSize; ++b )
+        if( failed[b] )
+            throw SingularMatrixException();
+}
+
+template<typename F>
+void LU( const vector<Matrix<F>*>& A, vector<Matrix<Int>>& p )
+{
+    DEBUG_ONLY(CSE cse("batched::LU"))
+    const Int batchSize = A.size();
+    p.resize( batchSize );
+    vector<byte> failed( batchSize, 0 );
+    auto isSmall = [&]( Int b )
+      {
+          return A[b]->Height() <= maxSmallSize &&
+                 A[b]->Width() <= maxSmallSize;
+      };
+
+    // Resizing p may allocate, so it is not done within the threaded loop
+    for( Int b=0; b<batchSize; ++b )
+        if( isSmall(b) )
+            p[b].Resize( A[b]->Height(), 1 );
+
+    EL_OUTER_PARALLEL_FOR
+    for( Int b=0; b<batchSize; ++b )
+    {
+        if( !isSmall(b) )
+            continue;
+        Matrix<F>& ABatch = *A[b];
+        LUChunk
+        ( ABatch.Height(), ABatch.Width(), ABatch.Buffer(),
+          GetStrides(ABatch), p[b].Buffer(), p[b].LDim(), 1, &failed[b] );
+    }
+
+    for( Int b=0; b<batchSize; ++b )
+    {
+        if( isSmall(b) )
+            continue;
+        try { El::LU( *A[b], p[b] ); }
+        catch( const SingularMatrixException& e ) { failed[b] = 1; }
+    }
+    for( Int b=0; b<batchSize; ++b )
+        if( failed[b] )
+            throw SingularMatrixException();
+}
+
+#define PROTO(F) \
+  template void Cholesky( UpperOrLower uplo, MatrixBatch<F>& A ); \
+  template void Cholesky( UpperOrLower uplo, const vector<Matrix<F>*>& A ); \
+  template void LU( MatrixBatch<F>& A, Matrix<Int>& p ); \
+  template void LU( const vector<Matrix<F>*>& A, vector<Matrix<Int>>& p );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace batched
+} // namespace El
@@ -0,0 +1,91 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_BATCHED_CHOLESKY_HPP
+#define EL_BATCHED_CHOLESKY_HPP
+
+namespace El {
+namespace batched {
+
+// Overwrite the lower triangle of each n x n matrix in a chunk with its
+// Cholesky factor. 'failed[t]' is set to one if the t'th matrix was
+// found not to be HPD; its remaining entries are then meaningless.
+template<Int N,typename F>
+inline void CholeskyKernel
+( Int nDyn, F* A, const Strides& sA, Int count, byte* failed )
+{
+    typedef Base<F> Real;
+    const Int n = FixedOr<N>( nDyn );
+    const Int aBS = sA.batchStride;
+    for( Int k=0; k<n; ++k )
+    {
+        F* alpha11 = &A[k*(sA.rowStride+sA.colStride)];
+        for( Int t=0; t<count; ++t )
+        {
+            const Real alpha = RealPart(alpha11[t*aBS]);
+            if( alpha <= Real(0) )
+            {
+                failed[t] = 1;
+                alpha11[t*aBS] = 1;
+            }
+            else
+                alpha11[t*aBS] = Sqrt(alpha);
+        }
+
+        F* a21 = &A[k*sA.colStride];
+        for( Int i=k+1; i<n; ++i )
+            for( Int t=0; t<count; ++t )
+                a21[i*sA.rowStride+t*aBS] /= RealPart(alpha11[t*aBS]);
+
+        // A22 := A22 - a21 a21^H (lower triangle only)
+        for( Int j=k+1; j<n; ++j )
+        {
+            const F* gamma = &a21[j*sA.rowStride];
+            F* a = &A[j*sA.colStride];
+            for( Int i=j; i<n; ++i )
+            {
+                const F* delta = &a21[i*sA.rowStride];
+                for( Int t=0; t<count; ++t )
+                    a[i*sA.rowStride+t*aBS] -=
+                      delta[t*aBS]*Conj(gamma[t*aBS]);
+            }
+        }
+    }
+}
+
+template<typename F>
+struct CholeskyCall
+{
+    Int n;
+    F* A; Strides sA;
+    Int count;
+    byte* failed;
+
+    template<Int N>
+    void Run() const
+    { CholeskyKernel<N>( n, A, sA, count, failed ); }
+};
+
+// The upper-triangular case, A = U^H U, is handled by applying the lower
+// kernel to the transpose of the stored upper triangle, which holds the
+// lower triangle of conj(A) = U^T conj(U)
+template<typename F>
+inline void CholeskyChunk
+( UpperOrLower uplo, Int n, F* A, Strides sA, Int count, byte* failed )
+{
+    if( uplo == UPPER )
+        sA.Transpose();
+    const CholeskyCall<F> call = { n, A, sA, count, failed };
+    DispatchSize( n, call );
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_CHOLESKY_HPP
@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_BATCHED_LU_HPP
+#define EL_BATCHED_LU_HPP
+
+namespace El {
+namespace batched {
+
+// Overwrite each m x n matrix of a chunk with its LU factorization with
+// partial pivoting. Column t of p (with leading dimension 'pLDim') is set to
+// the row permutation of the t'th matrix in the same format as LU(A,p).
+//
+// The pivot searches and row swaps necessarily differ between the matrices,
+// but the subsequent Schur-complement updates are uniform across the chunk.
+template<Int N,typename F>
+inline void LUKernel
+( Int mDyn, Int nDyn, F* A, const Strides& sA,
+  Int* p, Int pLDim, Int count, byte* failed )
+{
+    typedef Base<F> Real;
+    const Int m = FixedOr<N>( mDyn );
+    const Int n = FixedOr<N>( nDyn );
+    const Int minDim = Min(m,n);
+    const Int aBS = sA.batchStride;
+    for( Int t=0; t<count; ++t )
+        for( Int i=0; i<m; ++i )
+            p[i+t*pLDim] = i;
+
+    for( Int k=0; k<minDim; ++k )
+    {
+        for( Int t=0; t<count; ++t )
+        {
+            F* At = &A[t*aBS];
+            Int iPiv = k;
+            Real pivMag = Abs(At[k*(sA.rowStride+sA.colStride)]);
+            for( Int i=k+1; i<m; ++i )
+            {
+                const Real mag = Abs(At[i*sA.rowStride+k*sA.colStride]);
+                if( mag > pivMag )
+                {
+                    iPiv = i;
+                    pivMag = mag;
+                }
+            }
+            if( pivMag == Real(0) )
+            {
+                failed[t] = 1;
+                At[k*(sA.rowStride+sA.colStride)] = 1;
+            }
+            else if( iPiv != k )
+            {
+                for( Int j=0; j<n; ++j )
+                    std::swap
+                    ( At[k*sA.rowStride+j*sA.colStride],
+                      At[iPiv*sA.rowStride+j*sA.colStride] );
+                std::swap( p[k+t*pLDim], p[iPiv+t*pLDim] );
+            }
+        }
+
+        const F* alpha11 = &A[k*(sA.rowStride+sA.colStride)];
+        F* a21 = &A[k*sA.colStride];
+        for( Int i=k+1; i<m; ++i )
+            for( Int t=0; t<count; ++t )
+                a21[i*sA.rowStride+t*aBS] /= alpha11[t*aBS];
+
+        // A22 := A22 - a21 a12
+        const F* a12 = &A[k*sA.rowStride];
+        for( Int j=k+1; j<n; ++j )
+        {
+            const F* eta = &a12[j*sA.colStride];
+            F* a = &A[j*sA.colStride];
+            for( Int i=k+1; i<m; ++i )
+            {
+                const F* delta = &a21[i*sA.rowStride];
+                for( Int t=0; t<count; ++t )
+                    a[i*sA.rowStride+t*aBS] -= delta[t*aBS]*eta[t*aBS];
+            }
+        }
+    }
+}
+
+template<typename F>
+struct LUCall
+{
+    Int m, n;
+    F* A; Strides sA;
+    Int* p; Int pLDim;
+    Int count;
+    byte* failed;
+
+    template<Int N>
+    void Run() const
+    { LUKernel<N>( m, n, A, sA, p, pLDim, count, failed ); }
+};
+
+template<typename F>
+inline void LUChunk
+( Int m, Int n, F* A, const Strides& sA,
+  Int* p, Int pLDim, Int count, byte* failed )
+{
+    const LUCall<F> call = { m, n, A, sA, p, pLDim, count, failed };
+    if( m == n )
+        DispatchSize( n, call );
+    else
+        call.template Run<0>();
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_LU_HPP
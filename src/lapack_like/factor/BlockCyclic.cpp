@@ -0,0 +1,212 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "../../blas_like/level3/BlockCyclic/Util.hpp"
+
+namespace El {
+
+// Right-looking factorizations which operate directly upon the local storage
+// of [MC,MR] block distributions, with the algorithmic blocksize equal to
+// the distribution blocksize (as in ScaLAPACK). Every panel is owned by a
+// single process row or column, and the trailing updates are local GEMMs.
+
+template<typename F>
+void Cholesky( UpperOrLower uplo, AbstractBlockDistMatrix<F>& A )
+{
+    DEBUG_ONLY(
+      CSE cse("Cholesky");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    block::AssertMCMR( A );
+    const block::Layout rows = block::ColLayout( A );
+    const block::Layout cols = block::RowLayout( A );
+    const Int n = A.Height();
+    Matrix<F>& ALoc = A.Matrix();
+    const Int localHeight = ALoc.Height();
+    const Int localWidth = ALoc.Width();
+
+    Matrix<F> A11, X1, Y1, Z1;
+    for( Int k0=0; k0<n; )
+    {
+        const Int k1 = Min( rows.BlockEnd(k0), cols.BlockEnd(k0) );
+        const Int nb = k1 - k0;
+        const Int iLoc0 = rows.Offset(k0), iLoc1 = rows.Offset(k1);
+        const Int jLoc0 = cols.Offset(k0), jLoc1 = cols.Offset(k1);
+        const bool ownRow = ( A.ColRank() == rows.Owner(k0) );
+        const bool ownCol = ( A.RowRank() == cols.Owner(k0) );
+
+        // The process column (row) which owns the panel redundantly factors
+        // the diagonal block, and then shares whether it failed with the
+        // rest of its process rows (columns) so that every process throws
+        const bool lower = ( uplo == LOWER );
+        const bool inTeam = ( lower ? ownCol : ownRow );
+        block::BlockBroadcast
+        ( A, k0, k1, k0, k1, !lower,
+          lower ? cols.Owner(k0) : rows.Owner(k0), A11 );
+        byte failed = 0;
+        if( inTeam )
+        {
+            try { Cholesky( uplo, A11 ); }
+            catch( const NonHPDMatrixException& e ) { failed = 1; }
+        }
+        if( lower )
+            mpi::Broadcast( failed, cols.Owner(k0), A.RowComm() );
+        else
+            mpi::Broadcast( failed, rows.Owner(k0), A.ColComm() );
+        if( failed )
+            throw NonHPDMatrixException();
+        if( ownRow && ownCol )
+        {
+            auto A11Loc = View( ALoc, iLoc0, jLoc0, nb, nb );
+            A11Loc = A11;
+        }
+
+        if( uplo == LOWER )
+        {
+            // A21 := A21 L11^-H within the owning process column
+            if( ownCol )
+            {
+                auto A21 = View( ALoc, iLoc1, jLoc0, localHeight-iLoc1, nb );
+                Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+            }
+            // A22 := A22 - L21 L21^H
+            block::RowBroadcast( A, k0, k1, iLoc1, localHeight, X1 );
+            block::TransposeRows( X1, rows, cols, k1, A.ColComm(), Z1 );
+            Adjoint( Z1, Y1 );
+            block::TriangularUpdate
+            ( LOWER, rows, cols, k1, F(-1), X1, Y1, ALoc );
+        }
+        else
+        {
+            // A12 := U11^-H A12 within the owning process row
+            if( ownRow )
+            {
+                auto A12 = View( ALoc, iLoc0, jLoc1, nb, localWidth-jLoc1 );
+                Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 );
+            }
+            // A22 := A22 - U12^H U12
+            block::ColBroadcast( A, k0, k1, jLoc1, localWidth, Y1 );
+            Adjoint( Y1, Z1 );
+            block::TransposeRows( Z1, cols, rows, k1, A.RowComm(), X1 );
+            block::TriangularUpdate
+            ( UPPER, rows, cols, k1, F(-1), X1, Y1, ALoc );
+        }
+        k0 = k1;
+    }
+}
+
+template<typename F>
+void LU( AbstractBlockDistMatrix<F>& A, AbstractDistMatrix<Int>& p )
+{
+    DEBUG_ONLY(CSE cse("LU"))
+    block::AssertMCMR( A );
+    const block::Layout rows = block::ColLayout( A );
+    const block::Layout cols = block::RowLayout( A );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    Matrix<F>& ALoc = A.Matrix();
+    const Int localHeight = ALoc.Height();
+    const Int localWidth = ALoc.Width();
+
+    // Every process tracks the full permutation
+    vector<Int> perm( m );
+    for( Int i=0; i<m; ++i )
+        perm[i] = i;
+
+    Matrix<F> APan, X1, U12;
+    Matrix<Int> pPan;
+    vector<Int> permPan, permCopy;
+    for( Int k0=0; k0<minDim; )
+    {
+        const Int k1 =
+          Min( minDim, Min( rows.BlockEnd(k0), cols.BlockEnd(k0) ) );
+        const Int nb = k1 - k0;
+        const Int iLoc0 = rows.Offset(k0), iLoc1 = rows.Offset(k1);
+        const Int jLoc0 = cols.Offset(k0), jLoc1 = cols.Offset(k1);
+        const int panelOwner = cols.Owner(k0);
+        const bool ownRow = ( A.ColRank() == rows.Owner(k0) );
+        const bool ownCol = ( A.RowRank() == panelOwner );
+
+        // The owning process column gathers the panel A(k0:m,k0:k1) and
+        // redundantly factors it. The local rows of the result and the
+        // panel permutation (followed by a singularity flag) are then
+        // broadcast within each process row.
+        permPan.resize( m-k0+1 );
+        X1.Resize( localHeight-iLoc0, nb, Max(localHeight-iLoc0,Int(1)) );
+        if( ownCol )
+        {
+            auto APanLoc =
+              LockedView( ALoc, iLoc0, jLoc0, localHeight-iLoc0, nb );
+            block::TransposeRows
+            ( APanLoc, rows, block::Replicated(m), k0, A.ColComm(), APan );
+            bool singular = false;
+            try { LU( APan, pPan ); }
+            catch( const SingularMatrixException& e ) { singular = true; }
+            for( Int i=0; i<m-k0; ++i )
+                permPan[i] = ( singular ? i : pPan.Get(i,0) );
+            permPan[m-k0] = singular;
+            for( Int ii=0; ii<localHeight-iLoc0; ++ii )
+            {
+                const Int i = rows.Global(iLoc0+ii) - k0;
+                for( Int t=0; t<nb; ++t )
+                    X1.Set( ii, t, APan.Get(i,t) );
+            }
+        }
+        mpi::Broadcast( permPan.data(), m-k0+1, panelOwner, A.RowComm() );
+        if( permPan[m-k0] )
+            throw SingularMatrixException();
+        mpi::Broadcast
+        ( X1.Buffer(), (localHeight-iLoc0)*nb, panelOwner, A.RowComm() );
+
+        // Apply the panel's row interchanges to the remainder of the matrix
+        // and then overwrite the panel with its factorization
+        block::PermuteRows( ALoc, rows, k0, permPan.data(), A.ColComm() );
+        permCopy.assign( perm.begin()+k0, perm.end() );
+        for( Int i=0; i<m-k0; ++i )
+            perm[k0+i] = permCopy[permPan[i]];
+        if( ownCol )
+        {
+            auto APanLoc = View( ALoc, iLoc0, jLoc0, localHeight-iLoc0, nb );
+            APanLoc = X1;
+        }
+
+        // U12 := L11^-1 A12 within the owning process row
+        if( ownRow )
+        {
+            auto L11 = LockedView( X1, 0, 0, nb, nb );
+            auto A12 = View( ALoc, iLoc0, jLoc1, nb, localWidth-jLoc1 );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, A12 );
+        }
+
+        // A22 := A22 - L21 U12
+        block::ColBroadcast( A, k0, k1, jLoc1, localWidth, U12 );
+        auto L21 = LockedView( X1, iLoc1-iLoc0, 0, localHeight-iLoc1, nb );
+        auto A22 =
+          View( ALoc, iLoc1, jLoc1, localHeight-iLoc1, localWidth-jLoc1 );
+        Gemm( NORMAL, NORMAL, F(-1), L21, U12, F(1), A22 );
+        k0 = k1;
+    }
+
+    p.Resize( m, 1 );
+    for( Int iLoc=0; iLoc<p.LocalHeight(); ++iLoc )
+        for( Int jLoc=0; jLoc<p.LocalWidth(); ++jLoc )
+            p.SetLocal( iLoc, jLoc, perm[p.GlobalRow(iLoc)] );
+}
+
+#define PROTO(F) \
+  template void Cholesky( UpperOrLower uplo, AbstractBlockDistMatrix<F>& A ); \
+  template void LU( AbstractBlockDistMatrix<F>& A, AbstractDistMatrix<Int>& p );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -67,6 +67,7 @@ template<typename F>
 void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A )
 {
     DEBUG_ONLY(CSE cse("Cholesky"))
+    BlocksizeStackEntry bse( RegimeBlocksize(A.Height()) );
     if( uplo == LOWER )
         cholesky::LVar3( A );
     else
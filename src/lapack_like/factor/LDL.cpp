@@ -115,6 +115,167 @@ void LDL
     ChangeFrontType( front, newType );
 }
 
+namespace ldl {
+
+// Decide whether the factorization fits within the budget, perhaps only if
+// the completed fronts are streamed to disk
+inline bool StreamFronts
+( const FactorMemory& pred, const FactorMemoryCtrl& ctrl, mpi::Comm comm )
+{
+    if( ctrl.budget <= 0 )
+        return false;
+    const double peak = mpi::AllReduce( pred.peak, mpi::MAX, comm );
+    if( peak <= ctrl.budget )
+        return false;
+    const double streamedPeak =
+      mpi::AllReduce( pred.streamedPeak, mpi::MAX, comm );
+    if( streamedPeak > ctrl.budget )
+        RuntimeError
+        ("The factorization is predicted to require ",streamedPeak,
+         " bytes even when streaming fronts to disk, but the budget is ",
+         ctrl.budget," bytes");
+    return true;
+}
+
+// Each of the blocked forward and backward solves against the diagonal block
+// of a distributed front of size s requires roughly ceil(s/nb) collectives
+// over the front's team of p processes, whereas, after inverting the block
+// for roughly s^3/(3p) flops per process, each becomes a single Gemm with
+// an extra s^2 r/p flops per process. Since the fronts are traversed in
+// sequence, the costs are summed over each process's distributed path. The
+// break-even point of each process is formed before taking the worst case,
+// as the largest inversion cost and the smallest savings need not belong to
+// the same process.
+Int SelInvBreakEven( const DistNodeInfo& info, const SelInvCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ldl::SelInvBreakEven"))
+    const Int nb = Blocksize();
+    const double r = Max( ctrl.numRHS, Int(1) );
+    double invertCost=0, solveSavings=0;
+    for( const DistNodeInfo* node=&info; node->child!=nullptr;
+         node=node->child )
+    {
+        const double s = node->size;
+        const int p = mpi::Size( node->comm );
+        const Int numSteps = (node->size+nb-1)/nb;
+        Int numHops = 0;
+        while( (1<<numHops) < p )
+            ++numHops;
+        invertCost += s*s*s/(3*p);
+        solveSavings +=
+          2.*(numSteps-1)*numHops*ctrl.latencyFlops - 2*s*s*r/p;
+    }
+
+    // A process which saves nothing (e.g., when there are no distributed
+    // fronts) never breaks even, and neither does a break-even point which
+    // cannot be represented as an Int
+    double breakEven = std::numeric_limits<double>::infinity();
+    if( solveSavings > 0 )
+        breakEven = Max( std::ceil(invertCost/solveSavings), 1. );
+    breakEven = mpi::AllReduce( breakEven, mpi::MAX, info.comm );
+    if( breakEven >= double(std::numeric_limits<Int>::max()) )
+        return -1;
+    return Int(breakEven);
+}
+
+LDLFrontType SelInvFrontType
+( const DistNodeInfo& info, LDLFrontType type, const SelInvCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ldl::SelInvFrontType"))
+    if( Unfactored(type) || BlockFactorization(type) ||
+        SelInvFactorization(type) )
+        return type;
+
+    const Int breakEven = SelInvBreakEven( info, ctrl );
+    const bool selInv = ( breakEven >= 0 && ctrl.numSolves >= breakEven );
+    if( ctrl.progress && mpi::Rank(info.comm) == 0 )
+    {
+        if( breakEven < 0 )
+            cout << "Selective inversion is not predicted to ever pay off"
+                 << endl;
+        else
+            cout << "Selective inversion is predicted to pay off after "
+                 << breakEven << " solves (" << ctrl.numSolves
+                 << " are expected)" << endl;
+    }
+    return ( selInv ? AppendSelInv(type) : type );
+}
+
+} // namespace ldl
+
+template<typename F>
+void LDL
+( const ldl::NodeInfo& info, ldl::Front<F>& front, LDLFrontType newType,
+  const ldl::FactorMemoryCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LDL"))
+    if( !Unfactored(front.type) )
+        LogicError("Matrix is already factored");
+
+    const auto pred = ldl::PredictMemory<F>( info, newType );
+    const bool stream =
+      ldl::StreamFronts( pred, ctrl, mpi::COMM_SELF ) || ctrl.outOfCore;
+
+    ChangeFrontType( front, SYMM_2D );
+    if( stream )
+    {
+        auto store =
+          std::make_shared<ldl::FrontStore<F>>( ctrl.scratchBase );
+        ldl::Process( info, front, InitialFactorType(newType), store.get() );
+        store->Finish( front, ctrl.outOfCore );
+        if( ctrl.outOfCore )
+            front.storeOwner = store;
+        else
+            store->LoadAll();
+    }
+    else
+        ldl::Process( info, front, InitialFactorType(newType) );
+    ChangeFrontType( front, newType );
+}
+
+template<typename F>
+void LDL
+( const ldl::DistNodeInfo& info, ldl::DistFront<F>& front,
+  LDLFrontType newType, const ldl::FactorMemoryCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LDL"))
+    if( !Unfactored(front.type) )
+        LogicError("Matrix is already factored");
+
+    const auto pred = ldl::PredictMemory<F>( info, newType );
+    const bool stream =
+      ldl::StreamFronts( pred, ctrl, info.comm ) || ctrl.outOfCore;
+
+    ChangeFrontType( front, SYMM_2D );
+    if( stream )
+    {
+        auto store =
+          std::make_shared<ldl::FrontStore<F>>( ctrl.scratchBase );
+        ldl::Process( info, front, InitialFactorType(newType), store.get() );
+
+        ldl::DistFront<F>* leafFront = &front;
+        while( leafFront->child != nullptr )
+            leafFront = leafFront->child;
+        auto& rootDup = *leafFront->duplicate;
+        store->Finish( rootDup, ctrl.outOfCore );
+        if( ctrl.outOfCore )
+            front.storeOwner = store;
+        else
+            store->LoadAll();
+    }
+    else
+        ldl::Process( info, front, InitialFactorType(newType) );
+    ChangeFrontType( front, newType );
+}
+
+template<typename F>
+void LDL
+( const ldl::DistNodeInfo& info, ldl::DistFront<F>& front,
+  LDLFrontType newType, const ldl::SelInvCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LDL"))
+    LDL( info, front, ldl::SelInvFrontType(info,newType,ctrl) );
+}
 
 #define PROTO(F) \
   template void LDL( Matrix<F>& A, bool conjugate ); \
@@ -159,7 +320,16 @@ void LDL
   ( const ldl::NodeInfo& info, ldl::Front<F>& front, LDLFrontType newType ); \
   template void LDL \
   ( const ldl::DistNodeInfo& info, ldl::DistFront<F>& front, \
-    LDLFrontType newType );
+    LDLFrontType newType ); \
+  template void LDL \
+  ( const ldl::NodeInfo& info, ldl::Front<F>& front, \
+    LDLFrontType newType, const ldl::FactorMemoryCtrl& ctrl ); \
+  template void LDL \
+  ( const ldl::DistNodeInfo& info, ldl::DistFront<F>& front, \
+    LDLFrontType newType, const ldl::FactorMemoryCtrl& ctrl ); \
+  template void LDL \
+  ( const ldl::DistNodeInfo& info, ldl::DistFront<F>& front, \
+    LDLFrontType newType, const ldl::SelInvCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #include "El/macros/Instantiate.h"
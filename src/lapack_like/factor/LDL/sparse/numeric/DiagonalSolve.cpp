@@ -19,6 +19,8 @@
 */
 #include "El.hpp"
 
+#include "./FrontStore.hpp"
+
 namespace El {
 namespace ldl {
 
@@ -32,12 +34,14 @@ void DiagonalSolve
     for( Int c=0; c<numChildren; ++c )
         DiagonalSolve( *info.children[c], *front.children[c], *X.children[c] );
 
+    AcquireFront( front );
     if( PivotedFactorization(front.type) )
         QuasiDiagonalSolve
         ( LEFT, LOWER, front.diag, front.subdiag, 
           X.matrix, front.isHermitian );
     else
         DiagonalSolve( LEFT, NORMAL, front.diag, X.matrix, true );
+    ReleaseFront( front );
 }
 
 template<typename F>
@@ -64,6 +64,9 @@ void DistFront<F>::Pull
           LogicError("Local mapping was not the right size");
     )
     const bool time = false;
+
+    // Discard any out-of-core storage of a previous factorization
+    storeOwner.reset();
    
     mpi::Comm comm = A.Comm();
     const int commSize = mpi::Size( comm );
@@ -74,73 +74,34 @@ DistMultiVecNode<T>::operator=( const DistMatrixNode<T>& X )
     return *this;
 }
 
+// Compute the (width-independent) pattern for exchanging the rows of X with
+// the nodal rows (which must already be allocated) and cache it on the root
 template<typename T>
-void DistMultiVecNode<T>::Pull
+void ComputeMultiVecMeta
 ( const DistMap& invMap, const DistNodeInfo& info,
-  const DistMultiVec<T>& X )
+  const DistMultiVecNode<T>& XNodal, const DistMultiVec<T>& X )
 {
-    DEBUG_ONLY(CSE cse("DistMultiVecNode::Pull"))
-    const Int width = X.Width();
-
-    // Count the number of indices assigned to this process
-    // (and build the subtree)
-    int numRecvInds = 0;
-    function<void(const NodeInfo&,MatrixNode<T>&)> localCount =
-      [&]( const NodeInfo& node, MatrixNode<T>& XNode )
-      {
-        const Int numChildren = node.children.size();
-        XNode.children.resize(numChildren);
-        for( Int c=0; c<numChildren; ++c )
-        {
-            XNode.children[c] = new MatrixNode<T>(&XNode);
-            localCount( *node.children[c], *XNode.children[c] );
-        }
-
-        XNode.matrix.Resize( node.size, width );
-        numRecvInds += node.size;
-      };
-    function<void(const DistNodeInfo&,DistMultiVecNode<T>&)> count =
-      [&]( const DistNodeInfo& node, DistMultiVecNode<T>& XNode )
-      {
-        if( node.child == nullptr )
-        {
-            delete XNode.duplicate;
-            XNode.duplicate = new MatrixNode<T>(&XNode);
-            localCount( *node.duplicate, *XNode.duplicate );
+    DEBUG_ONLY(CSE cse("ldl::ComputeMultiVecMeta"))
+    auto& meta = info.multiVecMeta;
+    meta.Clear();
 
-            XNode.matrix.Attach( *node.grid, XNode.duplicate->matrix );
-
-            return;
-        }
-        XNode.child = new DistMultiVecNode<T>(&XNode);
-        count( *node.child, *XNode.child );
-
-        XNode.commMeta.Empty();
-        XNode.matrix.SetGrid( *node.grid );
-        XNode.matrix.Resize( node.size, width );
-        numRecvInds += XNode.matrix.LocalHeight();
-      };
-    count( info, *this );
-   
     // Pack the indices for mapping to the original ordering
-    Int off = 0;
-    vector<Int> mappedInds( numRecvInds );
-    function<void(const NodeInfo&,MatrixNode<T>&)> localPack =
-      [&]( const NodeInfo& node, MatrixNode<T>& XNode )
+    auto& mappedInds = meta.mappedInds;
+    mappedInds.reserve( XNodal.LocalHeight() );
+    function<void(const NodeInfo&)> localPack =
+      [&]( const NodeInfo& node )
       {
-        const Int numChildren = node.children.size();
-        for( Int c=0; c<numChildren; ++c )
-            localPack( *node.children[c], *XNode.children[c] );
-
+        for( const NodeInfo* child : node.children )
+            localPack( *child );
         for( Int t=0; t<node.size; ++t )
-            mappedInds[off++] = node.off+t;
+            mappedInds.push_back( node.off+t );
       };
-    function<void(const DistNodeInfo&,DistMultiVecNode<T>&)> pack =
-      [&]( const DistNodeInfo& node, DistMultiVecNode<T>& XNode )
+    function<void(const DistNodeInfo&,const DistMultiVecNode<T>&)> pack =
+      [&]( const DistNodeInfo& node, const DistMultiVecNode<T>& XNode )
       {
         if( node.child == nullptr )
         {
-            localPack( *node.duplicate, *XNode.duplicate );
+            localPack( *node.duplicate );
             return;
         }
         pack( *node.child, *XNode.child );
@@ -148,10 +109,10 @@ void DistMultiVecNode<T>::Pull
         for( Int tLoc=0; tLoc<XNode.matrix.LocalHeight(); ++tLoc )
         {
             const Int t = XNode.matrix.GlobalRow(tLoc);
-            mappedInds[off++] = node.off+t;
+            mappedInds.push_back( node.off+t );
         }
       };
-    pack( info, *this );
+    pack( info, XNodal );
 
     // Convert the indices to the original ordering
     invMap.Translate( mappedInds );
@@ -159,13 +120,13 @@ void DistMultiVecNode<T>::Pull
     // Figure out how many entries each process owns that we need
     mpi::Comm comm = X.Comm();
     const int commSize = mpi::Size( comm );
-    vector<int> recvSizes( commSize, 0 );
+    const int numRecvInds = mappedInds.size();
+    meta.recvSizes.resize( commSize, 0 );
     for( int s=0; s<numRecvInds; ++s )
-        ++recvSizes[ X.RowOwner( mappedInds[s] ) ];
-    vector<int> recvOffs;
-    Scan( recvSizes, recvOffs );
+        ++meta.recvSizes[ X.RowOwner( mappedInds[s] ) ];
+    Scan( meta.recvSizes, meta.recvOffs );
     vector<Int> recvInds( numRecvInds );
-    auto offs = recvOffs;
+    auto offs = meta.recvOffs;
     for( int s=0; s<numRecvInds; ++s )
     {
         const Int i = mappedInds[s];
@@ -173,33 +134,102 @@ void DistMultiVecNode<T>::Pull
     }
 
     // Coordinate for the coming AllToAll to exchange the indices of X
-    vector<int> sendSizes(commSize);
-    mpi::AllToAll( recvSizes.data(), 1, sendSizes.data(), 1, comm );
-    vector<int> sendOffs;
-    const int numSendInds = Scan( sendSizes, sendOffs );
+    meta.sendSizes.resize( commSize );
+    mpi::AllToAll
+    ( meta.recvSizes.data(), 1, meta.sendSizes.data(), 1, comm );
+    const int numSendInds = Scan( meta.sendSizes, meta.sendOffs );
 
     // Request the indices
-    vector<Int> sendInds( numSendInds );
+    meta.sendInds.resize( numSendInds );
     mpi::AllToAll
-    ( recvInds.data(), recvSizes.data(), recvOffs.data(),
-      sendInds.data(), sendSizes.data(), sendOffs.data(), comm );
+    ( recvInds.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(), 
+      comm );
+
+    meta.height = X.Height();
+    meta.commSize = commSize;
+    meta.ready = true;
+}
+
+template<typename T>
+void DistMultiVecNode<T>::Pull
+( const DistMap& invMap, const DistNodeInfo& info,
+  const DistMultiVec<T>& X )
+{
+    DEBUG_ONLY(CSE cse("DistMultiVecNode::Pull"))
+    const Int width = X.Width();
+
+    // Size the nodal matrices (and build the subtree if it does not yet 
+    // exist, as the tree and its communication metadata are reused by 
+    // subsequent Pull's)
+    function<void(const NodeInfo&,MatrixNode<T>&)> localCount =
+      [&]( const NodeInfo& node, MatrixNode<T>& XNode )
+      {
+        const Int numChildren = node.children.size();
+        XNode.children.resize(numChildren,nullptr);
+        for( Int c=0; c<numChildren; ++c )
+        {
+            if( XNode.children[c] == nullptr )
+                XNode.children[c] = new MatrixNode<T>(&XNode);
+            localCount( *node.children[c], *XNode.children[c] );
+        }
+
+        XNode.matrix.Resize( node.size, width );
+      };
+    function<void(const DistNodeInfo&,DistMultiVecNode<T>&)> count =
+      [&]( const DistNodeInfo& node, DistMultiVecNode<T>& XNode )
+      {
+        if( node.child == nullptr )
+        {
+            if( XNode.duplicate == nullptr )
+                XNode.duplicate = new MatrixNode<T>(&XNode);
+            localCount( *node.duplicate, *XNode.duplicate );
+
+            XNode.matrix.Attach( *node.grid, XNode.duplicate->matrix );
+
+            return;
+        }
+        if( XNode.child == nullptr )
+        {
+            XNode.child = new DistMultiVecNode<T>(&XNode);
+            XNode.commMeta.Empty();
+        }
+        count( *node.child, *XNode.child );
+
+        XNode.matrix.SetGrid( *node.grid );
+        XNode.matrix.Resize( node.size, width );
+      };
+    count( info, *this );
+
+    const auto& meta = info.multiVecMeta;
+    if( !meta.ready || meta.height != X.Height() ||
+        meta.commSize != mpi::Size(X.Comm()) )
+        ComputeMultiVecMeta( invMap, info, *this, X );
+    const auto& mappedInds = meta.mappedInds;
+    const int numRecvInds = mappedInds.size();
+    const int numSendInds = meta.sendInds.size();
 
     // Fulfill the requests
     vector<T> sendVals( numSendInds*width );
     const Int firstLocalRow = X.FirstLocalRow();
     for( Int s=0; s<numSendInds; ++s )
         for( Int j=0; j<width; ++j )
-            sendVals[s*width+j] = X.GetLocal( sendInds[s]-firstLocalRow, j );
+            sendVals[s*width+j] = 
+              X.GetLocal( meta.sendInds[s]-firstLocalRow, j );
 
     // Reply with the values
-    vector<T> recvVals( numRecvInds*width );
+    mpi::Comm comm = X.Comm();
+    const int commSize = mpi::Size( comm );
+    vector<int> sendSizes(commSize), sendOffs(commSize),
+                recvSizes(commSize), recvOffs(commSize);
     for( int q=0; q<commSize; ++q )
     {
-        sendSizes[q] *= width;
-        sendOffs[q] *= width;
-        recvSizes[q] *= width;
-        recvOffs[q] *= width;
+        sendSizes[q] = meta.sendSizes[q]*width;
+        sendOffs[q] = meta.sendOffs[q]*width;
+        recvSizes[q] = meta.recvSizes[q]*width;
+        recvOffs[q] = meta.recvOffs[q]*width;
     }
+    vector<T> recvVals( numRecvInds*width );
     mpi::AllToAll
     ( sendVals.data(), sendSizes.data(), sendOffs.data(),
       recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
@@ -208,8 +238,8 @@ void DistMultiVecNode<T>::Pull
     SwapClear( sendOffs );
 
     // Unpack the values
-    off = 0;
-    offs = recvOffs;
+    Int off = 0;
+    auto offs = recvOffs;
     function<void(const NodeInfo&,MatrixNode<T>&)> localUnpack =
       [&]( const NodeInfo& node, MatrixNode<T>& XNode )
       {
@@ -284,60 +314,24 @@ void DistMultiVecNode<T>::Push
     X.SetComm( comm );
     X.Resize( height, width );
 
-    // Fill the set of indices that we need to map to the original ordering
-    const int numSendInds = LocalHeight();
-    vector<Int> mappedInds( numSendInds );
-    {
-        Int off=0;
-
-        function<void(const NodeInfo&,MatrixNode<T>&)> localPack = 
-          [&]( const NodeInfo& node, MatrixNode<T>& XNode )
-          {
-            const Int numChildren = node.children.size();
-            for( Int c=0; c<numChildren; ++c )
-                localPack( *node.children[c], *XNode.children[c] );
-
-            for( Int t=0; t<node.size; ++t )
-                mappedInds[off++] = node.off+t;
-          };
-        function<void(const DistNodeInfo&,const DistMultiVecNode<T>&)> 
-          pack = 
-          [&]( const DistNodeInfo& node, const DistMultiVecNode<T>& XNode )
-          {
-            if( node.child == nullptr )
-            {
-                localPack( *node.duplicate, *XNode.duplicate );
-                return;
-            }
-            pack( *node.child, *XNode.child );
-
-            const Int nodeHeight = XNode.matrix.Height();
-            const Int colShift = XNode.matrix.ColShift();
-            const Int colStride = XNode.matrix.ColStride();
-            for( Int t=colShift; t<nodeHeight; t+=colStride )
-                mappedInds[off++] = node.off+t;
-          };
-
-        pack( info, *this );
-    }
-
-    // Convert the indices to the original ordering
-    invMap.Translate( mappedInds );
-
-    // Figure out how many indices each process owns that we need to send
-    const int commSize = mpi::Size( comm );
-    vector<int> sendSizes(commSize,0);
-    for( Int s=0; s<numSendInds; ++s )
-        ++sendSizes[ X.RowOwner(mappedInds[s]) ];
-    vector<int> sendOffs;
-    Scan( sendSizes, sendOffs );
+    // The send and recv roles of the cached metadata are reversed
+    const auto& meta = info.multiVecMeta;
+    if( !meta.ready || meta.height != height ||
+        meta.commSize != mpi::Size(comm) )
+        ComputeMultiVecMeta( invMap, info, *this, X );
+    const auto& mappedInds = meta.mappedInds;
+    const int numSendInds = mappedInds.size();
+    const int numRecvInds = meta.sendInds.size();
+    DEBUG_ONLY(
+      if( numRecvInds != X.LocalHeight() )
+          LogicError("numRecvInds was not equal to local height");
+    )
 
-    // Pack the send indices and values
+    // Pack the send values
     vector<T> sendVals( numSendInds*width );
-    vector<Int> sendInds( numSendInds );
     {
         Int off=0;
-        auto offs = sendOffs;
+        auto offs = meta.recvOffs;
 
         function<void(const NodeInfo&,const MatrixNode<T>&)> localPack = 
           [&]( const NodeInfo& node, const MatrixNode<T>& XNode )
@@ -352,7 +346,7 @@ void DistMultiVecNode<T>::Push
                 const int q = X.RowOwner(i);
                 for( Int j=0; j<width; ++j )
                     sendVals[offs[q]*width+j] = XNode.matrix.Get(t,j);    
-                sendInds[offs[q]++] = i;
+                ++offs[q];
             }
           };
         function<void(const DistNodeInfo&,const DistMultiVecNode<T>&)> 
@@ -373,37 +367,24 @@ void DistMultiVecNode<T>::Push
                 const int q = X.RowOwner(i);
                 for( Int j=0; j<width; ++j )
                     sendVals[offs[q]*width+j] = XNode.matrix.GetLocal(tLoc,j);
-                sendInds[offs[q]++] = i;
+                ++offs[q];
             }
           };
         pack( info, *this );
     }
 
-    // Coordinate for the coming AllToAll to exchange the indices of x
-    vector<int> recvSizes(commSize);
-    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm );
-    vector<int> recvOffs;
-    const int numRecvInds = Scan( recvSizes, recvOffs );
-    DEBUG_ONLY(
-      if( numRecvInds != X.LocalHeight() )
-          LogicError("numRecvInds was not equal to local height");
-    )
-
-    // Send the indices
-    vector<Int> recvInds( numRecvInds );
-    mpi::AllToAll
-    ( sendInds.data(), sendSizes.data(), sendOffs.data(),
-      recvInds.data(), recvSizes.data(), recvOffs.data(), comm );
-
     // Send the values
-    vector<T> recvVals( numRecvInds*width );
+    const int commSize = mpi::Size( comm );
+    vector<int> sendSizes(commSize), sendOffs(commSize),
+                recvSizes(commSize), recvOffs(commSize);
     for( int q=0; q<commSize; ++q )
     {
-        sendSizes[q] *= width;
-        sendOffs[q] *= width;
-        recvSizes[q] *= width;
-        recvOffs[q] *= width;
+        sendSizes[q] = meta.recvSizes[q]*width;
+        sendOffs[q] = meta.recvOffs[q]*width;
+        recvSizes[q] = meta.sendSizes[q]*width;
+        recvOffs[q] = meta.sendOffs[q]*width;
     }
+    vector<T> recvVals( numRecvInds*width );
     mpi::AllToAll
     ( sendVals.data(), sendSizes.data(), sendOffs.data(),
       recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
@@ -415,8 +396,7 @@ void DistMultiVecNode<T>::Push
     const Int firstLocalRow = X.FirstLocalRow();
     for( Int s=0; s<numRecvInds; ++s )
     {
-        const Int i = recvInds[s];
-        const Int iLoc = i - firstLocalRow;
+        const Int iLoc = meta.sendInds[s] - firstLocalRow;
         for( Int j=0; j<width; ++j )
             X.SetLocal( iLoc, j, recvVals[s*width+j] );
     }
@@ -24,7 +24,7 @@ namespace ldl {
 
 template<typename F>
 Front<F>::Front( Front<F>* parentNode )
-: parent(parentNode), duplicate(nullptr)
+: parent(parentNode), duplicate(nullptr), store(nullptr)
 { 
     if( parentNode != nullptr )
     {
@@ -35,7 +35,7 @@ Front<F>::Front( Front<F>* parentNode )
 
 template<typename F>
 Front<F>::Front( DistFront<F>* dupNode )
-: parent(nullptr), duplicate(dupNode)
+: parent(nullptr), duplicate(dupNode), store(nullptr)
 {
     isHermitian = dupNode->isHermitian;
     type = dupNode->type;
@@ -47,7 +47,7 @@ Front<F>::Front
   const vector<Int>& reordering,
   const NodeInfo& info,
   bool conjugate )
-: parent(nullptr), duplicate(nullptr)
+: parent(nullptr), duplicate(nullptr), store(nullptr)
 {
     DEBUG_ONLY(CSE cse("Front::Front"))
     Pull( A, reordering, info, conjugate );
@@ -81,7 +81,9 @@ void Front<F>::Pull
     function<void(const NodeInfo&,Front<F>&)> pull = 
       [&]( const NodeInfo& node, Front<F>& front )
       {
-        // Delete any existing children
+        // Discard any out-of-core storage before deleting existing children
+        front.store = nullptr;
+        front.storeOwner.reset();
         for( Front<F>* child : front.children )
             delete child;
 
@@ -201,6 +203,8 @@ void Front<F>::Push
   const NodeInfo& rootInfo ) const
 {
     DEBUG_ONLY(CSE cse("Front::Push"))
+    if( store != nullptr )
+        LogicError("Cannot push out-of-core fronts");
 
     // Invert the reordering
     const Int n = reordering.size();
@@ -261,6 +265,8 @@ template<typename F>
 void Front<F>::Unpack( SparseMatrix<F>& A, const NodeInfo& rootInfo ) const
 {
     DEBUG_ONLY(CSE cse("Front::Push"))
+    if( store != nullptr )
+        LogicError("Cannot unpack out-of-core fronts");
     const Int n = rootInfo.off + rootInfo.size;
     Zeros( A, n, n );
 
@@ -313,6 +319,8 @@ template<typename F>
 const Front<F>& Front<F>::operator=( const Front<F>& front )
 {
     DEBUG_ONLY(CSE cse("Front::operator="))
+    if( front.store != nullptr )
+        LogicError("Cannot copy out-of-core fronts");
     isHermitian = front.isHermitian;
     type = front.type;
     L = front.L;
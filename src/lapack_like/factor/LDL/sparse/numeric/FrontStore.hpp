@@ -0,0 +1,290 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_LDL_FRONTSTORE_HPP
+#define EL_LDL_FRONTSTORE_HPP
+
+#include <atomic>
+#include <future>
+#include <unordered_map>
+#ifdef _WIN32
+# include <process.h>
+#else
+# include <unistd.h>
+#endif
+
+namespace El {
+namespace ldl {
+
+// Factored sequential fronts are appended to a scratch file as raw,
+// column-major data (without any leading-dimension padding) and then freed.
+// Since the shapes are kept in memory, a front can be read back with a single
+// seek, and the solves read the next front of their traversal on a separate
+// thread while the current front is in use. Only raw file I/O is performed
+// on that thread, as the call stack and the memory of the matrices are not
+// thread-safe.
+//
+// Every store writes to its own file, '<basename>-<rank>-<pid>-<count>.bin',
+// so that several stores (e.g., of concurrent sequential factorizations,
+// or of separate jobs sharing a directory) never truncate or remove each
+// other's files.
+
+inline string ScratchFilename( const string& basename )
+{
+    static std::atomic<Int> count(0);
+#ifdef _WIN32
+    const long pid = _getpid();
+#else
+    const long pid = getpid();
+#endif
+    ostringstream os;
+    os << basename << "-" << mpi::WorldRank() << "-" << pid << "-"
+       << count++ << "." << FileExtension(BINARY);
+    return os.str();
+}
+
+template<typename F>
+class FrontStore
+{
+public:
+    FrontStore( const string& basename )
+    : filename_(ScratchFilename(basename))
+    {
+        DEBUG_ONLY(CSE cse("FrontStore::FrontStore"))
+        out_.open( filename_.c_str(), std::ios::binary );
+        if( !out_.is_open() )
+            RuntimeError("Could not open ",filename_);
+    }
+
+    ~FrontStore()
+    {
+        if( pending_.valid() )
+            pending_.wait();
+        in_.close();
+        out_.close();
+        std::remove( filename_.c_str() );
+    }
+
+    // Append a factored front to the file and free it
+    void Write( Front<F>& front )
+    {
+        DEBUG_ONLY(CSE cse("FrontStore::Write"))
+        Entry& entry = entries_[&front];
+        entry.offset = out_.tellp();
+        WriteMatrix( front.L, entry.L );
+        WriteMatrix( front.diag, entry.diag );
+        WriteMatrix( front.subdiag, entry.subdiag );
+        WriteMatrix( front.piv, entry.piv );
+        if( !out_.good() )
+            RuntimeError("Could not write front to ",filename_);
+        entry.loaded = false;
+        front.L.Empty();
+        front.diag.Empty();
+        front.subdiag.Empty();
+        front.piv.Empty();
+    }
+
+    // Switch from writing to reading and record the orders in which the
+    // stored fronts of the tree rooted at 'root' are traversed. If 'outOfCore'
+    // is true, each front of the tree is pointed to this store.
+    void Finish( Front<F>& root, bool outOfCore )
+    {
+        DEBUG_ONLY(CSE cse("FrontStore::Finish"))
+        out_.close();
+        in_.open( filename_.c_str(), std::ios::binary );
+        if( !in_.is_open() )
+            RuntimeError("Could not open ",filename_);
+        postorder_.clear();
+        preorder_.clear();
+        Traverse( root, outOfCore );
+    }
+
+    // Read every stored front back into memory
+    void LoadAll()
+    {
+        DEBUG_ONLY(CSE cse("FrontStore::LoadAll"))
+        for( const Front<F>* front : postorder_ )
+        {
+            Entry& entry = entries_[front];
+            if( !entry.loaded )
+            {
+                Resize( *front, entry );
+                ReadEntry( entry );
+            }
+        }
+    }
+
+    // Ensure that 'front' is in memory and begin reading the front which
+    // follows it in either a postorder or preorder traversal
+    void Acquire( const Front<F>& front, bool preorder=false )
+    {
+        DEBUG_ONLY(CSE cse("FrontStore::Acquire"))
+        auto it = entries_.find( &front );
+        if( it == entries_.end() )
+            return;
+        Wait();
+        Entry& entry = it->second;
+        if( !entry.loaded )
+        {
+            Resize( front, entry );
+            ReadEntry( entry );
+        }
+
+        const auto& order = ( preorder ? preorder_ : postorder_ );
+        const Int next = ( preorder ? entry.prePos : entry.postPos ) + 1;
+        if( next < Int(order.size()) )
+        {
+            const Front<F>& nextFront = *order[next];
+            Entry& nextEntry = entries_[&nextFront];
+            if( !nextEntry.loaded )
+            {
+                Resize( nextFront, nextEntry );
+                pending_ =
+                  std::async
+                  ( std::launch::async,
+                    [this,&nextEntry]() { ReadEntry( nextEntry ); } );
+            }
+        }
+    }
+
+    // Free a stored front which is no longer needed
+    void Release( const Front<F>& front )
+    {
+        DEBUG_ONLY(CSE cse("FrontStore::Release"))
+        auto it = entries_.find( &front );
+        if( it == entries_.end() || !it->second.loaded )
+            return;
+        if( pending_.valid() )
+            pending_.wait();
+        auto& mutableFront = const_cast<Front<F>&>(front);
+        mutableFront.L.Empty();
+        mutableFront.diag.Empty();
+        mutableFront.subdiag.Empty();
+        mutableFront.piv.Empty();
+        it->second.loaded = false;
+    }
+
+private:
+    // The buffer and (byte) leading dimension of a matrix which is being read
+    // are set on the main thread
+    struct Shape
+    {
+        Int height, width;
+        size_t entrySize, ldim;
+        char* buffer;
+    };
+    struct Entry
+    {
+        std::streamoff offset;
+        Shape L, diag, subdiag, piv;
+        Int postPos, prePos;
+        bool loaded;
+    };
+
+    string filename_;
+    ofstream out_;
+    ifstream in_;
+    std::unordered_map<const Front<F>*,Entry> entries_;
+    vector<const Front<F>*> postorder_, preorder_;
+    std::future<void> pending_;
+
+    template<typename T>
+    void WriteMatrix( const Matrix<T>& A, Shape& shape )
+    {
+        shape.height = A.Height();
+        shape.width = A.Width();
+        shape.entrySize = sizeof(T);
+        for( Int j=0; j<shape.width; ++j )
+            out_.write
+            ( (const char*)A.LockedBuffer(0,j), shape.height*sizeof(T) );
+    }
+
+    template<typename T>
+    void ResizeMatrix( Matrix<T>& A, Shape& shape )
+    {
+        A.Resize( shape.height, shape.width );
+        shape.ldim = A.LDim()*sizeof(T);
+        shape.buffer = (char*)A.Buffer();
+    }
+
+    void Resize( const Front<F>& front, Entry& entry )
+    {
+        auto& mutableFront = const_cast<Front<F>&>(front);
+        ResizeMatrix( mutableFront.L, entry.L );
+        ResizeMatrix( mutableFront.diag, entry.diag );
+        ResizeMatrix( mutableFront.subdiag, entry.subdiag );
+        ResizeMatrix( mutableFront.piv, entry.piv );
+        entry.loaded = true;
+    }
+
+    // Performs no allocations and no calls into the library so that it may
+    // be run on the prefetching thread
+    void ReadMatrix( const Shape& shape )
+    {
+        for( Int j=0; j<shape.width; ++j )
+            in_.read
+            ( &shape.buffer[j*shape.ldim], shape.height*shape.entrySize );
+    }
+
+    void ReadEntry( const Entry& entry )
+    {
+        in_.clear();
+        in_.seekg( entry.offset );
+        ReadMatrix( entry.L );
+        ReadMatrix( entry.diag );
+        ReadMatrix( entry.subdiag );
+        ReadMatrix( entry.piv );
+        if( !in_.good() )
+            RuntimeError("Could not read front from ",filename_);
+    }
+
+    void Wait()
+    {
+        if( pending_.valid() )
+            pending_.get();
+    }
+
+    void Traverse( Front<F>& front, bool outOfCore )
+    {
+        auto it = entries_.find( &front );
+        if( it != entries_.end() )
+        {
+            it->second.prePos = preorder_.size();
+            preorder_.push_back( &front );
+        }
+        if( outOfCore )
+            front.store = this;
+        for( auto* child : front.children )
+            Traverse( *child, outOfCore );
+        if( it != entries_.end() )
+        {
+            it->second.postPos = postorder_.size();
+            postorder_.push_back( &front );
+        }
+    }
+};
+
+template<typename F>
+inline void AcquireFront( const Front<F>& front, bool preorder=false )
+{
+    if( front.store != nullptr )
+        front.store->Acquire( front, preorder );
+}
+
+template<typename F>
+inline void ReleaseFront( const Front<F>& front )
+{
+    if( front.store != nullptr )
+        front.store->Release( front );
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_FRONTSTORE_HPP
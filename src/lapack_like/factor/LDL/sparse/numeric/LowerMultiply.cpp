@@ -8,6 +8,7 @@
 */
 #include "El.hpp"
 
+#include "./FrontStore.hpp"
 #include "./LowerMultiply/Forward.hpp"
 #include "./LowerMultiply/Backward.hpp"
 
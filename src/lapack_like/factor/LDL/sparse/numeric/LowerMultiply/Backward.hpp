@@ -50,7 +50,8 @@ inline void LowerBackwardMultiply
     {
         // Set up a workspace for the child
         auto& childW = X.children[c]->work;
-        childW.Resize( front.children[c]->L.Height(), numRHS );
+        const auto& childInfo = *info.children[c];
+        childW.Resize( childInfo.size+childInfo.lowerStruct.size(), numRHS );
         Matrix<F> childWT, childWB; 
         PartitionDown( childW, childWT, childWB, info.children[c]->size );
         childWT = X.children[c]->matrix;
@@ -69,7 +70,9 @@ inline void LowerBackwardMultiply
         LowerBackwardMultiply
         ( *info.children[c], *front.children[c], *X.children[c], conjugate );
 
+    AcquireFront( front );
     FrontLowerBackwardMultiply( front, W, conjugate );
+    ReleaseFront( front );
     if( haveParent )
     {
         X.matrix = W( IR(0,info.size), IR(0,numRHS) );
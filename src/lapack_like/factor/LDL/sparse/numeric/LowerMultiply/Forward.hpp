@@ -41,6 +41,7 @@ inline void LowerForwardMultiply
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
     //       (or a duplicate's parent)
+    AcquireFront( front );
     auto& W = X.work;
     const Int numRHS = X.matrix.Width();
     W.Resize( front.L.Height(), numRHS );
@@ -51,6 +52,7 @@ inline void LowerForwardMultiply
 
     // Multiply against this front
     FrontLowerForwardMultiply( front, W );
+    ReleaseFront( front );
 
     // Update using the children (if they exist)
     for( Int c=0; c<numChildren; ++c )
@@ -8,6 +8,7 @@
 */
 #include "El.hpp"
 
+#include "./FrontStore.hpp"
 #include "./LowerSolve/Forward.hpp"
 #include "./LowerSolve/Backward.hpp"
 
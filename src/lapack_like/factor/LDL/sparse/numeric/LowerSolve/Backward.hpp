@@ -44,7 +44,9 @@ inline void LowerBackwardSolve
                                      : (haveDupMatParent ? dupMat->work.Matrix()
                                                          : X.matrix)));
 
+    AcquireFront( front, true );
     FrontLowerBackwardSolve( front, W, conjugate );
+    ReleaseFront( front );
 
     const Int numRHS = X.matrix.Width();
     if( haveParent || haveDupMVParent || haveDupMatParent )
@@ -55,7 +57,8 @@ inline void LowerBackwardSolve
     {
         // Set up a workspace for the child
         auto& childW = X.children[c]->work;
-        childW.Resize( front.children[c]->L.Height(), numRHS );
+        const auto& childInfo = *info.children[c];
+        childW.Resize( childInfo.size+childInfo.lowerStruct.size(), numRHS );
         Matrix<F> childWT, childWB; 
         PartitionDown( childW, childWT, childWB, info.children[c]->size );
         childWT = X.children[c]->matrix;
@@ -41,6 +41,7 @@ inline void LowerForwardSolve
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
     //       (or a duplicate's parent)
+    AcquireFront( front );
     auto& W = X.work;
     const Int numRHS = X.matrix.Width();
     W.Resize( front.L.Height(), numRHS );
@@ -69,6 +70,7 @@ inline void LowerForwardSolve
 
     // Solve against this front
     FrontLowerForwardSolve( front, W );
+    ReleaseFront( front );
 
     // Store this node's portion of the result
     X.matrix = WT;
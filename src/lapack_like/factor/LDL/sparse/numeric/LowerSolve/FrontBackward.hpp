@@ -630,15 +630,19 @@ inline void FrontLowerBackwardSolve
         LogicError("Cannot solve against an unfactored matrix");
     const bool blocked = BlockFactorization(type);
 
+    // See FrontLowerForwardSolve
+    const bool singleL11AllGather = ( W.Width() < Blocksize() );
+
     if( type == LDL_1D )
-        FrontVanillaLowerBackwardSolve( front.L1D, W, conjugate );
+        FrontVanillaLowerBackwardSolve
+        ( front.L1D, W, conjugate, singleL11AllGather );
     else if( type == LDL_SELINV_1D )
         FrontFastLowerBackwardSolve( front.L1D, W, conjugate );
     else if( type == LDL_SELINV_2D )
         FrontFastLowerBackwardSolve( front.L2D, W, conjugate );
     else if( type == LDL_INTRAPIV_1D )
         FrontIntraPivLowerBackwardSolve
-        ( front.L1D, front.piv, W, conjugate );
+        ( front.L1D, front.piv, W, conjugate, singleL11AllGather );
     else if( type == LDL_INTRAPIV_SELINV_1D )
         FrontFastIntraPivLowerBackwardSolve
         ( front.L1D, front.piv, W, conjugate );
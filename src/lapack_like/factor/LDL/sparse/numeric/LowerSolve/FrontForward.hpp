@@ -582,14 +582,20 @@ FrontLowerForwardSolve
     DEBUG_ONLY(CSE cse("ldl::FrontLowerForwardSolve"))
     const LDLFrontType type = front.type;
 
+    // Once there are at least as many right-hand sides as the blocksize, 
+    // AllGather'ing each diagonal block of L along with the corresponding rows
+    // of W is cheaper than AllReduce'ing those rows
+    const bool singleL11AllGather = ( W.Width() < Blocksize() );
+
     if( type == LDL_1D )
-        FrontVanillaLowerForwardSolve( front.L1D, W );
+        FrontVanillaLowerForwardSolve( front.L1D, W, singleL11AllGather );
     else if( type == LDL_SELINV_1D )
         FrontFastLowerForwardSolve( front.L1D, W );
     else if( type == LDL_SELINV_2D )
         FrontFastLowerForwardSolve( front.L2D, W );
     else if( type == LDL_INTRAPIV_1D )
-        FrontIntraPivLowerForwardSolve( front.L1D, front.piv, W );
+        FrontIntraPivLowerForwardSolve
+        ( front.L1D, front.piv, W, singleL11AllGather );
     else if( type == LDL_INTRAPIV_SELINV_1D )
         FrontFastIntraPivLowerForwardSolve( front.L1D, front.piv, W );
     else if( type == LDL_INTRAPIV_SELINV_2D )
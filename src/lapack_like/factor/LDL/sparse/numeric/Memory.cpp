@@ -0,0 +1,291 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// The predictions mirror the allocations made by ldl::Process and
+// ChangeFrontType: all of the fronts are allocated when they are pulled from
+// the sparse matrix, the update matrix of a sequential front is allocated
+// after its first child has been processed (see NodeInfo::firstChild), and
+// the update matrix of a distributed front is allocated after the updates of
+// its children have been exchanged.
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+template<typename F>
+double TempBytes( Int size, Int updateSize, LDLFrontType factorType )
+{
+    const double height = size + updateSize;
+    const double nb = Min(Blocksize(),size);
+    double temp = ((height-nb)*nb + nb)*sizeof(F);
+    if( BlockFactorization(factorType) || PivotedFactorization(factorType) )
+        temp = Max( temp, double(updateSize)*size*sizeof(F) );
+    return temp;
+}
+
+template<typename F>
+double ExtraBytes( Int size, LDLFrontType factorType )
+{
+    if( BlockFactorization(factorType) )
+        return 0;
+    double extra = double(size)*sizeof(F);
+    if( PivotedFactorization(factorType) )
+        extra += double(Max(size-1,Int(0)))*sizeof(F) +
+                 double(size)*sizeof(Int);
+    return extra;
+}
+
+struct SubtreeMemory
+{
+    double fronts;       // the unfactored fronts of the subtree
+    double extra;        // the diagonals and pivots of the subtree
+    double update;       // the peak of the update matrices and temporaries
+    double streamedPeak; // the peak of the streamed subtree
+};
+
+template<typename F>
+SubtreeMemory PredictSubtree
+( const NodeInfo& info, LDLFrontType factorType, bool isRoot )
+{
+    const Int size = info.size;
+    const Int updateSize = info.lowerStruct.size();
+    const double front = double(size+updateSize)*size*sizeof(F);
+    const double work = double(updateSize)*updateSize*sizeof(F);
+    const double temp = TempBytes<F>( size, updateSize, factorType );
+    const double extra = ExtraBytes<F>( size, factorType );
+    // Completed fronts are only written to disk if they are not the root
+    const double kept = ( isRoot ? front+extra : 0 );
+
+    SubtreeMemory mem;
+    mem.fronts = front;
+    mem.extra = extra;
+    mem.update = work + temp;
+    mem.streamedPeak = front + work + temp + extra;
+
+    const Int numChildren = info.children.size();
+    if( numChildren == 0 )
+    {
+        mem.streamedPeak = Max( mem.streamedPeak, kept );
+        return mem;
+    }
+
+    vector<SubtreeMemory> childMems(numChildren);
+    for( Int c=0; c<numChildren; ++c )
+    {
+        childMems[c] =
+          PredictSubtree<F>( *info.children[c], factorType, false );
+        mem.fronts += childMems[c].fronts;
+        mem.extra += childMems[c].extra;
+    }
+    vector<Int> order;
+    const Int first = info.firstChild;
+    order.push_back( first );
+    for( Int c=0; c<numChildren; ++c )
+        if( c != first )
+            order.push_back( c );
+
+    double remaining = mem.fronts - front;
+    for( Int k=0; k<numChildren; ++k )
+    {
+        const Int c = order[k];
+        const auto& childInfo = *info.children[c];
+        const Int childUpdateSize = childInfo.lowerStruct.size();
+        const double childWork =
+          double(childUpdateSize)*childUpdateSize*sizeof(F);
+        const double parentWork = ( k == 0 ? 0 : work );
+        remaining -= childMems[c].fronts;
+
+        mem.update = Max( mem.update, parentWork+childMems[c].update );
+        mem.update = Max( mem.update, childWork+work );
+        mem.streamedPeak =
+          Max( mem.streamedPeak,
+               remaining+front+parentWork+childMems[c].streamedPeak );
+        mem.streamedPeak =
+          Max( mem.streamedPeak, remaining+front+childWork+work );
+    }
+    mem.streamedPeak = Max( mem.streamedPeak, kept );
+    return mem;
+}
+
+// The number of entries of the lower triangle of an n x n matrix stored on
+// this process when it is distributed over the given column and row shifts
+double LocalLowerEntries
+( Int n, Int colShift, Int colStride, Int rowShift, Int rowStride )
+{
+    const Int localHeight = Length( n, colShift, colStride );
+    double numEntries = 0;
+    for( Int j=rowShift; j<n; j+=rowStride )
+        numEntries += localHeight - Length( j, colShift, colStride );
+    return numEntries;
+}
+
+} // anonymous namespace
+
+template<typename F>
+FactorMemory PredictMemory( const NodeInfo& info, LDLFrontType type )
+{
+    DEBUG_ONLY(CSE cse("ldl::PredictMemory"))
+    const LDLFrontType factorType = InitialFactorType( type );
+    const auto mem = PredictSubtree<F>( info, factorType, true );
+
+    FactorMemory pred;
+    pred.initial = mem.fronts;
+    pred.factor = mem.fronts + mem.extra;
+    pred.update = mem.update;
+    pred.peak = mem.fronts + mem.extra + mem.update;
+    pred.streamedPeak = Max( mem.streamedPeak, pred.factor );
+    return pred;
+}
+
+template<typename F>
+FactorMemory PredictMemory( const DistNodeInfo& rootInfo, LDLFrontType type )
+{
+    DEBUG_ONLY(CSE cse("ldl::PredictMemory"))
+    const LDLFrontType factorType = InitialFactorType( type );
+    const bool finalIs1D = FrontIs1D( type );
+
+    // Walk down to the sequential subtree
+    vector<const DistNodeInfo*> path;
+    const DistNodeInfo* info = &rootInfo;
+    while( info->child != nullptr )
+    {
+        path.push_back( info );
+        info = info->child;
+    }
+    const NodeInfo& leafInfo = *info->duplicate;
+    const auto leafMem = PredictSubtree<F>( leafInfo, factorType, true );
+    const Int leafUpdateSize = leafInfo.lowerStruct.size();
+    const double leafFront =
+      double(leafInfo.size+leafUpdateSize)*leafInfo.size*sizeof(F);
+
+    double distFronts=0, distExtra=0, dist1D=0, max1D=0, distUpdate=0;
+    double childWork = double(leafUpdateSize)*leafUpdateSize*sizeof(F);
+    double childSend = double(leafUpdateSize)*(leafUpdateSize+1)/2*sizeof(F);
+    for( auto it=path.rbegin(); it!=path.rend(); ++it )
+    {
+        const DistNodeInfo& node = **it;
+        const Grid& g = *node.grid;
+        const Int height = g.Height();
+        const Int width = g.Width();
+        const Int commSize = g.Size();
+        const Int size = node.size;
+        const Int updateSize = node.lowerStruct.size();
+        const Int frontHeight = size + updateSize;
+
+        const double front =
+          double(Length(frontHeight,g.Row(),height))*
+          double(Length(size,g.Col(),width))*sizeof(F);
+        const double front1D =
+          double(Length(frontHeight,g.VCRank(),commSize))*size*sizeof(F);
+        distFronts += front;
+        dist1D += front1D;
+        max1D = Max( max1D, front1D );
+        if( !BlockFactorization(factorType) )
+        {
+            const Int localSize = Length( size, g.VCRank(), commSize );
+            distExtra += double(localSize)*sizeof(F);
+            if( PivotedFactorization(factorType) )
+                distExtra += double(localSize)*(sizeof(F)+sizeof(Int));
+        }
+
+        // The update matrix is aligned with the bottom-right of the front
+        const Int colShift = Shift( g.Row(), size % height, height );
+        const Int rowShift = Shift( g.Col(), size % width, width );
+        const double work =
+          double(Length(updateSize,colShift,height))*
+          double(Length(updateSize,rowShift,width))*sizeof(F);
+
+        // Count the child update entries which are received by this process
+        double numRecv = 0;
+        for( Int c=0; c<2; ++c )
+        {
+            const auto& relInds = node.childRelInds[c];
+            vector<Int> rowInds, colInds;
+            for( Int k=0; k<Int(relInds.size()); ++k )
+            {
+                if( relInds[k] % height == g.Row() )
+                    rowInds.push_back( k );
+                if( relInds[k] % width == g.Col() )
+                    colInds.push_back( k );
+            }
+            for( const Int jChild : colInds )
+            {
+                auto rowIt =
+                  std::lower_bound( rowInds.begin(), rowInds.end(), jChild );
+                numRecv += rowInds.end() - rowIt;
+            }
+        }
+        const double recv = numRecv*sizeof(F);
+        const double meta = 2*numRecv*sizeof(Int) + commSize*sizeof(int);
+
+        // Panel temporaries of the distributed front factorizations
+        const Int nb = Min(Blocksize(),size);
+        const Int panelHeight = frontHeight - nb;
+        double temp = double(nb)*(nb+1)*sizeof(F) +
+          double(nb)*(Length(panelHeight,g.VCRank(),commSize)+
+                      Length(panelHeight,g.Row(),height)+
+                      Length(panelHeight,g.Col(),width))*sizeof(F);
+        if( BlockFactorization(factorType) )
+            temp += double(Length(updateSize,g.Row(),height))*
+                    double(Length(size,g.Col(),width))*sizeof(F);
+        else if( PivotedFactorization(factorType) )
+            temp = Max
+              ( temp,
+                double(size)*(Length(updateSize,g.Row(),height)+
+                              Length(updateSize,g.VRRank(),commSize)+
+                              Length(updateSize,g.Col(),width))*sizeof(F) );
+
+        distUpdate = Max( distUpdate, childWork+meta+childSend );
+        distUpdate = Max( distUpdate, meta+childSend+recv );
+        distUpdate = Max( distUpdate, meta+recv+work );
+        distUpdate = Max( distUpdate, work+temp );
+
+        childWork = work;
+        childSend =
+          LocalLowerEntries(updateSize,colShift,height,rowShift,width)*
+          sizeof(F);
+    }
+
+    const double seqFactor = leafMem.fronts + leafMem.extra;
+    const double factor2D = distFronts + distExtra + seqFactor;
+
+    FactorMemory pred;
+    pred.initial = distFronts + leafMem.fronts;
+    pred.factor = ( finalIs1D ? dist1D : distFronts ) + distExtra + seqFactor;
+    pred.update = Max( leafMem.update, distUpdate );
+    pred.peak = factor2D + pred.update;
+    pred.streamedPeak =
+      distFronts + distExtra +
+      Max( leafMem.streamedPeak, leafFront+leafMem.extra+distUpdate );
+    pred.streamedPeak = Max( pred.streamedPeak, factor2D );
+    if( finalIs1D )
+    {
+        // A front is redistributed into a new buffer before the old one is
+        // freed
+        pred.peak = Max( pred.peak, factor2D+2*max1D );
+        pred.streamedPeak = Max( pred.streamedPeak, factor2D+2*max1D );
+    }
+    return pred;
+}
+
+#define PROTO(F) \
+  template FactorMemory PredictMemory<F> \
+  ( const NodeInfo& info, LDLFrontType type ); \
+  template FactorMemory PredictMemory<F> \
+  ( const DistNodeInfo& info, LDLFrontType type );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace ldl
+} // namespace El
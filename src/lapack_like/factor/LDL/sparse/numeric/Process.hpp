@@ -22,13 +22,18 @@
 #define EL_LDL_PROCESS_HPP
 
 #include "./ProcessFront.hpp"
+#include "./FrontStore.hpp"
 
 namespace El {
 namespace ldl {
 
+// Completed fronts (other than the root of the subtree, which a distributed
+// front may be attached to) are written to 'store' if it is non-null
 template<typename F> 
 inline void 
-Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+Process
+( const NodeInfo& info, Front<F>& front, LDLFrontType factorType,
+  FrontStore<F>* store=nullptr )
 {
     DEBUG_ONLY(CSE cse("ldl::Process"))
 
@@ -41,12 +46,17 @@ Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
           LogicError("Front was not the proper size");
     )
 
-    // Process children and add in their updates
-    Zeros( FBR, updateSize, updateSize );
+    // Process the child with the most demanding subtree before allocating
+    // the update matrix of this front, then the remaining children, and add
+    // in their updates as soon as each is complete
     const int numChildren = info.children.size();
-    for( Int c=0; c<numChildren; ++c )
+    const Int firstChild = info.firstChild;
+    for( Int k=0; k<numChildren; ++k )
     {
-        Process( *info.children[c], *front.children[c], factorType );
+        const Int c = ( k == 0 ? firstChild : (k <= firstChild ? k-1 : k) );
+        Process( *info.children[c], *front.children[c], factorType, store );
+        if( k == 0 )
+            Zeros( FBR, updateSize, updateSize );
 
         auto& childU = front.children[c]->work;
         const int childUSize = childU.Height();
@@ -65,14 +75,19 @@ Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
         }
         childU.Empty();
     }
+    if( numChildren == 0 )
+        Zeros( FBR, updateSize, updateSize );
 
     ProcessFront( front, factorType );
+    if( store != nullptr && front.parent != nullptr )
+        store->Write( front );
 }
 
 template<typename F>
 inline void
 Process
-( const DistNodeInfo& info, DistFront<F>& front, LDLFrontType factorType )
+( const DistNodeInfo& info, DistFront<F>& front, LDLFrontType factorType,
+  FrontStore<F>* store=nullptr )
 {
     DEBUG_ONLY(CSE cse("ldl::Process"))
 
@@ -82,7 +97,7 @@ Process
         const Grid& grid = *info.grid;
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        Process( *info.duplicate, frontDup, factorType, store );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
@@ -102,7 +117,7 @@ Process
 
     const auto& childInfo = *info.child;
     auto& childFront = *front.child;
-    Process( childInfo, childFront, factorType );
+    Process( childInfo, childFront, factorType, store );
 
     const Int updateSize = info.lowerStruct.size();
     front.work.Empty();
@@ -194,6 +209,7 @@ Process
     SwapClear( recvBuf );
     SwapClear( recvSizes );
     SwapClear( recvOffs );
+    front.commMeta.Empty();
 
     ProcessFront( front, factorType );
 }
@@ -67,6 +67,15 @@ void SolveAfter
 {
     DEBUG_ONLY(CSE cse("ldl::SolveAfter"))
 
+    // NOTE: Wide right-hand sides are not given a separate 2D layout.
+    // The 2D fronts already solve against [MC,MR] nodal matrices, while the
+    // 1D front kernels only accept [VC,* ] right-hand sides and instead switch
+    // to per-block L11 AllGathers once X is at least a blocksize wide (see
+    // FrontLowerForwardSolve). Nor are blocks of right-hand sides pipelined
+    // through the tree, as that would require nonblocking collectives, which
+    // the nodal solves do not use; since the redistribution pattern is cached
+    // on 'info', a caller may instead loop over column blocks of X without
+    // repeating any setup.
     if( FrontIs1D(front.type) )
     {
         DistMultiVecNode<F> XNodal( invMap, info, X );
@@ -0,0 +1,290 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// Relaxed supernode amalgamation in the spirit of Ashcraft and Grimes,
+// "The influence of relaxed supernode partitions on the multifrontal method",
+// followed by the child ordering of Liu, "On the storage requirement in the
+// out-of-core multifrontal method for sparse factorization".
+//
+// Since the structure of a child is always contained within the union of its
+// parent's indices and the structure of its parent, merging a child into its
+// parent leaves the structure of the parent unchanged, and the number of
+// explicit zeros which are introduced only depends upon the front sizes.
+// The merged fronts (and the reordered children) are renumbered with a
+// postorder traversal so that every front still owns a contiguous range of
+// the reordering.
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+struct AmalgNode
+{
+    // The indices (in the original reordering) and the original graph
+    // vertices of the pivots of this front, in elimination order
+    vector<Int> inds, sepInds;
+    // The original lower structure in the original reordering
+    vector<Int> origStruct;
+    Int structSize;
+    // The number of entries of the lower trapezoid of the front which are
+    // known to be zero
+    double zeros;
+    // The peak size of the update stack while processing this subtree
+    double peak;
+    vector<Int> children;
+};
+
+inline double FactorEntries( double size, double structSize )
+{ return size*(size+1)/2 + size*structSize; }
+
+inline double UpdateEntries( double structSize )
+{ return structSize*(structSize+1)/2; }
+
+// Flatten the tree into 'pool' and return the full lower structure of 'node'
+vector<Int> Flatten
+( const Separator& sep, const Node& node, vector<AmalgNode>& pool, Int& index )
+{
+    const Int numChildren = node.children.size();
+    DEBUG_ONLY(
+      if( Int(sep.children.size()) != numChildren )
+          LogicError("Separator and node trees did not match");
+    )
+    index = pool.size();
+    pool.emplace_back();
+    pool[index].children.resize( numChildren );
+
+    auto fullStruct = node.lowerStruct;
+    for( Int c=0; c<numChildren; ++c )
+    {
+        Int childIndex;
+        auto childStruct =
+          Flatten( *sep.children[c], *node.children[c], pool, childIndex );
+        pool[index].children[c] = childIndex;
+        fullStruct = Union( fullStruct, childStruct );
+    }
+    // Remove the pivots of this front from the union of the child structures
+    const Int nodeEnd = node.off + node.size;
+    auto it = std::lower_bound( fullStruct.begin(), fullStruct.end(), nodeEnd );
+    fullStruct.erase( fullStruct.begin(), it );
+
+    AmalgNode& amalg = pool[index];
+    amalg.inds.resize( node.size );
+    for( Int t=0; t<node.size; ++t )
+        amalg.inds[t] = node.off + t;
+    amalg.sepInds = sep.inds;
+    amalg.origStruct = node.lowerStruct;
+    amalg.structSize = fullStruct.size();
+    amalg.zeros = 0;
+    return fullStruct;
+}
+
+void MergeChildren( vector<AmalgNode>& pool, Int index, const BisectCtrl& ctrl )
+{
+    for( const Int child : pool[index].children )
+        MergeChildren( pool, child, ctrl );
+
+    AmalgNode& parent = pool[index];
+    while( true )
+    {
+        // Find the child whose merge would result in the smallest fraction
+        // of explicit zeros
+        const Int numChildren = parent.children.size();
+        Int bestChild = -1;
+        double bestRatio=0, bestZeros=0;
+        bool bestIsFree = false;
+        for( Int c=0; c<numChildren; ++c )
+        {
+            const AmalgNode& child = pool[parent.children[c]];
+            const Int mergedSize = parent.inds.size() + child.inds.size();
+            const double mergedEntries =
+              FactorEntries( mergedSize, parent.structSize );
+            const double newZeros = mergedEntries -
+              FactorEntries( child.inds.size(), child.structSize ) -
+              FactorEntries( parent.inds.size(), parent.structSize );
+            const double zeros = parent.zeros + child.zeros + newZeros;
+            const double ratio = zeros / mergedEntries;
+            if( bestChild == -1 || ratio < bestRatio )
+            {
+                bestChild = c;
+                bestRatio = ratio;
+                bestZeros = zeros;
+                bestIsFree = ( newZeros == 0 );
+            }
+        }
+        if( bestChild == -1 )
+            break;
+        const Int childIndex = parent.children[bestChild];
+        AmalgNode& child = pool[childIndex];
+        const Int mergedSize = parent.inds.size() + child.inds.size();
+        if( !bestIsFree && mergedSize > ctrl.relaxSize &&
+            bestRatio > ctrl.relaxFill )
+            break;
+
+        // Eliminate the pivots of the child immediately before those of the
+        // parent and adopt the children of the child
+        child.inds.insert
+        ( child.inds.end(), parent.inds.begin(), parent.inds.end() );
+        parent.inds.swap( child.inds );
+        child.sepInds.insert
+        ( child.sepInds.end(), parent.sepInds.begin(), parent.sepInds.end() );
+        parent.sepInds.swap( child.sepInds );
+        parent.origStruct = Union( parent.origStruct, child.origStruct );
+        parent.zeros = bestZeros;
+        parent.children.erase( parent.children.begin()+bestChild );
+        parent.children.insert
+        ( parent.children.begin()+bestChild,
+          child.children.begin(), child.children.end() );
+        SwapClear( child.inds );
+        SwapClear( child.sepInds );
+        SwapClear( child.origStruct );
+        SwapClear( child.children );
+    }
+}
+
+// Order the children by decreasing difference between their peak stack
+// usage and the size of their update matrix, which minimizes the peak of
+// the stack (Liu's ordering), and return the peak for this subtree
+double OrderChildren( vector<AmalgNode>& pool, Int index )
+{
+    for( const Int child : pool[index].children )
+        OrderChildren( pool, child );
+
+    AmalgNode& node = pool[index];
+    std::stable_sort
+    ( node.children.begin(), node.children.end(),
+      [&]( Int a, Int b )
+      { return pool[a].peak - UpdateEntries(pool[a].structSize) >
+               pool[b].peak - UpdateEntries(pool[b].structSize); } );
+
+    double stackSize=0, peak=0;
+    for( const Int child : node.children )
+    {
+        peak = Max( peak, stackSize+pool[child].peak );
+        stackSize += UpdateEntries( pool[child].structSize );
+    }
+    const Int size = node.inds.size();
+    const double frontSize = UpdateEntries( size+node.structSize );
+    node.peak = Max( peak, stackSize+frontSize );
+    return node.peak;
+}
+
+void Renumber
+( const vector<AmalgNode>& pool, Int index, Int subtreeOff,
+  vector<Int>& newInds, vector<Int>& newOffs, Int& counter )
+{
+    for( const Int child : pool[index].children )
+        Renumber( pool, child, subtreeOff, newInds, newOffs, counter );
+    newOffs[index] = counter;
+    for( const Int i : pool[index].inds )
+        newInds[i-subtreeOff] = counter++;
+}
+
+void Rebuild
+( const vector<AmalgNode>& pool, Int index, Int subtreeOff,
+  const vector<Int>& newInds, const vector<Int>& newOffs,
+  Separator& sep, Node& node )
+{
+    const AmalgNode& amalg = pool[index];
+    const Int numChildren = amalg.children.size();
+    sep.children.resize( numChildren );
+    node.children.resize( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        sep.children[c] = new Separator(&sep);
+        node.children[c] = new Node(&node);
+        Rebuild
+        ( pool, amalg.children[c], subtreeOff, newInds, newOffs,
+          *sep.children[c], *node.children[c] );
+    }
+
+    const Int size = amalg.inds.size();
+    const Int subtreeSize = newInds.size();
+    const Int off = newOffs[index];
+    sep.off = off;
+    sep.inds = amalg.sepInds;
+    node.size = size;
+    node.off = off;
+
+    // Translate the original structure into the new reordering and remove
+    // any indices which now belong to the pivots of this front
+    node.lowerStruct.resize( 0 );
+    node.lowerStruct.reserve( amalg.origStruct.size() );
+    for( Int i : amalg.origStruct )
+    {
+        if( i >= subtreeOff && i < subtreeOff+subtreeSize )
+            i = newInds[i-subtreeOff];
+        if( i >= off+size )
+            node.lowerStruct.push_back( i );
+    }
+    std::sort( node.lowerStruct.begin(), node.lowerStruct.end() );
+}
+
+} // anonymous namespace
+
+void Amalgamate( Separator& rootSep, Node& rootNode, const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ldl::Amalgamate"))
+    vector<AmalgNode> pool;
+    Int rootIndex;
+    Flatten( rootSep, rootNode, pool, rootIndex );
+    if( pool.size() == 1 )
+        return;
+
+    MergeChildren( pool, rootIndex, ctrl );
+    OrderChildren( pool, rootIndex );
+
+    // The subtree occupies a contiguous range of the reordering which ends
+    // with the pivots of the root
+    Int subtreeSize = 0;
+    for( const auto& amalg : pool )
+        subtreeSize += amalg.inds.size();
+    const Int subtreeOff = rootNode.off + rootNode.size - subtreeSize;
+    vector<Int> newInds( subtreeSize ), newOffs( pool.size() );
+    Int counter = subtreeOff;
+    Renumber( pool, rootIndex, subtreeOff, newInds, newOffs, counter );
+
+    for( const Separator* child : rootSep.children )
+        delete child;
+    for( const Node* child : rootNode.children )
+        delete child;
+    Rebuild
+    ( pool, rootIndex, subtreeOff, newInds, newOffs, rootSep, rootNode );
+}
+
+void Amalgamate
+( DistSeparator& rootSep, DistNode& rootNode, const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ldl::Amalgamate"))
+    // Only the sequential subtree at the bottom of the distributed tree is
+    // modified, as the distributed fronts are already large
+    DistSeparator* sep = &rootSep;
+    DistNode* node = &rootNode;
+    while( node->child != nullptr )
+    {
+        sep = sep->child;
+        node = node->child;
+    }
+    if( node->duplicate == nullptr || sep->duplicate == nullptr )
+        LogicError("Expected a sequential subtree at the leaf");
+    Amalgamate( *sep->duplicate, *node->duplicate, ctrl );
+
+    // Pull information up from the duplicates
+    sep->off = sep->duplicate->off;
+    sep->inds = sep->duplicate->inds;
+    node->size = node->duplicate->size;
+    node->off = node->duplicate->off;
+    node->lowerStruct = node->duplicate->lowerStruct;
+}
+
+} // namespace ldl
+} // namespace El
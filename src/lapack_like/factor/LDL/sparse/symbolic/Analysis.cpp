@@ -292,6 +292,32 @@ Int Analysis( const Node& node, NodeInfo& info, Int myOff )
             info.origLowerRelInds[i] = i + info.size;
     }
 
+    // Choose the child to process before allocating our update matrix from
+    // the (already computed) peaks of the children's subtrees
+    const double updateSize = info.lowerStruct.size();
+    const double work = updateSize*updateSize;
+    info.firstChild = 0;
+    info.updatePeak = work;
+    if( numChildren > 0 )
+    {
+        info.updatePeak = std::numeric_limits<double>::max();
+        for( Int f=0; f<numChildren; ++f )
+        {
+            const double childUpdateSize = info.children[f]->lowerStruct.size();
+            double peak =
+              Max( info.children[f]->updatePeak,
+                   childUpdateSize*childUpdateSize+work );
+            for( Int c=0; c<numChildren; ++c )
+                if( c != f )
+                    peak = Max( peak, work+info.children[c]->updatePeak );
+            if( peak < info.updatePeak )
+            {
+                info.updatePeak = peak;
+                info.firstChild = f;
+            }
+        }
+    }
+
     return myOff + info.size;
 }
 
@@ -305,6 +331,7 @@ void Analysis
 ( const DistNode& node, DistNodeInfo& info, bool computeFactRecvInds )
 {
     DEBUG_ONLY(CSE cse("ldl::Analysis"))
+    info.multiVecMeta.Clear();
 
     // Duplicate the communicator from the distributed eTree 
     mpi::Dup( node.comm, info.comm );
@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// Only the output of the nested dissection (the reordering, the separator
+// tree, and the original structure of the elimination tree) is stored. The
+// communicators are recreated with the same splittings used by Bisect and
+// the (comparatively cheap) symbolic analysis is then rerun.
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+void SaveLocal( ofstream& file, const Separator& sep, const NodeInfo& info )
+{
+    const Int numChildren = info.children.size();
+    DEBUG_ONLY(
+      if( Int(sep.children.size()) != numChildren )
+          LogicError("Separator and node trees did not match");
+    )
+    checkpoint::Write( file, sep.off );
+    checkpoint::Write( file, sep.inds );
+    checkpoint::Write( file, info.size );
+    checkpoint::Write( file, info.off );
+    checkpoint::Write( file, info.origLowerStruct );
+    checkpoint::Write( file, numChildren );
+    for( Int c=0; c<numChildren; ++c )
+        SaveLocal( file, *sep.children[c], *info.children[c] );
+}
+
+void LoadLocal( ifstream& file, Separator& sep, Node& node )
+{
+    checkpoint::Read( file, sep.off );
+    checkpoint::Read( file, sep.inds );
+    checkpoint::Read( file, node.size );
+    checkpoint::Read( file, node.off );
+    checkpoint::Read( file, node.lowerStruct );
+    Int numChildren;
+    checkpoint::Read( file, numChildren );
+    sep.children.resize( numChildren );
+    node.children.resize( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        sep.children[c] = new Separator(&sep);
+        node.children[c] = new Node(&node);
+        LoadLocal( file, *sep.children[c], *node.children[c] );
+    }
+}
+
+} // anonymous namespace
+
+void SaveAnalysis
+( const string& basename,
+  const DistMap& map, const DistSeparator& rootSep, const DistNodeInfo& rootInfo )
+{
+    DEBUG_ONLY(CSE cse("ldl::SaveAnalysis"))
+    ofstream file;
+    checkpoint::Open( file, basename, map.Comm() );
+
+    checkpoint::Write( file, map.NumSources() );
+    checkpoint::Write( file, map.Map() );
+
+    const DistSeparator* sep = &rootSep;
+    const DistNodeInfo* info = &rootInfo;
+    while( true )
+    {
+        const bool isLeaf = ( info->child == nullptr );
+        checkpoint::Write( file, isLeaf );
+        if( isLeaf )
+        {
+            SaveLocal( file, *sep->duplicate, *info->duplicate );
+            break;
+        }
+        checkpoint::Write( file, sep->off );
+        checkpoint::Write( file, sep->inds );
+        checkpoint::Write( file, info->size );
+        checkpoint::Write( file, info->off );
+        checkpoint::Write( file, info->origLowerStruct );
+        checkpoint::Write( file, info->child->onLeft );
+        sep = sep->child;
+        info = info->child;
+    }
+    checkpoint::Close( file, basename, map.Comm() );
+}
+
+void LoadAnalysis
+( const string& basename, mpi::Comm comm,
+  DistMap& map, DistSeparator& rootSep, DistNodeInfo& rootInfo,
+  bool storeFactRecvInds )
+{
+    DEBUG_ONLY(CSE cse("ldl::LoadAnalysis"))
+    // NOTE: There is a potential memory leak here if sep or info is reused
+    ifstream file;
+    checkpoint::Open( file, basename, comm );
+
+    Int numSources;
+    checkpoint::Read( file, numSources );
+    map.SetComm( comm );
+    map.Resize( numSources );
+    vector<Int> localMap;
+    checkpoint::Read( file, localMap );
+    if( Int(localMap.size()) != map.NumLocalSources() )
+        RuntimeError("Reordering in ",basename," has an inconsistent size");
+    map.Map() = localMap;
+
+    DistNode rootNode;
+    DistSeparator* sep = &rootSep;
+    DistNode* node = &rootNode;
+    mpi::Dup( comm, sep->comm );
+    mpi::Dup( comm, node->comm );
+    while( true )
+    {
+        bool isLeaf;
+        checkpoint::Read( file, isLeaf );
+        if( isLeaf )
+        {
+            sep->duplicate = new Separator(sep);
+            node->duplicate = new Node(node);
+            LoadLocal( file, *sep->duplicate, *node->duplicate );
+
+            // Pull information up from the duplicates
+            sep->off = sep->duplicate->off;
+            sep->inds = sep->duplicate->inds;
+            node->size = node->duplicate->size;
+            node->off = node->duplicate->off;
+            node->lowerStruct = node->duplicate->lowerStruct;
+            break;
+        }
+        checkpoint::Read( file, sep->off );
+        checkpoint::Read( file, sep->inds );
+        checkpoint::Read( file, node->size );
+        checkpoint::Read( file, node->off );
+        checkpoint::Read( file, node->lowerStruct );
+        bool childOnLeft;
+        checkpoint::Read( file, childOnLeft );
+
+        // Bisect orders each child team by rank within the parent team
+        sep->child = new DistSeparator(sep);
+        node->child = new DistNode(node);
+        node->child->onLeft = childOnLeft;
+        mpi::Split
+        ( node->comm, childOnLeft, mpi::Rank(node->comm), node->child->comm );
+        mpi::Dup( node->child->comm, sep->child->comm );
+        sep = sep->child;
+        node = node->child;
+    }
+
+    Analysis( rootNode, rootInfo, storeFactRecvInds );
+}
+
+} // namespace ldl
+} // namespace El
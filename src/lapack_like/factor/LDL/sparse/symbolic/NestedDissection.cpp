@@ -260,6 +260,8 @@ void NestedDissection
 
     Node node;
     NestedDissectionRecursion( graph, perm, sep, node, 0, ctrl );
+    if( ctrl.amalgamate )
+        Amalgamate( sep, node, ctrl );
 
     // Construct the distributed reordering    
     BuildMap( sep, map );
@@ -287,6 +289,8 @@ void NestedDissection
 
     DistNode node;
     NestedDissectionRecursion( graph, perm, sep, node, 0, ctrl );
+    if( ctrl.amalgamate )
+        Amalgamate( sep, node, ctrl );
 
     // Construct the distributed reordering    
     BuildMap( sep, map );
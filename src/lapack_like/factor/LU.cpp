@@ -60,7 +60,7 @@ void LU( AbstractDistMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = RegimeBlocksize( minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -184,7 +184,7 @@ void LU( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Int>& pPre )
 
     DistMatrix<Int,VC,STAR> p1(g), p1Inv(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize = RegimeBlocksize( minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_LU_STATICPIVOT_HPP
+#define EL_LU_STATICPIVOT_HPP
+
+namespace El {
+namespace lu {
+
+// LU without pivoting, where each pivot whose magnitude is less than 'tau' is
+// replaced with 'tau' times its phase (static pivoting). The number of
+// replaced pivots is returned.
+
+template<typename F>
+inline Int
+StaticPivotUnb( Matrix<F>& A, Base<F> tau )
+{
+    DEBUG_ONLY(CSE cse("lu::StaticPivotUnb"))
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Int numReplaced = 0;
+    for( Int j=0; j<Min(m,n); ++j )
+    {
+        F alpha = A.Get(j,j);
+        const Real alphaAbs = Abs(alpha);
+        if( alphaAbs < tau )
+        {
+            alpha = ( alphaAbs == Real(0) ? F(tau) : (tau/alphaAbs)*alpha );
+            A.Set( j, j, alpha );
+            ++numReplaced;
+        }
+        if( alpha == F(0) )
+            throw SingularMatrixException();
+
+        blas::Scal( m-(j+1), F(1)/alpha, A.Buffer(j+1,j), 1 );
+        blas::Geru
+        ( m-(j+1), n-(j+1),
+          F(-1), A.LockedBuffer(j+1,j), 1, A.LockedBuffer(j,j+1), A.LDim(),
+                 A.Buffer(j+1,j+1), A.LDim() );
+    }
+    return numReplaced;
+}
+
+template<typename F>
+inline Int
+StaticPivot( Matrix<F>& A, Base<F> tau )
+{
+    DEBUG_ONLY(CSE cse("lu::StaticPivot"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int bsize = Blocksize();
+    Int numReplaced = 0;
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const IR ind1( k, k+nb ), ind2( k+nb, END );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        numReplaced += StaticPivotUnb( A11, tau );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11, A21 );
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
+        Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
+    }
+    return numReplaced;
+}
+
+// Since every process redundantly factors the diagonal blocks, each process
+// returns the total number of replaced pivots
+template<typename F>
+inline Int
+StaticPivot( DistMatrix<F>& A, Base<F> tau )
+{
+    DEBUG_ONLY(CSE cse("lu::StaticPivot"))
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,MC,  STAR> A21_MC_STAR(g);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int bsize = Blocksize();
+    Int numReplaced = 0;
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const IR ind1( k, k+nb ), ind2( k+nb, END );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        A11_STAR_STAR = A11;
+        numReplaced += StaticPivotUnb( A11_STAR_STAR.Matrix(), tau );
+        A11 = A11_STAR_STAR;
+
+        A21_MC_STAR.AlignWith( A22 );
+        A21_MC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR, A21_MC_STAR );
+        A21 = A21_MC_STAR;
+
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12_STAR_VR;
+        LocalGemm( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+        A12 = A12_STAR_MR;
+    }
+    return numReplaced;
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_STATICPIVOT_HPP
@@ -0,0 +1,337 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "./Process.hpp"
+
+namespace El {
+
+namespace lu {
+
+namespace {
+
+template<typename F>
+Base<F> MaxAbs( const ldl::Front<F>& front )
+{
+    Base<F> maxAbs = MaxNorm( front.L );
+    for( const auto* child : front.children )
+        maxAbs = Max( maxAbs, MaxAbs(*child) );
+    return maxAbs;
+}
+
+// Returns the maximum over the entries owned by this process
+template<typename F>
+Base<F> MaxAbs( const ldl::DistFront<F>& front )
+{
+    if( front.duplicate != nullptr )
+        return MaxAbs( *front.duplicate );
+    return Max( MaxNorm(front.L2D.LockedMatrix()), MaxAbs(*front.child) );
+}
+
+template<typename F>
+void SolveAfter
+( const ldl::NodeInfo& info,
+  const ldl::Front<F>& L, const ldl::Front<F>& U, ldl::MatrixNode<F>& X )
+{
+    DEBUG_ONLY(CSE cse("lu::SolveAfter"))
+    // Solve against the unit-lower factor
+    ldl::LowerSolve( NORMAL, info, L, X );
+    // Solve against the diagonal
+    ldl::DiagonalSolve( info, L, X );
+    // Solve against the unit-upper factor, which is stored transposed
+    ldl::LowerSolve( TRANSPOSE, info, U, X );
+}
+
+template<typename F>
+void SolveAfter
+( const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& L, const ldl::DistFront<F>& U,
+  ldl::DistMatrixNode<F>& X )
+{
+    DEBUG_ONLY(CSE cse("lu::SolveAfter"))
+    ldl::LowerSolve( NORMAL, info, L, X );
+    ldl::DiagonalSolve( info, L, X );
+    ldl::LowerSolve( TRANSPOSE, info, U, X );
+}
+
+} // anonymous namespace
+
+template<typename F>
+void Pull
+( const SparseMatrix<F>& A, const vector<Int>& reordering,
+  const ldl::NodeInfo& info, ldl::Front<F>& L, ldl::Front<F>& U )
+{
+    DEBUG_ONLY(CSE cse("lu::Pull"))
+    // ldl::Front::Pull fills the lower trapezoid of each front using the rows
+    // of the given matrix, so the rows of A^T yield the lower trapezoids
+    SparseMatrix<F> ATrans;
+    Transpose( A, ATrans );
+    L.Pull( ATrans, reordering, info, false );
+    U.Pull( A, reordering, info, false );
+}
+
+template<typename F>
+void Pull
+( const DistSparseMatrix<F>& A, const DistMap& reordering,
+  const ldl::DistSeparator& rootSep, const ldl::DistNodeInfo& info,
+  ldl::DistFront<F>& L, ldl::DistFront<F>& U )
+{
+    DEBUG_ONLY(CSE cse("lu::Pull"))
+    DistSparseMatrix<F> ATrans(A.Comm());
+    Transpose( A, ATrans );
+    L.Pull( ATrans, reordering, rootSep, info, false );
+    U.Pull( A, reordering, rootSep, info, false );
+}
+
+} // namespace lu
+
+template<typename F>
+Int LU
+( const ldl::NodeInfo& info, ldl::Front<F>& L, ldl::Front<F>& U,
+  const LUStaticPivotCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LU"))
+    const Base<F> maxAbs = Max( lu::MaxAbs(L), lu::MaxAbs(U) );
+    return lu::Process( info, L, U, ctrl.pivotTol*maxAbs );
+}
+
+template<typename F>
+Int LU
+( const ldl::DistNodeInfo& info, ldl::DistFront<F>& L, ldl::DistFront<F>& U,
+  const LUStaticPivotCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LU"))
+    const Base<F> maxAbs =
+      mpi::AllReduce
+      ( Max(lu::MaxAbs(L),lu::MaxAbs(U)), mpi::MAX, info.comm );
+    const Int numReplaced = lu::Process( info, L, U, ctrl.pivotTol*maxAbs );
+    return mpi::AllReduce( numReplaced, info.comm );
+}
+
+namespace lu {
+
+template<typename F>
+void SolveAfter
+( const vector<Int>& invMap, const ldl::NodeInfo& info,
+  const ldl::Front<F>& L, const ldl::Front<F>& U, Matrix<F>& X )
+{
+    DEBUG_ONLY(CSE cse("lu::SolveAfter"))
+    ldl::MatrixNode<F> XNodal( invMap, info, X );
+    SolveAfter( info, L, U, XNodal );
+    XNodal.Push( invMap, info, X );
+}
+
+template<typename F>
+void SolveAfter
+( const DistMap& invMap, const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& L, const ldl::DistFront<F>& U,
+  DistMultiVec<F>& X )
+{
+    DEBUG_ONLY(CSE cse("lu::SolveAfter"))
+    ldl::DistMatrixNode<F> XNodal( invMap, info, X );
+    SolveAfter( info, L, U, XNodal );
+    XNodal.Push( invMap, info, X );
+}
+
+template<typename F>
+Int SolveWithIterativeRefinement
+( const SparseMatrix<F>& A,
+  const vector<Int>& invMap, const ldl::NodeInfo& info,
+  const ldl::Front<F>& L, const ldl::Front<F>& U, Matrix<F>& y,
+  Base<F> minReductionFactor, Int maxRefineIts )
+{
+    DEBUG_ONLY(CSE cse("lu::SolveWithIterativeRefinement"))
+    const Int numRHS = y.Width();
+    if( numRHS > 1 )
+    {
+        // Refine each right-hand side against the norm of its own residual
+        Int numRefineIts = 0;
+        Matrix<F> yCol;
+        for( Int j=0; j<numRHS; ++j )
+        {
+            auto yj = y( ALL, IR(j) );
+            yCol = yj;
+            const Int colRefineIts = SolveWithIterativeRefinement
+              ( A, invMap, info, L, U, yCol, minReductionFactor, maxRefineIts );
+            numRefineIts = Max( numRefineIts, colRefineIts );
+            yj = yCol;
+        }
+        return numRefineIts;
+    }
+
+    auto yOrig = y;
+
+    // Compute the initial guess
+    // =========================
+    Matrix<F> x;
+    ldl::MatrixNode<F> xNodal( invMap, info, y );
+    SolveAfter( info, L, U, xNodal );
+    xNodal.Push( invMap, info, x );
+
+    Int refineIt = 0;
+    if( maxRefineIts > 0 )
+    {
+        Matrix<F> dx, xCand;
+        Multiply( NORMAL, F(-1), A, x, F(1), y );
+        Base<F> errorNorm = Nrm2( y );
+        for( ; refineIt<maxRefineIts; ++refineIt )
+        {
+            // Compute the proposed update to the solution
+            // -------------------------------------------
+            xNodal.Pull( invMap, info, y );
+            SolveAfter( info, L, U, xNodal );
+            xNodal.Push( invMap, info, dx );
+            xCand = x;
+            xCand += dx;
+
+            // If the proposed update lowers the residual, accept it
+            // -----------------------------------------------------
+            y = yOrig;
+            Multiply( NORMAL, F(-1), A, xCand, F(1), y );
+            Base<F> newErrorNorm = Nrm2( y );
+            if( minReductionFactor*newErrorNorm < errorNorm )
+            {
+                x = xCand;
+                errorNorm = newErrorNorm;
+            }
+            else if( newErrorNorm < errorNorm )
+            {
+                x = xCand;
+                errorNorm = newErrorNorm;
+                break;
+            }
+            else
+                break;
+        }
+    }
+    // Store the final result
+    // ======================
+    y = x;
+    return refineIt;
+}
+
+template<typename F>
+Int SolveWithIterativeRefinement
+( const DistSparseMatrix<F>& A,
+  const DistMap& invMap, const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& L, const ldl::DistFront<F>& U, DistMultiVec<F>& y,
+  Base<F> minReductionFactor, Int maxRefineIts )
+{
+    DEBUG_ONLY(CSE cse("lu::SolveWithIterativeRefinement"))
+    mpi::Comm comm = y.Comm();
+    const Int numRHS = y.Width();
+    if( numRHS > 1 )
+    {
+        // Refine each right-hand side against the norm of its own residual
+        Int numRefineIts = 0;
+        DistMultiVec<F> yCol(comm);
+        for( Int j=0; j<numRHS; ++j )
+        {
+            yCol = y( ALL, IR(j) );
+            const Int colRefineIts = SolveWithIterativeRefinement
+              ( A, invMap, info, L, U, yCol, minReductionFactor, maxRefineIts );
+            numRefineIts = Max( numRefineIts, colRefineIts );
+            auto yjLoc = y.Matrix()( ALL, IR(j) );
+            yjLoc = yCol.LockedMatrix();
+        }
+        return numRefineIts;
+    }
+
+    DistMultiVec<F> yOrig(comm);
+    yOrig = y;
+
+    // Compute the initial guess
+    // =========================
+    DistMultiVec<F> x(comm);
+    ldl::DistMatrixNode<F> xNodal( invMap, info, y );
+    SolveAfter( info, L, U, xNodal );
+    xNodal.Push( invMap, info, x );
+
+    Int refineIt = 0;
+    if( maxRefineIts > 0 )
+    {
+        DistMultiVec<F> dx(comm), xCand(comm);
+        Multiply( NORMAL, F(-1), A, x, F(1), y );
+        Base<F> errorNorm = Nrm2( y );
+        for( ; refineIt<maxRefineIts; ++refineIt )
+        {
+            // Compute the proposed update to the solution
+            // -------------------------------------------
+            xNodal.Pull( invMap, info, y );
+            SolveAfter( info, L, U, xNodal );
+            xNodal.Push( invMap, info, dx );
+            xCand = x;
+            xCand += dx;
+
+            // If the proposed update lowers the residual, accept it
+            // -----------------------------------------------------
+            y = yOrig;
+            Multiply( NORMAL, F(-1), A, xCand, F(1), y );
+            Base<F> newErrorNorm = Nrm2( y );
+            if( minReductionFactor*newErrorNorm < errorNorm )
+            {
+                x = xCand;
+                errorNorm = newErrorNorm;
+            }
+            else if( newErrorNorm < errorNorm )
+            {
+                x = xCand;
+                errorNorm = newErrorNorm;
+                break;
+            }
+            else
+                break;
+        }
+    }
+    // Store the final result
+    // ======================
+    y = x;
+    return refineIt;
+}
+
+} // namespace lu
+
+#define PROTO(F) \
+  template Int LU \
+  ( const ldl::NodeInfo& info, ldl::Front<F>& L, ldl::Front<F>& U, \
+    const LUStaticPivotCtrl<Base<F>>& ctrl ); \
+  template Int LU \
+  ( const ldl::DistNodeInfo& info, \
+    ldl::DistFront<F>& L, ldl::DistFront<F>& U, \
+    const LUStaticPivotCtrl<Base<F>>& ctrl ); \
+  template void lu::Pull \
+  ( const SparseMatrix<F>& A, const vector<Int>& reordering, \
+    const ldl::NodeInfo& info, ldl::Front<F>& L, ldl::Front<F>& U ); \
+  template void lu::Pull \
+  ( const DistSparseMatrix<F>& A, const DistMap& reordering, \
+    const ldl::DistSeparator& rootSep, const ldl::DistNodeInfo& info, \
+    ldl::DistFront<F>& L, ldl::DistFront<F>& U ); \
+  template void lu::SolveAfter \
+  ( const vector<Int>& invMap, const ldl::NodeInfo& info, \
+    const ldl::Front<F>& L, const ldl::Front<F>& U, Matrix<F>& X ); \
+  template void lu::SolveAfter \
+  ( const DistMap& invMap, const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<F>& L, const ldl::DistFront<F>& U, \
+    DistMultiVec<F>& X ); \
+  template Int lu::SolveWithIterativeRefinement \
+  ( const SparseMatrix<F>& A, \
+    const vector<Int>& invMap, const ldl::NodeInfo& info, \
+    const ldl::Front<F>& L, const ldl::Front<F>& U, Matrix<F>& y, \
+    Base<F> minReductionFactor, Int maxRefineIts ); \
+  template Int lu::SolveWithIterativeRefinement \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMap& invMap, const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<F>& L, const ldl::DistFront<F>& U, \
+    DistMultiVec<F>& y, \
+    Base<F> minReductionFactor, Int maxRefineIts );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
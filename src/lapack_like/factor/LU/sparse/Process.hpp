@@ -0,0 +1,279 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_LU_SPARSE_PROCESS_HPP
+#define EL_LU_SPARSE_PROCESS_HPP
+
+#include "../StaticPivot.hpp"
+
+// Each front of an unsymmetric matrix A is split between two LDL fronts which
+// share the same structure: the lower trapezoid of the front of A is stored
+// within the 'L' front and the transpose of its strictly upper trapezoid
+// within the 'U' front. After factoring the front as L D U, the 'L' front
+// holds the unit-lower factor (and D), the 'U' front holds the transpose of
+// the unit-upper factor, and the full (square) Schur complement is stored in
+// the 'work' matrix of the 'L' front.
+
+namespace El {
+namespace lu {
+
+template<typename F>
+inline Int
+ProcessFront( ldl::Front<F>& L, ldl::Front<F>& U, Base<F> tau )
+{
+    DEBUG_ONLY(CSE cse("lu::ProcessFront"))
+    auto& FL = L.L;
+    auto& UL = U.L;
+    const Int m = FL.Height();
+    const Int n = FL.Width();
+    auto FTL = FL( IR(0,n), IR(0,n) );
+    auto FBL = FL( IR(n,m), IR(0,n) );
+    auto UTL = UL( IR(0,n), IR(0,n) );
+    auto UBL = UL( IR(n,m), IR(0,n) );
+
+    // Form the pivot block of the front of A
+    Matrix<F> FTLTrans;
+    Transpose( UTL, FTLTrans );
+    AxpyTrapezoid( UPPER, F(1), FTLTrans, FTL, 1 );
+
+    // Factor [A11; A21] = [L11; L21] U11, then form U12^T = A12^T inv(L11)^T
+    // and the Schur complement A22 - L21 U12
+    const Int numReplaced = StaticPivot( FL, tau );
+    Trsm( RIGHT, LOWER, TRANSPOSE, UNIT, F(1), FTL, UBL );
+    Gemm( NORMAL, TRANSPOSE, F(-1), FBL, UBL, F(1), L.work );
+
+    // Split U11 into D (inv(D) U11)
+    GetDiagonal( FL, L.diag );
+    Transpose( FTL, FTLTrans );
+    MakeTrapezoidal( LOWER, FTLTrans );
+    UTL = FTLTrans;
+    MakeTrapezoidal( LOWER, FTL );
+    DiagonalSolve( RIGHT, NORMAL, L.diag, UL );
+
+    L.type = LDL_2D;
+    U.type = LDL_2D;
+    return numReplaced;
+}
+
+// Since the Schur complements are not symmetric, the full update matrix of
+// each child is added into the parent
+template<typename F>
+inline Int
+Process
+( const ldl::NodeInfo& info, ldl::Front<F>& L, ldl::Front<F>& U, Base<F> tau )
+{
+    DEBUG_ONLY(CSE cse("lu::Process"))
+
+    const Int size = info.size;
+    const Int updateSize = info.lowerStruct.size();
+    auto& FL = L.L;
+    auto& UL = U.L;
+    auto& FBR = L.work;
+    FBR.Empty();
+    U.work.Empty();
+    DEBUG_ONLY(
+      if( FL.Height() != size+updateSize || FL.Width() != size ||
+          UL.Height() != size+updateSize || UL.Width() != size )
+          LogicError("Fronts were not the proper size");
+    )
+
+    // Follow the child ordering of ldl::Process so that the update matrix of
+    // this front is allocated after the most demanding child is processed
+    Int numReplaced = 0;
+    const Int numChildren = info.children.size();
+    const Int firstChild = info.firstChild;
+    for( Int k=0; k<numChildren; ++k )
+    {
+        const Int c = ( k == 0 ? firstChild : (k <= firstChild ? k-1 : k) );
+        numReplaced +=
+          Process( *info.children[c], *L.children[c], *U.children[c], tau );
+        if( k == 0 )
+            Zeros( FBR, updateSize, updateSize );
+
+        auto& childU = L.children[c]->work;
+        const Int childUSize = childU.Height();
+        for( Int jChild=0; jChild<childUSize; ++jChild )
+        {
+            const Int j = info.childRelInds[c][jChild];
+            for( Int iChild=0; iChild<childUSize; ++iChild )
+            {
+                const Int i = info.childRelInds[c][iChild];
+                const F value = childU.Get(iChild,jChild);
+                if( i < size && i < j )
+                    UL.Update( j, i, value );
+                else if( j < size )
+                    FL.Update( i, j, value );
+                else
+                    FBR.Update( i-size, j-size, value );
+            }
+        }
+        childU.Empty();
+    }
+    if( numChildren == 0 )
+        Zeros( FBR, updateSize, updateSize );
+
+    numReplaced += ProcessFront( L, U, tau );
+    return numReplaced;
+}
+
+template<typename F>
+inline Int
+ProcessFront( ldl::DistFront<F>& L, ldl::DistFront<F>& U, Base<F> tau )
+{
+    DEBUG_ONLY(CSE cse("lu::ProcessFront"))
+    auto& FL = L.L2D;
+    auto& UL = U.L2D;
+    const Grid& grid = FL.Grid();
+    const Int m = FL.Height();
+    const Int n = FL.Width();
+    auto FTL = FL( IR(0,n), IR(0,n) );
+    auto FBL = FL( IR(n,m), IR(0,n) );
+    auto UTL = UL( IR(0,n), IR(0,n) );
+    auto UBL = UL( IR(n,m), IR(0,n) );
+
+    DistMatrix<F> FTLTrans(grid);
+    Transpose( UTL, FTLTrans );
+    AxpyTrapezoid( UPPER, F(1), FTLTrans, FTL, 1 );
+
+    const Int numReplaced = StaticPivot( FL, tau );
+    Trsm( RIGHT, LOWER, TRANSPOSE, UNIT, F(1), FTL, UBL );
+    Gemm( NORMAL, TRANSPOSE, F(-1), FBL, UBL, F(1), L.work );
+
+    auto diag = GetDiagonal( FL );
+    L.diag.SetGrid( grid );
+    L.diag = diag;
+    Transpose( FTL, FTLTrans );
+    MakeTrapezoidal( LOWER, FTLTrans );
+    UTL = FTLTrans;
+    MakeTrapezoidal( LOWER, FTL );
+    DiagonalSolve( RIGHT, NORMAL, diag, UL );
+
+    L.type = LDL_2D;
+    U.type = LDL_2D;
+    return numReplaced;
+}
+
+// Each process only counts the replaced pivots of the sequential fronts it
+// owns and of the distributed fronts for which it is the root of the team
+template<typename F>
+inline Int
+Process
+( const ldl::DistNodeInfo& info, ldl::DistFront<F>& L, ldl::DistFront<F>& U,
+  Base<F> tau )
+{
+    DEBUG_ONLY(CSE cse("lu::Process"))
+
+    // Switch to a sequential algorithm if possible
+    if( L.duplicate != nullptr )
+    {
+        const Grid& grid = *info.grid;
+        auto& LDup = *L.duplicate;
+        auto& UDup = *U.duplicate;
+
+        const Int numReplaced = Process( *info.duplicate, LDup, UDup, tau );
+
+        // Pull the relevant information up from the duplicates
+        L.type = LDup.type;
+        U.type = UDup.type;
+        L.work.LockedAttach( grid, LDup.work );
+        L.diag.LockedAttach( grid, LDup.diag );
+        return numReplaced;
+    }
+
+    const auto& childInfo = *info.child;
+    auto& childL = *L.child;
+    Int numReplaced = Process( childInfo, childL, *U.child, tau );
+
+    const Int size = info.size;
+    const Int updateSize = info.lowerStruct.size();
+    auto& FL = L.L2D;
+    auto& UL = U.L2D;
+    L.work.Empty();
+    U.work.Empty();
+    DEBUG_ONLY(
+      if( FL.Height() != size+updateSize || FL.Width() != size ||
+          UL.Height() != size+updateSize || UL.Width() != size )
+          LogicError("Fronts were not the proper size");
+    )
+
+    // Count and pack the child updates along with their (parent) indices.
+    // Unlike ldl::Process, the receive indices are not precomputed, as the
+    // destination of each entry depends upon which triangle it lies in.
+    mpi::Comm comm = FL.DistComm();
+    const int commSize = mpi::Size( comm );
+    const auto& childU = childL.work;
+    const Int myChild = ( childInfo.onLeft ? 0 : 1 );
+    const auto& childRelInds = info.childRelInds[myChild];
+    const Int updateLocHeight = childU.LocalHeight();
+    const Int updateLocWidth = childU.LocalWidth();
+    auto owner =
+      [&]( Int i, Int j )
+      { return ( i < size && i < j ? FL.Owner(j,i) : FL.Owner(i,j) ); };
+
+    vector<int> sendSizes(commSize,0);
+    for( Int jChildLoc=0; jChildLoc<updateLocWidth; ++jChildLoc )
+    {
+        const Int j = childRelInds[childU.GlobalCol(jChildLoc)];
+        for( Int iChildLoc=0; iChildLoc<updateLocHeight; ++iChildLoc )
+            ++sendSizes[owner(childRelInds[childU.GlobalRow(iChildLoc)],j)];
+    }
+    vector<int> sendOffs;
+    const int sendBufSize = Scan( sendSizes, sendOffs );
+    vector<Entry<F>> sendBuf( sendBufSize );
+    auto offs = sendOffs;
+    for( Int jChildLoc=0; jChildLoc<updateLocWidth; ++jChildLoc )
+    {
+        const Int j = childRelInds[childU.GlobalCol(jChildLoc)];
+        for( Int iChildLoc=0; iChildLoc<updateLocHeight; ++iChildLoc )
+        {
+            const Int i = childRelInds[childU.GlobalRow(iChildLoc)];
+            const F value = childU.GetLocal(iChildLoc,jChildLoc);
+            sendBuf[offs[owner(i,j)]++] = Entry<F>{ i, j, value };
+        }
+    }
+    SwapClear( offs );
+    childL.work.Empty();
+    if( childL.duplicate != nullptr )
+        childL.duplicate->work.Empty();
+
+    auto recvBuf = mpi::AllToAll( sendBuf, sendSizes, sendOffs, comm );
+    SwapClear( sendBuf );
+    SwapClear( sendSizes );
+    SwapClear( sendOffs );
+
+    // Unpack the child updates
+    auto FTL = FL( IR(0,size), IR(0,size) );
+    auto& FBR = L.work;
+    FBR.SetGrid( FTL.Grid() );
+    FBR.Align( FTL.RowOwner(size), FTL.ColOwner(size) );
+    Zeros( FBR, updateSize, updateSize );
+    for( const auto& entry : recvBuf )
+    {
+        const Int i = entry.i;
+        const Int j = entry.j;
+        if( i < size && i < j )
+            UL.UpdateLocal( UL.LocalRow(j), UL.LocalCol(i), entry.value );
+        else if( j < size )
+            FL.UpdateLocal( FL.LocalRow(i), FL.LocalCol(j), entry.value );
+        else
+            FBR.UpdateLocal
+            ( FBR.LocalRow(i-size), FBR.LocalCol(j-size), entry.value );
+    }
+    SwapClear( recvBuf );
+
+    const Int frontReplaced = ProcessFront( L, U, tau );
+    if( mpi::Rank(comm) == 0 )
+        numReplaced += frontReplaced;
+    return numReplaced;
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_SPARSE_PROCESS_HPP
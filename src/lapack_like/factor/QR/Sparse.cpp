@@ -0,0 +1,351 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// Each front has the pivot columns of its node followed by the columns of its
+// lower structure. Its rows are the rows of A whose leading column (in the
+// reordering) is a pivot of the front, followed by the update matrices of its
+// children (in order). Since the front is fully triangularized, the update
+// matrix passed to the parent is the upper trapezoid of R which lies below
+// the pivot rows and to the right of the pivot columns, and it has at most as
+// many rows as the lower structure has columns. The front is padded with
+// zero rows so that it has at least as many rows as pivots.
+
+namespace El {
+
+namespace qr {
+
+namespace {
+
+template<typename F>
+Int UpdateHeight( const ldl::NodeInfo& info, const SparseFront<F>& front )
+{
+    const Int updateSize = info.lowerStruct.size();
+    return Min( front.QR.Height()-info.size, updateSize );
+}
+
+// Build the front tree (with the same shape as 'info') and list the nodes by
+// their index offsets
+template<typename F>
+void BuildTree
+( const ldl::NodeInfo& info, SparseFront<F>& front,
+  vector<SparseFront<F>*>& frontOf )
+{
+    for( const SparseFront<F>* child : front.children )
+        delete child;
+    const Int numChildren = info.children.size();
+    front.children.resize( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        front.children[c] = new SparseFront<F>(&front);
+        BuildTree( *info.children[c], *front.children[c], frontOf );
+    }
+    front.rows.clear();
+    for( Int t=0; t<info.size; ++t )
+        frontOf[info.off+t] = &front;
+}
+
+// Diagonal entries of R with magnitudes of at most 'tol' are treated as zero
+template<typename F>
+void Factor
+( const SparseMatrix<F>& A, const vector<Int>& map,
+  const ldl::NodeInfo& info, SparseFront<F>& front, Base<F> tol )
+{
+    DEBUG_ONLY(CSE cse("qr::Factor"))
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        Factor( A, map, *info.children[c], *front.children[c], tol );
+
+    const Int size = info.size;
+    const Int updateSize = info.lowerStruct.size();
+    const Int numOrigRows = front.rows.size();
+    Int numRows = numOrigRows;
+    for( const SparseFront<F>* child : front.children )
+        numRows += child->work.Height();
+    Zeros( front.QR, Max(numRows,size), size+updateSize );
+
+    // Assemble the original rows
+    for( Int k=0; k<numOrigRows; ++k )
+    {
+        const Int row = front.rows[k];
+        const Int rowOff = A.RowOffset( row );
+        const Int numConn = A.NumConnections( row );
+        for( Int e=rowOff; e<rowOff+numConn; ++e )
+        {
+            const Int j = map[A.Col(e)];
+            DEBUG_ONLY(
+              if( j < info.off )
+                  LogicError("Row was assembled into the wrong front");
+            )
+            const Int col =
+              ( j < info.off+size ? j-info.off
+                                  : size+Find(info.lowerStruct,j) );
+            front.QR.Update( k, col, A.Value(e) );
+        }
+    }
+
+    // Stack the updates from the children
+    Int rowOff = numOrigRows;
+    for( Int c=0; c<numChildren; ++c )
+    {
+        auto& childW = front.children[c]->work;
+        const Int childHeight = childW.Height();
+        const Int childWidth = childW.Width();
+        for( Int jChild=0; jChild<childWidth; ++jChild )
+        {
+            const Int j = info.childRelInds[c][jChild];
+            for( Int iChild=0; iChild<Min(jChild+1,childHeight); ++iChild )
+                front.QR.Set( rowOff+iChild, j, childW.Get(iChild,jChild) );
+        }
+        rowOff += childHeight;
+        childW.Empty();
+    }
+
+    QR( front.QR, front.t, front.d );
+    for( Int t=0; t<size; ++t )
+        if( Abs(front.QR.Get(t,t)) <= tol )
+            RuntimeError
+            ("R had a (numerically) zero diagonal entry in column ",
+             info.off+t," of the reordering, so A is rank-deficient and its "
+             "least squares problem does not have a unique solution");
+
+    const Int updateHeight = UpdateHeight( info, front );
+    auto RBR = front.QR( IR(size,size+updateHeight), IR(size,END) );
+    front.work = RBR;
+    MakeTrapezoidal( UPPER, front.work );
+}
+
+// Returns the portion of the transformed right-hand sides to be passed to
+// the parent
+template<typename F>
+Matrix<F> ApplyQAdjointRec
+( const ldl::NodeInfo& info, const SparseFront<F>& front,
+  const Matrix<F>& B, Matrix<F>& C )
+{
+    DEBUG_ONLY(CSE cse("qr::ApplyQAdjointRec"))
+    const Int numChildren = info.children.size();
+    vector<Matrix<F>> childUpdates( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+        childUpdates[c] =
+          ApplyQAdjointRec( *info.children[c], *front.children[c], B, C );
+
+    const Int size = info.size;
+    const Int numRHS = B.Width();
+    const Int numOrigRows = front.rows.size();
+    Matrix<F> Z;
+    Zeros( Z, front.QR.Height(), numRHS );
+    for( Int k=0; k<numOrigRows; ++k )
+        for( Int j=0; j<numRHS; ++j )
+            Z.Set( k, j, B.Get(front.rows[k],j) );
+    Int rowOff = numOrigRows;
+    for( Int c=0; c<numChildren; ++c )
+    {
+        const Int childHeight = childUpdates[c].Height();
+        auto ZChild = Z( IR(rowOff,rowOff+childHeight), ALL );
+        ZChild = childUpdates[c];
+        rowOff += childHeight;
+    }
+
+    ApplyQ( LEFT, ADJOINT, front.QR, front.t, front.d, Z );
+
+    auto CT = C( IR(info.off,info.off+size), ALL );
+    CT = Z( IR(0,size), ALL );
+    const Int updateHeight = UpdateHeight( info, front );
+    Matrix<F> update;
+    update = Z( IR(size,size+updateHeight), ALL );
+    return update;
+}
+
+} // anonymous namespace
+
+template<typename F>
+void NestedDissection
+( const SparseMatrix<F>& A,
+        vector<Int>& map,
+        ldl::Separator& rootSep,
+        ldl::NodeInfo& info,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("qr::NestedDissection"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // Form the graph of A^H A by connecting each pair of columns which share
+    // a row (and each column to itself, so that the zero columns of a
+    // rank-deficient A still appear as sources)
+    Int numEdges = n;
+    for( Int i=0; i<m; ++i )
+        numEdges += A.NumConnections(i)*A.NumConnections(i);
+    Graph graph( n );
+    graph.Reserve( numEdges );
+    for( Int j=0; j<n; ++j )
+        graph.QueueConnection( j, j );
+    for( Int i=0; i<m; ++i )
+    {
+        const Int rowOff = A.RowOffset( i );
+        const Int numConn = A.NumConnections( i );
+        for( Int e0=rowOff; e0<rowOff+numConn; ++e0 )
+            for( Int e1=rowOff; e1<rowOff+numConn; ++e1 )
+                graph.QueueConnection( A.Col(e0), A.Col(e1) );
+    }
+    graph.ProcessQueues();
+
+    ldl::NestedDissection( graph, map, rootSep, info, ctrl );
+}
+
+template<typename F>
+void ApplyQAdjoint
+( const ldl::NodeInfo& info, const SparseFront<F>& front,
+  const Matrix<F>& B, Matrix<F>& C )
+{
+    DEBUG_ONLY(CSE cse("qr::ApplyQAdjoint"))
+    Zeros( C, info.off+info.size, B.Width() );
+    ApplyQAdjointRec( info, front, B, C );
+}
+
+template<typename F>
+void SolveR
+( const ldl::NodeInfo& info, const SparseFront<F>& front, Matrix<F>& X )
+{
+    DEBUG_ONLY(CSE cse("qr::SolveR"))
+    const Int size = info.size;
+    const Int updateSize = info.lowerStruct.size();
+    const Int numRHS = X.Width();
+    auto R11 = front.QR( IR(0,size), IR(0,size) );
+    auto R12 = front.QR( IR(0,size), IR(size,END) );
+    auto X1 = X( IR(info.off,info.off+size), ALL );
+
+    // The entries of the solution corresponding to the lower structure were
+    // computed by the ancestors of this front
+    Matrix<F> XStruct( updateSize, numRHS );
+    for( Int k=0; k<updateSize; ++k )
+        for( Int j=0; j<numRHS; ++j )
+            XStruct.Set( k, j, X.Get(info.lowerStruct[k],j) );
+    Gemm( NORMAL, NORMAL, F(-1), R12, XStruct, F(1), X1 );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, X1, true );
+
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        SolveR( *info.children[c], *front.children[c], X );
+}
+
+template<typename F>
+void SolveAfter
+( const vector<Int>& invMap, const ldl::NodeInfo& info,
+  const SparseFront<F>& front, const Matrix<F>& B, Matrix<F>& X )
+{
+    DEBUG_ONLY(CSE cse("qr::SolveAfter"))
+    Matrix<F> C;
+    ApplyQAdjoint( info, front, B, C );
+    SolveR( info, front, C );
+
+    const Int n = invMap.size();
+    const Int numRHS = B.Width();
+    X.Resize( n, numRHS );
+    for( Int i=0; i<n; ++i )
+        for( Int j=0; j<numRHS; ++j )
+            X.Set( invMap[i], j, C.Get(i,j) );
+}
+
+template<typename F>
+void ExplicitTriang
+( const ldl::NodeInfo& info, const SparseFront<F>& front,
+  SparseMatrix<F>& R )
+{
+    DEBUG_ONLY(CSE cse("qr::ExplicitTriang"))
+    const Int n = info.off + info.size;
+    Zeros( R, n, n );
+
+    function<void(const ldl::NodeInfo&,const SparseFront<F>&)> queue =
+      [&]( const ldl::NodeInfo& node, const SparseFront<F>& nodeFront )
+      {
+          const Int numChildren = node.children.size();
+          for( Int c=0; c<numChildren; ++c )
+              queue( *node.children[c], *nodeFront.children[c] );
+          const Int size = node.size;
+          const Int width = nodeFront.QR.Width();
+          for( Int i=0; i<size; ++i )
+          {
+              for( Int j=i; j<width; ++j )
+              {
+                  const F value = nodeFront.QR.Get(i,j);
+                  if( value == F(0) )
+                      continue;
+                  const Int col =
+                    ( j < size ? node.off+j : node.lowerStruct[j-size] );
+                  R.QueueUpdate( node.off+i, col, value );
+              }
+          }
+      };
+    queue( info, front );
+    R.ProcessQueues();
+}
+
+} // namespace qr
+
+template<typename F>
+void QR
+( const SparseMatrix<F>& A, const vector<Int>& map,
+  const ldl::NodeInfo& info, qr::SparseFront<F>& front )
+{
+    DEBUG_ONLY(
+      CSE cse("QR");
+      if( A.Width() != Int(map.size()) )
+          LogicError("Mapping was not the right size");
+    )
+    const Int m = A.Height();
+    const Int n = A.Width();
+    vector<qr::SparseFront<F>*> frontOf( n );
+    qr::BuildTree( info, front, frontOf );
+
+    // Assemble each row into the front containing its leading column
+    for( Int i=0; i<m; ++i )
+    {
+        const Int rowOff = A.RowOffset( i );
+        const Int numConn = A.NumConnections( i );
+        if( numConn == 0 )
+            continue;
+        Int lead = n;
+        for( Int e=rowOff; e<rowOff+numConn; ++e )
+            lead = Min( lead, map[A.Col(e)] );
+        frontOf[lead]->rows.push_back( i );
+    }
+
+    const Base<F> tol = Max(m,n)*Epsilon<Base<F>>()*FrobeniusNorm(A);
+    qr::Factor( A, map, info, front, tol );
+    front.work.Empty();
+}
+
+#define PROTO(F) \
+  template void QR \
+  ( const SparseMatrix<F>& A, const vector<Int>& map, \
+    const ldl::NodeInfo& info, qr::SparseFront<F>& front ); \
+  template void qr::NestedDissection \
+  ( const SparseMatrix<F>& A, \
+          vector<Int>& map, \
+          ldl::Separator& rootSep, \
+          ldl::NodeInfo& info, \
+    const BisectCtrl& ctrl ); \
+  template void qr::ApplyQAdjoint \
+  ( const ldl::NodeInfo& info, const qr::SparseFront<F>& front, \
+    const Matrix<F>& B, Matrix<F>& C ); \
+  template void qr::SolveR \
+  ( const ldl::NodeInfo& info, const qr::SparseFront<F>& front, \
+    Matrix<F>& X ); \
+  template void qr::SolveAfter \
+  ( const vector<Int>& invMap, const ldl::NodeInfo& info, \
+    const qr::SparseFront<F>& front, const Matrix<F>& B, Matrix<F>& X ); \
+  template void qr::ExplicitTriang \
+  ( const ldl::NodeInfo& info, const qr::SparseFront<F>& front, \
+    SparseMatrix<F>& R );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -18,6 +18,7 @@ ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl )
     ctrl->tol = 0;
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
+    ctrl->newtonSchulz = false;
     ctrl->progress = false;
     return EL_SUCCESS;
 }
@@ -27,6 +28,7 @@ ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl )
     ctrl->tol = 0;
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
+    ctrl->newtonSchulz = false;
     ctrl->progress = false;
     return EL_SUCCESS;
 }
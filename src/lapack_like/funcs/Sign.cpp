@@ -19,14 +19,14 @@ namespace sign {
 template<typename F>
 inline void
 NewtonStep
-( const Matrix<F>& X, Matrix<F>& XNew, SignScaling scaling=SIGN_SCALE_FROB )
+( const Matrix<F>& X, Matrix<F>& XNew, Matrix<Int>& p,
+  SignScaling scaling=SIGN_SCALE_FROB )
 {
     DEBUG_ONLY(CSE cse("sign::NewtonStep"))
     typedef Base<F> Real;
 
     // Calculate mu while forming XNew := inv(X)
     Real mu=1;
-    Matrix<Int> p;
     XNew = X;
     LU( XNew, p );
     if( scaling == SIGN_SCALE_DET )
@@ -48,7 +48,7 @@ NewtonStep
 template<typename F>
 inline void
 NewtonStep
-( const DistMatrix<F>& X, DistMatrix<F>& XNew, 
+( const DistMatrix<F>& X, DistMatrix<F>& XNew, DistMatrix<Int,VC,STAR>& p,
   SignScaling scaling=SIGN_SCALE_FROB )
 {
     DEBUG_ONLY(CSE cse("sign::NewtonStep"))
@@ -56,7 +56,6 @@ NewtonStep
 
     // Calculate mu while forming B := inv(X)
     Real mu=1;
-    DistMatrix<Int,VC,STAR> p( X.Grid() );
     XNew = X;
     LU( XNew, p );
     if( scaling == SIGN_SCALE_DET )
@@ -80,15 +79,23 @@ inline void
 NewtonSchulzStep( const Matrix<F>& X, Matrix<F>& XTmp, Matrix<F>& XNew )
 {
     DEBUG_ONLY(CSE cse("sign::NewtonSchulzStep"))
-    typedef Base<F> Real;
-    const Int n = X.Height();
- 
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    // XTmp := 3I - X^2, where XTmp = I - X^2 on input
+    ShiftDiagonal( XTmp, F(2) );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), X, XTmp, XNew );
+}
+
+// Overwrite XTmp with I - X^2 and return its one norm
+template<typename F>
+inline Base<F>
+InvolutionResidual( const Matrix<F>& X, Matrix<F>& XTmp )
+{
+    DEBUG_ONLY(CSE cse("sign::InvolutionResidual"))
+    const Int n = X.Height();
+    Identity( XTmp, n, n );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(1), XTmp );
+    return OneNorm( XTmp );
 }
 
 template<typename F>
@@ -97,15 +104,23 @@ NewtonSchulzStep
 ( const DistMatrix<F>& X, DistMatrix<F>& XTmp, DistMatrix<F>& XNew )
 {
     DEBUG_ONLY(CSE cse("sign::NewtonSchulzStep"))
-    typedef Base<F> Real;
-    const Int n = X.Height();
-
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    // XTmp := 3I - X^2, where XTmp = I - X^2 on input
+    ShiftDiagonal( XTmp, F(2) );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), X, XTmp, XNew );
+}
+
+// Overwrite XTmp with I - X^2 and return its one norm
+template<typename F>
+inline Base<F>
+InvolutionResidual( const DistMatrix<F>& X, DistMatrix<F>& XTmp )
+{
+    DEBUG_ONLY(CSE cse("sign::InvolutionResidual"))
+    const Int n = X.Height();
+    Identity( XTmp, n, n );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(1), XTmp );
+    return OneNorm( XTmp );
 }
 
 // Please see Chapter 5 of Higham's 
@@ -122,12 +137,17 @@ Newton( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
         tol = A.Height()*Epsilon<Real>();
 
     Int numIts=0;
-    Matrix<F> B;
+    Matrix<F> B, XTmp;
+    Matrix<Int> p;
     Matrix<F> *X=&A, *XNew=&B;
+    bool schulz=false;
     while( numIts < ctrl.maxIts )
     {
         // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        if( schulz )
+            NewtonSchulzStep( *X, XTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, p, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
@@ -138,12 +158,27 @@ Newton( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
         ++numIts;
         std::swap( X, XNew );
         if( ctrl.progress )
-            cout << "after " << numIts << " Newton iter's: " 
+            cout << "after " << numIts << " Newton iter's: "
                  << "oneDiff=" << oneDiff << ", oneNew=" << oneNew 
                  << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
                  << tol << endl;
         if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
             break;
+
+        // Newton-Schulz converges once || I - X^2 ||_1 < 1, and it is only
+        // worth testing for (with a Gemm) once Newton has nearly converged.
+        // Either way, XTmp is left holding I - X^2 for the next Newton-Schulz
+        // step.
+        if( schulz )
+            InvolutionResidual( *X, XTmp );
+        else if( ctrl.newtonSchulz && 4*oneDiff <= oneNew )
+        {
+            const Real oneRes = InvolutionResidual( *X, XTmp );
+            schulz = ( oneRes < Real(1) );
+            if( schulz && ctrl.progress )
+                cout << "switching to Newton-Schulz with ||I-X^2||_1="
+                     << oneRes << endl;
+        }
     }
     if( X != &A )
         A = *X;
@@ -161,12 +196,17 @@ Newton( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
         tol = A.Height()*Epsilon<Real>();
 
     Int numIts=0;
-    DistMatrix<F> B( A.Grid() );
+    DistMatrix<F> B( A.Grid() ), XTmp( A.Grid() );
+    DistMatrix<Int,VC,STAR> p( A.Grid() );
     DistMatrix<F> *X=&A, *XNew=&B;
+    bool schulz=false;
     while( numIts < ctrl.maxIts )
     {
         // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        if( schulz )
+            NewtonSchulzStep( *X, XTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, p, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
@@ -183,14 +223,27 @@ Newton( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
                  << tol << endl;
         if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
             break;
+
+        // Newton-Schulz converges once || I - X^2 ||_1 < 1, and it is only
+        // worth testing for (with a Gemm) once Newton has nearly converged.
+        // Either way, XTmp is left holding I - X^2 for the next Newton-Schulz
+        // step.
+        if( schulz )
+            InvolutionResidual( *X, XTmp );
+        else if( ctrl.newtonSchulz && 4*oneDiff <= oneNew )
+        {
+            const Real oneRes = InvolutionResidual( *X, XTmp );
+            schulz = ( oneRes < Real(1) );
+            if( schulz && ctrl.progress && A.Grid().Rank() == 0 )
+                cout << "switching to Newton-Schulz with ||I-X^2||_1="
+                     << oneRes << endl;
+        }
     }
     if( X != &A )
         A = *X;
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
-
 } // namespace sign
 
 template<typename F>
@@ -0,0 +1,341 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+namespace {
+
+template<typename F>
+void MakeAlternating( Matrix<F>& x )
+{
+    typedef Base<F> Real;
+    const Int n = x.Height();
+    const Real denom = Max(n-1,1);
+    for( Int i=0; i<n; ++i )
+    {
+        const Real sign = ( i%2 == 0 ? Real(1) : Real(-1) );
+        x.Set( i, 0, sign*(1+i/denom) );
+    }
+}
+
+template<typename F>
+void MakeAlternating( AbstractDistMatrix<F>& x )
+{
+    typedef Base<F> Real;
+    const Int n = x.Height();
+    const Real denom = Max(n-1,1);
+    const Int localHeight = x.LocalHeight();
+    const Int localWidth = x.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = x.GlobalRow(iLoc);
+            const Real sign = ( i%2 == 0 ? Real(1) : Real(-1) );
+            x.SetLocal( iLoc, jLoc, sign*(1+i/denom) );
+        }
+    }
+}
+
+template<typename F>
+void MakeAlternating( DistMultiVec<F>& x )
+{
+    typedef Base<F> Real;
+    const Int n = x.Height();
+    const Real denom = Max(n-1,1);
+    const Int localHeight = x.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = x.GlobalRow(iLoc);
+        const Real sign = ( i%2 == 0 ? Real(1) : Real(-1) );
+        x.SetLocal( iLoc, 0, sign*(1+i/denom) );
+    }
+}
+
+// Estimate the one-norm of inv(A) given the means of overwriting a vector x
+// with either inv(A) x or inv(A)^H x. The input vector should be n x 1 and
+// is used as workspace.
+//
+// See Algorithm 4.1 of N.J. Higham, "FORTRAN codes for estimating the
+// one-norm of a real or complex matrix, with applications to condition
+// estimation", ACM TOMS, Vol. 14, No. 4, 1988.
+template<typename F,class VectorType>
+Base<F> InverseOneNormEstimate
+( function<void(Orientation,VectorType&)> applyInverse, VectorType& x,
+  Int maxIts=5 )
+{
+    DEBUG_ONLY(CSE cse("InverseOneNormEstimate"))
+    typedef Base<F> Real;
+    const Int n = x.Height();
+    if( n == 0 )
+        return Real(0);
+
+    auto sign =
+      []( F alpha ) { return alpha == F(0) ? F(1) : alpha/Abs(alpha); };
+
+    Fill( x, F(1)/F(n) );
+    VectorType y( x );
+    Real estimate = 0;
+    Int lastIndex = -1;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        y = x;
+        applyInverse( NORMAL, y );
+        const Real yOneNorm = EntrywiseNorm( y, Real(1) );
+        if( it > 0 && yOneNorm <= estimate )
+            break;
+        estimate = yOneNorm;
+
+        // Overwrite y with z := inv(A)^H sign(y)
+        EntrywiseMap( y, function<F(F)>(sign) );
+        applyInverse( ADJOINT, y );
+
+        // Stop if the subgradient test is satisfied or would not move us to
+        // a new vertex of the unit ball
+        const auto pivot = VectorMaxAbs( y );
+        if( pivot.value <= RealPart(Dot(y,x)) || pivot.index == lastIndex )
+            break;
+        lastIndex = pivot.index;
+        Zeros( x, n, 1 );
+        x.Set( pivot.index, 0, F(1) );
+    }
+
+    // Guard against the (rare) cases where the above iteration badly
+    // underestimates the norm by testing against a vector with alternating
+    // signs and gradually increasing magnitudes
+    MakeAlternating( x );
+    applyInverse( NORMAL, x );
+    const Real altEstimate = 2*EntrywiseNorm( x, Real(1) )/(3*n);
+    return Max( estimate, altEstimate );
+}
+
+// || inv(A) ||_oo = || inv(A)^H ||_1
+template<typename F,class VectorType>
+Base<F> InverseInfinityNormEstimate
+( function<void(Orientation,VectorType&)> applyInverse, VectorType& x )
+{
+    function<void(Orientation,VectorType&)> applyAdjointInverse =
+      [&]( Orientation orientation, VectorType& y )
+      { applyInverse( orientation==NORMAL ? ADJOINT : NORMAL, y ); };
+    return InverseOneNormEstimate<F>( applyAdjointInverse, x );
+}
+
+// Symmetric matrices satisfy inv(A)^H = conj(inv(A)), so their adjoint
+// solves can be formed by conjugating before and after a normal solve
+template<typename F,class VectorType>
+function<void(Orientation,VectorType&)>
+SymmetricInverse
+( function<void(VectorType&)> solve, bool conjugated )
+{
+    function<F(F)> conj = []( F alpha ) { return Conj(alpha); };
+    return
+      [=]( Orientation orientation, VectorType& y )
+      {
+          if( orientation == NORMAL || conjugated || !IsComplex<F>::val )
+          {
+              solve( y );
+          }
+          else
+          {
+              EntrywiseMap( y, conj );
+              solve( y );
+              EntrywiseMap( y, conj );
+          }
+      };
+}
+
+} // anonymous namespace
+
+namespace lu {
+
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA, const Matrix<F>& A, const Matrix<Int>& p )
+{
+    DEBUG_ONLY(CSE cse("lu::OneConditionEstimate"))
+    function<void(Orientation,Matrix<F>&)> applyInverse =
+      [&]( Orientation orientation, Matrix<F>& y )
+      { SolveAfter( orientation, A, p, y ); };
+    Matrix<F> x;
+    Zeros( x, A.Height(), 1 );
+    return oneNormA*InverseOneNormEstimate<F>( applyInverse, x );
+}
+
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA,
+  const AbstractDistMatrix<F>& A, const AbstractDistMatrix<Int>& p )
+{
+    DEBUG_ONLY(CSE cse("lu::OneConditionEstimate"))
+    function<void(Orientation,DistMatrix<F>&)> applyInverse =
+      [&]( Orientation orientation, DistMatrix<F>& y )
+      { SolveAfter( orientation, A, p, y ); };
+    DistMatrix<F> x( A.Grid() );
+    Zeros( x, A.Height(), 1 );
+    return oneNormA*InverseOneNormEstimate<F>( applyInverse, x );
+}
+
+template<typename F>
+Base<F> InfinityConditionEstimate
+( Base<F> infNormA, const Matrix<F>& A, const Matrix<Int>& p )
+{
+    DEBUG_ONLY(CSE cse("lu::InfinityConditionEstimate"))
+    function<void(Orientation,Matrix<F>&)> applyInverse =
+      [&]( Orientation orientation, Matrix<F>& y )
+      { SolveAfter( orientation, A, p, y ); };
+    Matrix<F> x;
+    Zeros( x, A.Height(), 1 );
+    return infNormA*InverseInfinityNormEstimate<F>( applyInverse, x );
+}
+
+template<typename F>
+Base<F> InfinityConditionEstimate
+( Base<F> infNormA,
+  const AbstractDistMatrix<F>& A, const AbstractDistMatrix<Int>& p )
+{
+    DEBUG_ONLY(CSE cse("lu::InfinityConditionEstimate"))
+    function<void(Orientation,DistMatrix<F>&)> applyInverse =
+      [&]( Orientation orientation, DistMatrix<F>& y )
+      { SolveAfter( orientation, A, p, y ); };
+    DistMatrix<F> x( A.Grid() );
+    Zeros( x, A.Height(), 1 );
+    return infNormA*InverseInfinityNormEstimate<F>( applyInverse, x );
+}
+
+} // namespace lu
+
+namespace cholesky {
+
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA, UpperOrLower uplo, const Matrix<F>& A )
+{
+    DEBUG_ONLY(CSE cse("cholesky::OneConditionEstimate"))
+    // Hermitian positive-definite matrices have Hermitian inverses
+    function<void(Orientation,Matrix<F>&)> applyInverse =
+      [&]( Orientation orientation, Matrix<F>& y )
+      { SolveAfter( uplo, NORMAL, A, y ); };
+    Matrix<F> x;
+    Zeros( x, A.Height(), 1 );
+    return oneNormA*InverseOneNormEstimate<F>( applyInverse, x );
+}
+
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA, UpperOrLower uplo, const AbstractDistMatrix<F>& A )
+{
+    DEBUG_ONLY(CSE cse("cholesky::OneConditionEstimate"))
+    function<void(Orientation,DistMatrix<F>&)> applyInverse =
+      [&]( Orientation orientation, DistMatrix<F>& y )
+      { SolveAfter( uplo, NORMAL, A, y ); };
+    DistMatrix<F> x( A.Grid() );
+    Zeros( x, A.Height(), 1 );
+    return oneNormA*InverseOneNormEstimate<F>( applyInverse, x );
+}
+
+} // namespace cholesky
+
+namespace ldl {
+
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA, const Matrix<F>& A, const Matrix<F>& dSub,
+  const Matrix<Int>& p, bool conjugated )
+{
+    DEBUG_ONLY(CSE cse("ldl::OneConditionEstimate"))
+    function<void(Matrix<F>&)> solve =
+      [&]( Matrix<F>& y ) { SolveAfter( A, dSub, p, y, conjugated ); };
+    auto applyInverse = SymmetricInverse<F>( solve, conjugated );
+    Matrix<F> x;
+    Zeros( x, A.Height(), 1 );
+    return oneNormA*InverseOneNormEstimate<F>( applyInverse, x );
+}
+
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA,
+  const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& dSub,
+  const AbstractDistMatrix<Int>& p, bool conjugated )
+{
+    DEBUG_ONLY(CSE cse("ldl::OneConditionEstimate"))
+    function<void(DistMatrix<F>&)> solve =
+      [&]( DistMatrix<F>& y ) { SolveAfter( A, dSub, p, y, conjugated ); };
+    auto applyInverse = SymmetricInverse<F>( solve, conjugated );
+    DistMatrix<F> x( A.Grid() );
+    Zeros( x, A.Height(), 1 );
+    return oneNormA*InverseOneNormEstimate<F>( applyInverse, x );
+}
+
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA,
+  const vector<Int>& invMap, const NodeInfo& info, const Front<F>& front )
+{
+    DEBUG_ONLY(CSE cse("ldl::OneConditionEstimate"))
+    function<void(Matrix<F>&)> solve =
+      [&]( Matrix<F>& y ) { SolveAfter( invMap, info, front, y ); };
+    auto applyInverse = SymmetricInverse<F>( solve, front.isHermitian );
+    Matrix<F> x;
+    Zeros( x, Int(invMap.size()), 1 );
+    return oneNormA*InverseOneNormEstimate<F>( applyInverse, x );
+}
+
+template<typename F>
+Base<F> OneConditionEstimate
+( Base<F> oneNormA,
+  const DistMap& invMap, const DistNodeInfo& info,
+  const DistFront<F>& front )
+{
+    DEBUG_ONLY(CSE cse("ldl::OneConditionEstimate"))
+    function<void(DistMultiVec<F>&)> solve =
+      [&]( DistMultiVec<F>& y ) { SolveAfter( invMap, info, front, y ); };
+    auto applyInverse = SymmetricInverse<F>( solve, front.isHermitian );
+    DistMultiVec<F> x( invMap.Comm() );
+    Zeros( x, invMap.NumSources(), 1 );
+    return oneNormA*InverseOneNormEstimate<F>( applyInverse, x );
+}
+
+} // namespace ldl
+
+#define PROTO(F) \
+  template Base<F> lu::OneConditionEstimate \
+  ( Base<F> oneNormA, const Matrix<F>& A, const Matrix<Int>& p ); \
+  template Base<F> lu::OneConditionEstimate \
+  ( Base<F> oneNormA, \
+    const AbstractDistMatrix<F>& A, const AbstractDistMatrix<Int>& p ); \
+  template Base<F> lu::InfinityConditionEstimate \
+  ( Base<F> infNormA, const Matrix<F>& A, const Matrix<Int>& p ); \
+  template Base<F> lu::InfinityConditionEstimate \
+  ( Base<F> infNormA, \
+    const AbstractDistMatrix<F>& A, const AbstractDistMatrix<Int>& p ); \
+  template Base<F> cholesky::OneConditionEstimate \
+  ( Base<F> oneNormA, UpperOrLower uplo, const Matrix<F>& A ); \
+  template Base<F> cholesky::OneConditionEstimate \
+  ( Base<F> oneNormA, UpperOrLower uplo, const AbstractDistMatrix<F>& A ); \
+  template Base<F> ldl::OneConditionEstimate \
+  ( Base<F> oneNormA, const Matrix<F>& A, const Matrix<F>& dSub, \
+    const Matrix<Int>& p, bool conjugated ); \
+  template Base<F> ldl::OneConditionEstimate \
+  ( Base<F> oneNormA, \
+    const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& dSub, \
+    const AbstractDistMatrix<Int>& p, bool conjugated ); \
+  template Base<F> ldl::OneConditionEstimate \
+  ( Base<F> oneNormA, \
+    const vector<Int>& invMap, const ldl::NodeInfo& info, \
+    const ldl::Front<F>& front ); \
+  template Base<F> ldl::OneConditionEstimate \
+  ( Base<F> oneNormA, \
+    const DistMap& invMap, const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<F>& front );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -219,6 +219,76 @@ void LinearSolve
     B = X;
 }
 
+template<typename F>
+void LinearSolve
+( const SparseMatrix<F>& A, Matrix<F>& B,
+  const LUStaticPivotCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LinearSolve"))
+    const Int n = A.Height();
+
+    // Reorder using the (symmetric) graph of A + A^T
+    const Int numEntries = A.NumEntries();
+    Graph graph( n );
+    graph.Reserve( 2*numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        graph.QueueConnection( A.Row(e), A.Col(e) );
+        graph.QueueConnection( A.Col(e), A.Row(e) );
+    }
+    graph.ProcessQueues();
+
+    ldl::NodeInfo info;
+    ldl::Separator rootSep;
+    vector<Int> map, invMap;
+    ldl::NestedDissection( graph, map, rootSep, info );
+    InvertMap( map, invMap );
+
+    ldl::Front<F> L, U;
+    lu::Pull( A, map, info, L, U );
+    LU( info, L, U, ctrl );
+    lu::SolveWithIterativeRefinement
+    ( A, invMap, info, L, U, B, ctrl.minReductionFactor, ctrl.maxRefineIts );
+}
+
+template<typename F>
+void LinearSolve
+( const DistSparseMatrix<F>& A, DistMultiVec<F>& B,
+  const LUStaticPivotCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LinearSolve"))
+    mpi::Comm comm = A.Comm();
+    const Int n = A.Height();
+
+    // Reorder using the (symmetric) graph of A + A^T, whose local sources are
+    // the local rows of both A and A^T
+    DistSparseMatrix<F> ATrans(comm);
+    Transpose( A, ATrans );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int numLocalEntriesTrans = ATrans.NumLocalEntries();
+    DistGraph graph( n, comm );
+    graph.Reserve( numLocalEntries+numLocalEntriesTrans );
+    for( Int e=0; e<numLocalEntries; ++e )
+        graph.QueueLocalConnection( A.Row(e)-firstLocalRow, A.Col(e) );
+    for( Int e=0; e<numLocalEntriesTrans; ++e )
+        graph.QueueLocalConnection
+        ( ATrans.Row(e)-firstLocalRow, ATrans.Col(e) );
+    graph.ProcessLocalQueues();
+
+    ldl::DistNodeInfo info;
+    ldl::DistSeparator rootSep;
+    DistMap map, invMap;
+    ldl::NestedDissection( graph, map, rootSep, info );
+    InvertMap( map, invMap );
+
+    ldl::DistFront<F> L, U;
+    lu::Pull( A, map, rootSep, info, L, U );
+    LU( info, L, U, ctrl );
+    lu::SolveWithIterativeRefinement
+    ( A, invMap, info, L, U, B, ctrl.minReductionFactor, ctrl.maxRefineIts );
+}
+
 #define PROTO(F) \
   template void lin_solve::Overwrite( Matrix<F>& A, Matrix<F>& B ); \
   template void lin_solve::Overwrite \
@@ -231,7 +301,13 @@ void LinearSolve
     const LeastSquaresCtrl<Base<F>>& ctrl ); \
   template void LinearSolve \
   ( const DistSparseMatrix<F>& A, DistMultiVec<F>& B, \
-    const LeastSquaresCtrl<Base<F>>& ctrl );
+    const LeastSquaresCtrl<Base<F>>& ctrl ); \
+  template void LinearSolve \
+  ( const SparseMatrix<F>& A, Matrix<F>& B, \
+    const LUStaticPivotCtrl<Base<F>>& ctrl ); \
+  template void LinearSolve \
+  ( const DistSparseMatrix<F>& A, DistMultiVec<F>& B, \
+    const LUStaticPivotCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #include "El/macros/Instantiate.h"
@@ -39,68 +39,64 @@ LN( F alpha, const Matrix<F>& H, const Matrix<F>& shifts, Matrix<F>& X )
 
     // Initialize the workspace for shifted columns of H
     Matrix<F> W(m,n);
+
+    // Since the shifts are independent, each column of X is run through the
+    // entire factorization and solve before moving on to the next. This keeps
+    // the working column resident in cache and allows the shifts to be 
+    // divided amongst threads.
+    EL_PARALLEL_FOR
     for( Int j=0; j<n; ++j )
     {
-        MemCopy( W.Buffer(0,j), H.LockedBuffer(), m );
-        W.Update( 0, j, -shifts.Get(j,0) );
-    }
-     
-    // Simultaneously find the LQ factorization and solve against L
-    for( Int k=0; k<m-1; ++k )
-    {
-        auto hB = H( IR(k+2,m), IR(k+1) );
-        const F etakkp1 = H.Get(k,k+1);
-        const F etakp1kp1 = H.Get(k+1,k+1);
-        for( Int j=0; j<n; ++j )
+        const F mu = shifts.Get( j, 0 );
+        F* x = X.Buffer(0,j);
+        F* w = W.Buffer(0,j);
+        Real* c = C.Buffer(0,j);
+        F* s = S.Buffer(0,j);
+        MemCopy( w, H.LockedBuffer(), m );
+        w[0] -= mu;
+
+        // Simultaneously find the LQ factorization and solve against L
+        for( Int k=0; k<m-1; ++k )
         {
+            const F* hB = H.LockedBuffer(k+2,k+1);
+            const F etakkp1 = H.Get(k,k+1);
+            const F etakp1kp1 = H.Get(k+1,k+1);
+
             // Find the Givens rotation needed to zero H(k,k+1),
             //   | c        s | | H(k,k)   | = | gamma |
             //   | -conj(s) c | | H(k,k+1) |   | 0     |
-            Real c; F s;
-            lapack::Givens( W.Get(k,j), etakkp1, &c, &s );
-            C.Set( k, j, c );
-            S.Set( k, j, s );
+            lapack::Givens( w[k], etakkp1, &c[k], &s[k] );
 
             // The new diagonal value of L
-            const F lambdakk = c*W.Get(k,j) + s*etakkp1;
+            const F lambdakk = c[k]*w[k] + s[k]*etakkp1;
 
             // Divide our current entry of x by the diagonal value of L
-            X.Set( k, j, X.Get(k,j)/lambdakk );
+            x[k] /= lambdakk;
 
             // x(k+1:end) -= x(k) * L(k+1:end,k), where
             // L(k+1:end,k) = c H(k+1:end,k) + s H(k+1:end,k+1). We express this
             // more concisely as xB -= x(k) * ( c wB + s hB ).
             // Note that we carefully handle updating the k+1'th entry since
             // it is shift-dependent.
-            const F mu = shifts.Get( j, 0 );
-            const F xc = X.Get(k,j)*c;
-            const F xs  = X.Get(k,j)*s;
-            X.Update( k+1, j, -xc*W.Get(k+1,j)-xs*(etakp1kp1-mu) );
-            blas::Axpy
-            ( m-(k+2), -xc, W.LockedBuffer(k+2,j), 1, X.Buffer(k+2,j), 1 );
-            blas::Axpy
-            ( m-(k+2), -xs, hB.LockedBuffer(),     1, X.Buffer(k+2,j), 1 );
+            const F xc = x[k]*c[k];
+            const F xs = x[k]*s[k];
+            x[k+1] -= xc*w[k+1] + xs*(etakp1kp1-mu);
+            blas::Axpy( m-(k+2), -xc, &w[k+2], 1, &x[k+2], 1 );
+            blas::Axpy( m-(k+2), -xs, hB,      1, &x[k+2], 1 );
 
             // Change the working vector, wB, from representing a fully-updated
             // portion of the k'th column of H from the end of the last 
             // to a fully-updated portion of the k+1'th column of this iteration
             //
             // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1)
-            W.Set( k+1, j, -Conj(s)*W.Get(k+1,j)+c*(etakp1kp1-mu) );
-            blas::Scal( m-(k+2), -Conj(s), W.Buffer(k+2,j), 1 );
-            blas::Axpy( m-(k+2), c, hB.LockedBuffer(), 1, W.Buffer(k+2,j), 1 );
+            w[k+1] = -Conj(s[k])*w[k+1] + c[k]*(etakp1kp1-mu);
+            blas::Scal( m-(k+2), -Conj(s[k]), &w[k+2], 1 );
+            blas::Axpy( m-(k+2), c[k], hB, 1, &w[k+2], 1 );
         }
-    }
-    // Divide x(end) by L(end,end)
-    for( Int j=0; j<n; ++j )
-        X.Set( m-1, j, X.Get(m-1,j)/W.Get(m-1,j) );
+        // Divide x(end) by L(end,end)
+        x[m-1] /= w[m-1];
 
-    // Solve against Q
-    for( Int j=0; j<n; ++j )        
-    {
-        F* x = X.Buffer(0,j);
-        const Real* c = C.LockedBuffer(0,j);
-        const F*    s = S.LockedBuffer(0,j);
+        // Solve against Q
         F tau0 = x[m-1];
         for( Int k=m-2; k>=0; --k )
         {
@@ -131,66 +127,61 @@ UN( F alpha, const Matrix<F>& H, const Matrix<F>& shifts, Matrix<F>& X )
 
     // Initialize the workspace for shifted columns of H
     Matrix<F> W(m,n);
+
+    // Each shift is handled independently (see the comment in mshs::LN)
+    EL_PARALLEL_FOR
     for( Int j=0; j<n; ++j )
     {
-        MemCopy( W.Buffer(0,j), H.LockedBuffer(0,m-1), m );
-        W.Update( m-1, j, -shifts.Get(j,0) );
-    }
-     
-    // Simultaneously form the RQ factorization and solve against R
-    for( Int k=m-1; k>0; --k )
-    {
-        auto hT = H( IR(0,k-1), IR(k-1) );
-        const F etakkm1 = H.Get(k,k-1);
-        const F etakm1km1 = H.Get(k-1,k-1);
-        for( Int j=0; j<n; ++j )
+        const F mu = shifts.Get( j, 0 );
+        F* x = X.Buffer(0,j);
+        F* w = W.Buffer(0,j);
+        Real* c = C.Buffer(0,j);
+        F* s = S.Buffer(0,j);
+        MemCopy( w, H.LockedBuffer(0,m-1), m );
+        w[m-1] -= mu;
+
+        // Simultaneously form the RQ factorization and solve against R
+        for( Int k=m-1; k>0; --k )
         {
+            const F* hT = H.LockedBuffer(0,k-1);
+            const F etakkm1 = H.Get(k,k-1);
+            const F etakm1km1 = H.Get(k-1,k-1);
+
             // Find the Givens rotation needed to zero H(k,k-1),
             //   | c        s | | H(k,k)   | = | gamma |
             //   | -conj(s) c | | H(k,k-1) |   | 0     |
-            Real c; F s;
-            lapack::Givens( W.Get(k,j), etakkm1, &c, &s );
-            C.Set( k, j, c );
-            S.Set( k, j, s );
+            lapack::Givens( w[k], etakkm1, &c[k], &s[k] );
 
             // The new diagonal value of R
-            const F rhokk = c*W.Get(k,j) + s*etakkm1;
+            const F rhokk = c[k]*w[k] + s[k]*etakkm1;
 
             // Divide our current entry of x by the diagonal value of R
-            X.Set( k, j, X.Get(k,j)/rhokk );
+            x[k] /= rhokk;
 
             // x(0:k-1) -= x(k) * R(0:k-1,k), where
             // R(0:k-1,k) = c H(0:k-1,k) + s H(0:k-1,k-1). We express this
             // more concisely as xT -= x(k) * ( c wT + s hT ).
             // Note that we carefully handle updating the k-1'th entry since
             // it is shift-dependent.
-            const F mu = shifts.Get( j, 0 );
-            const F xc = X.Get(k,j)*c;
-            const F xs  = X.Get(k,j)*s;
-            blas::Axpy( k-1, -xc, W.LockedBuffer(0,j), 1, X.Buffer(0,j), 1 );
-            blas::Axpy( k-1, -xs, hT.LockedBuffer(),   1, X.Buffer(0,j), 1 );
-            X.Update( k-1, j, -xc*W.Get(k-1,j)-xs*(etakm1km1-mu) );
+            const F xc = x[k]*c[k];
+            const F xs = x[k]*s[k];
+            blas::Axpy( k-1, -xc, w,  1, x, 1 );
+            blas::Axpy( k-1, -xs, hT, 1, x, 1 );
+            x[k-1] -= xc*w[k-1] + xs*(etakm1km1-mu);
 
             // Change the working vector, wT, from representing a fully-updated
             // portion of the k'th column of H from the end of the last 
             // to a fully-updated portion of the k-1'th column of this iteration
             //
             // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1)
-            blas::Scal( k-1, -Conj(s), W.Buffer(0,j), 1 );
-            blas::Axpy( k-1, c, hT.LockedBuffer(), 1, W.Buffer(0,j), 1 );
-            W.Set( k-1, j, -Conj(s)*W.Get(k-1,j)+c*(etakm1km1-mu) );
+            blas::Scal( k-1, -Conj(s[k]), w, 1 );
+            blas::Axpy( k-1, c[k], hT, 1, w, 1 );
+            w[k-1] = -Conj(s[k])*w[k-1] + c[k]*(etakm1km1-mu);
         }
-    }
-    // Divide x(0) by R(0,0)
-    for( Int j=0; j<n; ++j )
-        X.Set( 0, j, X.Get(0,j)/W.Get(0,j) );
+        // Divide x(0) by R(0,0)
+        x[0] /= w[0];
 
-    // Solve against Q
-    for( Int j=0; j<n; ++j )        
-    {
-        F* x = X.Buffer(0,j);
-        const Real* c = C.LockedBuffer(0,j);
-        const F*    s = S.LockedBuffer(0,j);
+        // Solve against Q
         F tau0 = x[0];
         for( Int k=1; k<m; ++k )
         {
@@ -259,6 +250,7 @@ LN
         hB_STAR_STAR = *hB;
         const F etakkp1 = H.Get(k,k+1);
         const F etakp1kp1 = H.Get(k+1,k+1);
+        EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
             // Find the Givens rotation needed to zero H(k,k+1),
@@ -308,6 +300,7 @@ LN
         X.SetLocal( m-1, jLoc, X.GetLocal(m-1,jLoc)/W.Get(m-1,jLoc) );
 
     // Solve against Q
+    EL_PARALLEL_FOR
     for( Int jLoc=0; jLoc<nLoc; ++jLoc ) 
     {
         F* x = X.Buffer(0,jLoc);
@@ -376,6 +369,7 @@ UN
         hT_STAR_STAR = *hT;
         const F etakkm1 = H.Get(k,k-1);
         const F etakm1km1 = H.Get(k-1,k-1);
+        EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
             // Find the Givens rotation needed to zero H(k,k-1),
@@ -421,6 +415,7 @@ UN
         X.SetLocal( 0, jLoc, X.GetLocal(0,jLoc)/W.Get(0,jLoc) );
 
     // Solve against Q
+    EL_PARALLEL_FOR
     for( Int jLoc=0; jLoc<nLoc; ++jLoc )
     {
         F* x = X.Buffer(0,jLoc);
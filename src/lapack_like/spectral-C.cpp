@@ -34,6 +34,28 @@ ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl )
     return EL_SUCCESS;
 }
 
+/* HermitianSubspaceCtrl */
+ElError ElHermitianSubspaceCtrlDefault_s( ElHermitianSubspaceCtrl_s* ctrl )
+{
+    ctrl->degree = 10;
+    ctrl->numGuard = 0;
+    ctrl->maxWidthRatio = 0.25;
+    ctrl->maxIts = 100;
+    ctrl->tol = 0;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+ElError ElHermitianSubspaceCtrlDefault_d( ElHermitianSubspaceCtrl_d* ctrl )
+{
+    ctrl->degree = 10;
+    ctrl->numGuard = 0;
+    ctrl->maxWidthRatio = 0.25;
+    ctrl->maxIts = 100;
+    ctrl->tol = 0;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+
 /* HermitianEigSubset */
 ElError ElHermitianEigSubsetDefault_s( ElHermitianEigSubset_s* subset )
 {
@@ -61,28 +83,36 @@ ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl )
 {
     ElHermitianTridiagCtrlDefault_s( &ctrl->tridiagCtrl );
     ElHermitianSDCCtrlDefault_s( &ctrl->sdcCtrl );
+    ElHermitianSubspaceCtrlDefault_s( &ctrl->subspaceCtrl );
     ctrl->useSDC = false;
+    ctrl->useSubspace = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl )
 {
     ElHermitianTridiagCtrlDefault_d( &ctrl->tridiagCtrl );
     ElHermitianSDCCtrlDefault_d( &ctrl->sdcCtrl );
+    ElHermitianSubspaceCtrlDefault_d( &ctrl->subspaceCtrl );
     ctrl->useSDC = false;
+    ctrl->useSubspace = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianEigCtrlDefault_c( ElHermitianEigCtrl_c* ctrl )
 {
     ElHermitianTridiagCtrlDefault_c( &ctrl->tridiagCtrl );
     ElHermitianSDCCtrlDefault_s( &ctrl->sdcCtrl );
+    ElHermitianSubspaceCtrlDefault_s( &ctrl->subspaceCtrl );
     ctrl->useSDC = false;
+    ctrl->useSubspace = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianEigCtrlDefault_z( ElHermitianEigCtrl_z* ctrl )
 {
     ElHermitianTridiagCtrlDefault_z( &ctrl->tridiagCtrl );
     ElHermitianSDCCtrlDefault_d( &ctrl->sdcCtrl );
+    ElHermitianSubspaceCtrlDefault_d( &ctrl->subspaceCtrl );
     ctrl->useSDC = false;
+    ctrl->useSubspace = false;
     return EL_SUCCESS;
 }
 
@@ -124,6 +154,9 @@ ElError ElHessQRCtrlDefault( ElHessQRCtrl* ctrl )
     ctrl->distAED = false;
     ctrl->blockHeight = DefaultBlockHeight();
     ctrl->blockWidth = DefaultBlockWidth();
+    ctrl->minMultishiftSize = 75;
+    ctrl->numShifts = 0;
+    ctrl->deflationSize = 0;
     return EL_SUCCESS;
 }
 
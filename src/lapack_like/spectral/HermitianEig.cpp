@@ -9,6 +9,7 @@
 #include "El.hpp"
 
 #include "./HermitianEig/SDC.hpp"
+#include "./HermitianEig/Subspace.hpp"
 
 // The targeted number of pieces to break the eigenvectors into during the
 // redistribution from the [* ,VR] distribution after PMRRR to the [MC,MR]
@@ -124,6 +125,41 @@ bool CheckScale( UpperOrLower uplo, DistMatrix<F>& A, Base<F>& scale )
         return false;
 }
 
+// LAPACK's drivers always use a one-stage reduction, so a two-stage
+// reduction is followed by a separate tridiagonal eigensolver
+template<typename F>
+void TwoStage
+( UpperOrLower uplo, Matrix<F>& A, Matrix<Base<F>>& w, SortType sort,
+  const HermitianEigSubset<Base<F>>& subset,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("herm_eig::TwoStage"))
+    Matrix<F> t;
+    herm_tridiag::BulgeChase<F> chase;
+    HermitianTridiag( uplo, A, t, chase, ctrl.bandwidth );
+    const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+    auto d = GetRealPartOfDiagonal(A);
+    auto e = GetRealPartOfDiagonal(A,subdiagonal);
+    HermitianTridiagEig( d, e, w, sort, subset );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo, Matrix<F>& A, Matrix<Base<F>>& w, Matrix<F>& Z,
+  SortType sort, const HermitianEigSubset<Base<F>>& subset,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("herm_eig::TwoStage"))
+    Matrix<F> t;
+    herm_tridiag::BulgeChase<F> chase;
+    HermitianTridiag( uplo, A, t, chase, ctrl.bandwidth );
+    const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+    auto d = GetRealPartOfDiagonal(A);
+    auto e = GetDiagonal(A,subdiagonal);
+    HermitianTridiagEig( d, e, w, Z, sort, subset );
+    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, chase, Z );
+}
+
 } // namespace herm_eig
 
 // Compute eigenvalues
@@ -153,6 +189,11 @@ void HermitianEig
         w.Resize(0,1);
         return;
     }
+    if( ctrl.tridiagCtrl.twoStage )
+    {
+        herm_eig::TwoStage( uplo, A, w, sort, subset, ctrl.tridiagCtrl );
+        return;
+    }
 
     const Int n = A.Height();
     const char uploChar = UpperOrLowerToChar( uplo );
@@ -204,6 +245,12 @@ void HermitianEig
         w.Resize(0,1);
         return;
     }
+    if( ctrl.tridiagCtrl.twoStage )
+    {
+        herm_eig::TwoStage
+        ( uplo, A.Matrix(), w.Matrix(), sort, subset, ctrl.tridiagCtrl );
+        return;
+    }
 
     const char uploChar = UpperOrLowerToChar( uplo );
     w.Resize( n, 1 );
@@ -252,6 +299,15 @@ void HermitianEig
         w.Resize(0,1);
         return;
     }
+    if( ctrl.useSubspace && (subset.indexSubset || subset.rangeSubset) )
+    {
+        DistMatrix<F> Z(APre.Grid());
+        if( herm_eig::Subspace( uplo, APre, w, Z, subset, ctrl.subspaceCtrl ) )
+        {
+            Sort( w, sort );
+            return;
+        }
+    }
 
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); 
     auto& A = *APtr;
@@ -330,6 +386,11 @@ void HermitianEig
         Z.Resize(n,0);
         return; 
     }
+    if( ctrl.tridiagCtrl.twoStage )
+    {
+        herm_eig::TwoStage( uplo, A, w, Z, sort, subset, ctrl.tridiagCtrl );
+        return;
+    }
 
     const char uploChar = UpperOrLowerToChar( uplo );
     w.Resize( n, 1 );
@@ -392,6 +453,13 @@ void HermitianEig
         Z.Resize(n,0);
         return; 
     }
+    if( ctrl.tridiagCtrl.twoStage )
+    {
+        herm_eig::TwoStage
+        ( uplo, A.Matrix(), w.Matrix(), Z.Matrix(), sort, subset,
+          ctrl.tridiagCtrl );
+        return;
+    }
 
     const char uploChar = UpperOrLowerToChar( uplo );
     w.Resize( n, 1 );
@@ -454,6 +522,12 @@ void HermitianEig
         ZPre.Resize(n,0);
         return; 
     }
+    if( ctrl.useSubspace && (subset.indexSubset || subset.rangeSubset) &&
+        herm_eig::Subspace( uplo, APre, w, ZPre, subset, ctrl.subspaceCtrl ) )
+    {
+        herm_eig::Sort( w, ZPre, sort );
+        return;
+    }
 
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); 
     auto& A = *APtr;
@@ -475,7 +549,11 @@ void HermitianEig
     // Tridiagonalize A
     const Grid& g = A.Grid();
     DistMatrix<F,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t, ctrl.tridiagCtrl );
+    herm_tridiag::BulgeChase<F> chase;
+    if( ctrl.tridiagCtrl.twoStage )
+        HermitianTridiag( uplo, A, t, chase, ctrl.tridiagCtrl.bandwidth );
+    else
+        HermitianTridiag( uplo, A, t, ctrl.tridiagCtrl );
 
     if( ctrl.timeStages )
     {
@@ -594,7 +672,10 @@ void HermitianEig
     }
 
     // Backtransform the tridiagonal eigenvectors, Z
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, Z );
+    if( ctrl.tridiagCtrl.twoStage )
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, chase, Z );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, Z );
 
     if( ctrl.timeStages )
     {
@@ -0,0 +1,245 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANEIG_SUBSPACE_HPP
+#define EL_HERMITIANEIG_SUBSPACE_HPP
+
+namespace El {
+namespace herm_eig {
+
+// Chebyshev-filtered subspace iteration (see Zhou and Saad, "A
+// Chebyshev-Davidson algorithm for large symmetric eigenproblems") for a
+// window of eigenpairs of a distributed Hermitian matrix.
+//
+// The iteration targets the eigenpairs from the nearer end of the spectrum
+// through the end of the window, so that, aside from bracketing a range
+// subset with two LDL^H inertia computations, the cost of each iteration is
+// a handful of Hemm's against a tall-skinny basis whose width is
+// proportional to the number of wanted eigenpairs.
+
+// Count the eigenvalues of A which are at most sigma
+template<typename F>
+inline Int NumEigsUpTo
+( UpperOrLower uplo, const DistMatrix<F>& A, Base<F> sigma )
+{
+    DEBUG_ONLY(CSE cse("herm_eig::NumEigsUpTo"))
+    DistMatrix<F> B( A );
+    MakeHermitian( uplo, B );
+    ShiftDiagonal( B, F(-sigma) );
+    const InertiaType inertia = Inertia( LOWER, B );
+    return inertia.numNegative + inertia.numZero;
+}
+
+// An upper bound for the spectrum of sgn A from a few steps of Lanczos (see
+// Zhou and Li, "Bounding the spectrum of large Hermitian matrices"): the
+// largest Ritz value plus the norm of the final residual
+template<typename F>
+inline Base<F> LanczosUpperBound
+( UpperOrLower uplo, const DistMatrix<F>& A, Base<F> sgn, Int numSteps )
+{
+    DEBUG_ONLY(CSE cse("herm_eig::LanczosUpperBound"))
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int k = Min( numSteps, n );
+
+    DistMatrix<F> v(g), vOld(g), f(g);
+    Gaussian( v, n, 1 );
+    v *= F(1)/FrobeniusNorm(v);
+    Zeros( vOld, n, 1 );
+    Matrix<Real> d, e;
+    Zeros( d, k, 1 );
+    Zeros( e, Max(k-1,Int(0)), 1 );
+    Int numTaken = 0;
+    Real beta = 0;
+    while( numTaken < k )
+    {
+        Zeros( f, n, 1 );
+        Hemm( LEFT, uplo, F(sgn), A, v, F(0), f );
+        const Real alpha = RealPart(Dot(v,f));
+        Axpy( F(-alpha), v, f );
+        Axpy( F(-beta), vOld, f );
+        d.Set( numTaken, 0, alpha );
+        beta = FrobeniusNorm( f );
+        ++numTaken;
+        if( beta == Real(0) || numTaken == k )
+            break;
+        e.Set( numTaken-1, 0, beta );
+        vOld = v;
+        v = f;
+        v *= F(1)/beta;
+    }
+    auto dTaken = d( IR(0,numTaken), ALL );
+    auto eTaken = e( IR(0,numTaken-1), ALL );
+    Matrix<Real> ritzValues;
+    HermitianTridiagEig( dTaken, eTaken, ritzValues, DESCENDING );
+    return ritzValues.Get(0,0) + beta;
+}
+
+// X := p(sgn A) X, where p is the scaled Chebyshev polynomial of the given
+// degree which is damped over [a,b] and satisfies p(a0)=1
+template<typename F>
+inline void ChebyshevFilter
+( UpperOrLower uplo, const DistMatrix<F>& A, Base<F> sgn, DistMatrix<F>& X,
+  Int degree, Base<F> a, Base<F> b, Base<F> a0 )
+{
+    DEBUG_ONLY(CSE cse("herm_eig::ChebyshevFilter"))
+    typedef Base<F> Real;
+    const Real e = (b-a)/2;
+    const Real c = (b+a)/2;
+    Real sigma = e/(a0-c);
+    const Real tau = 2/sigma;
+
+    DistMatrix<F> Y( X ), YNew( A.Grid() );
+    Hemm( LEFT, uplo, F(sgn*sigma/e), A, X, F(-c*sigma/e), Y );
+    for( Int i=1; i<degree; ++i )
+    {
+        const Real sigmaNew = 1/(tau-sigma);
+        YNew = X;
+        Hemm
+        ( LEFT, uplo, F(2*sgn*sigmaNew/e), A, Y, F(-sigma*sigmaNew), YNew );
+        Axpy( F(-2*c*sigmaNew/e), Y, YNew );
+        X = Y;
+        Y = YNew;
+        sigma = sigmaNew;
+    }
+    X = Y;
+}
+
+// Replace X with the Ritz vectors of sgn A from the span of its columns,
+// set AX := sgn A X, and return the (ascending) Ritz values in theta
+template<typename F>
+inline void RayleighRitz
+( UpperOrLower uplo, const DistMatrix<F>& A, Base<F> sgn,
+  DistMatrix<F>& X, DistMatrix<F>& AX, DistMatrix<Base<F>,STAR,STAR>& theta )
+{
+    DEBUG_ONLY(CSE cse("herm_eig::RayleighRitz"))
+    const Grid& g = A.Grid();
+    qr::ExplicitUnitary( X );
+    Zeros( AX, X.Height(), X.Width() );
+    Hemm( LEFT, uplo, F(sgn), A, X, F(0), AX );
+
+    DistMatrix<F> G(g);
+    Gemm( ADJOINT, NORMAL, F(1), X, AX, G );
+    DistMatrix<F,STAR,STAR> G_STAR_STAR( G ), V_STAR_STAR(g);
+    HermitianEig( LOWER, G_STAR_STAR, theta, V_STAR_STAR, ASCENDING );
+
+    DistMatrix<F> V( V_STAR_STAR ), Y(g);
+    Gemm( NORMAL, NORMAL, F(1), X, V, Y );
+    X = Y;
+    Gemm( NORMAL, NORMAL, F(1), AX, V, Y );
+    AX = Y;
+}
+
+// False is returned, without modifying w or Z, if the basis would be wider
+// than ctrl.maxWidthRatio times the height of A, in which case the
+// tridiagonal approach should be used instead
+template<typename F>
+inline bool Subspace
+( UpperOrLower uplo, AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& w, AbstractDistMatrix<F>& Z,
+  const HermitianEigSubset<Base<F>>& subset,
+  const HermitianSubspaceCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("herm_eig::Subspace"))
+    typedef Base<F> Real;
+    auto APtr = ReadProxy<F,MC,MR>( &APre );
+    auto& A = *APtr;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+
+    // Convert the subset into an inclusive range of indices
+    Int lowerIndex, upperIndex;
+    if( subset.rangeSubset )
+    {
+        lowerIndex = NumEigsUpTo( uplo, A, subset.lowerBound );
+        upperIndex = NumEigsUpTo( uplo, A, subset.upperBound ) - 1;
+    }
+    else
+    {
+        lowerIndex = subset.lowerIndex;
+        upperIndex = subset.upperIndex;
+    }
+    if( lowerIndex > upperIndex )
+    {
+        w.Resize( 0, 1 );
+        Z.Resize( n, 0 );
+        return true;
+    }
+
+    // Iterate on -A if the window is closer to the top of the spectrum
+    const bool fromBelow = ( upperIndex+1 <= n-lowerIndex );
+    const Real sgn = ( fromBelow ? 1 : -1 );
+    const Int numLow = ( fromBelow ? upperIndex+1 : n-lowerIndex );
+    const Int numGuard =
+      ( ctrl.numGuard > 0 ? ctrl.numGuard : Max(Int(10),numLow/5) );
+    const Int p = Min( n, numLow+numGuard );
+    if( p > ctrl.maxWidthRatio*n )
+        return false;
+
+    // The one norm bounds the spectral radius of A, but a Lanczos estimate
+    // of the top of the spectrum of sgn A is typically much tighter
+    const Real normA = HermitianOneNorm( uplo, A );
+    const Int numLanczosSteps = 10;
+    const Real upperBound =
+      Min( normA, LanczosUpperBound( uplo, A, sgn, numLanczosSteps ) );
+    // The residuals of the Ritz pairs cannot be expected to fall much below
+    // the error in forming A X, which is a modest multiple of n eps ||A||
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real tol = ( ctrl.tol > Real(0) ? ctrl.tol : n*eps );
+
+    DistMatrix<F> X(g), AX(g), R(g);
+    DistMatrix<Real,STAR,STAR> theta(g);
+    DistMatrix<Real,MR,STAR> resNorms(g);
+    Gaussian( X, n, p );
+    RayleighRitz( uplo, A, sgn, X, AX, theta );
+    Int numIts = 0;
+    while( true )
+    {
+        // Check the residuals of the targeted Ritz pairs
+        R = X;
+        DiagonalScale( RIGHT, NORMAL, theta, R );
+        Axpy( F(-1), AX, R );
+        ColumnTwoNorms( R, resNorms );
+        DistMatrix<Real,STAR,STAR> resNorms_STAR_STAR( resNorms );
+        Real maxRes = 0;
+        for( Int j=0; j<numLow; ++j )
+            maxRes = Max( maxRes, resNorms_STAR_STAR.GetLocal(j,0) );
+        if( ctrl.progress && g.Rank() == 0 )
+            cout << "iteration " << numIts << ": max relative residual="
+                 << maxRes/normA << endl;
+        if( maxRes <= tol*normA || p == n )
+            break;
+        if( numIts == ctrl.maxIts )
+            RuntimeError("Subspace iteration did not converge");
+        ++numIts;
+
+        // Damp the portion of the spectrum above the largest Ritz value
+        const Real a = theta.GetLocal(p-1,0);
+        const Real a0 = theta.GetLocal(0,0);
+        if( a >= upperBound )
+            RuntimeError("Subspace iteration stagnated");
+        ChebyshevFilter( uplo, A, sgn, X, ctrl.degree, a, upperBound, a0 );
+        RayleighRitz( uplo, A, sgn, X, AX, theta );
+    }
+
+    // Extract the window (in descending order when iterating on -A)
+    const Int k = upperIndex-lowerIndex+1;
+    const Int jBeg = ( fromBelow ? lowerIndex : n-1-upperIndex );
+    w.Resize( k, 1 );
+    for( Int j=0; j<k; ++j )
+        w.Set( j, 0, sgn*theta.GetLocal(jBeg+j,0) );
+    Copy( X( ALL, IR(jBeg,jBeg+k) ), Z );
+    return true;
+}
+
+} // namespace herm_eig
+} // namespace El
+
+#endif // ifndef EL_HERMITIANEIG_SUBSPACE_HPP
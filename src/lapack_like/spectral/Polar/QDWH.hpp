@@ -22,16 +22,81 @@ namespace El {
 //
 // The careful calculation of the coefficients is due to a suggestion from
 // Gregorio Quintana Orti.
+//
+// The workspace for the iteration (the stacked [sqrt(c) A; I] matrix, the
+// Householder scalars of its QR factorization, the Cholesky factor, and a
+// second iterate) is allocated once, and the iterates alternate between two
+// buffers so that the difference between them can be formed in place. Since
+// the weight c decreases monotonically, once it falls below 100 the remaining
+// iterations use the cheaper Cholesky-based formulation.
 
 namespace polar {
 
+// Compute the weights (a,b,c) of the dynamically weighted Halley iteration
+// from the lower bound L on the smallest singular value and update L
+template<typename Real>
+inline void Weights( Real& L, Real tol, Real& a, Real& b, Real& c )
+{
+    typedef Complex<Real> Cpx;
+    const Real oneThird = Real(1)/Real(3);
+    Real L2;
+    Cpx dd, sqd;
+    if( Abs(1-L) < tol )
+    {
+        L2 = 1;
+        dd = 0;
+        sqd = 1;
+    }
+    else
+    {
+        L2 = L*L;
+        dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
+        sqd = Sqrt( Real(1)+dd );
+    }
+    const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
+    a = (sqd + Sqrt(arg)/Real(2)).real();
+    b = (a-1)*(a-1)/4;
+    c = a+b-1;
+
+    L = L*(a+b*L2)/(1+c*L2);
+}
+
+// Overwrite Q with the explicit unitary factor from its QR factorization
+// while reusing the storage for the Householder scalars (and pivots)
+template<typename F>
+inline void StackedUnitary
+( Matrix<F>& Q, Matrix<F>& t, Matrix<Base<F>>& d, Matrix<Int>& p,
+  const QRCtrl<Base<F>>& qrCtrl )
+{
+    DEBUG_ONLY(CSE cse("polar::StackedUnitary"))
+    if( qrCtrl.colPiv )
+        QR( Q, t, d, p, qrCtrl );
+    else
+        QR( Q, t, d );
+    ExpandPackedReflectors( LOWER, VERTICAL, CONJUGATED, 0, Q, t );
+    DiagonalScale( RIGHT, NORMAL, d, Q );
+}
+
+template<typename F>
+inline void StackedUnitary
+( DistMatrix<F>& Q, DistMatrix<F,MD,STAR>& t, DistMatrix<Base<F>,MD,STAR>& d,
+  DistMatrix<Int,VR,STAR>& p, const QRCtrl<Base<F>>& qrCtrl )
+{
+    DEBUG_ONLY(CSE cse("polar::StackedUnitary"))
+    if( qrCtrl.colPiv )
+        QR( Q, t, d, p, qrCtrl );
+    else
+        QR( Q, t, d );
+    ExpandPackedReflectors( LOWER, VERTICAL, CONJUGATED, 0, Q, t );
+    DiagonalScale( RIGHT, NORMAL, d, Q );
+}
+
 template<typename F>
 inline Int 
 QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const PolarCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("polar::QDWHInner"))
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Int m = A.Height();
     const Int n = A.Width();
     const Real oneThird = Real(1)/Real(3);
@@ -46,49 +111,34 @@ QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const PolarCtrl& ctrl )
     const Real cubeRootTol = Pow(tol,oneThird);
     Real L = sMinUpper / Sqrt(Real(n));
 
-    Real frobNormADiff;
-    Matrix<F> ALast, ATemp, C;
+    Matrix<F> ANew, C, t;
+    Matrix<Real> d;
+    Matrix<Int> p;
     Matrix<F> Q( m+n, n );
     Matrix<F> QT, QB;
     PartitionDown( Q, QT, QB, m );
+    Matrix<F> *X=&A, *XNew=&ANew;
     Int numIts=0;
+    Real frobNormADiff;
     while( numIts < ctrl.maxIts )
     {
-        ALast = A;
-
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
+        Real a, b, c;
+        Weights( L, tol, a, b, c );
         const Real alpha = a-b/c;
         const Real beta = b/c;
 
-        L = L*(a+b*L2)/(1+c*L2);
-
+        *XNew = *X;
         if( c > 100 )
         {
             //
             // The standard QR-based algorithm
             //
-            QT = A;
+            QT = *X;
             QT *= Sqrt(c);
             MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, qrCtrl );
-            Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            StackedUnitary( Q, t, d, p, qrCtrl );
+            Gemm
+            ( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), *XNew );
         }
         else
         {
@@ -96,21 +146,24 @@ QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const PolarCtrl& ctrl )
             // Use faster Cholesky-based algorithm since A is well-conditioned
             //
             Identity( C, n, n );
-            Herk( LOWER, ADJOINT, c, A, Real(1), C );
+            Herk( LOWER, ADJOINT, c, *X, Real(1), C );
             Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
-            A *= beta;
-            Axpy( alpha, ATemp, A );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, *XNew );
+            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, *XNew );
+            *XNew *= alpha;
+            Axpy( beta, *X, *XNew );
         }
 
+        // Form the difference of the iterates in place of the old one
         ++numIts;
-        ALast -= A;
-        frobNormADiff = FrobeniusNorm( ALast );
+        Axpy( F(-1), *XNew, *X );
+        frobNormADiff = FrobeniusNorm( *X );
+        std::swap( X, XNew );
         if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
             break;
     }
+    if( X != &A )
+        A = *X;
     return numIts;
 }
 
@@ -157,8 +210,9 @@ QDWH( Matrix<F>& A, Matrix<F>& P, const PolarCtrl& ctrl )
     DEBUG_ONLY(CSE cse("polar::QDWH"))
     Matrix<F> ACopy( A );
     const Int numIts = QDWH( A, ctrl );
-    Zeros( P, A.Height(), A.Height() );
-    Trrk( LOWER, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    // P := Q^H A
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
     MakeHermitian( LOWER, P );
     return numIts;
 }
@@ -174,7 +228,6 @@ QDWHInner
     auto& A = *APtr;
 
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Int m = A.Height();
     const Int n = A.Width();
     const Real oneThird = Real(1)/Real(3);
@@ -190,50 +243,35 @@ QDWHInner
     Real L = sMinUpper / Sqrt(Real(n));
 
     const Grid& g = A.Grid();
-    DistMatrix<F> ALast(g), ATemp(g), C(g);
+    DistMatrix<F> ANew(g), C(g);
+    DistMatrix<F,MD,STAR> t(g);
+    DistMatrix<Real,MD,STAR> d(g);
+    DistMatrix<Int,VR,STAR> p(g);
     DistMatrix<F> Q( m+n, n, g );
     DistMatrix<F> QT(g), QB(g);
     PartitionDown( Q, QT, QB, m );
-
+    DistMatrix<F> *X=&A, *XNew=&ANew;
     Int numIts=0;
     Real frobNormADiff;
     while( numIts < ctrl.maxIts )
     {
-        ALast = A;
-
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
+        Real a, b, c;
+        Weights( L, tol, a, b, c );
         const Real alpha = a-b/c;
         const Real beta = b/c;
 
-        L = L*(a+b*L2)/(1+c*L2);
-
+        *XNew = *X;
         if( c > 100 )
         {
             //
             // The standard QR-based algorithm
             //
-            QT = A;
+            QT = *X;
             QT *= Sqrt(c);
             MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, qrCtrl );
-            Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            StackedUnitary( Q, t, d, p, qrCtrl );
+            Gemm
+            ( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), *XNew );
         }
         else
         {
@@ -241,21 +279,24 @@ QDWHInner
             // Use faster Cholesky-based algorithm since A is well-conditioned
             //
             Identity( C, n, n );
-            Herk( LOWER, ADJOINT, c, A, Real(1), C );
+            Herk( LOWER, ADJOINT, c, *X, Real(1), C );
             Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
-            A *= beta;
-            Axpy( alpha, ATemp, A );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, *XNew );
+            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, *XNew );
+            *XNew *= alpha;
+            Axpy( beta, *X, *XNew );
         }
 
+        // Form the difference of the iterates in place of the old one
         ++numIts;
-        ALast -= A;
-        frobNormADiff = FrobeniusNorm( ALast );
+        Axpy( F(-1), *XNew, *X );
+        frobNormADiff = FrobeniusNorm( *X );
+        std::swap( X, XNew );
         if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
             break;
     }
+    if( X != &A )
+        A = *X;
     return numIts;
 }
 
@@ -312,8 +353,9 @@ QDWH
 
     DistMatrix<F> ACopy( A );
     const Int numIts = QDWH( A, ctrl );
-    Zeros( P, A.Height(), A.Height() );
-    Trrk( LOWER, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    // P := Q^H A
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
     MakeHermitian( LOWER, P );
     return numIts;
 }
@@ -332,7 +374,6 @@ QDWHInner
         LogicError("Height must be same as width");
 
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Int n = A.Height();
     const Real oneThird = Real(1)/Real(3);
 
@@ -344,50 +385,36 @@ QDWHInner
     const Real cubeRootTol = Pow(tol,oneThird);
     Real L = sMinUpper / Sqrt(Real(n));
 
-    Real frobNormADiff;
-    Matrix<F> ALast, ATemp, C;
+    Matrix<F> ANew, C, t;
+    Matrix<Real> d;
+    Matrix<Int> p;
     Matrix<F> Q( 2*n, n );
     Matrix<F> QT, QB;
     PartitionDown( Q, QT, QB, n );
+    Matrix<F> *X=&A, *XNew=&ANew;
     Int numIts=0;
+    Real frobNormADiff;
     while( numIts < ctrl.maxIts )
     {
-        ALast = A;
-
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
+        Real a, b, c;
+        polar::Weights( L, tol, a, b, c );
         const Real alpha = a-b/c;
         const Real beta = b/c;
 
-        L = L*(a+b*L2)/(1+c*L2);
-
+        MakeHermitian( uplo, *X );
+        *XNew = *X;
         if( c > 100 )
         {
             //
             // The standard QR-based algorithm
             //
-            MakeHermitian( uplo, A );
-            QT = A;
+            QT = *X;
             QT *= Sqrt(c);
             MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, qrCtrl );
-            Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            polar::StackedUnitary( Q, t, d, p, qrCtrl );
+            Trrk
+            ( uplo, NORMAL, ADJOINT,
+              F(alpha/Sqrt(c)), QT, QB, F(beta), *XNew );
         }
         else
         {
@@ -397,26 +424,26 @@ QDWHInner
             // TODO: Think of how to better exploit the symmetry of A,
             //       e.g., by halving the work in the first Herk through 
             //       a custom routine for forming L^2, where L is strictly lower
-            MakeHermitian( uplo, A );
             Identity( C, n, n );
-            Herk( LOWER, ADJOINT, c, A, Real(1), C );
+            Herk( LOWER, ADJOINT, c, *X, Real(1), C );
             Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
-            A *= beta;
-            Axpy( alpha, ATemp, A );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, *XNew );
+            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, *XNew );
+            *XNew *= alpha;
+            Axpy( beta, *X, *XNew );
         }
 
-        ALast -= A;
-        frobNormADiff = HermitianFrobeniusNorm( uplo, ALast );
-
+        // Form the difference of the iterates in place of the old one
         ++numIts;
+        Axpy( F(-1), *XNew, *X );
+        frobNormADiff = HermitianFrobeniusNorm( uplo, *X );
+        std::swap( X, XNew );
         if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
             break;
     }
-
-    MakeHermitian( uplo, A );
+    MakeHermitian( uplo, *X );
+    if( X != &A )
+        A = *X;
     return numIts;
 }
 
@@ -474,7 +501,6 @@ QDWHInner
     auto& A = *APtr;
 
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Grid& g = A.Grid();
     const Int n = A.Height();
     const Real oneThird = Real(1)/Real(3);
@@ -487,50 +513,37 @@ QDWHInner
     const Real cubeRootTol = Pow(tol,oneThird);
     Real L = sMinUpper / Sqrt(Real(n));
 
-    Real frobNormADiff;
-    DistMatrix<F> ALast(g), ATemp(g), C(g);
+    DistMatrix<F> ANew(g), C(g);
+    DistMatrix<F,MD,STAR> t(g);
+    DistMatrix<Real,MD,STAR> d(g);
+    DistMatrix<Int,VR,STAR> p(g);
     DistMatrix<F> Q( 2*n, n, g );
     DistMatrix<F> QT(g), QB(g);
     PartitionDown( Q, QT, QB, n );
+    DistMatrix<F> *X=&A, *XNew=&ANew;
     Int numIts=0;
+    Real frobNormADiff;
     while( numIts < ctrl.maxIts )
     {
-        ALast = A;
-
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
+        Real a, b, c;
+        polar::Weights( L, tol, a, b, c );
         const Real alpha = a-b/c;
         const Real beta = b/c;
 
-        L = L*(a+b*L2)/(1+c*L2);
-
+        MakeHermitian( uplo, *X );
+        *XNew = *X;
         if( c > 100 )
         {
             //
             // The standard QR-based algorithm
             //
-            MakeHermitian( uplo, A );
-            QT = A;
+            QT = *X;
             QT *= Sqrt(c);
             MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, qrCtrl );
-            Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            polar::StackedUnitary( Q, t, d, p, qrCtrl );
+            Trrk
+            ( uplo, NORMAL, ADJOINT,
+              F(alpha/Sqrt(c)), QT, QB, F(beta), *XNew );
         }
         else
         {
@@ -540,24 +553,26 @@ QDWHInner
             // TODO: Think of how to better exploit the symmetry of A,
             //       e.g., by halving the work in the first Herk through 
             //       a custom routine for forming L^2, where L is strictly lower
-            MakeHermitian( uplo, A );
             Identity( C, n, n );
-            Herk( LOWER, ADJOINT, c, A, Real(1), C );
+            Herk( LOWER, ADJOINT, c, *X, Real(1), C );
             Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
-            A *= beta;
-            Axpy( alpha, ATemp, A );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, *XNew );
+            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, *XNew );
+            *XNew *= alpha;
+            Axpy( beta, *X, *XNew );
         }
 
+        // Form the difference of the iterates in place of the old one
         ++numIts;
-        ALast -= A;
-        frobNormADiff = HermitianFrobeniusNorm( uplo, ALast );
+        Axpy( F(-1), *XNew, *X );
+        frobNormADiff = HermitianFrobeniusNorm( uplo, *X );
+        std::swap( X, XNew );
         if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
             break;
     }
-    MakeHermitian( uplo, A );
+    MakeHermitian( uplo, *X );
+    if( X != &A )
+        A = *X;
     return numIts;
 }
 
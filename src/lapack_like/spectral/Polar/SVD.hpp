@@ -49,6 +49,7 @@ SVD( Matrix<F>& A, Matrix<F>& P )
 
     // Form P := V Sigma V^H in P
     HermitianFromEVD( LOWER, P, s, V );
+    MakeHermitian( LOWER, P );
 }
 
 template<typename F>
@@ -94,6 +95,7 @@ SVD( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& PPre )
 
     // Form P := V Sigma V^H in P
     HermitianFromEVD( LOWER, P, s, V );
+    MakeHermitian( LOWER, P );
 }
 
 } // namespace polar
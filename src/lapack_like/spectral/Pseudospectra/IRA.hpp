@@ -28,14 +28,16 @@ ComputeNewEstimates
     const Int numShifts = activeEsts.Height();
     if( numShifts == 0 )
         return;
-    Matrix<Complex<Real>> H, HTL;
-    Matrix<Complex<Real>> w(n,1);
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
     {
-        H = HList[j];
-        HTL = H( IR(0,n), IR(0,n) );
         if( !activeConverged.Get(j,0) )
         {
+            // Each thread requires its own workspace (and HTL must be a copy
+            // since the Hessenberg eigensolver overwrites it)
+            Matrix<Complex<Real>> HTL;
+            HTL = HList[j]( IR(0,n), IR(0,n) );
+            Matrix<Complex<Real>> w(n,1);
             if( !HasNan(HTL) )
             {
                 lapack::HessenbergEig
@@ -78,17 +80,19 @@ Restart
     if( numShifts == 0 )
         return;
     const Int basisSize = HList[0].Width();
-    Matrix<Complex<Real>> H, HTL, Q(basisSize,basisSize);
-    Matrix<Complex<Real>> w(basisSize,1), u(n,1);
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
     {
-        H = HList[j];
-        HTL = H( IR(0,basisSize), IR(0,basisSize) );
-
         if( !activeConverged.Get(j,0) )
         {
+            // Each thread requires its own workspace (and HTL must be a copy
+            // since the eigensolver overwrites it)
+            Matrix<Complex<Real>> HTL;
+            HTL = HList[j]( IR(0,basisSize), IR(0,basisSize) );
             if( !HasNan(HTL) )
             {
+                Matrix<Complex<Real>> Q(basisSize,basisSize);
+                Matrix<Complex<Real>> w(basisSize,1), u(n,1);
                 // TODO: Switch to lapack::HessenbergEig
                 lapack::Eig
                 ( basisSize, HTL.Buffer(), HTL.LDim(), w.Buffer(), 
@@ -134,17 +138,19 @@ Restart
     if( numShifts == 0 )
         return;
     const Int basisSize = HList[0].Width();
-    Matrix<Complex<Real>> H, HTL, Q(basisSize,basisSize);
-    Matrix<Complex<Real>> w(basisSize,1), u(n,1), v(n,1);
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
     {
-        H = HList[j];
-        HTL = H( IR(0,basisSize), IR(0,basisSize) );
-
         if( !activeConverged.Get(j,0) )
         {
+            // Each thread requires its own workspace (and HTL must be a copy
+            // since the eigensolver overwrites it)
+            Matrix<Complex<Real>> HTL;
+            HTL = HList[j]( IR(0,basisSize), IR(0,basisSize) );
             if( !HasNan(HTL) )
             {
+                Matrix<Complex<Real>> Q(basisSize,basisSize);
+                Matrix<Complex<Real>> w(basisSize,1), u(n,1), v(n,1);
                 // TODO: Switch to lapack::HessenbergEig
                 lapack::Eig
                 ( basisSize, HTL.Buffer(), HTL.LDim(), w.Buffer(), 
@@ -282,6 +288,17 @@ IRA
     Zeros( estimates, numShifts, 1 );
     Matrix<Real> lastActiveEsts;
     Matrix<Int> activePreimage;
+    if( psCtrl.snapCtrl.resume )
+    {
+        Restore
+        ( psCtrl.snapCtrl, mpi::COMM_SELF, numIts, numDone,
+          VList[0], pivShifts, preimage, itCounts, estimates );
+
+        // The restored estimates are the reference for the next convergence
+        // and deflation tests
+        const Int numActive = ( deflate ? numShifts-numDone : numShifts );
+        lastActiveEsts = estimates( IR(0,numActive), ALL );
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -436,6 +453,11 @@ IRA
         // Save snapshots of the estimates at the requested rate
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        // Checkpoint the full state at the requested rate
+        Checkpoint
+        ( psCtrl.snapCtrl, mpi::COMM_SELF, numIts, numDone,
+          VList[0], pivShifts, preimage, itCounts, estimates );
     } 
 
     invNorms = estimates;
@@ -505,6 +527,17 @@ IRA
     Zeros( estimates, numShifts, 1 );
     Matrix<Real> lastActiveEsts;
     Matrix<Int> activePreimage;
+    if( psCtrl.snapCtrl.resume )
+    {
+        Restore
+        ( psCtrl.snapCtrl, mpi::COMM_SELF, numIts, numDone,
+          VRealList[0], VImagList[0], pivShifts, preimage, itCounts, estimates );
+
+        // The restored estimates are the reference for the next convergence
+        // and deflation tests
+        const Int numActive = ( deflate ? numShifts-numDone : numShifts );
+        lastActiveEsts = estimates( IR(0,numActive), ALL );
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -649,6 +682,11 @@ IRA
         // Save snapshots of the estimates at the requested rate
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        // Checkpoint the full state at the requested rate
+        Checkpoint
+        ( psCtrl.snapCtrl, mpi::COMM_SELF, numIts, numDone,
+          VRealList[0], VImagList[0], pivShifts, preimage, itCounts, estimates );
     } 
 
     invNorms = estimates;
@@ -740,6 +778,17 @@ IRA
     estimates.AlignWith( shifts );
     Zeros( estimates, numShifts, 1 );
     DistMatrix<Int,VR,STAR> activePreimage(g);
+    if( psCtrl.snapCtrl.resume )
+    {
+        Restore
+        ( psCtrl.snapCtrl, g.Comm(), numIts, numDone,
+          VList[0], pivShifts, preimage, itCounts, estimates );
+
+        // The restored estimates are the reference for the next convergence
+        // and deflation tests
+        const Int numActive = ( deflate ? numShifts-numDone : numShifts );
+        lastActiveEsts = estimates( IR(0,numActive), ALL );
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -929,6 +978,11 @@ IRA
         // Save snapshots of the estimates at the requested rate
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        // Checkpoint the full state at the requested rate
+        Checkpoint
+        ( psCtrl.snapCtrl, g.Comm(), numIts, numDone,
+          VList[0], pivShifts, preimage, itCounts, estimates );
     } 
 
     invNorms = estimates;
@@ -1019,6 +1073,17 @@ IRA
     estimates.AlignWith( shifts );
     Zeros( estimates, numShifts, 1 );
     DistMatrix<Int,VR,STAR> activePreimage(g);
+    if( psCtrl.snapCtrl.resume )
+    {
+        Restore
+        ( psCtrl.snapCtrl, g.Comm(), numIts, numDone,
+          VRealList[0], VImagList[0], pivShifts, preimage, itCounts, estimates );
+
+        // The restored estimates are the reference for the next convergence
+        // and deflation tests
+        const Int numActive = ( deflate ? numShifts-numDone : numShifts );
+        lastActiveEsts = estimates( IR(0,numActive), ALL );
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -1188,6 +1253,11 @@ IRA
         // Save snapshots of the estimates at the requested rate
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        // Checkpoint the full state at the requested rate
+        Checkpoint
+        ( psCtrl.snapCtrl, g.Comm(), numIts, numDone,
+          VRealList[0], VImagList[0], pivShifts, preimage, itCounts, estimates );
     } 
 
     invNorms = estimates;
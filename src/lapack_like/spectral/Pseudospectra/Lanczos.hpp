@@ -30,12 +30,12 @@ ComputeNewEstimates
     if( numShifts == 0 )
         return;
     const BlasInt krylovSize = BlasInt(HDiagList[0].Height());
-    Matrix<Real> HDiag, HSubdiag;
-    vector<Real> w(krylovSize);
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
     {
-        HDiag = HDiagList[j]; 
-        HSubdiag = HSubdiagList[j];
+        // Each thread requires its own workspace
+        Matrix<Real> HDiag( HDiagList[j] ), HSubdiag( HSubdiagList[j] );
+        vector<Real> w(krylovSize);
         if( !HasNan(HDiag) && !HasNan(HSubdiag) )
         {
             lapack::SymmetricTridiagEig     
@@ -80,6 +80,7 @@ Deflate
         timer.Start();
     const Int numActive = activeX.Width(); 
     Int swapTo = numActive-1;
+    vector<pair<Int,Int>> colSwaps;
     for( Int swapFrom=numActive-1; swapFrom>=0; --swapFrom )
     {
         if( activeConverged.Get(swapFrom,0) )
@@ -92,12 +93,13 @@ Deflate
                 RowSwap( activePreimage, swapFrom, swapTo );
                 RowSwap( activeEsts,     swapFrom, swapTo );
                 RowSwap( activeItCounts, swapFrom, swapTo );
-                ColSwap( activeXOld,     swapFrom, swapTo );
-                ColSwap( activeX,        swapFrom, swapTo );
+                colSwaps.push_back( std::make_pair(swapFrom,swapTo) );
             }
             --swapTo;
         }
     }
+    ApplyColSwaps( colSwaps, activeXOld );
+    ApplyColSwaps( colSwaps, activeX );
     if( progress )
         cout << "Deflation took " << timer.Stop() << " seconds" << endl;
 }
@@ -279,6 +281,14 @@ Lanczos
     Matrix<Int> activePreimage;
     Matrix<Real> components;
     Matrix<Real> colNorms;
+    if( psCtrl.snapCtrl.resume )
+    {
+        Restore
+        ( psCtrl.snapCtrl, mpi::COMM_SELF, numIts, numDone,
+          X, pivShifts, preimage, itCounts, estimates );
+        lastActiveEsts =
+          estimates( IR(0,(deflate ? numShifts-numDone : numShifts)), ALL );
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -392,6 +402,11 @@ Lanczos
         psCtrl.snapCtrl.Iterate();
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        // Checkpoint the full state at the requested rate
+        Checkpoint
+        ( psCtrl.snapCtrl, mpi::COMM_SELF, numIts, numDone,
+          X, pivShifts, preimage, itCounts, estimates );
     } 
 
     invNorms = estimates;
@@ -487,6 +502,14 @@ Lanczos
     DistMatrix<Int,VR,STAR> activePreimage(g);
     Matrix<Real> components;
     DistMatrix<Real,MR,STAR> colNorms(g);
+    if( psCtrl.snapCtrl.resume )
+    {
+        Restore
+        ( psCtrl.snapCtrl, g.Comm(), numIts, numDone,
+          X, pivShifts, preimage, itCounts, estimates );
+        lastActiveEsts =
+          estimates( IR(0,(deflate ? numShifts-numDone : numShifts)), ALL );
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -638,6 +661,11 @@ Lanczos
         psCtrl.snapCtrl.Iterate();
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        // Checkpoint the full state at the requested rate
+        Checkpoint
+        ( psCtrl.snapCtrl, g.Comm(), numIts, numDone,
+          X, pivShifts, preimage, itCounts, estimates );
     } 
 
     invNorms = estimates;
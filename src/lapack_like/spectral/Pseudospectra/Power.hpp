@@ -32,6 +32,7 @@ Deflate
         timer.Start();
     const Int numActive = activeX.Width(); 
     Int swapTo = numActive-1;
+    vector<pair<Int,Int>> colSwaps;
     for( Int swapFrom=numActive-1; swapFrom>=0; --swapFrom )
     {
         if( activeConverged.Get(swapFrom,0) )
@@ -43,11 +44,12 @@ Deflate
                 RowSwap( activeEsts,     swapFrom, swapTo );
                 RowSwap( activeItCounts, swapFrom, swapTo );
                 // NOTE: We only need to move information one way
-                ColSwap( activeX,        swapFrom, swapTo );
+                colSwaps.push_back( std::make_pair(swapFrom,swapTo) );
             }
             --swapTo;
         }
     }
+    ApplyColSwaps( colSwaps, activeX );
     if( progress )
         cout << "Deflation took " << timer.Stop() << " seconds" << endl;
 }
@@ -70,6 +72,7 @@ Deflate
         timer.Start();
     const Int numActive = activeXReal.Width();
     Int swapTo = numActive-1;
+    vector<pair<Int,Int>> colSwaps;
     for( Int swapFrom=numActive-1; swapFrom>=0; --swapFrom )
     {
         if( activeConverged.Get(swapFrom,0) )
@@ -81,12 +84,13 @@ Deflate
                 RowSwap( activeEsts,     swapFrom, swapTo );
                 RowSwap( activeItCounts, swapFrom, swapTo );
                 // NOTE: We only need to move information one way
-                ColSwap( activeXReal,    swapFrom, swapTo );
-                ColSwap( activeXImag,    swapFrom, swapTo );
+                colSwaps.push_back( std::make_pair(swapFrom,swapTo) );
             }
             --swapTo;
         }
     }
+    ApplyColSwaps( colSwaps, activeXReal );
+    ApplyColSwaps( colSwaps, activeXImag );
     if( progress )
         cout << "Deflation took " << timer.Stop() << " seconds" << endl;
 }
@@ -253,6 +257,14 @@ Power
     Zeros( estimates, numShifts, 1 );
     auto lastActiveEsts = estimates;
     Matrix<Int> activePreimage;
+    if( psCtrl.snapCtrl.resume )
+    {
+        Restore
+        ( psCtrl.snapCtrl, mpi::COMM_SELF, numIts, numDone,
+          X, pivShifts, preimage, itCounts, estimates );
+        lastActiveEsts =
+          estimates( IR(0,(deflate ? numShifts-numDone : numShifts)), ALL );
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -321,6 +333,11 @@ Power
         psCtrl.snapCtrl.Iterate();
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        // Checkpoint the full state at the requested rate
+        Checkpoint
+        ( psCtrl.snapCtrl, mpi::COMM_SELF, numIts, numDone,
+          X, pivShifts, preimage, itCounts, estimates );
     } 
 
     invNorms = estimates;
@@ -400,6 +417,14 @@ Power
     Zeros( estimates, numShifts, 1 );
     auto lastActiveEsts = estimates;
     DistMatrix<Int,VR,STAR> activePreimage(g);
+    if( psCtrl.snapCtrl.resume )
+    {
+        Restore
+        ( psCtrl.snapCtrl, g.Comm(), numIts, numDone,
+          X, pivShifts, preimage, itCounts, estimates );
+        lastActiveEsts =
+          estimates( IR(0,(deflate ? numShifts-numDone : numShifts)), ALL );
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -470,6 +495,11 @@ Power
         psCtrl.snapCtrl.Iterate();
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        // Checkpoint the full state at the requested rate
+        Checkpoint
+        ( psCtrl.snapCtrl, g.Comm(), numIts, numDone,
+          X, pivShifts, preimage, itCounts, estimates );
     } 
 
     invNorms = estimates;
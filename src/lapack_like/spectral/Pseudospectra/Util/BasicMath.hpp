@@ -90,6 +90,7 @@ ColumnSubtractions
     )
     const Int numShifts = Y.Width();
     const Int m = Y.Height();
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
     {
         const F gamma = components.Get(j,0);
@@ -111,6 +112,7 @@ ColumnSubtractions
     )
     const Int numShifts = YReal.Width();
     const Int m = YReal.Height();
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
     {
         const Complex<Real> gamma = components.Get(j,0);
@@ -167,6 +169,7 @@ InnerProducts
     const Int numShifts = X.Width();
     const Int m = X.Height();
     innerProds.Resize( numShifts, 1 );
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
     {
         const Real alpha =
@@ -187,6 +190,7 @@ InnerProducts
     const Int numShifts = XReal.Width();
     const Int m = XReal.Height();
     innerProds.Resize( numShifts, 1 );
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
     {
         const Real alpha =
@@ -208,6 +212,7 @@ InnerProducts
     const Int numShifts = X.Width();
     const Int m = X.Height();
     innerProds.Resize( numShifts, 1 );
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
     {
         const F alpha =
@@ -228,6 +233,7 @@ InnerProducts
     const Int numShifts = XReal.Width();
     const Int m = XReal.Height();
     innerProds.Resize( numShifts, 1 );
+    EL_PARALLEL_FOR
     for( Int j=0; j<numShifts; ++j )
     {
         const Real alpha =
@@ -122,6 +122,31 @@ RestoreOrdering
     }
 }
 
+// Apply a sequence of column swaps. Each row is permuted independently of
+// the others, so the rows are split into blocks which are handled in parallel.
+template<typename T>
+inline void
+ApplyColSwaps( const vector<pair<Int,Int>>& swaps, Matrix<T>& X )
+{
+    DEBUG_ONLY(CSE cse("pspec::ApplyColSwaps"))
+    const Int m = X.Height();
+    const Int numSwaps = swaps.size();
+    if( m == 0 || numSwaps == 0 )
+        return;
+    const Int blockHeight = 128;
+    const Int numBlocks = (m+blockHeight-1) / blockHeight;
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int i = block*blockHeight;
+        const Int mb = Min(blockHeight,m-i);
+        for( Int k=0; k<numSwaps; ++k )
+            blas::Swap
+            ( mb, X.Buffer(i,swaps[k].first),  1, 
+                  X.Buffer(i,swaps[k].second), 1 );
+    }
+}
+
 template<typename T1,typename T2>
 inline void
 ExtractList
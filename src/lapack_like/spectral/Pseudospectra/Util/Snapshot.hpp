@@ -290,6 +290,92 @@ FinalSnapshot
     }
 }
 
+// Checkpoints of the full state of the iteration
+// ===============================================
+// Each process stores its local portion of the state (the Krylov vectors,
+// the pivoted shifts, the pivot history, the estimates, and the iteration
+// counts) so that restarts avoid any communication
+
+inline void CheckpointWrite( ofstream& file ) { }
+
+template<typename T,typename... Rest>
+inline void CheckpointWrite
+( ofstream& file, const Matrix<T>& A, const Rest&... rest )
+{
+    checkpoint::Write( file, A );
+    CheckpointWrite( file, rest... );
+}
+
+template<typename T,typename... Rest>
+inline void CheckpointWrite
+( ofstream& file, const AbstractDistMatrix<T>& A, const Rest&... rest )
+{
+    checkpoint::Write( file, A.LockedMatrix() );
+    CheckpointWrite( file, rest... );
+}
+
+inline void CheckpointRead( ifstream& file ) { }
+
+template<typename T,typename... Rest>
+inline void CheckpointRead( ifstream& file, Matrix<T>& A, Rest&... rest )
+{
+    Matrix<T> B;
+    checkpoint::Read( file, B );
+    if( B.Height() != A.Height() || B.Width() != A.Width() )
+        RuntimeError("Pseudospectral checkpoint has inconsistent sizes");
+    A = B;
+    CheckpointRead( file, rest... );
+}
+
+template<typename T,typename... Rest>
+inline void CheckpointRead
+( ifstream& file, AbstractDistMatrix<T>& A, Rest&... rest )
+{
+    Matrix<T> B;
+    checkpoint::Read( file, B );
+    if( B.Height() != A.LocalHeight() || B.Width() != A.LocalWidth() )
+        RuntimeError("Pseudospectral checkpoint has inconsistent sizes");
+    A.Matrix() = B;
+    CheckpointRead( file, rest... );
+}
+
+template<typename... Mats>
+inline void
+Checkpoint
+( SnapshotCtrl& snapCtrl, mpi::Comm comm, Int numIts, Int numDone, 
+  const Mats&... mats )
+{
+    DEBUG_ONLY(CSE cse("pspec::Checkpoint"));
+    if( snapCtrl.chkptFreq <= 0 )
+        return;
+    ++snapCtrl.chkptCount;
+    if( snapCtrl.chkptCount < snapCtrl.chkptFreq )
+        return;
+
+    ofstream file;
+    checkpoint::Open( file, snapCtrl.chkptBase, comm );
+    checkpoint::Write( file, numIts );
+    checkpoint::Write( file, numDone );
+    CheckpointWrite( file, mats... );
+    snapCtrl.chkptCount = 0;
+}
+
+// The matrices must already have the sizes (and distributions) used when the
+// checkpoint was written
+template<typename... Mats>
+inline void
+Restore
+( const SnapshotCtrl& snapCtrl, mpi::Comm comm, Int& numIts, Int& numDone,
+  Mats&... mats )
+{
+    DEBUG_ONLY(CSE cse("pspec::Restore"));
+    ifstream file;
+    checkpoint::Open( file, snapCtrl.chkptBase, comm );
+    checkpoint::Read( file, numIts );
+    checkpoint::Read( file, numDone );
+    CheckpointRead( file, mats... );
+}
+
 } // namespace pspec
 } // namespace El
 
@@ -15,6 +15,101 @@
 namespace El {
 namespace svd {
 
+// || U^H U - I ||_max
+template<typename Real>
+inline Real
+OrthogonalityError( const DistMatrix<Real,STAR,VR>& U )
+{
+    DEBUG_ONLY(CSE cse("svd::OrthogonalityError"))
+    DistMatrix<Real> X(U.Grid());
+    Identity( X, U.Width(), U.Width() );
+    Herk( LOWER, ADJOINT, Real(-1), U, Real(1), X );
+    return HermitianMaxNorm( LOWER, X );
+}
+
+// The Golub-Kahan matrix of a k x k upper bidiagonal matrix B,
+//
+//   T = P [0, B'; B, 0] P',
+//
+// where P interleaves the two halves, is tridiagonal, with a zero diagonal 
+// and the off-diagonal (d_0,e_0,d_1,e_1,...,d_{k-1}). If (sigma,[v;u]/sqrt(2))
+// is an eigenpair of [0, B'; B, 0] with sigma >= 0, then B v = sigma u, and so
+// the singular triplets of B are the upper half of the spectrum of T. These
+// are computed with (distributed) MRRR so that each process only forms the
+// singular vectors which it owns.
+//
+// False is returned if any of the computed eigenvectors fail to split into a
+// pair of vectors of equal norm, or if the resulting singular vectors are not
+// orthonormal, to within a small multiple of k times the machine precision.
+// This happens for (numerically) zero or tightly clustered singular values of
+// B, in which case the QR algorithm should be used instead.
+template<typename Real>
+inline bool
+BidiagMRRR
+( const DistMatrix<Real,STAR,STAR>& d, const DistMatrix<Real,STAR,STAR>& e,
+  DistMatrix<Real,VR,STAR>& s, 
+  DistMatrix<Real,STAR,VR>& U, DistMatrix<Real,STAR,VR>& V )
+{
+    DEBUG_ONLY(CSE cse("svd::BidiagMRRR"))
+    const Int k = d.Height();
+    const Grid& g = d.Grid();
+
+    DistMatrix<Real,STAR,STAR> dGK(g), eGK(g);
+    Zeros( dGK, 2*k, 1 );
+    Zeros( eGK, Max(2*k-1,Int(0)), 1 );
+    for( Int j=0; j<k; ++j )
+    {
+        eGK.SetLocal( 2*j, 0, d.GetLocal(j,0) );
+        if( j < k-1 )
+            eGK.SetLocal( 2*j+1, 0, e.GetLocal(j,0) );
+    }
+
+    DistMatrix<Real,STAR,VR> Z(g);
+    if( k > 0 )
+    {
+        HermitianEigSubset<Real> subset;
+        subset.indexSubset = true;
+        subset.lowerIndex = k;
+        subset.upperIndex = 2*k-1;
+        HermitianTridiagEig( dGK, eGK, s, Z, DESCENDING, subset );
+    }
+    else
+    {
+        s.Resize( 0, 1 );
+        Z.Resize( 0, 0 );
+    }
+
+    // Split each eigenvector into its (normalized) right and left halves
+    const Real tol = 10*Max(k,Int(1))*lapack::MachinePrecision<Real>();
+    U.AlignWith( Z );
+    V.AlignWith( Z );
+    U.Resize( k, k );
+    V.Resize( k, k );
+    bool split = true;
+    for( Int jLoc=0; jLoc<Z.LocalWidth(); ++jLoc )
+    {
+        const Real* z = Z.LockedBuffer(0,jLoc);
+        Real* u = U.Buffer(0,jLoc);
+        Real* v = V.Buffer(0,jLoc);
+        const Real vNorm = blas::Nrm2( k, &z[0], 2 );
+        const Real uNorm = blas::Nrm2( k, &z[1], 2 );
+        if( Abs(uNorm-vNorm) > tol*Max(uNorm,vNorm) || 
+            uNorm == Real(0) || vNorm == Real(0) )
+        {
+            split = false;
+            break;
+        }
+        for( Int i=0; i<k; ++i )
+        {
+            v[i] = z[2*i  ] / vNorm;
+            u[i] = z[2*i+1] / uNorm;
+        }
+    }
+    if( !mpi::AllReduce( int(split), mpi::MIN, g.VRComm() ) )
+        return false;
+    return OrthogonalityError( U ) <= tol && OrthogonalityError( V ) <= tol;
+}
+
 template<typename F>
 inline void
 GolubReinsch
@@ -32,7 +127,6 @@ GolubReinsch
     const Int offdiagonal = ( m>=n ? 1 : -1 );
     const char uplo = ( m>=n ? 'U' : 'L' );
 
-
     // Bidiagonalize A
     const Grid& g = A.Grid();
     DistMatrix<F,STAR,STAR> tP(g), tQ(g);
@@ -49,52 +143,51 @@ GolubReinsch
     auto e_STAR_STAR = eHat_STAR_STAR( IR(0,k-1), ALL );
     e_STAR_STAR = e_MD_STAR;
 
-    // Initialize U and VAdj to the appropriate identity matrices
-    DistMatrix<F,VC,STAR> U_VC_STAR( g );
-    U_VC_STAR.AlignWith( A );
-    Identity( U_VC_STAR, m, k );
-    DistMatrix<F,STAR,VC> VAdj_STAR_VC( g );
-    VAdj_STAR_VC.AlignWith( V );
-    Identity( VAdj_STAR_VC, k, n );
-
-    // Compute the SVD of the bidiagonal matrix and accumulate the Givens
-    // rotations into our local portion of U and VAdj
-    Matrix<F>& ULoc = U_VC_STAR.Matrix();
-    Matrix<F>& VAdjLoc = VAdj_STAR_VC.Matrix();
-    lapack::BidiagQRAlg
-    ( uplo, k, VAdjLoc.Width(), ULoc.Height(),
-      d_STAR_STAR.Buffer(), e_STAR_STAR.Buffer(), 
-      VAdjLoc.Buffer(), VAdjLoc.LDim(), 
-      ULoc.Buffer(), ULoc.LDim() );
-
-    // Make a copy of A (for the Householder vectors) and pull the necessary 
-    // portions of U and VAdj into a standard matrix dist.
-    auto B( A );
-    if( m >= n )
+    // Compute the SVD of the bidiagonal matrix, B = UHat diag(s) VHat^H. 
+    // Since the adjoint of a lower bidiagonal matrix is upper bidiagonal, the
+    // roles of the left and right singular vectors are swapped in that case.
+    DistMatrix<Real,VR,STAR> s_VR_STAR(g);
+    DistMatrix<Real,STAR,VR> UHat(g), VHat(g);
+    const bool split = 
+      ( uplo == 'U' ?
+        BidiagMRRR( d_STAR_STAR, e_STAR_STAR, s_VR_STAR, UHat, VHat ) :
+        BidiagMRRR( d_STAR_STAR, e_STAR_STAR, s_VR_STAR, VHat, UHat ) );
+    if( !split )
     {
-        DistMatrix<F> AT(g), AB(g);
-        DistMatrix<F,VC,STAR> UT_VC_STAR(g), UB_VC_STAR(g);
-        PartitionDown( A, AT, AB, n );
-        PartitionDown( U_VC_STAR, UT_VC_STAR, UB_VC_STAR, n );
-        AT = UT_VC_STAR;
-        Zero( AB );
-        Adjoint( VAdj_STAR_VC, V );
-    }
-    else
-    {
-        auto VAdjL_STAR_VC = VAdj_STAR_VC( IR(0,k), IR(0,m) );
-        DistMatrix<F> VT(g), VB(g);
-        PartitionDown( V, VT, VB, m );
-        Adjoint( VAdjL_STAR_VC, VT );
-        Zero( VB );
+        // Redundantly run the QR algorithm, with each process accumulating
+        // the Givens rotations into its portion of UHat and VHat^H
+        DistMatrix<Real,VC,STAR> UHat_VC_STAR(g);
+        DistMatrix<Real,STAR,VC> VHatAdj_STAR_VC(g);
+        Identity( UHat_VC_STAR, k, k );
+        Identity( VHatAdj_STAR_VC, k, k );
+        Matrix<Real>& ULoc = UHat_VC_STAR.Matrix();
+        Matrix<Real>& VAdjLoc = VHatAdj_STAR_VC.Matrix();
+        lapack::BidiagQRAlg
+        ( uplo, k, VAdjLoc.Width(), ULoc.Height(),
+          d_STAR_STAR.Buffer(), e_STAR_STAR.Buffer(), 
+          VAdjLoc.Buffer(), VAdjLoc.LDim(), 
+          ULoc.Buffer(), ULoc.LDim() );
+        UHat = UHat_VC_STAR;
+        Transpose( VHatAdj_STAR_VC, VHat );
+        s_VR_STAR = d_STAR_STAR;
     }
 
+    // Make a copy of A (for the Householder vectors) and embed UHat and VHat
+    // into the top-left corners of A and V
+    auto B( A );
+    Zero( A );
+    auto AT = A( IR(0,k), IR(0,k) );
+    Copy( UHat, AT );
+    Zeros( V, n, k );
+    auto VT = V( IR(0,k), ALL );
+    Copy( VHat, VT );
+
     // Backtransform U and V
     bidiag::ApplyQ( LEFT, NORMAL, B, tQ, A );
     bidiag::ApplyP( LEFT, NORMAL, B, tP, V );
 
     // Copy out the appropriate subset of the singular values
-    Copy( d_STAR_STAR, s );
+    Copy( s_VR_STAR, s );
 }
 
 #ifdef EL_HAVE_FLA_BSVD
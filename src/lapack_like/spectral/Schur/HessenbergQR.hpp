@@ -0,0 +1,579 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SCHUR_HESSENBERGQR_HPP
+#define EL_SCHUR_HESSENBERGQR_HPP
+
+namespace El {
+namespace schur {
+
+// A native small-bulge multishift QR algorithm with aggressive early
+// deflation (AED) for distributed upper-Hessenberg matrices, in the spirit
+// of Braman, Byers, and Mathias. Each iteration computes the Schur
+// decomposition of a window in the bottom-right corner of the active block,
+// deflates the eigenvalues whose spike entries are negligible, and, unless
+// enough eigenvalues were deflated, uses the remaining eigenvalues of the
+// window as the shifts of a tightly-packed chain of 3x3 bulges.
+//
+// The AED window and each portion of the bulge chain are small enough to be
+// processed redundantly by every process. The resulting transformations are
+// accumulated into a small unitary matrix, which is then applied to the
+// remainder of H (and Z) with local Gemm's.
+
+namespace hess_qr {
+
+// The number of shifts and the deflation window size suggested by LAPACK's
+// IPARMQ for an active block of the given size
+inline Int DefaultNumShifts( Int n )
+{
+    Int numShifts;
+    if( n < 30 )
+        numShifts = 2;
+    else if( n < 60 )
+        numShifts = 4;
+    else if( n < 150 )
+        numShifts = 10;
+    else if( n < 590 )
+        numShifts = Max( Int(10), n/Int(Log(double(n))/Log(2.)+0.5) );
+    else if( n < 3000 )
+        numShifts = 64;
+    else if( n < 6000 )
+        numShifts = 128;
+    else
+        numShifts = 256;
+    return Max( Int(2), numShifts-numShifts%2 );
+}
+
+inline Int DefaultDeflationSize( Int n, Int numShifts )
+{ return ( n <= 500 ? numShifts : 3*numShifts/2 ); }
+
+// Overwrite the length-n vector x with beta e_0 and return tau and v, with
+// v[0]=1, such that (I - tau v v^H) x = beta e_0
+template<typename F>
+inline F MakeReflector( F* x, Int n, F* v )
+{
+    Matrix<F> xB;
+    xB.Attach( n-1, 1, x+1, Max(n-1,Int(1)) );
+    const F tau = LeftReflector( x[0], xB );
+    v[0] = 1;
+    for( Int l=1; l<n; ++l )
+    {
+        v[l] = x[l];
+        x[l] = 0;
+    }
+    return tau;
+}
+
+// A(i0:i0+n,j0:j1) := (I - tau v v^H) A(i0:i0+n,j0:j1)
+template<typename F>
+inline void ReflectRows
+( Matrix<F>& A, Int i0, Int j0, Int j1, const F* v, Int n, F tau )
+{
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int j=j0; j<j1; ++j )
+    {
+        F* a = &ABuf[i0+j*ALDim];
+        F gamma = 0;
+        for( Int l=0; l<n; ++l )
+            gamma += Conj(v[l])*a[l];
+        gamma *= tau;
+        for( Int l=0; l<n; ++l )
+            a[l] -= gamma*v[l];
+    }
+}
+
+// A(i0:i1,j0:j0+n) := A(i0:i1,j0:j0+n) (I - tau v v^H)^H
+template<typename F>
+inline void ReflectCols
+( Matrix<F>& A, Int i0, Int i1, Int j0, const F* v, Int n, F tau )
+{
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int i=i0; i<i1; ++i )
+    {
+        F* a = &ABuf[i+j0*ALDim];
+        F gamma = 0;
+        for( Int l=0; l<n; ++l )
+            gamma += a[l*ALDim]*v[l];
+        gamma *= Conj(tau);
+        for( Int l=0; l<n; ++l )
+            a[l*ALDim] -= gamma*Conj(v[l]);
+    }
+}
+
+// Each double-shift bulge is defined by the sum and product of its shifts,
+// which are real for real matrices since the shifts are then paired with
+// their conjugates (or with another real shift)
+template<typename Real>
+inline void PairShifts
+( const vector<Complex<Real>>& shifts, vector<Real>& sums, vector<Real>& prods )
+{
+    sums.resize( 0 );
+    prods.resize( 0 );
+    vector<Real> realShifts;
+    for( const Complex<Real>& shift : shifts )
+    {
+        if( ImagPart(shift) == Real(0) )
+            realShifts.push_back( RealPart(shift) );
+        else if( ImagPart(shift) > Real(0) )
+        {
+            sums.push_back( 2*RealPart(shift) );
+            prods.push_back( RealPart(shift*Conj(shift)) );
+        }
+    }
+    const Int numReal = realShifts.size();
+    for( Int i=0; i<numReal; i+=2 )
+    {
+        const Real alpha = realShifts[i];
+        const Real beta = ( i+1<numReal ? realShifts[i+1] : alpha );
+        sums.push_back( alpha+beta );
+        prods.push_back( alpha*beta );
+    }
+}
+
+template<typename Real>
+inline void PairShifts
+( const vector<Complex<Real>>& shifts,
+  vector<Complex<Real>>& sums, vector<Complex<Real>>& prods )
+{
+    sums.resize( 0 );
+    prods.resize( 0 );
+    const Int numShifts = shifts.size();
+    for( Int i=0; i<numShifts; i+=2 )
+    {
+        const Complex<Real> alpha = shifts[i];
+        const Complex<Real> beta = ( i+1<numShifts ? shifts[i+1] : alpha );
+        sums.push_back( alpha+beta );
+        prods.push_back( alpha*beta );
+    }
+}
+
+// Apply the unitary matrix U, which was accumulated while processing the
+// diagonal window [w0,w1) of H, to the portions of H outside of the window
+// (restricted to rows [rowBeg,w1) and columns [w0,colEnd)) and to Z
+template<typename F>
+inline void ApplyWindowTransform
+( const Matrix<F>& U, DistMatrix<F>& H, DistMatrix<F>& Z, bool wantZ,
+  Int w0, Int w1, Int rowBeg, Int colEnd )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::ApplyWindowTransform"))
+    const Grid& g = H.Grid();
+    const Range<Int> winInd( w0, w1 );
+    Matrix<F> X;
+    if( w1 < colEnd )
+    {
+        auto HRight = H( winInd, IR(w1,colEnd) );
+        DistMatrix<F,STAR,MR> HRight_STAR_MR(g);
+        HRight_STAR_MR.AlignWith( HRight );
+        HRight_STAR_MR = HRight;
+        X = HRight_STAR_MR.Matrix();
+        Gemm( ADJOINT, NORMAL, F(1), U, X, F(0), HRight_STAR_MR.Matrix() );
+        HRight = HRight_STAR_MR;
+    }
+    if( rowBeg < w0 )
+    {
+        auto HAbove = H( IR(rowBeg,w0), winInd );
+        DistMatrix<F,MC,STAR> HAbove_MC_STAR(g);
+        HAbove_MC_STAR.AlignWith( HAbove );
+        HAbove_MC_STAR = HAbove;
+        X = HAbove_MC_STAR.Matrix();
+        Gemm( NORMAL, NORMAL, F(1), X, U, F(0), HAbove_MC_STAR.Matrix() );
+        HAbove = HAbove_MC_STAR;
+    }
+    if( wantZ )
+    {
+        auto ZWin = Z( ALL, winInd );
+        DistMatrix<F,MC,STAR> ZWin_MC_STAR(g);
+        ZWin_MC_STAR.AlignWith( ZWin );
+        ZWin_MC_STAR = ZWin;
+        X = ZWin_MC_STAR.Matrix();
+        Gemm( NORMAL, NORMAL, F(1), X, U, F(0), ZWin_MC_STAR.Matrix() );
+        ZWin = ZWin_MC_STAR;
+    }
+}
+
+// Redundantly compute the Schur decomposition of the (small) active block
+// [ilo,ihi)
+template<typename F>
+inline void SmallBlock
+( DistMatrix<F>& H, DistMatrix<Complex<Base<F>>,STAR,STAR>& w,
+  DistMatrix<F>& Z, bool wantZ, Int ilo, Int ihi, Int rowBeg, Int colEnd )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::SmallBlock"))
+    const Range<Int> actInd( ilo, ihi );
+    auto HAct = H( actInd, actInd );
+    DistMatrix<F,STAR,STAR> T_STAR_STAR( HAct );
+    Matrix<Complex<Base<F>>> wT;
+    Matrix<F> V;
+    Schur( T_STAR_STAR.Matrix(), wT, V, true );
+    HAct = T_STAR_STAR;
+    for( Int i=0; i<ihi-ilo; ++i )
+        w.SetLocal( ilo+i, 0, wT.Get(i,0) );
+    ApplyWindowTransform( V, H, Z, wantZ, ilo, ihi, rowBeg, colEnd );
+}
+
+template<typename F>
+void Helper
+( DistMatrix<F>& H, DistMatrix<Complex<Base<F>>,STAR,STAR>& w,
+  DistMatrix<F>& Z, bool wantZ, bool fullTriangle, const HessQRCtrl& ctrl );
+
+// Perform aggressive early deflation upon the window [ihi-winSize,ihi) and
+// return the number of deflated eigenvalues. The undeflated eigenvalues of
+// the window are returned in 'shifts'.
+template<typename F>
+inline Int AED
+( DistMatrix<F>& H, DistMatrix<Complex<Base<F>>,STAR,STAR>& w,
+  DistMatrix<F>& Z, bool wantZ, Int ilo, Int ihi, Int winSize,
+  Int rowBeg, Int colEnd, const HessQRCtrl& ctrl,
+  vector<Complex<Base<F>>>& shifts )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::AED"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Grid& g = H.Grid();
+    const Int nw = winSize;
+    const Int kwtop = ihi - nw;
+    const Real ulp = lapack::MachinePrecision<Real>();
+    const Real smallNum = lapack::MachineSafeMin<Real>()*(Real(nw)/ulp);
+
+    // Gather the window along with the spike to its left
+    const Int c0 = ( kwtop > ilo ? kwtop-1 : kwtop );
+    const Int off = kwtop - c0;
+    const Range<Int> winInd( kwtop, ihi );
+    auto HWin = H( winInd, IR(c0,ihi) );
+    DistMatrix<F,STAR,STAR> W_STAR_STAR( HWin );
+    Matrix<F>& W = W_STAR_STAR.Matrix();
+    const F spike = ( off==1 ? W.Get(0,0) : F(0) );
+
+    Matrix<F> T, V;
+    Matrix<C> wT;
+    // The window is only handled by a recursive distributed QR algorithm
+    // when it is a proper subset of the active block
+    if( ctrl.distAED && nw > ctrl.minMultishiftSize && kwtop > ilo )
+    {
+        DistMatrix<F> TDist(g), VDist(g);
+        TDist = H( winInd, winInd );
+        Identity( VDist, nw, nw );
+        DistMatrix<C,STAR,STAR> wT_STAR_STAR(g);
+        Helper( TDist, wT_STAR_STAR, VDist, true, true, ctrl );
+        DistMatrix<F,STAR,STAR> T_STAR_STAR( TDist ), V_STAR_STAR( VDist );
+        T = T_STAR_STAR.Matrix();
+        V = V_STAR_STAR.Matrix();
+        wT = wT_STAR_STAR.Matrix();
+    }
+    else
+    {
+        T = W( ALL, IR(off,END) );
+        Schur( T, wT, V, true );
+    }
+
+    // Deflate from the bottom of the window (without reordering) for as
+    // long as the corresponding entries of the spike are negligible, keeping
+    // the 2x2 blocks of real Schur forms intact
+    vector<F> s( nw );
+    for( Int i=0; i<nw; ++i )
+        s[i] = spike*Conj(V.Get(0,i));
+    Int numDeflated = 0;
+    if( spike == F(0) )
+        numDeflated = nw;
+    else
+    {
+        for( Int i=nw-1; i>=0; )
+        {
+            if( !IsComplex<F>::val && i > 0 && T.Get(i,i-1) != F(0) )
+            {
+                Real scale = Abs(T.Get(i,i)) +
+                  Sqrt(Abs(T.Get(i,i-1)))*Sqrt(Abs(T.Get(i-1,i)));
+                if( scale == Real(0) )
+                    scale = Abs(spike);
+                if( Max(Abs(s[i]),Abs(s[i-1])) > Max(smallNum,ulp*scale) )
+                    break;
+                numDeflated += 2;
+                i -= 2;
+            }
+            else
+            {
+                Real scale = Abs(T.Get(i,i));
+                if( scale == Real(0) )
+                    scale = Abs(spike);
+                if( Abs(s[i]) > Max(smallNum,ulp*scale) )
+                    break;
+                ++numDeflated;
+                --i;
+            }
+        }
+    }
+    const Int nu = nw - numDeflated;
+    for( Int i=nu; i<nw; ++i )
+        s[i] = 0;
+
+    // Return the undeflated portion of the window to Hessenberg form by
+    // reflecting its spike onto e_0 and then reducing it
+    if( nu > 1 )
+    {
+        vector<F> v( nu );
+        const F tau = MakeReflector( s.data(), nu, v.data() );
+        ReflectRows( T, 0, 0, nw, v.data(), nu, tau );
+        ReflectCols( T, 0, nu, 0, v.data(), nu, tau );
+        ReflectCols( V, 0, nw, 0, v.data(), nu, tau );
+
+        auto TTL = T( IR(0,nu), IR(0,nu) );
+        auto TTR = T( IR(0,nu), IR(nu,nw) );
+        auto VL = V( ALL, IR(0,nu) );
+        Matrix<F> t;
+        Hessenberg( UPPER, TTL, t );
+        hessenberg::ApplyQ( LEFT, UPPER, ADJOINT, TTL, t, TTR );
+        hessenberg::ApplyQ( RIGHT, UPPER, NORMAL, TTL, t, VL );
+        MakeTrapezoidal( UPPER, TTL, -1 );
+    }
+
+    // Overwrite the window (and spike) and apply V to the rest of H and Z
+    for( Int i=0; i<nw; ++i )
+    {
+        if( off == 1 )
+            W.Set( i, 0, s[i] );
+        for( Int j=0; j<nw; ++j )
+            W.Set( i, j+off, T.Get(i,j) );
+    }
+    HWin = W_STAR_STAR;
+    ApplyWindowTransform( V, H, Z, wantZ, kwtop, ihi, rowBeg, colEnd );
+
+    for( Int i=nu; i<nw; ++i )
+        w.SetLocal( kwtop+i, 0, wT.Get(i,0) );
+    shifts.resize( nu );
+    for( Int i=0; i<nu; ++i )
+        shifts[i] = wT.Get(i,0);
+    return numDeflated;
+}
+
+// Advance every bulge of the chain from time step t0 to t1 within the
+// redundantly-stored diagonal window W of H, which begins at index w0, while
+// accumulating the transformations into U. Bulge b has its reflector
+// anchored at column k = ilo-1+t-4b at time t, where k = ilo-1 denotes the
+// introduction of the bulge, and the chain is spaced so that the
+// transformations from a single time step are independent.
+template<typename F>
+inline void ChaseWindow
+( Matrix<F>& W, Matrix<F>& U, Int w0, Int ilo, Int ihi, Int t0, Int t1,
+  const vector<F>& sums, const vector<F>& prods )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::ChaseWindow"))
+    const Int nw = W.Height();
+    const Int numBulges = sums.size();
+    F x[3], v[3];
+    for( Int t=t0; t<t1; ++t )
+    {
+        for( Int b=0; b<numBulges; ++b )
+        {
+            const Int k = ilo-1 + t - 4*b;
+            if( k < ilo-1 || k > ihi-3 )
+                continue;
+            Int n;
+            if( k == ilo-1 )
+            {
+                // Form the first column of (H-s_1 I)(H-s_2 I)
+                const Int i = ilo-w0;
+                const F eta00 = W.Get(i,i),   eta01 = W.Get(i,i+1),
+                        eta10 = W.Get(i+1,i), eta11 = W.Get(i+1,i+1),
+                        eta21 = W.Get(i+2,i+1);
+                n = 3;
+                x[0] = eta00*eta00 + eta01*eta10 - sums[b]*eta00 + prods[b];
+                x[1] = eta10*(eta00+eta11-sums[b]);
+                x[2] = eta10*eta21;
+            }
+            else
+            {
+                n = Min( Int(3), ihi-1-k );
+                for( Int l=0; l<n; ++l )
+                    x[l] = W.Get(k+1+l-w0,k-w0);
+            }
+            const F tau = MakeReflector( x, n, v );
+            if( k >= ilo )
+                for( Int l=0; l<n; ++l )
+                    W.Set( k+1+l-w0, k-w0, x[l] );
+
+            const Int jBeg = ( k >= ilo ? k+1 : ilo ) - w0;
+            const Int iEnd = Min( k+n+2, ihi ) - w0;
+            ReflectRows( W, k+1-w0, jBeg, nw, v, n, tau );
+            ReflectCols( W, 0, iEnd, k+1-w0, v, n, tau );
+            ReflectCols( U, 0, nw, k+1-w0, v, n, tau );
+        }
+    }
+}
+
+// Perform a multishift QR sweep over the active block [ilo,ihi) by chasing
+// the chain of bulges through a sequence of overlapping diagonal windows
+template<typename F>
+inline void Sweep
+( DistMatrix<F>& H, DistMatrix<F>& Z, bool wantZ, Int ilo, Int ihi,
+  Int rowBeg, Int colEnd, const vector<F>& sums, const vector<F>& prods )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::Sweep"))
+    const Int numBulges = sums.size();
+    const Int winSize = 12*numBulges;
+    const Int tEnd = ihi-ilo-1 + 4*(numBulges-1);
+    Matrix<F> U;
+    for( Int t0=0; t0<tEnd; )
+    {
+        // The window begins at the column of the trailing bulge and, unless
+        // it reaches the bottom of the active block, the leading bulge can
+        // only be chased while its transformations remain within the window
+        const Int w0 = Max( ilo, ilo-1+t0-4*(numBulges-1) );
+        const Int w1 = Min( ihi, w0+winSize );
+        const Int t1 = ( w1==ihi ? tEnd : w1-3-ilo );
+
+        const Range<Int> winInd( w0, w1 );
+        auto HWin = H( winInd, winInd );
+        DistMatrix<F,STAR,STAR> W_STAR_STAR( HWin );
+        Identity( U, w1-w0, w1-w0 );
+        ChaseWindow
+        ( W_STAR_STAR.Matrix(), U, w0, ilo, ihi, t0, t1, sums, prods );
+        HWin = W_STAR_STAR;
+        ApplyWindowTransform( U, H, Z, wantZ, w0, w1, rowBeg, colEnd );
+        t0 = t1;
+    }
+}
+
+template<typename F>
+void Helper
+( DistMatrix<F>& H, DistMatrix<Complex<Base<F>>,STAR,STAR>& w,
+  DistMatrix<F>& Z, bool wantZ, bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::Helper"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Int n = H.Height();
+    const Grid& g = H.Grid();
+    const Real ulp = lapack::MachinePrecision<Real>();
+    const Real smallNum = lapack::MachineSafeMin<Real>()*(Real(n)/ulp);
+    // The bulge chase requires at least a handful of rows
+    const Int minSize = Max( ctrl.minMultishiftSize, Int(12) );
+    const Int exceptionalShiftFreq = 6;
+    const Int maxIts = 30*Max(Int(10),n);
+    w.Resize( n, 1 );
+
+    DistMatrix<F,STAR,STAR> d_STAR_STAR(g), e_STAR_STAR(g);
+    vector<C> shifts;
+    vector<F> sums, prods;
+    Int numIts=0, itsSinceDeflation=0;
+    for( Int ihi=n; ihi>0; )
+    {
+        // Search upwards for a negligible subdiagonal entry
+        auto HAct = H( IR(0,ihi), IR(0,ihi) );
+        d_STAR_STAR = GetDiagonal( HAct );
+        e_STAR_STAR = GetDiagonal( HAct, -1 );
+        Int ilo = ihi-1;
+        for( ; ilo>0; --ilo )
+        {
+            const Real eta = Abs(e_STAR_STAR.GetLocal(ilo-1,0));
+            const Real scale = Abs(d_STAR_STAR.GetLocal(ilo-1,0)) +
+                               Abs(d_STAR_STAR.GetLocal(ilo,0));
+            if( eta <= Max(smallNum,ulp*scale) )
+            {
+                H.Set( ilo, ilo-1, F(0) );
+                break;
+            }
+        }
+        const Int nh = ihi - ilo;
+        const Int rowBeg = ( fullTriangle ? 0 : ilo );
+        const Int colEnd = ( fullTriangle ? n : ihi );
+        if( nh <= minSize )
+        {
+            SmallBlock( H, w, Z, wantZ, ilo, ihi, rowBeg, colEnd );
+            ihi = ilo;
+            itsSinceDeflation = 0;
+            continue;
+        }
+        if( numIts == maxIts )
+            RuntimeError("QR algorithm did not converge");
+        ++numIts;
+        ++itsSinceDeflation;
+
+        Int numShifts =
+          ( ctrl.numShifts > 0 ? ctrl.numShifts : DefaultNumShifts(nh) );
+        numShifts = Max( Int(2), Min(numShifts,nh/6) );
+        numShifts -= numShifts % 2;
+        const Int winSize =
+          Min( nh, ctrl.deflationSize > 0 ?
+                   ctrl.deflationSize : DefaultDeflationSize(nh,numShifts) );
+
+        const Int numDeflated =
+          AED
+          ( H, w, Z, wantZ, ilo, ihi, winSize, rowBeg, colEnd, ctrl, shifts );
+        if( numDeflated > 0 )
+        {
+            ihi -= numDeflated;
+            itsSinceDeflation = 0;
+            // Skip the sweep if AED was sufficiently successful
+            if( 100*numDeflated > 14*winSize || ihi-ilo <= minSize )
+                continue;
+        }
+
+        if( itsSinceDeflation > 0 &&
+            itsSinceDeflation % exceptionalShiftFreq == 0 )
+        {
+            // Use ad-hoc shifts from the bottom of the active block in order
+            // to break any cycles
+            const Real scale =
+              Abs(H.Get(ihi-1,ihi-2)) + Abs(H.Get(ihi-2,ihi-3));
+            const F alpha = H.Get(ihi-1,ihi-1) + Real(3)/Real(4)*scale;
+            const Real beta = Sqrt(Real(7)/Real(16))*scale;
+            shifts.resize( numShifts );
+            for( Int i=0; i<numShifts; i+=2 )
+            {
+                if( IsComplex<F>::val )
+                {
+                    shifts[i] = alpha;
+                    shifts[i+1] = alpha;
+                }
+                else
+                {
+                    shifts[i] = C(RealPart(alpha),beta);
+                    shifts[i+1] = C(RealPart(alpha),-beta);
+                }
+            }
+        }
+        else if( Int(shifts.size()) > numShifts )
+            shifts.erase( shifts.begin(), shifts.end()-numShifts );
+        PairShifts( shifts, sums, prods );
+        if( sums.size() == 0 )
+            continue;
+        Sweep( H, Z, wantZ, ilo, ihi, rowBeg, colEnd, sums, prods );
+    }
+}
+
+} // namespace hess_qr
+
+template<typename F>
+inline void
+HessenbergQR
+( DistMatrix<F>& H, DistMatrix<Complex<Base<F>>,STAR,STAR>& w,
+  bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur::HessenbergQR"))
+    DistMatrix<F> Z(H.Grid());
+    hess_qr::Helper( H, w, Z, false, fullTriangle, ctrl );
+}
+
+// Z is overwritten with Z Q, where H = Q T Q^H is the Schur decomposition
+template<typename F>
+inline void
+HessenbergQR
+( DistMatrix<F>& H, DistMatrix<Complex<Base<F>>,STAR,STAR>& w,
+  DistMatrix<F>& Z, bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur::HessenbergQR"))
+    hess_qr::Helper( H, w, Z, true, fullTriangle, ctrl );
+}
+
+} // namespace schur
+} // namespace El
+
+#endif // ifndef EL_SCHUR_HESSENBERGQR_HPP
@@ -10,6 +10,8 @@
 #ifndef EL_SCHUR_QR_HPP
 #define EL_SCHUR_QR_HPP
 
+#include "./HessenbergQR.hpp"
+
 namespace El {
 namespace schur {
 
@@ -101,7 +103,14 @@ QR
     blacs::FreeHandle( bhandle );
     blacs::Exit();
 #else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
+    DistMatrix<F> AElem( A );
+    DistMatrix<F,STAR,STAR> t( A.Grid() );
+    Hessenberg( UPPER, AElem, t );
+    MakeTrapezoidal( UPPER, AElem, -1 );
+    DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( A.Grid() );
+    HessenbergQR( AElem, w_STAR_STAR, fullTriangle, ctrl );
+    A = AElem;
+    Copy( w_STAR_STAR, w );
 #endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
@@ -181,7 +190,18 @@ QR
     blacs::FreeHandle( bhandle );
     blacs::Exit();
 #else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
+    const Int n = A.Height();
+    DistMatrix<F> AElem( A ), QElem( A.Grid() );
+    DistMatrix<F,STAR,STAR> t( A.Grid() );
+    Hessenberg( UPPER, AElem, t );
+    Identity( QElem, n, n );
+    hessenberg::ApplyQ( LEFT, UPPER, NORMAL, AElem, t, QElem );
+    MakeTrapezoidal( UPPER, AElem, -1 );
+    DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( A.Grid() );
+    HessenbergQR( AElem, w_STAR_STAR, QElem, fullTriangle, ctrl );
+    A = AElem;
+    Q = QElem;
+    Copy( w_STAR_STAR, w );
 #endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
@@ -209,7 +229,6 @@ QR
     MakeTrapezoidal( UPPER, A, -1 );
 
     // Run the QR algorithm in block form
-    // TODO: Create schur::HessenbergQR
     const Int n = A.Height(); 
     const Int mb = ctrl.blockHeight;
     const Int nb = ctrl.blockWidth;
@@ -240,7 +259,12 @@ QR
     blacs::FreeHandle( bhandle );
     blacs::Exit();
 #else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
+    DistMatrix<F,STAR,STAR> t( A.Grid() );
+    Hessenberg( UPPER, A, t );
+    MakeTrapezoidal( UPPER, A, -1 );
+    DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( A.Grid() );
+    HessenbergQR( A, w_STAR_STAR, fullTriangle, ctrl );
+    Copy( w_STAR_STAR, w );
 #endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
@@ -313,7 +337,15 @@ QR
     blacs::FreeHandle( bhandle );
     blacs::Exit();
 #else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
+    const Int n = A.Height();
+    DistMatrix<F,STAR,STAR> t( A.Grid() );
+    Hessenberg( UPPER, A, t );
+    Identity( Q, n, n );
+    hessenberg::ApplyQ( LEFT, UPPER, NORMAL, A, t, Q );
+    MakeTrapezoidal( UPPER, A, -1 );
+    DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( A.Grid() );
+    HessenbergQR( A, w_STAR_STAR, Q, fullTriangle, ctrl );
+    Copy( w_STAR_STAR, w );
 #endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+namespace {
+
+// Return the minimum time over the repetitions, maximized over the grid so
+// that every process makes the same decision
+template<typename SetupFunc,typename RunFunc>
+double TuneTime( const Grid& g, Int numReps, SetupFunc setup, RunFunc run )
+{
+    double minTime = std::numeric_limits<double>::max();
+    for( Int rep=0; rep<Max(numReps,Int(1)); ++rep )
+    {
+        setup();
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        run();
+        minTime = Min( minTime, mpi::Time()-startTime );
+    }
+    return mpi::AllReduce( minTime, mpi::MAX, g.Comm() );
+}
+
+// The algorithmic blocksize is shared by all of the datatypes, so it is tuned
+// using the sum of the Cholesky, LU, and Gemm times in double-precision
+Int TuneBlocksize( const Grid& g, const TuneCtrl& ctrl, Int n, bool progress )
+{
+    DEBUG_ONLY(CSE cse("TuneBlocksize"))
+    DistMatrix<double> AOrig(g), A(g), B(g), C(g);
+    DistMatrix<Int,VC,STAR> p(g);
+    Uniform( AOrig, n, n );
+    MakeHermitian( LOWER, AOrig );
+    ShiftDiagonal( AOrig, double(2*n) );
+    Uniform( B, n, n );
+
+    Int bestBlocksize = Blocksize();
+    double bestTime = std::numeric_limits<double>::max();
+    for( const Int nb : ctrl.blocksizes )
+    {
+        double cholTime, luTime, gemmTime;
+        {
+            BlocksizeStackEntry bse( nb );
+            cholTime = TuneTime
+            ( g, ctrl.numReps,
+              [&]() { A = AOrig; }, [&]() { Cholesky( LOWER, A ); } );
+            luTime = TuneTime
+            ( g, ctrl.numReps,
+              [&]() { A = AOrig; }, [&]() { LU( A, p ); } );
+            gemmTime = TuneTime
+            ( g, ctrl.numReps,
+              [&]() { }, [&]() { Gemm( NORMAL, NORMAL, 1., AOrig, B, C ); } );
+        }
+
+        const double time = cholTime + luTime + gemmTime;
+        if( progress )
+            cout << "  n=" << n << ", blocksize " << nb
+                 << ": Cholesky=" << cholTime
+                 << ", LU=" << luTime << ", Gemm=" << gemmTime
+                 << " seconds" << endl;
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestBlocksize = nb;
+        }
+    }
+    if( progress )
+        cout << "Chose an algorithmic blocksize of " << bestBlocksize
+             << " for n=" << n << endl;
+    return bestBlocksize;
+}
+
+// Each tuned size represents the regime of sizes up to the geometric mean of
+// it and the next tuned size
+void TuneBlocksizeRegimes( const Grid& g, const TuneCtrl& ctrl, bool progress )
+{
+    DEBUG_ONLY(CSE cse("TuneBlocksizeRegimes"))
+    vector<Int> sizes( ctrl.sizes );
+    std::sort( sizes.begin(), sizes.end() );
+    vector<Int> bestBlocksizes;
+    for( const Int n : sizes )
+        bestBlocksizes.push_back( TuneBlocksize( g, ctrl, n, progress ) );
+
+    ClearBlocksizeRegimes();
+    const Int numSizes = sizes.size();
+    for( Int j=0; j<numSizes; ++j )
+    {
+        const Int maxSize =
+          ( j+1 < numSizes ? Int(Sqrt(double(sizes[j])*sizes[j+1]))
+                           : sizes[j] );
+        SetBlocksizeRegime( maxSize, bestBlocksizes[j] );
+    }
+    if( numSizes > 0 )
+        SetTunedBlocksize( bestBlocksizes.back() );
+}
+
+template<typename T>
+void TuneLocalBlocksizes
+( const Grid& g, const TuneCtrl& ctrl, bool progress, const string& typeName )
+{
+    DEBUG_ONLY(CSE cse("TuneLocalBlocksizes"))
+    const Int n = ctrl.localN;
+    DistMatrix<T> A(g), B(g), C(g), x(g), y(g);
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Uniform( x, n, 1 );
+    Uniform( y, n, 1 );
+
+    const Int origTrrk = LocalTrrkBlocksize<T>();
+    const Int origTrr2k = LocalTrr2kBlocksize<T>();
+    Int bestSymv=LocalSymvBlocksize<T>(), bestTrrk=origTrrk,
+        bestTrr2k=origTrr2k;
+    double bestSymvTime, bestTrrkTime, bestTrr2kTime;
+    bestSymvTime = bestTrrkTime = bestTrr2kTime =
+      std::numeric_limits<double>::max();
+    for( const Int bsize : ctrl.localBlocksizes )
+    {
+        SymvCtrl<T> symvCtrl;
+        symvCtrl.bsize = bsize;
+        const double symvTime = TuneTime
+        ( g, ctrl.numReps, [&]() { },
+          [&]() { Symv( LOWER, T(1), A, x, T(0), y, false, symvCtrl ); } );
+
+        SetLocalTrrkBlocksize<T>( bsize );
+        const double trrkTime = TuneTime
+        ( g, ctrl.numReps, [&]() { },
+          [&]() { Syrk( LOWER, NORMAL, T(1), A, C ); } );
+
+        SetLocalTrr2kBlocksize<T>( bsize );
+        const double trr2kTime = TuneTime
+        ( g, ctrl.numReps, [&]() { },
+          [&]() { Syr2k( LOWER, NORMAL, T(1), A, B, C ); } );
+
+        if( progress )
+            cout << "  " << typeName << " local blocksize " << bsize
+                 << ": Symv=" << symvTime << ", Syrk=" << trrkTime
+                 << ", Syr2k=" << trr2kTime << " seconds" << endl;
+        if( symvTime < bestSymvTime )
+        {
+            bestSymvTime = symvTime;
+            bestSymv = bsize;
+        }
+        if( trrkTime < bestTrrkTime )
+        {
+            bestTrrkTime = trrkTime;
+            bestTrrk = bsize;
+        }
+        if( trr2kTime < bestTrr2kTime )
+        {
+            bestTrr2kTime = trr2kTime;
+            bestTrr2k = bsize;
+        }
+    }
+    SetLocalSymvBlocksize<T>( bestSymv );
+    SetLocalTrrkBlocksize<T>( bestTrrk );
+    SetLocalTrr2kBlocksize<T>( bestTrr2k );
+    if( progress )
+        cout << "Chose " << typeName << " local blocksizes of "
+             << bestSymv << " (Symv), " << bestTrrk << " (Trrk), and "
+             << bestTrr2k << " (Trr2k)" << endl;
+}
+
+// Find the smallest ratios k/max(m,n) for which the stationary-B and
+// dot-product SUMMA variants outperform their alternatives. If a variant
+// never won, its crossover is placed just beyond the sampled range.
+template<typename T>
+void TuneGemmCrossover
+( const Grid& g, const TuneCtrl& ctrl, bool progress, const string& typeName )
+{
+    DEBUG_ONLY(CSE cse("TuneGemmCrossover"))
+    const Int s = ctrl.gemmSize;
+    double weightTowardsC = 2*ctrl.maxGemmRatio,
+           weightAwayFromDot = 2*ctrl.maxGemmRatio;
+    bool foundTowardsC=false, foundAwayFromDot=false;
+    DistMatrix<T> A(g), B(g), C(g);
+    for( Int ratio=1; ratio<=ctrl.maxGemmRatio; ratio*=2 )
+    {
+        const Int k = ratio*s;
+        Uniform( A, s, k );
+        Uniform( B, k, s );
+        Zeros( C, s, s );
+        const double timeB = TuneTime
+        ( g, ctrl.numReps, [&]() { },
+          [&]() { Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C, GEMM_SUMMA_B ); } );
+        const double timeC = TuneTime
+        ( g, ctrl.numReps, [&]() { },
+          [&]() { Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C, GEMM_SUMMA_C ); } );
+        const double timeDot = TuneTime
+        ( g, ctrl.numReps, [&]() { },
+          [&]()
+          { Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C, GEMM_SUMMA_DOT ); } );
+        if( progress )
+            cout << "  " << typeName << " Gemm with k=" << ratio << "*" << s
+                 << ": SUMMA_B=" << timeB << ", SUMMA_C=" << timeC
+                 << ", SUMMA_DOT=" << timeDot << " seconds" << endl;
+
+        if( !foundTowardsC && timeB <= timeC )
+        {
+            weightTowardsC = ratio;
+            foundTowardsC = true;
+        }
+        if( !foundAwayFromDot && timeDot <= Min(timeB,timeC) )
+        {
+            weightAwayFromDot = ratio;
+            foundAwayFromDot = true;
+        }
+    }
+    SetGemmCrossoverWeights<T>( weightTowardsC, weightAwayFromDot );
+    if( progress )
+        cout << "Chose " << typeName << " Gemm crossover weights of "
+             << weightTowardsC << " (towards C) and "
+             << weightAwayFromDot << " (away from dot)" << endl;
+}
+
+template<typename T>
+void TuneType
+( const Grid& g, const TuneCtrl& ctrl, bool progress, const string& typeName )
+{
+    TuneLocalBlocksizes<T>( g, ctrl, progress, typeName );
+    TuneGemmCrossover<T>( g, ctrl, progress, typeName );
+}
+
+} // anonymous namespace
+
+void AutoTune( const Grid& g, const TuneCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("AutoTune"))
+    const bool progress = ctrl.progress && mpi::Rank(g.Comm()) == 0;
+
+    TuneBlocksizeRegimes( g, ctrl, progress );
+    TuneType<double>( g, ctrl, progress, "double" );
+    if( ctrl.tuneComplex )
+        TuneType<Complex<double>>( g, ctrl, progress, "Complex<double>" );
+    if( ctrl.tuneSingle )
+    {
+        TuneType<float>( g, ctrl, progress, "float" );
+        if( ctrl.tuneComplex )
+            TuneType<Complex<float>>( g, ctrl, progress, "Complex<float>" );
+    }
+}
+
+} // namespace El
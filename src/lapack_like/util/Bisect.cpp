@@ -12,7 +12,7 @@
 
 #ifdef EL_HAVE_PARMETIS
 # include "parmetis.h"
-#else
+#elif defined(EL_HAVE_METIS)
 # include "metis.h"
 #endif
 
@@ -23,6 +23,22 @@ Int Bisect
   vector<Int>& perm, const BisectCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("Bisect"))
+#ifdef EL_HAVE_METIS
+    const bool native = ctrl.native;
+#else
+    const bool native = true;
+#endif
+    if( native )
+    {
+        Int leftChildSize, rightChildSize;
+        const Int sepSize =
+          MultilevelBisect( graph, perm, leftChildSize, rightChildSize, ctrl );
+        DEBUG_ONLY(EnsurePermutation( perm ))
+        BuildChildrenFromPerm
+        ( graph, perm, leftChildSize, leftChild, rightChildSize, rightChild );
+        return sepSize;
+    }
+
 #ifdef EL_HAVE_METIS
     // METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
@@ -91,7 +107,6 @@ Int Bisect
     ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
     return sizes[2];
 #else
-    LogicError("METIS interface was not available");
     return -1;
 #endif
 }
@@ -104,15 +119,37 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("Bisect"))
-#ifdef EL_HAVE_METIS
     mpi::Comm comm = graph.Comm();
     const int commSize = mpi::Size( comm );
-    const int commRank = mpi::Rank( comm );
     if( commSize == 1 )
         LogicError
         ("This routine assumes at least two processes are used, "
          "otherwise one child will be lost");
 
+    // Fall back to the native partitioner when the requested (Par)METIS
+    // routine is unavailable
+    bool native = ctrl.native;
+#ifndef EL_HAVE_METIS
+    native = true;
+#endif
+#ifndef EL_HAVE_PARMETIS
+    if( !ctrl.sequential )
+        native = true;
+#endif
+    if( native )
+    {
+        Int leftChildSize, rightChildSize;
+        const Int sepSize =
+          MultilevelBisect( graph, perm, leftChildSize, rightChildSize, ctrl );
+        DEBUG_ONLY(EnsurePermutation( perm ))
+        BuildChildFromPerm
+        ( graph, perm, leftChildSize, rightChildSize, onLeft, child );
+        return sepSize;
+    }
+
+#ifdef EL_HAVE_METIS
+    const int commRank = mpi::Rank( comm );
+
     // (Par)METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
     const Int numSources = graph.NumSources();
@@ -295,7 +332,6 @@ Int Bisect
     BuildChildFromPerm( graph, perm, sizes[0], sizes[1], onLeft, child );
     return sizes[2];
 #else
-    LogicError("METIS was not available");
     return -1;
 #endif
 }
@@ -0,0 +1,884 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// A native multilevel vertex-separator bisection which requires neither METIS
+// nor ParMETIS. The graph is repeatedly coarsened via a parallel heavy-edge
+// matching, the (small) coarsest graph is replicated so that each process can
+// compute a candidate separator via graph growing, the best candidate is
+// chosen, and the separator is then projected back through each level and
+// refined in parallel. At no point does a process store more than its own
+// portion of the graph (plus its ghost vertices) except for the coarsest one,
+// which is only replicated if it is small; if coarsening stalls above that
+// size, the initial separator is instead computed in distributed form.
+
+namespace El {
+
+namespace {
+
+// Each process owns a contiguous range of the vertices (as described by
+// 'vtxDist') and stores their adjacency lists using local indices: a target
+// in [0,numLocal) is owned by this process, while the target numLocal+g
+// refers to the g'th ghost vertex (whose global indices are sorted).
+struct LevelGraph
+{
+    mpi::Comm comm;
+    vector<Int> vtxDist;
+    Int firstLocal, numLocal;
+    vector<Int> offsets, targets, edgeWgts, vertWgts;
+    vector<Int> ghosts;
+
+    // Metadata for refreshing the ghost values
+    vector<int> sendCounts, sendOffs, recvCounts, recvOffs;
+    vector<Int> sendInds;
+
+    Int NumSources() const { return vtxDist.back(); }
+    Int NumGhosts() const { return ghosts.size(); }
+
+    int Owner( Int i ) const
+    {
+        return int(std::upper_bound(vtxDist.begin(),vtxDist.end(),i) -
+                   vtxDist.begin()) - 1;
+    }
+
+    Int Global( Int v ) const
+    { return ( v < numLocal ? firstLocal+v : ghosts[v-numLocal] ); }
+
+    // NOTE: 'i' must be either owned by this process or a ghost
+    Int Local( Int i ) const
+    {
+        if( i >= firstLocal && i < firstLocal+numLocal )
+            return i - firstLocal;
+        auto it = std::lower_bound( ghosts.begin(), ghosts.end(), i );
+        DEBUG_ONLY(
+          if( it == ghosts.end() || *it != i )
+              LogicError("Index ",i," was neither local nor a ghost");
+        )
+        return numLocal + (it-ghosts.begin());
+    }
+};
+
+// Convert the global targets of each local adjacency list into local indices
+// and set up the metadata needed for refreshing the ghost values
+void FinalizeLevel( LevelGraph& G, const vector<Int>& globalTargets )
+{
+    DEBUG_ONLY(CSE cse("FinalizeLevel"))
+    const int commSize = mpi::Size( G.comm );
+    const Int numEdges = globalTargets.size();
+    const Int lastLocal = G.firstLocal + G.numLocal;
+
+    G.ghosts.resize( 0 );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int t = globalTargets[e];
+        if( t < G.firstLocal || t >= lastLocal )
+            G.ghosts.push_back( t );
+    }
+    std::sort( G.ghosts.begin(), G.ghosts.end() );
+    G.ghosts.erase
+    ( std::unique(G.ghosts.begin(),G.ghosts.end()), G.ghosts.end() );
+
+    G.targets.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+        G.targets[e] = G.Local( globalTargets[e] );
+
+    // Since the ghosts are sorted, they are grouped by their owners
+    G.recvCounts.assign( commSize, 0 );
+    for( const Int i : G.ghosts )
+        ++G.recvCounts[G.Owner(i)];
+    G.sendCounts.resize( commSize );
+    mpi::AllToAll( G.recvCounts.data(), 1, G.sendCounts.data(), 1, G.comm );
+    Scan( G.recvCounts, G.recvOffs );
+    const int totalSend = Scan( G.sendCounts, G.sendOffs );
+    G.sendInds.resize( totalSend );
+    mpi::AllToAll
+    ( G.ghosts.data(), G.recvCounts.data(), G.recvOffs.data(),
+      G.sendInds.data(), G.sendCounts.data(), G.sendOffs.data(), G.comm );
+    for( Int& i : G.sendInds )
+        i -= G.firstLocal;
+}
+
+// Overwrite the trailing (ghost) entries of 'vals' with the values stored by
+// their owners
+void UpdateGhosts( const LevelGraph& G, vector<Int>& vals )
+{
+    DEBUG_ONLY(CSE cse("UpdateGhosts"))
+    vector<Int> sendVals( G.sendInds.size() );
+    for( size_t s=0; s<G.sendInds.size(); ++s )
+        sendVals[s] = vals[G.sendInds[s]];
+    mpi::AllToAll
+    ( sendVals.data(), G.sendCounts.data(), G.sendOffs.data(),
+      vals.data()+G.numLocal, G.recvCounts.data(), G.recvOffs.data(), G.comm );
+}
+
+// Return the values, stored by their owners, of an arbitrary set of vertices
+void Pull
+( const LevelGraph& G, const vector<Int>& vals, const vector<Int>& inds,
+  vector<Int>& pulled )
+{
+    DEBUG_ONLY(CSE cse("Pull"))
+    const int commSize = mpi::Size( G.comm );
+    const Int numPulls = inds.size();
+    vector<int> sendCounts(commSize,0);
+    for( const Int i : inds )
+        ++sendCounts[G.Owner(i)];
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Int> sendInds( totalSend );
+    auto offs = sendOffs;
+    for( const Int i : inds )
+        sendInds[offs[G.Owner(i)]++] = i;
+    vector<int> recvCounts(commSize), recvOffs;
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, G.comm );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    vector<Int> recvInds( totalRecv );
+    mpi::AllToAll
+    ( sendInds.data(), sendCounts.data(), sendOffs.data(),
+      recvInds.data(), recvCounts.data(), recvOffs.data(), G.comm );
+    for( Int& i : recvInds )
+        i = vals[i-G.firstLocal];
+    mpi::AllToAll
+    ( recvInds.data(), recvCounts.data(), recvOffs.data(),
+      sendInds.data(), sendCounts.data(), sendOffs.data(), G.comm );
+    pulled.resize( numPulls );
+    offs = sendOffs;
+    for( Int k=0; k<numPulls; ++k )
+        pulled[k] = sendInds[offs[G.Owner(inds[k])]++];
+}
+
+// A cheap, deterministic mixing function used to randomize tie-breaking
+Int Hash( Int a, Int b, Int seed )
+{
+    unsigned long long x =
+      (unsigned long long)(a)*0x9E3779B97F4A7C15ULL ^
+      (unsigned long long)(b)*0xC2B2AE3D27D4EB4FULL ^
+      (unsigned long long)(seed)*0x165667B19E3779F9ULL;
+    x ^= x >> 31;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 29;
+    return Int(x & 0x3FFFFFFF);
+}
+
+LevelGraph FromGraph( const Graph& graph )
+{
+    DEBUG_ONLY(CSE cse("FromGraph"))
+    LevelGraph G;
+    G.comm = mpi::COMM_SELF;
+    const Int numSources = graph.NumSources();
+    G.vtxDist.resize( 2 );
+    G.vtxDist[0] = 0;
+    G.vtxDist[1] = numSources;
+    G.firstLocal = 0;
+    G.numLocal = numSources;
+    G.vertWgts.assign( numSources, 1 );
+
+    const Int numEdges = graph.NumEdges();
+    G.offsets.assign( numSources+1, 0 );
+    vector<Int> globalTargets;
+    globalTargets.reserve( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int s = graph.Source(e);
+        const Int t = graph.Target(e);
+        if( s != t && t < numSources )
+        {
+            ++G.offsets[s+1];
+            globalTargets.push_back( t );
+        }
+    }
+    for( Int s=0; s<numSources; ++s )
+        G.offsets[s+1] += G.offsets[s];
+    G.edgeWgts.assign( globalTargets.size(), 1 );
+    FinalizeLevel( G, globalTargets );
+    return G;
+}
+
+LevelGraph FromDistGraph( const DistGraph& graph )
+{
+    DEBUG_ONLY(CSE cse("FromDistGraph"))
+    LevelGraph G;
+    G.comm = graph.Comm();
+    const int commSize = mpi::Size( G.comm );
+    const Int numSources = graph.NumSources();
+    const Int blocksize = graph.Blocksize();
+    G.vtxDist.resize( commSize+1 );
+    for( int q=0; q<commSize; ++q )
+        G.vtxDist[q] = q*blocksize;
+    G.vtxDist[commSize] = numSources;
+    G.firstLocal = graph.FirstLocalSource();
+    G.numLocal = graph.NumLocalSources();
+    G.vertWgts.assign( G.numLocal, 1 );
+
+    const Int numLocalEdges = graph.NumLocalEdges();
+    G.offsets.assign( G.numLocal+1, 0 );
+    vector<Int> globalTargets;
+    globalTargets.reserve( numLocalEdges );
+    for( Int e=0; e<numLocalEdges; ++e )
+    {
+        const Int s = graph.Source(e);
+        const Int t = graph.Target(e);
+        if( s != t && t < numSources )
+        {
+            ++G.offsets[s-G.firstLocal+1];
+            globalTargets.push_back( t );
+        }
+    }
+    for( Int s=0; s<G.numLocal; ++s )
+        G.offsets[s+1] += G.offsets[s];
+    G.edgeWgts.assign( globalTargets.size(), 1 );
+    FinalizeLevel( G, globalTargets );
+    return G;
+}
+
+// Coarsening
+// ==========
+
+// Heavy-edge matching via locally-dominant edges: each unmatched vertex
+// proposes to the neighbor connected by its heaviest edge (with ties broken
+// by a symmetric hash of the edge), and mutual proposals are accepted. The
+// result stores the global index of each vertex's partner (or -1).
+vector<Int> Match
+( const LevelGraph& G, const vector<Int>& vertWgts, Int maxVertWgt,
+  Int numRounds, Int seed )
+{
+    DEBUG_ONLY(CSE cse("Match"))
+    const Int numLocal = G.numLocal;
+    const Int numTotal = numLocal + G.NumGhosts();
+    vector<Int> match(numTotal,-1), proposal(numTotal,-1);
+    for( Int round=0; round<numRounds; ++round )
+    {
+        for( Int v=0; v<numLocal; ++v )
+        {
+            proposal[v] = -1;
+            if( match[v] != -1 )
+                continue;
+            const Int vGlobal = G.firstLocal + v;
+            Int bestWgt=-1, bestHash=-1;
+            for( Int e=G.offsets[v]; e<G.offsets[v+1]; ++e )
+            {
+                const Int t = G.targets[e];
+                if( match[t] != -1 || vertWgts[v]+vertWgts[t] > maxVertWgt )
+                    continue;
+                const Int tGlobal = G.Global(t);
+                const Int hash =
+                  Hash( Min(vGlobal,tGlobal), Max(vGlobal,tGlobal),
+                        seed+round );
+                if( G.edgeWgts[e] > bestWgt ||
+                    (G.edgeWgts[e] == bestWgt && hash > bestHash) )
+                {
+                    bestWgt = G.edgeWgts[e];
+                    bestHash = hash;
+                    proposal[v] = tGlobal;
+                }
+            }
+        }
+        UpdateGhosts( G, proposal );
+        for( Int v=0; v<numLocal; ++v )
+        {
+            if( proposal[v] == -1 )
+                continue;
+            const Int t = G.Local( proposal[v] );
+            if( proposal[t] == G.firstLocal+v )
+                match[v] = proposal[v];
+        }
+        UpdateGhosts( G, match );
+    }
+    return match;
+}
+
+struct WeightedEdge
+{
+    Int source, target, weight;
+};
+
+// Form the coarse graph whose vertices are the matched pairs (and unmatched
+// vertices). Each coarse vertex is owned by the owner of the member with the
+// smaller index, and 'coarseMap' stores the coarse index of each (local or
+// ghost) vertex.
+void Contract
+( const LevelGraph& G, const vector<Int>& match,
+  LevelGraph& C, vector<Int>& coarseMap )
+{
+    DEBUG_ONLY(CSE cse("Contract"))
+    const int commSize = mpi::Size( G.comm );
+    const int commRank = mpi::Rank( G.comm );
+    const Int numLocal = G.numLocal;
+
+    Int numCoarseLocal = 0;
+    for( Int v=0; v<numLocal; ++v )
+        if( match[v] == -1 || G.firstLocal+v < match[v] )
+            ++numCoarseLocal;
+    C.comm = G.comm;
+    vector<Int> coarseCounts( commSize );
+    mpi::AllGather( &numCoarseLocal, 1, coarseCounts.data(), 1, G.comm );
+    const Int numCoarse = Scan( coarseCounts, C.vtxDist );
+    C.vtxDist.push_back( numCoarse );
+    C.firstLocal = C.vtxDist[commRank];
+    C.numLocal = numCoarseLocal;
+
+    // Number the coarse vertices owned by this process and then retrieve the
+    // numbering of the (possibly remote) partners with smaller indices
+    coarseMap.assign( numLocal+G.NumGhosts(), -1 );
+    Int coarseOff = C.firstLocal;
+    for( Int v=0; v<numLocal; ++v )
+        if( match[v] == -1 || G.firstLocal+v < match[v] )
+            coarseMap[v] = coarseOff++;
+    UpdateGhosts( G, coarseMap );
+    for( Int v=0; v<numLocal; ++v )
+        if( coarseMap[v] == -1 )
+            coarseMap[v] = coarseMap[G.Local(match[v])];
+    UpdateGhosts( G, coarseMap );
+
+    // Send the vertex weights and the coarsened edges to the owners of the
+    // coarse vertices, where a target of -1 denotes a vertex weight
+    vector<int> sendCounts(commSize,0);
+    for( Int v=0; v<numLocal; ++v )
+    {
+        const int owner = C.Owner( coarseMap[v] );
+        sendCounts[owner] += 3*(1+G.offsets[v+1]-G.offsets[v]);
+    }
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Int> sendBuf( totalSend );
+    auto offs = sendOffs;
+    for( Int v=0; v<numLocal; ++v )
+    {
+        const Int vCoarse = coarseMap[v];
+        const int owner = C.Owner( vCoarse );
+        sendBuf[offs[owner]++] = vCoarse;
+        sendBuf[offs[owner]++] = -1;
+        sendBuf[offs[owner]++] = G.vertWgts[v];
+        for( Int e=G.offsets[v]; e<G.offsets[v+1]; ++e )
+        {
+            sendBuf[offs[owner]++] = vCoarse;
+            sendBuf[offs[owner]++] = coarseMap[G.targets[e]];
+            sendBuf[offs[owner]++] = G.edgeWgts[e];
+        }
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, G.comm );
+    SwapClear( sendBuf );
+
+    // Accumulate the vertex weights and merge the parallel edges
+    C.vertWgts.assign( C.numLocal, 0 );
+    vector<WeightedEdge> edges;
+    edges.reserve( recvBuf.size()/3 );
+    for( size_t k=0; k<recvBuf.size(); k+=3 )
+    {
+        const Int source = recvBuf[k]-C.firstLocal;
+        const Int target = recvBuf[k+1];
+        if( target == -1 )
+            C.vertWgts[source] += recvBuf[k+2];
+        else if( target != recvBuf[k] )
+            edges.push_back( WeightedEdge{source,target,recvBuf[k+2]} );
+    }
+    SwapClear( recvBuf );
+    std::sort
+    ( edges.begin(), edges.end(),
+      []( const WeightedEdge& a, const WeightedEdge& b )
+      { return a.source < b.source ||
+               (a.source == b.source && a.target < b.target); } );
+
+    C.offsets.assign( C.numLocal+1, 0 );
+    C.edgeWgts.resize( 0 );
+    vector<Int> globalTargets;
+    for( size_t k=0; k<edges.size(); ++k )
+    {
+        if( k > 0 && edges[k].source == edges[k-1].source &&
+                     edges[k].target == edges[k-1].target )
+        {
+            C.edgeWgts.back() += edges[k].weight;
+        }
+        else
+        {
+            ++C.offsets[edges[k].source+1];
+            globalTargets.push_back( edges[k].target );
+            C.edgeWgts.push_back( edges[k].weight );
+        }
+    }
+    for( Int v=0; v<C.numLocal; ++v )
+        C.offsets[v+1] += C.offsets[v];
+    FinalizeLevel( C, globalTargets );
+}
+
+// Separator computation and refinement
+// ====================================
+// The part of each vertex is 0 (left), 1 (right), or 2 (separator)
+
+// Greedily move separator vertices into side X = pass % 2 when the weight of
+// the neighbors in the opposite side (which must join the separator) is less
+// than that of the moved vertex. Since each pass only moves vertices into a
+// single side, simultaneous moves on different processes cannot connect the
+// two sides.
+void Refine
+( const LevelGraph& G, vector<Int>& part, Int numPasses, double imbalance )
+{
+    DEBUG_ONLY(CSE cse("Refine"))
+    const int commSize = mpi::Size( G.comm );
+    const Int numLocal = G.numLocal;
+    vector<Int> vertWgts( G.vertWgts );
+    vertWgts.resize( numLocal+G.NumGhosts() );
+    UpdateGhosts( G, vertWgts );
+
+    vector<Int> candidates;
+    vector<int> sendCounts(commSize), recvCounts(commSize);
+    vector<int> sendOffs, recvOffs;
+    Int numQuietPasses = 0;
+    for( Int pass=0; pass<numPasses && numQuietPasses<2; ++pass )
+    {
+        const Int X = pass % 2;
+        const Int Y = 1-X;
+
+        Int weights[3] = { 0, 0, 0 };
+        for( Int v=0; v<numLocal; ++v )
+            weights[part[v]] += vertWgts[v];
+        mpi::AllReduce( weights, 3, mpi::SUM, G.comm );
+        const Int totalWgt = weights[0] + weights[1] + weights[2];
+        const Int maxSide = Int(imbalance*totalWgt/2);
+        Int budget = (maxSide-weights[X]) / commSize;
+
+        // Try the separator vertices in decreasing order of their gains
+        candidates.resize( 0 );
+        for( Int v=0; v<numLocal; ++v )
+            if( part[v] == 2 )
+                candidates.push_back( v );
+        auto gain = [&]( Int v )
+        {
+            Int g = vertWgts[v];
+            for( Int e=G.offsets[v]; e<G.offsets[v+1]; ++e )
+                if( part[G.targets[e]] == Y )
+                    g -= vertWgts[G.targets[e]];
+            return g;
+        };
+        vector<Int> gains( numLocal );
+        for( const Int v : candidates )
+            gains[v] = gain( v );
+        std::sort
+        ( candidates.begin(), candidates.end(),
+          [&]( Int a, Int b ) { return gains[a] > gains[b]; } );
+
+        Int numMoves = 0;
+        vector<Int> remoteSeps;
+        for( const Int v : candidates )
+        {
+            if( gains[v] <= 0 )
+                break;
+            if( vertWgts[v] > budget || gain(v) <= 0 )
+                continue;
+            part[v] = X;
+            budget -= vertWgts[v];
+            ++numMoves;
+            for( Int e=G.offsets[v]; e<G.offsets[v+1]; ++e )
+            {
+                const Int t = G.targets[e];
+                if( part[t] == Y )
+                {
+                    part[t] = 2;
+                    if( t >= numLocal )
+                        remoteSeps.push_back( G.Global(t) );
+                }
+            }
+        }
+
+        // Inform the owners of the ghosts which joined the separator
+        sendCounts.assign( commSize, 0 );
+        for( const Int i : remoteSeps )
+            ++sendCounts[G.Owner(i)];
+        const int totalSend = Scan( sendCounts, sendOffs );
+        vector<Int> sendInds( totalSend );
+        auto offs = sendOffs;
+        for( const Int i : remoteSeps )
+            sendInds[offs[G.Owner(i)]++] = i;
+        mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, G.comm );
+        const int totalRecv = Scan( recvCounts, recvOffs );
+        vector<Int> recvInds( totalRecv );
+        mpi::AllToAll
+        ( sendInds.data(), sendCounts.data(), sendOffs.data(),
+          recvInds.data(), recvCounts.data(), recvOffs.data(), G.comm );
+        for( const Int i : recvInds )
+            part[i-G.firstLocal] = 2;
+        UpdateGhosts( G, part );
+
+        numMoves = mpi::AllReduce( numMoves, G.comm );
+        if( numMoves == 0 )
+            ++numQuietPasses;
+        else
+            numQuietPasses = 0;
+    }
+}
+
+// Grow the left side via a breadth-first search from a random vertex until it
+// contains half of the weight, then form a vertex separator from the lighter
+// of the two sets of boundary vertices and refine it. The graph must be
+// stored entirely on one process.
+void GrowSeparator
+( const LevelGraph& G, vector<Int>& part, Int numPasses, double imbalance,
+  Int seed )
+{
+    DEBUG_ONLY(CSE cse("GrowSeparator"))
+    const Int n = G.numLocal;
+    part.assign( n, 1 );
+    if( n == 0 )
+        return;
+    Int totalWgt = 0;
+    for( Int v=0; v<n; ++v )
+        totalWgt += G.vertWgts[v];
+
+    // Visit the (disconnected) components in a random order
+    vector<Int> order( n );
+    for( Int v=0; v<n; ++v )
+        order[v] = v;
+    std::sort
+    ( order.begin(), order.end(),
+      [&]( Int a, Int b ) { return Hash(a,0,seed) < Hash(b,0,seed); } );
+
+    Int leftWgt = 0;
+    vector<Int> queue;
+    queue.reserve( n );
+    for( Int k=0; k<n && 2*leftWgt<totalWgt; ++k )
+    {
+        if( part[order[k]] == 0 )
+            continue;
+        queue.resize( 0 );
+        queue.push_back( order[k] );
+        part[order[k]] = 0;
+        leftWgt += G.vertWgts[order[k]];
+        for( size_t head=0; head<queue.size() && 2*leftWgt<totalWgt; ++head )
+        {
+            const Int v = queue[head];
+            for( Int e=G.offsets[v]; e<G.offsets[v+1]; ++e )
+            {
+                const Int t = G.targets[e];
+                if( part[t] == 1 && 2*leftWgt < totalWgt )
+                {
+                    part[t] = 0;
+                    leftWgt += G.vertWgts[t];
+                    queue.push_back( t );
+                }
+            }
+        }
+    }
+
+    // Form the separator from the lighter boundary
+    Int boundaryWgts[2] = { 0, 0 };
+    vector<Int> onBoundary( n, 0 );
+    for( Int v=0; v<n; ++v )
+    {
+        for( Int e=G.offsets[v]; e<G.offsets[v+1]; ++e )
+        {
+            if( part[G.targets[e]] != part[v] )
+            {
+                onBoundary[v] = 1;
+                boundaryWgts[part[v]] += G.vertWgts[v];
+                break;
+            }
+        }
+    }
+    const Int sepSide = ( boundaryWgts[0] <= boundaryWgts[1] ? 0 : 1 );
+    for( Int v=0; v<n; ++v )
+        if( onBoundary[v] && part[v] == sepSide )
+            part[v] = 2;
+
+    Refine( G, part, numPasses, imbalance );
+}
+
+// Replicate the (small) coarsest graph on every process
+LevelGraph Replicate( const LevelGraph& G )
+{
+    DEBUG_ONLY(CSE cse("Replicate"))
+    const int commSize = mpi::Size( G.comm );
+    const Int numSources = G.NumSources();
+    LevelGraph R;
+    R.comm = mpi::COMM_SELF;
+    R.vtxDist.resize( 2 );
+    R.vtxDist[0] = 0;
+    R.vtxDist[1] = numSources;
+    R.firstLocal = 0;
+    R.numLocal = numSources;
+
+    // Gather the vertex weights and the adjacency list sizes
+    vector<int> vertCounts(commSize), vertOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        vertCounts[q] = G.vtxDist[q+1]-G.vtxDist[q];
+        vertOffs[q] = G.vtxDist[q];
+    }
+    R.vertWgts.resize( numSources );
+    mpi::AllGather
+    ( G.vertWgts.data(), G.numLocal,
+      R.vertWgts.data(), vertCounts.data(), vertOffs.data(), G.comm );
+    vector<Int> localDegrees( G.numLocal ), degrees( numSources );
+    for( Int v=0; v<G.numLocal; ++v )
+        localDegrees[v] = G.offsets[v+1]-G.offsets[v];
+    mpi::AllGather
+    ( localDegrees.data(), G.numLocal,
+      degrees.data(), vertCounts.data(), vertOffs.data(), G.comm );
+    R.offsets.resize( numSources+1 );
+    R.offsets[0] = 0;
+    for( Int v=0; v<numSources; ++v )
+        R.offsets[v+1] = R.offsets[v] + degrees[v];
+
+    // Gather the (global) targets and edge weights
+    const Int numLocalEdges = G.targets.size();
+    vector<int> edgeCounts(commSize), edgeOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        edgeCounts[q] = R.offsets[G.vtxDist[q+1]]-R.offsets[G.vtxDist[q]];
+        edgeOffs[q] = R.offsets[G.vtxDist[q]];
+    }
+    vector<Int> localTargets( numLocalEdges );
+    for( Int e=0; e<numLocalEdges; ++e )
+        localTargets[e] = G.Global( G.targets[e] );
+    const Int numEdges = R.offsets[numSources];
+    R.targets.resize( numEdges );
+    R.edgeWgts.resize( numEdges );
+    mpi::AllGather
+    ( localTargets.data(), numLocalEdges,
+      R.targets.data(), edgeCounts.data(), edgeOffs.data(), G.comm );
+    mpi::AllGather
+    ( G.edgeWgts.data(), numLocalEdges,
+      R.edgeWgts.data(), edgeCounts.data(), edgeOffs.data(), G.comm );
+
+    // There are no ghosts, so the global targets are already local indices
+    R.recvCounts.assign( 1, 0 );
+    R.recvOffs.assign( 1, 0 );
+    R.sendCounts.assign( 1, 0 );
+    R.sendOffs.assign( 1, 0 );
+    return R;
+}
+
+// Compute a separator of the coarsest graph by having each process try
+// 'numTrials' different random starts and keeping the best overall result
+void CoarsestSeparator
+( const LevelGraph& G, vector<Int>& part, Int numTrials, Int numPasses,
+  double imbalance )
+{
+    DEBUG_ONLY(CSE cse("CoarsestSeparator"))
+    const int commSize = mpi::Size( G.comm );
+    const int commRank = mpi::Rank( G.comm );
+    LevelGraph R = Replicate( G );
+    const Int n = R.numLocal;
+    Int totalWgt = 0;
+    for( Int v=0; v<n; ++v )
+        totalWgt += R.vertWgts[v];
+
+    Int bestCost = std::numeric_limits<Int>::max();
+    vector<Int> bestPart, trialPart;
+    for( Int trial=0; trial<Max(numTrials,Int(1)); ++trial )
+    {
+        GrowSeparator
+        ( R, trialPart, numPasses, imbalance, commRank*numTrials+trial );
+        Int weights[3] = { 0, 0, 0 };
+        for( Int v=0; v<n; ++v )
+            weights[trialPart[v]] += R.vertWgts[v];
+        // Heavily penalize imbalanced separators
+        Int cost = weights[2];
+        if( Max(weights[0],weights[1]) > imbalance*totalWgt/2 )
+            cost += totalWgt;
+        if( cost < bestCost )
+        {
+            bestCost = cost;
+            bestPart = trialPart;
+        }
+    }
+
+    // Choose the lowest-ranked process with the cheapest separator
+    vector<Int> costs( commSize );
+    mpi::AllGather( &bestCost, 1, costs.data(), 1, G.comm );
+    const int root =
+      int(std::min_element(costs.begin(),costs.end())-costs.begin());
+    bestPart.resize( n );
+    mpi::Broadcast( bestPart.data(), n, root, G.comm );
+
+    part.resize( G.numLocal+G.NumGhosts() );
+    for( Int v=0; v<G.numLocal; ++v )
+        part[v] = bestPart[G.firstLocal+v];
+    for( Int g=0; g<G.NumGhosts(); ++g )
+        part[G.numLocal+g] = bestPart[G.ghosts[g]];
+}
+
+// Compute a separator of a graph which is too large to replicate by
+// splitting its vertices by their global indices into two halves of equal
+// weight and taking the lighter side of the boundary as the separator
+void DistributedSeparator
+( const LevelGraph& G, vector<Int>& part, Int numPasses, double imbalance )
+{
+    DEBUG_ONLY(CSE cse("DistributedSeparator"))
+    const Int numLocal = G.numLocal;
+    Int localWgt = 0;
+    for( Int v=0; v<numLocal; ++v )
+        localWgt += G.vertWgts[v];
+    const Int totalWgt = mpi::AllReduce( localWgt, G.comm );
+    Int wgtOff = mpi::Scan( localWgt, G.comm ) - localWgt;
+
+    part.resize( numLocal+G.NumGhosts() );
+    for( Int v=0; v<numLocal; ++v )
+    {
+        part[v] = ( 2*wgtOff < totalWgt ? 0 : 1 );
+        wgtOff += G.vertWgts[v];
+    }
+    UpdateGhosts( G, part );
+
+    Int boundaryWgts[2] = { 0, 0 };
+    vector<Int> onBoundary( numLocal, 0 );
+    for( Int v=0; v<numLocal; ++v )
+    {
+        for( Int e=G.offsets[v]; e<G.offsets[v+1]; ++e )
+        {
+            if( part[G.targets[e]] != part[v] )
+            {
+                onBoundary[v] = 1;
+                boundaryWgts[part[v]] += G.vertWgts[v];
+                break;
+            }
+        }
+    }
+    mpi::AllReduce( boundaryWgts, 2, mpi::SUM, G.comm );
+    const Int sepSide = ( boundaryWgts[0] <= boundaryWgts[1] ? 0 : 1 );
+    for( Int v=0; v<numLocal; ++v )
+        if( onBoundary[v] && part[v] == sepSide )
+            part[v] = 2;
+    UpdateGhosts( G, part );
+
+    Refine( G, part, numPasses, imbalance );
+}
+
+// Return the part of each local vertex of the finest graph
+vector<Int> MultilevelSeparator( LevelGraph fine, const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("MultilevelSeparator"))
+    const Int coarseSize = 1000;
+    const Int maxReplicateSize = 20*coarseSize;
+    const Int maxLevels = 40;
+    const Int maxRelaxations = 4;
+    const Int numMatchRounds = 4;
+    const Int numPasses = 10;
+    const double imbalance = 1.1;
+    const double minReduction = 0.95;
+    const int commSize = mpi::Size( fine.comm );
+
+    Int totalWgt = fine.numLocal;
+    totalWgt = mpi::AllReduce( totalWgt, fine.comm );
+    Int maxVertWgt = Max( Int(2), Int(1.5*totalWgt/coarseSize) );
+    Int numRelaxations = 0;
+
+    // Coarsen
+    vector<LevelGraph> levels;
+    vector<vector<Int>> coarseMaps;
+    levels.push_back( std::move(fine) );
+    while( levels.back().NumSources() > coarseSize &&
+           Int(levels.size()) < maxLevels )
+    {
+        const LevelGraph& G = levels.back();
+        vector<Int> vertWgts( G.vertWgts );
+        vertWgts.resize( G.numLocal+G.NumGhosts() );
+        UpdateGhosts( G, vertWgts );
+        auto match =
+          Match( G, vertWgts, maxVertWgt, numMatchRounds, levels.size() );
+        LevelGraph C;
+        vector<Int> coarseMap;
+        Contract( G, match, C, coarseMap );
+        if( C.NumSources() > minReduction*G.NumSources() )
+        {
+            // Coarsening stalled. Unless the graph is already small enough
+            // to replicate, retry with a relaxed bound on the coarse vertex
+            // weights.
+            if( G.NumSources() <= maxReplicateSize ||
+                numRelaxations == maxRelaxations )
+                break;
+            maxVertWgt *= 2;
+            ++numRelaxations;
+            continue;
+        }
+        coarseMaps.push_back( std::move(coarseMap) );
+        levels.push_back( std::move(C) );
+    }
+
+    // Partition the coarsest graph
+    vector<Int> part;
+    if( commSize == 1 || levels.back().NumSources() <= maxReplicateSize )
+        CoarsestSeparator
+        ( levels.back(), part, ctrl.numDistSeps, numPasses, imbalance );
+    else
+        DistributedSeparator( levels.back(), part, numPasses, imbalance );
+
+    // Project and refine
+    for( Int level=levels.size()-2; level>=0; --level )
+    {
+        const LevelGraph& G = levels[level];
+        const LevelGraph& C = levels[level+1];
+        const vector<Int>& coarseMap = coarseMaps[level];
+        vector<Int> coarseInds( coarseMap.begin(),
+                                coarseMap.begin()+G.numLocal ), fineLocalPart;
+        vector<Int> coarsePart( part.begin(), part.begin()+C.numLocal );
+        Pull( C, coarsePart, coarseInds, fineLocalPart );
+        part.resize( G.numLocal+G.NumGhosts() );
+        std::copy( fineLocalPart.begin(), fineLocalPart.end(), part.begin() );
+        UpdateGhosts( G, part );
+        levels.pop_back();
+        Refine( G, part, numPasses, imbalance );
+    }
+    part.resize( levels[0].numLocal );
+    return part;
+}
+
+} // anonymous namespace
+
+Int MultilevelBisect
+( const Graph& graph, vector<Int>& perm, Int& leftSize, Int& rightSize,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("MultilevelBisect"))
+    const Int numSources = graph.NumSources();
+    auto part = MultilevelSeparator( FromGraph(graph), ctrl );
+
+    Int sizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numSources; ++s )
+        ++sizes[part[s]];
+    Int offsets[3];
+    offsets[0] = 0;
+    offsets[1] = sizes[0];
+    offsets[2] = sizes[0] + sizes[1];
+    perm.resize( numSources );
+    for( Int s=0; s<numSources; ++s )
+        perm[s] = offsets[part[s]]++;
+    leftSize = sizes[0];
+    rightSize = sizes[1];
+    return sizes[2];
+}
+
+Int MultilevelBisect
+( const DistGraph& graph, DistMap& perm, Int& leftSize, Int& rightSize,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("MultilevelBisect"))
+    mpi::Comm comm = graph.Comm();
+    const Int numLocalSources = graph.NumLocalSources();
+    auto part = MultilevelSeparator( FromDistGraph(graph), ctrl );
+
+    // Each part is ordered by the owning process and then by the local index
+    Int localSizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numLocalSources; ++s )
+        ++localSizes[part[s]];
+    Int sizes[3], offsets[3];
+    mpi::AllReduce( localSizes, sizes, 3, mpi::SUM, comm );
+    mpi::Scan( localSizes, offsets, 3, mpi::SUM, comm );
+    offsets[0] += -localSizes[0];
+    offsets[1] += sizes[0] - localSizes[1];
+    offsets[2] += sizes[0] + sizes[1] - localSizes[2];
+
+    perm.SetComm( comm );
+    perm.Resize( graph.NumSources() );
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, offsets[part[s]]++ );
+    leftSize = sizes[0];
+    rightSize = sizes[1];
+    return sizes[2];
+}
+
+} // namespace El
@@ -56,7 +56,7 @@ inline void ADMM
     const Base<F> tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    Matrix<F> E, Y;
+    Matrix<F> E, Y, V;
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -85,7 +85,10 @@ inline void ADMM
         L -= S;
         Axpy( F(1)/beta, Y, L );
         Int rank;
-        if( ctrl.usePivQR )
+        if( ctrl.useRandSVT )
+            rank = svt::Randomized
+            ( L, Real(1)/beta, V, ctrl.randOversample, ctrl.numPowerIts );
+        else if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
         else
             rank = SVT( L, Real(1)/beta );
@@ -155,7 +158,7 @@ inline void ADMM
     const Base<F> tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    DistMatrix<F> E( M.Grid() ), Y( M.Grid() );
+    DistMatrix<F> E( M.Grid() ), Y( M.Grid() ), V( M.Grid() );
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -184,7 +187,10 @@ inline void ADMM
         L -= S;
         Axpy( F(1)/beta, Y, L );
         Int rank;
-        if( ctrl.usePivQR )
+        if( ctrl.useRandSVT )
+            rank = svt::Randomized
+            ( L, Real(1)/beta, V, ctrl.randOversample, ctrl.numPowerIts );
+        else if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
         else
             rank = SVT( L, Real(1)/beta );
@@ -272,7 +278,7 @@ inline void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    Matrix<F> LLast, SLast, E;
+    Matrix<F> LLast, SLast, E, V;
     while( true )
     {
         ++numIts;
@@ -296,7 +302,10 @@ inline void ALM
             L = M;
             L -= S;
             Axpy( F(1)/beta, Y, L );
-            if( ctrl.usePivQR )
+            if( ctrl.useRandSVT )
+                rank = svt::Randomized
+                ( L, Real(1)/beta, V, ctrl.randOversample, ctrl.numPowerIts );
+            else if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
             else
                 rank = SVT( L, Real(1)/beta );
@@ -417,7 +426,8 @@ inline void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    DistMatrix<F> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() );
+    DistMatrix<F> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() ),
+                  V( M.Grid() );
     while( true )
     {
         ++numIts;
@@ -441,7 +451,10 @@ inline void ALM
             L = M;
             L -= S;
             Axpy( F(1)/beta, Y, L );
-            if( ctrl.usePivQR )
+            if( ctrl.useRandSVT )
+                rank = svt::Randomized
+                ( L, Real(1)/beta, V, ctrl.randOversample, ctrl.numPowerIts );
+            else if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
             else
                 rank = SVT( L, Real(1)/beta );
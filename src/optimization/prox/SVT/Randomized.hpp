@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SVT_RANDOMIZED_HPP
+#define EL_SVT_RANDOMIZED_HPP
+
+namespace El {
+namespace svt {
+
+// Only compute the leading portion of the SVD via a randomized range finder
+// (see Halko, Martinsson, and Tropp, "Finding structure with randomness"),
+// where the test matrix is warm-started with the right singular vectors in V
+// and padded with 'oversample' Gaussian columns. If every computed singular
+// value survives the threshold, the sketch may have missed part of the
+// retained subspace, and so the sketch is doubled in width (up to min(m,n))
+// and the process is repeated. On exit, V holds the right singular vectors
+// corresponding to the nonzero thresholded singular values.
+
+template<typename F>
+Int Randomized
+( Matrix<F>& A, Base<F> tau, Matrix<F>& V,
+  Int oversample, Int numPowerIts, bool relative )
+{
+    DEBUG_ONLY(CSE cse("svt::Randomized"))
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+    {
+        V.Resize( n, 0 );
+        return 0;
+    }
+    if( V.Height() != n )
+        V.Resize( n, 0 );
+
+    Matrix<F> Omega, Y, Z, B;
+    Matrix<Real> s;
+    Int sketchSize = Min( V.Width()+Max(oversample,Int(1)), minDim );
+    while( true )
+    {
+        // Form the test matrix from the warm start and Gaussian columns
+        const Int numWarm = Min( V.Width(), sketchSize );
+        Gaussian( Omega, n, sketchSize );
+        auto OmegaWarm = Omega( IR(0,n), IR(0,numWarm) );
+        OmegaWarm = V( IR(0,n), IR(0,numWarm) );
+
+        // Y := orth((A A^H)^q A Omega)
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Y );
+        for( Int powerIt=0; powerIt<numPowerIts; ++powerIt )
+        {
+            qr::ExplicitUnitary( Y );
+            Gemm( ADJOINT, NORMAL, F(1), A, Y, Z );
+            qr::ExplicitUnitary( Z );
+            Gemm( NORMAL, NORMAL, F(1), A, Z, Y );
+        }
+        qr::ExplicitUnitary( Y );
+
+        // Compute the SVD of B := Y^H A = U_B diag(s) V^H
+        Gemm( ADJOINT, NORMAL, F(1), Y, A, B );
+        SVD( B, s, V );
+        SoftThreshold( s, tau, relative );
+        const Int rank = ZeroNorm( s );
+        if( rank < sketchSize || sketchSize == minDim )
+        {
+            // A := (Y U_B) diag(s) V^H, keeping only the first 'rank' triplets
+            auto UB = B( IR(0,sketchSize), IR(0,rank) );
+            auto sRank = s( IR(0,rank), IR(0,1) );
+            Matrix<F> U;
+            Gemm( NORMAL, NORMAL, F(1), Y, UB, U );
+            DiagonalScale( RIGHT, NORMAL, sRank, U );
+            V.Resize( n, rank );
+            Gemm( NORMAL, ADJOINT, F(1), U, V, F(0), A );
+            return rank;
+        }
+        sketchSize = Min( 2*sketchSize, minDim );
+    }
+}
+
+template<typename F>
+Int Randomized
+( AbstractDistMatrix<F>& APre, Base<F> tau, AbstractDistMatrix<F>& VPre,
+  Int oversample, Int numPowerIts, bool relative )
+{
+    DEBUG_ONLY(CSE cse("svt::Randomized"))
+
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre );
+    auto& A = *APtr;
+    auto VPtr = ReadWriteProxy<F,MC,MR>( &VPre );
+    auto& V = *VPtr;
+
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+    {
+        V.Resize( n, 0 );
+        return 0;
+    }
+    if( V.Height() != n )
+        V.Resize( n, 0 );
+
+    DistMatrix<F> Omega(g), Y(g), Z(g), B(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    Int sketchSize = Min( V.Width()+Max(oversample,Int(1)), minDim );
+    while( true )
+    {
+        const Int numWarm = Min( V.Width(), sketchSize );
+        Gaussian( Omega, n, sketchSize );
+        auto OmegaWarm = Omega( IR(0,n), IR(0,numWarm) );
+        OmegaWarm = V( IR(0,n), IR(0,numWarm) );
+
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Y );
+        for( Int powerIt=0; powerIt<numPowerIts; ++powerIt )
+        {
+            qr::ExplicitUnitary( Y );
+            Gemm( ADJOINT, NORMAL, F(1), A, Y, Z );
+            qr::ExplicitUnitary( Z );
+            Gemm( NORMAL, NORMAL, F(1), A, Z, Y );
+        }
+        qr::ExplicitUnitary( Y );
+
+        Gemm( ADJOINT, NORMAL, F(1), Y, A, B );
+        SVD( B, s, V );
+        SoftThreshold( s, tau, relative );
+        const Int rank = ZeroNorm( s );
+        if( rank < sketchSize || sketchSize == minDim )
+        {
+            auto UB = B( IR(0,sketchSize), IR(0,rank) );
+            auto sRank = s( IR(0,rank), IR(0,1) );
+            DistMatrix<F> U(g);
+            Gemm( NORMAL, NORMAL, F(1), Y, UB, U );
+            DiagonalScale( RIGHT, NORMAL, sRank, U );
+            V.Resize( n, rank );
+            Gemm( NORMAL, ADJOINT, F(1), U, V, F(0), A );
+            return rank;
+        }
+        sketchSize = Min( 2*sketchSize, minDim );
+    }
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_RANDOMIZED_HPP
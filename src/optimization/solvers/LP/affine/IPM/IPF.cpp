@@ -776,7 +776,7 @@ void IPF
         UpdateDiagonal( J, Real(1), regTmp );
 
         if( wMaxNorm >= ruizEquilTol )
-            SymmetricRuizEquil( J, dInner, ctrl.print );
+            SymmetricRuizEquil( J, dInner, ctrl.print, true );
         else if( wMaxNorm >= diagEquilTol )
             SymmetricDiagonalEquil( J, dInner, ctrl.print );
         else
@@ -1095,7 +1095,7 @@ void IPF
         UpdateDiagonal( J, Real(1), regTmp );
 
         if( wMaxNorm >= ruizEquilTol )
-            SymmetricRuizEquil( J, dInner, ctrl.print );
+            SymmetricRuizEquil( J, dInner, ctrl.print, true );
         else if( wMaxNorm >= diagEquilTol )
             SymmetricDiagonalEquil( J, dInner, ctrl.print );
         else
@@ -933,7 +933,7 @@ void IPF
 
             UpdateDiagonal( J, Real(1), regTmp );
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
@@ -976,7 +976,7 @@ void IPF
 
             UpdateDiagonal( J, Real(1), regTmp );
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
@@ -1018,7 +1018,7 @@ void IPF
             UpdateDiagonal( J, Real(1), regTmp );
 
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
@@ -1407,7 +1407,7 @@ void IPF
 
             UpdateDiagonal( J, Real(1), regTmp );
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
@@ -1461,7 +1461,7 @@ void IPF
 
             UpdateDiagonal( J, Real(1), regTmp );
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
@@ -1510,7 +1510,7 @@ void IPF
             UpdateDiagonal( J, Real(1), regTmp );
 
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
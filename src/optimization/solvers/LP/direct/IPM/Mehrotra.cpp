@@ -1175,7 +1175,7 @@ void Mehrotra
                 {
                     if( ctrl.print )
                         Output("Running SymmetricRuizEquil");
-                    SymmetricRuizEquil( J, dInner, ctrl.print );
+                    SymmetricRuizEquil( J, dInner, ctrl.print, true );
                 }
                 else if( wMaxNorm >= diagEquilTol )
                 {
@@ -1224,7 +1224,7 @@ void Mehrotra
             {
                 if( ctrl.print )
                     Output("Running SymmetricRuizEquil");
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             }
             else if( wMaxNorm >= diagEquilTol )
             {
@@ -1737,7 +1737,7 @@ void Mehrotra
                 {
                     if( ctrl.print && commRank == 0 )
                         Output("Running SymmetricRuizEquil");
-                    SymmetricRuizEquil( J, dInner, ctrl.print );
+                    SymmetricRuizEquil( J, dInner, ctrl.print, true );
                 }
                 else if( wMaxNorm >= diagEquilTol )
                 {
@@ -1805,7 +1805,7 @@ void Mehrotra
             {
                 if( ctrl.print && commRank == 0 )
                     Output("Running SymmetricRuizEquil");
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             }
             else if( wMaxNorm >= diagEquilTol )
             {
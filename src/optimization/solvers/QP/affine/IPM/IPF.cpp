@@ -825,7 +825,7 @@ void IPF
         UpdateDiagonal( J, Real(1), regTmp );
 
         if( wMaxNorm >= ruizEquilTol )
-            SymmetricRuizEquil( J, dInner, ctrl.print );
+            SymmetricRuizEquil( J, dInner, ctrl.print, true );
         else if( wMaxNorm >= diagEquilTol )
             SymmetricDiagonalEquil( J, dInner, ctrl.print );
         else
@@ -1160,7 +1160,7 @@ void IPF
         J.multMeta = JStatic.multMeta;
 
         if( wMaxNorm >= ruizEquilTol )
-            SymmetricRuizEquil( J, dInner, ctrl.print );
+            SymmetricRuizEquil( J, dInner, ctrl.print, true );
         else if( wMaxNorm >= diagEquilTol )
             SymmetricDiagonalEquil( J, dInner, ctrl.print );
         else
@@ -958,7 +958,7 @@ void Mehrotra
             UpdateDiagonal( J, Real(1), regTmp );
 
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else 
@@ -1133,6 +1133,19 @@ void Mehrotra
     const int commRank = mpi::Rank(comm);
     Timer timer, iterTimer;
 
+    // Resume from a checkpointed (unequilibrated) iterate
+    bool primalInit=ctrl.primalInit, dualInit=ctrl.dualInit;
+    Int firstIt = 0;
+    if( ctrl.resume )
+    {
+        x.SetComm( comm );
+        y.SetComm( comm );
+        z.SetComm( comm );
+        s.SetComm( comm );
+        firstIt = LoadIPMIterate( ctrl.checkpointBase+"-iterate", x, y, z, s );
+        primalInit = dualInit = true;
+    }
+
     // Equilibrate the QP by diagonally scaling [A;G]
     auto Q = QPre;
     auto A = APre;
@@ -1161,12 +1174,12 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol, Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             DiagonalScale( LEFT, NORMAL, dCol,  x );
             DiagonalSolve( LEFT, NORMAL, dRowG, s );
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRowA, y );
             DiagonalScale( LEFT, NORMAL, dRowG, z );
@@ -1227,7 +1240,18 @@ void Mehrotra
     ldl::DistSeparator rootSep;
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
+    if( ctrl.resume )
+    {
+        ldl::LoadAnalysis
+        ( ctrl.checkpointBase+"-analysis", comm, map, rootSep, info );
+    }
+    else
+    {
+        NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
+        if( ctrl.checkpointFreq > 0 )
+            ldl::SaveAnalysis
+            ( ctrl.checkpointBase+"-analysis", map, rootSep, info );
+    }
     if( commRank == 0 && ctrl.time )
         Output("ND: ",timer.Stop()," secs");
     InvertMap( map, invMap );
@@ -1237,7 +1261,7 @@ void Mehrotra
     Initialize
     ( JStatic, regTmp, b, c, h, x, y, z, s, 
       map, invMap, rootSep, info, 
-      ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.qsdCtrl );
+      primalInit, dualInit, standardShift, ctrl.qsdCtrl );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1253,7 +1277,7 @@ void Mehrotra
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm);
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( Int numIts=firstIt; numIts<=ctrl.maxIts; ++numIts )
     {
         if( ctrl.time && commRank == 0 )
             iterTimer.Start();
@@ -1366,7 +1390,7 @@ void Mehrotra
             if( commRank == 0 && ctrl.time )
                 timer.Start();
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else 
@@ -1513,6 +1537,23 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
+
+        // Checkpoint the unequilibrated iterate
+        // =====================================
+        if( ctrl.checkpointFreq > 0 && (numIts+1) % ctrl.checkpointFreq == 0 )
+        {
+            auto xChk = x;
+            auto yChk = y;
+            auto zChk = z;
+            auto sChk = s;
+            DiagonalSolve( LEFT, NORMAL, dCol,  xChk );
+            DiagonalSolve( LEFT, NORMAL, dRowA, yChk );
+            DiagonalSolve( LEFT, NORMAL, dRowG, zChk );
+            DiagonalScale( LEFT, NORMAL, dRowG, sChk );
+            SaveIPMIterate
+            ( ctrl.checkpointBase+"-iterate", numIts+1,
+              xChk, yChk, zChk, sChk );
+        }
     }
     SetIndent( indent );
 
@@ -815,7 +815,7 @@ void IPF
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
@@ -858,7 +858,7 @@ void IPF
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
@@ -1208,7 +1208,7 @@ void IPF
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
             if( wMaxNorm >= ruizEquilTol ) 
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
@@ -1261,7 +1261,7 @@ void IPF
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
             if( wMaxNorm >= ruizEquilTol )
-                SymmetricRuizEquil( J, dInner, ctrl.print );
+                SymmetricRuizEquil( J, dInner, ctrl.print, true );
             else if( wMaxNorm >= diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
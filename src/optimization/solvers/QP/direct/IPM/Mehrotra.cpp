@@ -1007,7 +1007,7 @@ void Mehrotra
 
                 UpdateDiagonal( J, Real(1), regTmp );
                 if( wMaxNorm >= ruizEquilTol )
-                    SymmetricRuizEquil( J, dInner, ctrl.print );
+                    SymmetricRuizEquil( J, dInner, ctrl.print, true );
                 else if( wMaxNorm >= diagEquilTol )
                     SymmetricDiagonalEquil( J, dInner, ctrl.print );
                 else
@@ -1463,7 +1463,7 @@ void Mehrotra
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
                 if( wMaxNorm >= ruizEquilTol )
-                    SymmetricRuizEquil( J, dInner, ctrl.print );
+                    SymmetricRuizEquil( J, dInner, ctrl.print, true );
                 else if( wMaxNorm >= diagEquilTol )
                     SymmetricDiagonalEquil( J, dInner, ctrl.print );
                 else
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+namespace {
+
+template<typename Real>
+void SaveVec( ofstream& file, const DistMultiVec<Real>& x )
+{
+    checkpoint::Write( file, x.Height() );
+    checkpoint::Write( file, x.LockedMatrix() );
+}
+
+template<typename Real>
+void LoadVec( ifstream& file, DistMultiVec<Real>& x )
+{
+    Int height;
+    checkpoint::Read( file, height );
+    x.Resize( height, 1 );
+    Matrix<Real> xLoc;
+    checkpoint::Read( file, xLoc );
+    if( xLoc.Height() != x.LocalHeight() || xLoc.Width() != 1 )
+        RuntimeError("Iterate in checkpoint has an inconsistent size");
+    x.Matrix() = xLoc;
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void SaveIPMIterate
+( const string& basename, Int numIts,
+  const DistMultiVec<Real>& x, const DistMultiVec<Real>& y,
+  const DistMultiVec<Real>& z )
+{
+    DEBUG_ONLY(CSE cse("SaveIPMIterate"))
+    ofstream file;
+    checkpoint::Open( file, basename, x.Comm() );
+    const Int numVecs = 3;
+    checkpoint::Write( file, numIts );
+    checkpoint::Write( file, numVecs );
+    SaveVec( file, x );
+    SaveVec( file, y );
+    SaveVec( file, z );
+    checkpoint::Close( file, basename, x.Comm() );
+}
+
+template<typename Real>
+void SaveIPMIterate
+( const string& basename, Int numIts,
+  const DistMultiVec<Real>& x, const DistMultiVec<Real>& y,
+  const DistMultiVec<Real>& z, const DistMultiVec<Real>& s )
+{
+    DEBUG_ONLY(CSE cse("SaveIPMIterate"))
+    ofstream file;
+    checkpoint::Open( file, basename, x.Comm() );
+    const Int numVecs = 4;
+    checkpoint::Write( file, numIts );
+    checkpoint::Write( file, numVecs );
+    SaveVec( file, x );
+    SaveVec( file, y );
+    SaveVec( file, z );
+    SaveVec( file, s );
+    checkpoint::Close( file, basename, x.Comm() );
+}
+
+template<typename Real>
+Int LoadIPMIterate
+( const string& basename,
+  DistMultiVec<Real>& x, DistMultiVec<Real>& y, DistMultiVec<Real>& z )
+{
+    DEBUG_ONLY(CSE cse("LoadIPMIterate"))
+    ifstream file;
+    checkpoint::Open( file, basename, x.Comm() );
+    Int numIts, numVecs;
+    checkpoint::Read( file, numIts );
+    checkpoint::Read( file, numVecs );
+    if( numVecs != 3 )
+        RuntimeError("Expected 3 vectors in ",basename," but found ",numVecs);
+    LoadVec( file, x );
+    LoadVec( file, y );
+    LoadVec( file, z );
+    return numIts;
+}
+
+template<typename Real>
+Int LoadIPMIterate
+( const string& basename,
+  DistMultiVec<Real>& x, DistMultiVec<Real>& y,
+  DistMultiVec<Real>& z, DistMultiVec<Real>& s )
+{
+    DEBUG_ONLY(CSE cse("LoadIPMIterate"))
+    ifstream file;
+    checkpoint::Open( file, basename, x.Comm() );
+    Int numIts, numVecs;
+    checkpoint::Read( file, numIts );
+    checkpoint::Read( file, numVecs );
+    if( numVecs != 4 )
+        RuntimeError("Expected 4 vectors in ",basename," but found ",numVecs);
+    LoadVec( file, x );
+    LoadVec( file, y );
+    LoadVec( file, z );
+    LoadVec( file, s );
+    return numIts;
+}
+
+#define PROTO(Real) \
+  template void SaveIPMIterate \
+  ( const string& basename, Int numIts, \
+    const DistMultiVec<Real>& x, const DistMultiVec<Real>& y, \
+    const DistMultiVec<Real>& z ); \
+  template void SaveIPMIterate \
+  ( const string& basename, Int numIts, \
+    const DistMultiVec<Real>& x, const DistMultiVec<Real>& y, \
+    const DistMultiVec<Real>& z, const DistMultiVec<Real>& s ); \
+  template Int LoadIPMIterate \
+  ( const string& basename, \
+    DistMultiVec<Real>& x, DistMultiVec<Real>& y, DistMultiVec<Real>& z ); \
+  template Int LoadIPMIterate \
+  ( const string& basename, \
+    DistMultiVec<Real>& x, DistMultiVec<Real>& y, \
+    DistMultiVec<Real>& z, DistMultiVec<Real>& s );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -0,0 +1,255 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Entry (i,j) of matrix b of a batch
+template<typename T>
+T& BatchEntry( const MatrixBatch<T>& batch, Int b, Int i, Int j )
+{
+    if( batch.layout == BATCH_STRIDED )
+        return batch.buffer[b*batch.stride+i+j*batch.ldim];
+    else
+        return batch.buffer[b+(i+j*batch.ldim)*batch.batchSize];
+}
+
+// Copy a set of equal-sized matrices into a batch with padded leading
+// dimensions (and, for the strided layout, padded strides)
+template<typename T>
+void Pack
+( const vector<Matrix<T>>& A, BatchLayout layout,
+  vector<T>& buffer, MatrixBatch<T>& batch )
+{
+    batch.batchSize = A.size();
+    batch.height = A[0].Height();
+    batch.width = A[0].Width();
+    batch.ldim = batch.height + 1;
+    batch.stride = batch.ldim*batch.width + 3;
+    batch.layout = layout;
+    buffer.resize( batch.batchSize*batch.stride );
+    batch.buffer = buffer.data();
+    for( Int b=0; b<batch.batchSize; ++b )
+        for( Int j=0; j<batch.width; ++j )
+            for( Int i=0; i<batch.height; ++i )
+                BatchEntry( batch, b, i, j ) = A[b].Get(i,j);
+}
+
+template<typename T>
+Base<T> MaxRelDiff( const MatrixBatch<T>& batch, const vector<Matrix<T>>& A )
+{
+    Base<T> maxDiff = 0;
+    for( Int b=0; b<batch.batchSize; ++b )
+    {
+        auto E( A[b] );
+        for( Int j=0; j<batch.width; ++j )
+            for( Int i=0; i<batch.height; ++i )
+                E.Update( i, j, -BatchEntry(batch,b,i,j) );
+        const Base<T> scale = Max( FrobeniusNorm(A[b]), Base<T>(1) );
+        maxDiff = Max( maxDiff, FrobeniusNorm(E)/scale );
+    }
+    return maxDiff;
+}
+
+template<typename T>
+Base<T> MaxRelDiff
+( const vector<Matrix<T>>& ABatch, const vector<Matrix<T>>& A )
+{
+    Base<T> maxDiff = 0;
+    for( size_t b=0; b<A.size(); ++b )
+    {
+        auto E( A[b] );
+        Axpy( T(-1), ABatch[b], E );
+        const Base<T> scale = Max( FrobeniusNorm(A[b]), Base<T>(1) );
+        maxDiff = Max( maxDiff, FrobeniusNorm(E)/scale );
+    }
+    return maxDiff;
+}
+
+void CheckDiff( double diff, double tol, string msg )
+{
+    if( diff > tol )
+        LogicError(msg," deviated from the unbatched routine by ",diff);
+}
+
+string LayoutName( BatchLayout layout )
+{ return layout == BATCH_STRIDED ? "strided" : "interleaved"; }
+
+// Compare batched::Gemm against Gemm for every pair of orientations. Square
+// sizes of at most 8 use the fixed-size kernels and the rest (including any
+// rectangular case) use the generic-size kernel.
+template<typename T>
+void TestGemm( Int m, Int n, Int k, Int batchSize, BatchLayout layout )
+{
+    typedef Base<T> Real;
+    const Real tol = 100*Max(Max(m,n),k)*Epsilon<Real>();
+    const T alpha = T(2), beta = T(-1)/T(3);
+    const Orientation orients[3] = { NORMAL, TRANSPOSE, ADJOINT };
+    for( Int a=0; a<3; ++a )
+    {
+        for( Int c=0; c<3; ++c )
+        {
+            const Orientation orientA = orients[a], orientB = orients[c];
+            vector<Matrix<T>> A(batchSize), B(batchSize), C(batchSize);
+            for( Int b=0; b<batchSize; ++b )
+            {
+                if( orientA == NORMAL ) Uniform( A[b], m, k );
+                else                    Uniform( A[b], k, m );
+                if( orientB == NORMAL ) Uniform( B[b], k, n );
+                else                    Uniform( B[b], n, k );
+                Uniform( C[b], m, n );
+            }
+            vector<T> ABuf, BBuf, CBuf;
+            MatrixBatch<T> ABatch, BBatch, CBatch;
+            Pack( A, layout, ABuf, ABatch );
+            Pack( B, layout, BBuf, BBatch );
+            Pack( C, layout, CBuf, CBatch );
+            batched::Gemm
+            ( orientA, orientB, alpha, ABatch, BBatch, beta, CBatch );
+            for( Int b=0; b<batchSize; ++b )
+                Gemm( orientA, orientB, alpha, A[b], B[b], beta, C[b] );
+            CheckDiff( MaxRelDiff( CBatch, C ), tol, "Batched Gemm" );
+        }
+    }
+}
+
+// The Trsm analogue of TestGemm, with well-conditioned triangular matrices
+template<typename F>
+void TestTrsm( Int m, Int n, Int batchSize, BatchLayout layout )
+{
+    typedef Base<F> Real;
+    const Real tol = 100*Max(m,n)*Epsilon<Real>();
+    const F alpha = F(3);
+    const LeftOrRight sides[2] = { LEFT, RIGHT };
+    const UpperOrLower uplos[2] = { LOWER, UPPER };
+    const Orientation orients[3] = { NORMAL, TRANSPOSE, ADJOINT };
+    const UnitOrNonUnit diags[2] = { NON_UNIT, UNIT };
+    for( auto side : sides )
+    for( auto uplo : uplos )
+    for( auto orient : orients )
+    for( auto diag : diags )
+    {
+        const Int order = ( side == LEFT ? m : n );
+        vector<Matrix<F>> A(batchSize), B(batchSize);
+        for( Int b=0; b<batchSize; ++b )
+        {
+            Uniform( A[b], order, order );
+            ShiftDiagonal( A[b], F(order+1) );
+            Uniform( B[b], m, n );
+        }
+        vector<F> ABuf, BBuf;
+        MatrixBatch<F> ABatch, BBatch;
+        Pack( A, layout, ABuf, ABatch );
+        Pack( B, layout, BBuf, BBatch );
+        batched::Trsm( side, uplo, orient, diag, alpha, ABatch, BBatch );
+        for( Int b=0; b<batchSize; ++b )
+            Trsm( side, uplo, orient, diag, alpha, A[b], B[b] );
+        CheckDiff( MaxRelDiff( BBatch, B ), tol, "Batched Trsm" );
+    }
+}
+
+// Variable-sized batches mix the unblocked kernels with the fallback to the
+// standard routines for matrices of dimension greater than 32
+template<typename F>
+void TestVariable( Int batchSize )
+{
+    typedef Base<F> Real;
+    const Real tol = 1000*Epsilon<Real>();
+    vector<Matrix<F>> A(batchSize), B(batchSize), C(batchSize),
+                      U(batchSize), X(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const Int n = ( b % 4 == 3 ? 40 : 1+(b%9) );
+        const Int k = ( b % 5 == 4 ? 36 : n+1 );
+        Uniform( A[b], n, k );
+        Uniform( B[b], k, n );
+        Uniform( C[b], n, n );
+        Uniform( U[b], n, n );
+        ShiftDiagonal( U[b], F(n+1) );
+        Uniform( X[b], n, 2 );
+    }
+    auto CBatch( C );
+    auto XBatch( X );
+    vector<const Matrix<F>*> APtrs(batchSize), BPtrs(batchSize),
+                             UPtrs(batchSize);
+    vector<Matrix<F>*> CPtrs(batchSize), XPtrs(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        APtrs[b] = &A[b];
+        BPtrs[b] = &B[b];
+        UPtrs[b] = &U[b];
+        CPtrs[b] = &CBatch[b];
+        XPtrs[b] = &XBatch[b];
+    }
+
+    batched::Gemm( NORMAL, NORMAL, F(2), APtrs, BPtrs, F(-1), CPtrs );
+    for( Int b=0; b<batchSize; ++b )
+        Gemm( NORMAL, NORMAL, F(2), A[b], B[b], F(-1), C[b] );
+    CheckDiff( MaxRelDiff( CBatch, C ), tol, "Variable-sized batched Gemm" );
+
+    batched::Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, F(1), UPtrs, XPtrs );
+    for( Int b=0; b<batchSize; ++b )
+        Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, F(1), U[b], X[b] );
+    CheckDiff( MaxRelDiff( XBatch, X ), tol, "Variable-sized batched Trsm" );
+}
+
+template<typename F>
+void TestBatched( Int batchSize, Int maxFixed, Int generic, bool print )
+{
+    const BatchLayout layouts[2] = { BATCH_STRIDED, BATCH_INTERLEAVED };
+    for( auto layout : layouts )
+    {
+        if( print )
+            cout << "  " << LayoutName(layout) << " layout" << endl;
+        for( Int n=1; n<=maxFixed; ++n )
+        {
+            TestGemm<F>( n, n, n, batchSize, layout );
+            TestTrsm<F>( n, n, batchSize, layout );
+        }
+        TestGemm<F>( generic, generic, generic, batchSize, layout );
+        TestGemm<F>( 3, 5, 4, batchSize, layout );
+        TestTrsm<F>( generic, 3, batchSize, layout );
+        TestTrsm<F>( 2, generic, batchSize, layout );
+    }
+    TestVariable<F>( batchSize );
+    if( print )
+        cout << "  PASSED" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        // The batch size should exceed the interleaved chunk size (64) so
+        // that both full and partial chunks are exercised
+        const Int batchSize = Input("--batchSize","matrices per batch",70);
+        const Int maxFixed = Input("--maxFixed","largest fixed size",8);
+        const Int generic = Input("--generic","a size above maxFixed",13);
+        ProcessInput();
+        PrintInputReport();
+
+        // Every process runs the same sequential tests
+        const bool print = ( commRank == 0 );
+        if( print )
+            cout << "Testing with doubles:" << endl;
+        TestBatched<double>( batchSize, maxFixed, generic, print );
+        if( print )
+            cout << "Testing with double-precision complex:" << endl;
+        TestBatched<Complex<double>>( batchSize, maxFixed, generic, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -175,6 +175,58 @@ void TestGemm
     }
 }
 
+template<typename T>
+void TestBlockCyclicGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, T alpha, T beta, const Grid& g, Int mb,
+  bool print, bool correctness )
+{
+    DistMatrix<T> A(g), B(g), COrig(g);
+    if( orientA == NORMAL )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( orientB == NORMAL )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Uniform( COrig, m, n );
+
+    // B is given a different blocksize than A and C so that its panels are
+    // gathered rather than broadcast
+    BlockDistMatrix<T> ABlock( A.Height(), A.Width(), g, mb, mb ),
+                       BBlock( B.Height(), B.Width(), g, mb+1, mb+1 ),
+                       CBlock( m, n, g, mb, mb );
+    ABlock = A;
+    BBlock = B;
+    CBlock = COrig;
+
+    if( g.Rank() == 0 )
+        cout << "Block-cyclic Algorithm:" << endl;
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, ABlock, BBlock, beta, CBlock );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    const double realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    const double gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds. GFlops = " 
+             << gFlops << endl;
+    }
+    DistMatrix<T> C( CBlock );
+    if( print )
+    {
+        ostringstream msg;
+        msg << "C := " << alpha << " A B + " << beta << " C";
+        Print( C, msg.str() );
+    }
+    if( correctness )
+        TestCorrectness( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -193,6 +245,7 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int mb = Input("--mb","block-cyclic distribution blocksize",32);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
@@ -221,6 +274,8 @@ main( int argc, char* argv[] )
         TestGemm<double>
         ( orientA, orientB, m, n, k, 3., 4., g, print, correctness,
           colAlignA, rowAlignA, colAlignB, rowAlignB, colAlignC, rowAlignC );
+        TestBlockCyclicGemm<double>
+        ( orientA, orientB, m, n, k, 3., 4., g, mb, print, correctness );
 
         if( commRank == 0 )
             cout << "Testing with double-precision complex:" << endl;
@@ -228,6 +283,9 @@ main( int argc, char* argv[] )
         ( orientA, orientB, m, n, k, 
           Complex<double>(3), Complex<double>(4), g, print, correctness,
           colAlignA, rowAlignA, colAlignB, rowAlignB, colAlignC, rowAlignC );
+        TestBlockCyclicGemm<Complex<double>>
+        ( orientA, orientB, m, n, k, 
+          Complex<double>(3), Complex<double>(4), g, mb, print, correctness );
     }
     catch( exception& e ) { ReportException(e); }
 
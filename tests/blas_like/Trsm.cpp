@@ -15,7 +15,7 @@ void TestTrsm
 ( bool print,
   LeftOrRight side, UpperOrLower uplo, 
   Orientation orientation, UnitOrNonUnit diag,
-  Int m, Int n, F alpha, const Grid& g )
+  Int m, Int n, F alpha, const Grid& g, bool blockCyclic=false, Int mb=32 )
 {
     DistMatrix<F> A(g), X(g);
 
@@ -44,7 +44,17 @@ void TestTrsm
     }
     mpi::Barrier( g.Comm() );
     const double startTime = mpi::Time();
-    Trsm( side, uplo, orientation, diag, alpha, A, Y );
+    if( blockCyclic )
+    {
+        BlockDistMatrix<F> ABlock( A.Height(), A.Width(), g, mb, mb ),
+                           YBlock( m, n, g, mb, mb );
+        ABlock = A;
+        YBlock = Y;
+        Trsm( side, uplo, orientation, diag, alpha, ABlock, YBlock );
+        Y = YBlock;
+    }
+    else
+        Trsm( side, uplo, orientation, diag, alpha, A, Y );
     mpi::Barrier( g.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = 
@@ -92,6 +102,7 @@ main( int argc, char* argv[] )
         const Int m = Input("--m","height of result",100);
         const Int n = Input("--n","width of result",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int mb = Input("--mb","block-cyclic distribution blocksize",32);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -114,11 +125,21 @@ main( int argc, char* argv[] )
         if( commRank == 0 )
             cout << "Testing with doubles:" << endl;
         TestTrsm<double>( print, side, uplo, orientation, diag, m, n, 3., g );
+        if( commRank == 0 )
+            cout << "Testing block-cyclic with doubles:" << endl;
+        TestTrsm<double>
+        ( print, side, uplo, orientation, diag, m, n, 3., g, true, mb );
 
         if( commRank == 0 )
             cout << "Testing with double-precision complex:" << endl;
         TestTrsm<Complex<double>>
         ( print, side, uplo, orientation, diag, m, n, Complex<double>(3), g );
+        if( commRank == 0 )
+            cout << "Testing block-cyclic with double-precision complex:" 
+                 << endl;
+        TestTrsm<Complex<double>>
+        ( print, side, uplo, orientation, diag, m, n, Complex<double>(3), g,
+          true, mb );
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -75,6 +75,51 @@ Check( DistMatrix<T,AColDist,ARowDist>& A,
     }
 }
 
+template<typename T,Dist U,Dist V>
+void
+CheckPulls( const DistMatrix<T,U,V>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("CheckPulls"))
+    const Grid& g = A.Grid();
+    const Int commRank = g.Rank();
+    const Int height = A.Height();
+    const Int width = A.Width();
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+
+    if( commRank == 0 )
+    {
+        std::cout << "Testing pulls from [" << DistToString(U) << ","
+                  << DistToString(V) << "]...";
+        std::cout.flush();
+    }
+
+    // Each process requests a different random sample of the entries
+    const Int numPulls = Min(height*width,Int(100));
+    vector<Int> rows(numPulls), cols(numPulls);
+    A.ReservePulls( numPulls );
+    for( Int k=0; k<numPulls; ++k )
+    {
+        rows[k] = SampleUniform<Int>(0,height);
+        cols[k] = SampleUniform<Int>(0,width);
+        A.QueuePull( rows[k], cols[k] );
+    }
+    vector<T> pullBuf;
+    A.ProcessPullQueue( pullBuf );
+
+    Int myErrorFlag = 0;
+    for( Int k=0; k<numPulls; ++k )
+        if( pullBuf[k] != A_STAR_STAR.GetLocal(rows[k],cols[k]) )
+            myErrorFlag = 1;
+    const Int summedErrorFlag = mpi::AllReduce( myErrorFlag, g.Comm() );
+    if( commRank == 0 )
+    {
+        if( summedErrorFlag == 0 )
+            std::cout << "PASSED" << std::endl;
+        else
+            std::cout << "FAILED" << std::endl;
+    }
+}
+
 template<typename T,Dist U,Dist V>
 void CheckAll( Int m, Int n, const Grid& g, bool print )
 {
@@ -85,6 +130,7 @@ void CheckAll( Int m, Int n, const Grid& g, bool print )
     mpi::Broadcast( rowAlign, 0, g.Comm() );
     A.Align( colAlign, rowAlign );
     Uniform( A, m, n );
+    CheckPulls( A );
 
     DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC(g);
     DistMatrix<T,MC,  MR  > A_MC_MR(g);
@@ -117,6 +163,65 @@ void CheckAll( Int m, Int n, const Grid& g, bool print )
     Check( A_VR_STAR,   A, print );
 }
 
+// Perform [MD,STAR] <- [MC,MR] with nonzero alignments and return whether
+// the result was incorrect on any process
+template<typename T>
+Int
+TeamRedist( Int m, Int n, const Grid& g )
+{
+    DEBUG_ONLY(CallStackEntry cse("TeamRedist"))
+    DistMatrix<T,MC,MR> A(g);
+    DistMatrix<T,MD,STAR> B(g);
+    A.Align( 1 % A.ColStride(), 1 % A.RowStride() );
+    B.Align( 1 % B.ColStride(), 0 );
+    Uniform( A, m, n );
+    B = A;
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    Int myErrorFlag = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) )
+                myErrorFlag = 1;
+    return mpi::AllReduce( myErrorFlag, g.Comm() );
+}
+
+// Two teams perform different numbers of redistributions over their own
+// subgrids, so that any cached communication patterns diverge between them,
+// before and after redistributing over the full grid
+template<typename T>
+void
+CheckTeams( Int m, Int n, const Grid& g )
+{
+    DEBUG_ONLY(CallStackEntry cse("CheckTeams"))
+    mpi::Comm comm = g.Comm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    if( commSize < 2 )
+        return;
+    if( commRank == 0 )
+    {
+        std::cout << "Testing [MD,STAR] <- [MC,MR] over two teams...";
+        std::cout.flush();
+    }
+
+    Int errorFlag = TeamRedist<T>( m, n, g );
+    const int team = ( commRank < commSize/2 ? 0 : 1 );
+    mpi::Comm teamComm;
+    mpi::Split( comm, team, commRank, teamComm );
+    {
+        const Grid teamGrid( teamComm );
+        const Int numRedists = ( team == 0 ? 80 : 1 );
+        for( Int k=0; k<numRedists; ++k )
+            errorFlag += TeamRedist<T>( m+k, n, teamGrid );
+    }
+    mpi::Free( teamComm );
+    errorFlag += TeamRedist<T>( m, n, g );
+
+    errorFlag = mpi::AllReduce( errorFlag, comm );
+    if( commRank == 0 )
+        std::cout << ( errorFlag == 0 ? "PASSED" : "FAILED" ) << std::endl;
+}
+
 template<typename T>
 void
 DistMatrixTest( Int m, Int n, const Grid& g, bool print )
@@ -136,6 +241,7 @@ DistMatrixTest( Int m, Int n, const Grid& g, bool print )
     CheckAll<T,STAR,VR  >( m, n, g, print );
     CheckAll<T,VC,  STAR>( m, n, g, print );
     CheckAll<T,VR,  STAR>( m, n, g, print );
+    CheckTeams<T>( m, n, g );
 }
 
 int 
@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Each process pulls a different random sample of the entries, including
+// some it owns, and compares them against a redundant copy
+template<typename T>
+void TestPulls( Int m, Int n, Int numPulls, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    DistMultiVec<T> X(comm);
+    Uniform( X, m, n );
+
+    // DistMultiVec can only be copied into a non-redundant distribution
+    DistMatrix<T> XDist;
+    Copy( X, XDist );
+    DistMatrix<T,STAR,STAR> X_STAR_STAR( XDist );
+
+    vector<Int> rows(numPulls), cols(numPulls);
+    X.ReservePulls( numPulls );
+    for( Int k=0; k<numPulls; ++k )
+    {
+        if( k % 4 == 0 && X.LocalHeight() > 0 )
+            rows[k] = X.FirstLocalRow() +
+                      SampleUniform<Int>(0,X.LocalHeight());
+        else
+            rows[k] = SampleUniform<Int>(0,m);
+        cols[k] = SampleUniform<Int>(0,n);
+        X.QueuePull( rows[k], cols[k] );
+    }
+    vector<T> pullBuf;
+    X.ProcessPullQueue( pullBuf );
+
+    Int numWrong = 0;
+    if( Int(pullBuf.size()) != numPulls )
+        numWrong = numPulls;
+    else
+        for( Int k=0; k<numPulls; ++k )
+            if( pullBuf[k] != X_STAR_STAR.GetLocal(rows[k],cols[k]) )
+                ++numWrong;
+    numWrong = mpi::AllReduce( numWrong, comm );
+    if( commRank == 0 )
+        cout << "  " << numWrong << " incorrect pulls" << endl;
+    if( numWrong != 0 )
+        LogicError("DistMultiVec pulls were incorrect");
+
+    // An empty queue must still participate in the exchange
+    if( commRank == 0 )
+        X.QueuePull( m-1, n-1 );
+    X.ProcessPullQueue( pullBuf );
+    Int loneWrong = 0;
+    if( commRank == 0 && pullBuf[0] != X_STAR_STAR.GetLocal(m-1,n-1) )
+        loneWrong = 1;
+    if( mpi::AllReduce( loneWrong, comm ) != 0 )
+        LogicError("Pull from a lone process was incorrect");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of multivector",100);
+        const Int n = Input("--width","width of multivector",3);
+        const Int numPulls = Input("--numPulls","pulls per process",200);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+            cout << "Testing with integers:" << endl;
+        TestPulls<Int>( m, n, numPulls, comm );
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestPulls<double>( m, n, numPulls, comm );
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestPulls<Complex<double>>( m, n, numPulls, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
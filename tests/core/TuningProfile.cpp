@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+void CheckBlocksize( Int n, Int expected, string msg )
+{
+    const Int nb = RegimeBlocksize( n );
+    if( nb != expected )
+        LogicError(msg,": RegimeBlocksize(",n,")=",nb," instead of ",expected);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const string filename =
+          Input("--filename","tuning profile to write","TuningProfile.txt");
+        ProcessInput();
+        PrintInputReport();
+
+        // Save a profile with two regimes and reload it
+        // =============================================
+        SetBlocksizeRegime( 100, 32 );
+        SetBlocksizeRegime( 1000, 96 );
+        SetTunedBlocksize( 96 );
+        SaveTuningProfile( filename );
+        ClearBlocksizeRegimes();
+        SetTunedBlocksize( 128 );
+        CheckBlocksize( 50, 128, "Cleared regimes" );
+
+        LoadTuningProfile( filename );
+        if( commRank == 0 )
+            cout << "Loaded " << filename << endl;
+        CheckBlocksize( 50, 32, "Loaded profile" );
+        CheckBlocksize( 100, 32, "Loaded profile" );
+        CheckBlocksize( 500, 96, "Loaded profile" );
+        CheckBlocksize( 5000, 96, "Loaded profile" );
+        if( Blocksize() != 96 )
+            LogicError("Loaded blocksize was ",Blocksize()," instead of 96");
+
+        // A pushed blocksize overrides the regimes until it is popped, even
+        // if an exception is thrown
+        // ==============================================================
+        try
+        {
+            BlocksizeStackEntry bse( 17 );
+            CheckBlocksize( 50, 17, "Pushed blocksize" );
+            RuntimeError("Expected exception");
+        }
+        catch( std::exception& e ) { }
+        CheckBlocksize( 50, 32, "After exception" );
+
+        // An explicitly-set blocksize overrides both the regimes and any
+        // subsequently-loaded profile
+        // ==============================================================
+        SetBlocksize( 64 );
+        CheckBlocksize( 50, 64, "Explicit blocksize" );
+        CheckBlocksize( 5000, 64, "Explicit blocksize" );
+        LoadTuningProfile( filename );
+        CheckBlocksize( 50, 64, "Explicit blocksize after loading" );
+        if( Blocksize() != 64 )
+            LogicError("Profile overrode the explicit blocksize");
+
+        if( commRank == 0 )
+        {
+            cout << "PASSED" << endl;
+            remove( filename.c_str() );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
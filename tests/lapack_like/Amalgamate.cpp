@@ -0,0 +1,178 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Ensure that every front owns a contiguous range of the reordering which
+// immediately follows the ranges of its children's subtrees, that each lower
+// structure is sorted and lies beyond its front, and that the structure of
+// each child is contained within its parent's pivots and structure.
+// The number of fronts in the subtree is returned.
+Int CheckTree( const ldl::NodeInfo& info, Int subtreeOff )
+{
+    Int numFronts = 1;
+    Int off = subtreeOff;
+    for( const ldl::NodeInfo* child : info.children )
+    {
+        numFronts += CheckTree( *child, off );
+        off = child->off + child->size;
+
+        for( const Int i : child->lowerStruct )
+        {
+            const bool isPivot = ( i >= info.off && i < info.off+info.size );
+            if( !isPivot &&
+                !std::binary_search
+                 ( info.lowerStruct.begin(), info.lowerStruct.end(), i ) )
+                LogicError
+                ("Index ",i," of a child structure is not in its parent");
+        }
+    }
+    if( info.off != off )
+        LogicError
+        ("Front at ",info.off," did not follow its children, which ended at ",
+         off);
+    if( !std::is_sorted( info.lowerStruct.begin(), info.lowerStruct.end() ) )
+        LogicError("Lower structure of front at ",info.off," was not sorted");
+    if( !info.lowerStruct.empty() &&
+        info.lowerStruct.front() < info.off+info.size )
+        LogicError("Lower structure of front at ",info.off," overlaps it");
+    return numFronts;
+}
+
+Int TestSequential
+( const Graph& graph, const BisectCtrl& ctrl, const string& label )
+{
+    const Int numSources = graph.NumSources();
+    vector<Int> map;
+    ldl::Separator sep;
+    ldl::NodeInfo info;
+    ldl::NestedDissection( graph, map, sep, info, ctrl );
+
+    vector<Int> hits( numSources, 0 );
+    for( const Int i : map )
+        if( i < 0 || i >= numSources || hits[i]++ != 0 )
+            LogicError(label,": the reordering is not a permutation");
+
+    if( info.off+info.size != numSources )
+        LogicError(label,": the root front does not end the reordering");
+    const Int numFronts = CheckTree( info, 0 );
+    cout << "  " << label << ": " << numFronts << " fronts" << endl;
+    return numFronts;
+}
+
+void TestSolve
+( Int n, const BisectCtrl& ctrl, double tol, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    const Int N = n*n*n;
+    const Int numRHS = 2;
+
+    DistSparseMatrix<double> A(comm);
+    Laplacian( A, n, n, n );
+    A *= -1;
+    DistMultiVec<double> X( N, numRHS, comm ), Y( N, numRHS, comm );
+    MakeUniform( X );
+    Zero( Y );
+    Multiply( NORMAL, 1., A, X, 0., Y );
+
+    ldl::DistNodeInfo info;
+    ldl::DistSeparator sep;
+    DistMap map, invMap;
+    ldl::NestedDissection( A.DistGraph(), map, sep, info, ctrl );
+    InvertMap( map, invMap );
+
+    ldl::DistFront<double> front( A, map, sep, info );
+    LDL( info, front, LDL_1D );
+    ldl::SolveAfter( invMap, info, front, Y );
+
+    Matrix<double> XNorms, errorNorms;
+    ColumnTwoNorms( X, XNorms );
+    Y -= X;
+    ColumnTwoNorms( Y, errorNorms );
+    for( Int j=0; j<numRHS; ++j )
+    {
+        const double relError = errorNorms.Get(j,0) / XNorms.Get(j,0);
+        if( commRank == 0 )
+            cout << "  amalgamated solve: relative error of RHS " << j
+                 << " is " << relError << endl;
+        if( relError > tol )
+            LogicError("Relative error of ",relError," exceeded ",tol);
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of n x n x n grid",16);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",16);
+        const double tol = Input("--tol","tolerated relative error",1e-8);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.native = true;
+        ctrl.cutoff = cutoff;
+        if( ctrl.amalgamate )
+            LogicError("Amalgamation should not be enabled by default");
+
+        if( commRank == 0 )
+        {
+            const Int N = n*n*n;
+            SparseMatrix<double> A;
+            Laplacian( A, n, n, n );
+            const Graph& graph = A.Graph();
+
+            const Int numFronts = TestSequential( graph, ctrl, "unmodified" );
+
+            // Only fundamental supernodes may be merged
+            ctrl.amalgamate = true;
+            ctrl.relaxSize = 0;
+            ctrl.relaxFill = 0;
+            const Int numFundamental =
+              TestSequential( graph, ctrl, "fundamental" );
+            if( numFundamental > numFronts )
+                LogicError("Merging supernodes increased the number of fronts");
+
+            ctrl.relaxSize = 16;
+            ctrl.relaxFill = 0.05;
+            const Int numRelaxed = TestSequential( graph, ctrl, "relaxed" );
+            if( numRelaxed > numFundamental )
+                LogicError("Relaxation increased the number of fronts");
+            if( numRelaxed == numFronts )
+                LogicError("Relaxation did not merge any fronts");
+
+            // Any merge is allowed once 'relaxSize' or 'relaxFill' is large
+            // enough, so the tree should collapse into a single front
+            ctrl.relaxSize = N;
+            ctrl.relaxFill = 0;
+            if( TestSequential( graph, ctrl, "maximal relaxSize" ) != 1 )
+                LogicError("A maximal relaxSize did not yield a single front");
+            ctrl.relaxSize = 0;
+            ctrl.relaxFill = 1;
+            if( TestSequential( graph, ctrl, "maximal relaxFill" ) != 1 )
+                LogicError("A maximal relaxFill did not yield a single front");
+        }
+
+        ctrl.amalgamate = true;
+        ctrl.relaxSize = 16;
+        ctrl.relaxFill = 0.05;
+        TestSolve( n, ctrl, tol, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,279 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Entry (i,j) of matrix b of a batch
+template<typename T>
+T& BatchEntry( const MatrixBatch<T>& batch, Int b, Int i, Int j )
+{
+    if( batch.layout == BATCH_STRIDED )
+        return batch.buffer[b*batch.stride+i+j*batch.ldim];
+    else
+        return batch.buffer[b+(i+j*batch.ldim)*batch.batchSize];
+}
+
+// Copy a set of equal-sized matrices into a batch with padded leading
+// dimensions (and, for the strided layout, padded strides)
+template<typename T>
+void Pack
+( const vector<Matrix<T>>& A, BatchLayout layout,
+  vector<T>& buffer, MatrixBatch<T>& batch )
+{
+    batch.batchSize = A.size();
+    batch.height = A[0].Height();
+    batch.width = A[0].Width();
+    batch.ldim = batch.height + 1;
+    batch.stride = batch.ldim*batch.width + 3;
+    batch.layout = layout;
+    buffer.resize( batch.batchSize*batch.stride );
+    batch.buffer = buffer.data();
+    for( Int b=0; b<batch.batchSize; ++b )
+        for( Int j=0; j<batch.width; ++j )
+            for( Int i=0; i<batch.height; ++i )
+                BatchEntry( batch, b, i, j ) = A[b].Get(i,j);
+}
+
+template<typename T>
+void Unpack( const MatrixBatch<T>& batch, vector<Matrix<T>>& A )
+{
+    A.resize( batch.batchSize );
+    for( Int b=0; b<batch.batchSize; ++b )
+    {
+        A[b].Resize( batch.height, batch.width );
+        for( Int j=0; j<batch.width; ++j )
+            for( Int i=0; i<batch.height; ++i )
+                A[b].Set( i, j, BatchEntry(batch,b,i,j) );
+    }
+}
+
+// The relative difference of the factors, where only the 'uplo' triangle is
+// compared for Cholesky
+template<typename F>
+Base<F> MaxRelDiff
+( const vector<Matrix<F>>& ABatch, const vector<Matrix<F>>& A,
+  bool triangular=false, UpperOrLower uplo=LOWER )
+{
+    Base<F> maxDiff = 0;
+    for( size_t b=0; b<A.size(); ++b )
+    {
+        auto E( A[b] );
+        Axpy( F(-1), ABatch[b], E );
+        if( triangular )
+            MakeTrapezoidal( uplo, E );
+        const Base<F> scale = Max( FrobeniusNorm(A[b]), Base<F>(1) );
+        maxDiff = Max( maxDiff, FrobeniusNorm(E)/scale );
+    }
+    return maxDiff;
+}
+
+void CheckDiff( double diff, double tol, string msg )
+{
+    if( diff > tol )
+        LogicError(msg," deviated from the unbatched routine by ",diff);
+}
+
+void CheckPivots
+( const Matrix<Int>& p, Int b, const Matrix<Int>& pRef, string msg )
+{
+    for( Int i=0; i<pRef.Height(); ++i )
+        if( p.Get(i,b) != pRef.Get(i,0) )
+            LogicError(msg," chose a different pivot sequence");
+}
+
+template<typename F>
+void MakeHPD( Matrix<F>& A, Int n )
+{
+    Matrix<F> G;
+    Uniform( G, n, n );
+    Herk( LOWER, NORMAL, Base<F>(1), G, A );
+    MakeHermitian( LOWER, A );
+    ShiftDiagonal( A, F(n) );
+}
+
+// Compare the batched factorizations of equal-sized matrices against
+// Cholesky and LU. Square sizes of at most 8 use the fixed-size kernels and
+// the rest (including rectangular LU) use the generic-size kernel.
+template<typename F>
+void TestCholesky( Int n, Int batchSize, BatchLayout layout )
+{
+    typedef Base<F> Real;
+    const Real tol = 100*n*Epsilon<Real>();
+    const UpperOrLower uplos[2] = { LOWER, UPPER };
+    for( auto uplo : uplos )
+    {
+        vector<Matrix<F>> A(batchSize);
+        for( Int b=0; b<batchSize; ++b )
+            MakeHPD( A[b], n );
+        vector<F> buffer;
+        MatrixBatch<F> batch;
+        Pack( A, layout, buffer, batch );
+        batched::Cholesky( uplo, batch );
+        vector<Matrix<F>> ABatch;
+        Unpack( batch, ABatch );
+        for( Int b=0; b<batchSize; ++b )
+            Cholesky( uplo, A[b] );
+        CheckDiff
+        ( MaxRelDiff( ABatch, A, true, uplo ), tol, "Batched Cholesky" );
+    }
+}
+
+template<typename F>
+void TestLU( Int m, Int n, Int batchSize, BatchLayout layout )
+{
+    typedef Base<F> Real;
+    const Real tol = 100*Max(m,n)*Epsilon<Real>();
+    vector<Matrix<F>> A(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+        Uniform( A[b], m, n );
+    vector<F> buffer;
+    MatrixBatch<F> batch;
+    Pack( A, layout, buffer, batch );
+    Matrix<Int> p;
+    batched::LU( batch, p );
+    vector<Matrix<F>> ABatch;
+    Unpack( batch, ABatch );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<Int> pRef;
+        LU( A[b], pRef );
+        CheckPivots( p, b, pRef, "Batched LU" );
+    }
+    CheckDiff( MaxRelDiff( ABatch, A ), tol, "Batched LU" );
+}
+
+// Variable-sized batches mix the unblocked kernels with the fallback to the
+// standard routines for matrices of dimension greater than 32
+template<typename F>
+void TestVariable( Int batchSize )
+{
+    typedef Base<F> Real;
+    const Real tol = 1000*Epsilon<Real>();
+    vector<Matrix<F>> A(batchSize), B(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const Int n = ( b % 4 == 3 ? 40 : 1+(b%9) );
+        MakeHPD( A[b], n );
+        Uniform( B[b], n, ( b % 5 == 4 ? 36 : n+2 ) );
+    }
+    auto ABatch( A );
+    auto BBatch( B );
+    vector<Matrix<F>*> APtrs(batchSize), BPtrs(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        APtrs[b] = &ABatch[b];
+        BPtrs[b] = &BBatch[b];
+    }
+
+    batched::Cholesky( UPPER, APtrs );
+    for( Int b=0; b<batchSize; ++b )
+        Cholesky( UPPER, A[b] );
+    CheckDiff
+    ( MaxRelDiff( ABatch, A, true, UPPER ), tol,
+      "Variable-sized batched Cholesky" );
+
+    vector<Matrix<Int>> p;
+    batched::LU( BPtrs, p );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<Int> pRef;
+        LU( B[b], pRef );
+        CheckPivots( p[b], 0, pRef, "Variable-sized batched LU" );
+    }
+    CheckDiff( MaxRelDiff( BBatch, B ), tol, "Variable-sized batched LU" );
+}
+
+// A failure must only be reported after the rest of the batch is factored
+template<typename F>
+void TestFailure( Int n, Int batchSize, BatchLayout layout )
+{
+    typedef Base<F> Real;
+    const Real tol = 100*n*Epsilon<Real>();
+    vector<Matrix<F>> A(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+        MakeHPD( A[b], n );
+    const Int bad = batchSize / 2;
+    ShiftDiagonal( A[bad], F(-10*n*n) );
+    vector<F> buffer;
+    MatrixBatch<F> batch;
+    Pack( A, layout, buffer, batch );
+    bool threw = false;
+    try { batched::Cholesky( LOWER, batch ); }
+    catch( NonHPDMatrixException& e ) { threw = true; }
+    if( !threw )
+        LogicError("Batched Cholesky did not detect a non-HPD matrix");
+    vector<Matrix<F>> ABatch;
+    Unpack( batch, ABatch );
+    A.erase( A.begin()+bad );
+    ABatch.erase( ABatch.begin()+bad );
+    for( auto& AHPD : A )
+        Cholesky( LOWER, AHPD );
+    CheckDiff
+    ( MaxRelDiff( ABatch, A, true, LOWER ), tol,
+      "Batched Cholesky with a non-HPD matrix" );
+}
+
+template<typename F>
+void TestBatched( Int batchSize, Int maxFixed, Int generic, bool print )
+{
+    const BatchLayout layouts[2] = { BATCH_STRIDED, BATCH_INTERLEAVED };
+    for( auto layout : layouts )
+    {
+        if( print )
+            cout << "  " << ( layout == BATCH_STRIDED ? "strided"
+                                                      : "interleaved" )
+                 << " layout" << endl;
+        for( Int n=1; n<=maxFixed; ++n )
+        {
+            TestCholesky<F>( n, batchSize, layout );
+            TestLU<F>( n, n, batchSize, layout );
+        }
+        TestCholesky<F>( generic, batchSize, layout );
+        TestLU<F>( generic, generic, batchSize, layout );
+        TestLU<F>( 7, 4, batchSize, layout );
+        TestLU<F>( 4, 7, batchSize, layout );
+        TestFailure<F>( 5, batchSize, layout );
+    }
+    TestVariable<F>( batchSize );
+    if( print )
+        cout << "  PASSED" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        // The batch size should exceed the interleaved chunk size (64) so
+        // that both full and partial chunks are exercised
+        const Int batchSize = Input("--batchSize","matrices per batch",70);
+        const Int maxFixed = Input("--maxFixed","largest fixed size",8);
+        const Int generic = Input("--generic","a size above maxFixed",13);
+        ProcessInput();
+        PrintInputReport();
+
+        // Every process runs the same sequential tests
+        const bool print = ( commRank == 0 );
+        if( print )
+            cout << "Testing with doubles:" << endl;
+        TestBatched<double>( batchSize, maxFixed, generic, print );
+        if( print )
+            cout << "Testing with double-precision complex:" << endl;
+        TestBatched<Complex<double>>( batchSize, maxFixed, generic, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
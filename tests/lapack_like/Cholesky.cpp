@@ -62,7 +62,8 @@ void TestCorrectness
 template<typename F,Dist UPerm> 
 void TestCholesky
 ( bool testCorrectness, bool pivot, bool print, bool printDiag,
-  UpperOrLower uplo, Int m, const Grid& g )
+  UpperOrLower uplo, Int m, const Grid& g,
+  bool blockCyclic=false, Int mb=32 )
 {
     DistMatrix<F> A(g), AOrig(g);
     DistMatrix<Int,UPerm,STAR> p(g);
@@ -89,7 +90,14 @@ void TestCholesky
     }
     mpi::Barrier( g.Comm() );
     const double startTime = mpi::Time();
-    if( pivot )
+    if( blockCyclic )
+    {
+        BlockDistMatrix<F> ABlock( m, m, g, mb, mb );
+        ABlock = A;
+        Cholesky( uplo, ABlock );
+        A = ABlock;
+    }
+    else if( pivot )
         Cholesky( uplo, A, p );
     else
         Cholesky( uplo, A );
@@ -115,6 +123,26 @@ void TestCholesky
         TestCorrectness( pivot, uplo, A, p, AOrig );
 }
 
+// Every process must detect that an indefinite matrix is not HPD, even
+// though only the owners of the failing diagonal block factor it
+template<typename F>
+void TestBlockCyclicFailure( UpperOrLower uplo, Int m, Int mb, const Grid& g )
+{
+    DistMatrix<F> A(g);
+    HermitianUniformSpectrum( A, m, 1, 10 );
+    const Int iFail = m - 1;
+    A.Set( iFail, iFail, -A.Get(iFail,iFail) );
+    BlockDistMatrix<F> ABlock( m, m, g, mb, mb );
+    ABlock = A;
+    bool threw = false;
+    try { Cholesky( uplo, ABlock ); }
+    catch( const NonHPDMatrixException& e ) { threw = true; }
+    if( !threw )
+        LogicError("An indefinite block-cyclic matrix was not detected");
+    if( g.Rank() == 0 )
+        cout << "  Indefinite block-cyclic matrix was detected" << endl;
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -131,6 +159,7 @@ main( int argc, char* argv[] )
         const Int m = Input("--m","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int mb = Input("--mb","block-cyclic distribution blocksize",32);
         const bool pivot = Input("--pivot","use pivoting?",false);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
@@ -155,11 +184,22 @@ main( int argc, char* argv[] )
             cout << "Testing with doubles:" << endl;
         TestCholesky<double,VC>
         ( testCorrectness, pivot, print, printDiag, uplo, m, g );
+        if( commRank == 0 )
+            cout << "Testing block-cyclic with doubles:" << endl;
+        TestCholesky<double,VC>
+        ( testCorrectness, false, print, printDiag, uplo, m, g, true, mb );
+        TestBlockCyclicFailure<double>( uplo, m, mb, g );
 
         if( commRank == 0 )
             cout << "Testing with double-precision complex:" << endl;
         TestCholesky<Complex<double>,VC>
         ( testCorrectness, pivot, print, printDiag, uplo, m, g );
+        if( commRank == 0 )
+            cout << "Testing block-cyclic with double-precision complex:"
+                 << endl;
+        TestCholesky<Complex<double>,VC>
+        ( testCorrectness, false, print, printDiag, uplo, m, g, true, mb );
+        TestBlockCyclicFailure<Complex<double>>( uplo, m, mb, g );
     }
     catch( exception& e ) { ReportException(e); }
 
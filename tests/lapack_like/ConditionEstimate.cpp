@@ -0,0 +1,263 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Hager-Higham estimates are the norms of particular columns of inv(A), so
+// they should never exceed the exact condition numbers (up to roundoff), and
+// in practice they are within a small factor of them
+void CheckEstimate
+( double estimate, double exact, double factor, const string& label,
+  bool print )
+{
+    if( print )
+        cout << "  " << label << ": estimate=" << estimate
+             << ", exact=" << exact << endl;
+    if( estimate > exact*(1+1e-6) )
+        LogicError(label,": estimate ",estimate," exceeded ",exact);
+    if( estimate < exact/factor )
+        LogicError
+        (label,": estimate ",estimate," was not within a factor of ",factor,
+         " of ",exact);
+}
+
+// Grade the rows of a random matrix so that its condition number is large
+template<typename F>
+void MakeGraded( Matrix<F>& A, Int n )
+{
+    Uniform( A, n, n );
+    for( Int i=0; i<n; ++i )
+    {
+        const Base<F> scale = Pow( Base<F>(10), -Base<F>(3*i)/n );
+        for( Int j=0; j<n; ++j )
+            A.Set( i, j, scale*A.Get(i,j) );
+    }
+}
+
+template<typename F>
+void MakeHPD( Matrix<F>& A, Int n )
+{
+    Matrix<F> G;
+    MakeGraded( G, n );
+    Herk( LOWER, NORMAL, Base<F>(1), G, A );
+    MakeHermitian( LOWER, A );
+    ShiftDiagonal( A, F(Base<F>(1)/n) );
+}
+
+template<typename F>
+void MakeIndefinite( Matrix<F>& A, Int n )
+{
+    Uniform( A, n, n );
+    MakeHermitian( LOWER, A );
+}
+
+// Every process uses the root's matrices so that the results (and failures)
+// are the same on every process
+template<typename F>
+void Synchronize( Matrix<F>& A, mpi::Comm comm )
+{ mpi::Broadcast( A.Buffer(), A.LDim()*A.Width(), 0, comm ); }
+
+template<typename F>
+void TestSequential( mpi::Comm comm, Int n, double factor, bool print )
+{
+    typedef Base<F> Real;
+    if( print )
+        cout << " Sequential dense:" << endl;
+
+    Matrix<F> A;
+    MakeGraded( A, n );
+    Synchronize( A, comm );
+    const Real oneNormA = OneNorm( A );
+    const Real infNormA = InfinityNorm( A );
+    const Real oneCond = OneCondition( A );
+    const Real infCond = InfinityCondition( A );
+    auto ALU( A );
+    Matrix<Int> p;
+    LU( ALU, p );
+    CheckEstimate
+    ( lu::OneConditionEstimate( oneNormA, ALU, p ), oneCond, factor,
+      "LU, one-norm", print );
+    CheckEstimate
+    ( lu::InfinityConditionEstimate( infNormA, ALU, p ), infCond, factor,
+      "LU, infinity-norm", print );
+
+    const UpperOrLower uplos[2] = { LOWER, UPPER };
+    MakeHPD( A, n );
+    Synchronize( A, comm );
+    for( auto uplo : uplos )
+    {
+        auto AChol( A );
+        Cholesky( uplo, AChol );
+        CheckEstimate
+        ( cholesky::OneConditionEstimate( OneNorm(A), uplo, AChol ),
+          OneCondition(A), factor,
+          uplo == LOWER ? "Cholesky, lower" : "Cholesky, upper", print );
+    }
+
+    MakeIndefinite( A, n );
+    Synchronize( A, comm );
+    Matrix<F> dSub;
+    auto ALDL( A );
+    LDL( ALDL, dSub, p, true );
+    CheckEstimate
+    ( ldl::OneConditionEstimate( OneNorm(A), ALDL, dSub, p, true ),
+      OneCondition(A), factor, "LDL^H", print );
+    MakeSymmetric( LOWER, A );
+    ALDL = A;
+    LDL( ALDL, dSub, p, false );
+    CheckEstimate
+    ( ldl::OneConditionEstimate( OneNorm(A), ALDL, dSub, p, false ),
+      OneCondition(A), factor, "LDL^T", print );
+}
+
+template<typename F>
+void TestDistributed( const Grid& g, Int n, double factor, bool print )
+{
+    typedef Base<F> Real;
+    if( print )
+        cout << " Distributed dense:" << endl;
+
+    Matrix<F> ALoc;
+    MakeGraded( ALoc, n );
+    Synchronize( ALoc, g.Comm() );
+    DistMatrix<F,STAR,STAR> ASTAR( g );
+    ASTAR.LockedAttach( n, n, g, 0, 0, ALoc.LockedBuffer(), ALoc.LDim() );
+    DistMatrix<F> A( ASTAR );
+    const Real oneNormA = OneNorm( A );
+    const Real infNormA = InfinityNorm( A );
+    const Real oneCond = OneCondition( A );
+    const Real infCond = InfinityCondition( A );
+    auto ALU( A );
+    DistMatrix<Int,VC,STAR> p( g );
+    LU( ALU, p );
+    CheckEstimate
+    ( lu::OneConditionEstimate( oneNormA, ALU, p ), oneCond, factor,
+      "LU, one-norm", print );
+    CheckEstimate
+    ( lu::InfinityConditionEstimate( infNormA, ALU, p ), infCond, factor,
+      "LU, infinity-norm", print );
+
+    const UpperOrLower uplos[2] = { LOWER, UPPER };
+    MakeHPD( ALoc, n );
+    Synchronize( ALoc, g.Comm() );
+    ASTAR.LockedAttach( n, n, g, 0, 0, ALoc.LockedBuffer(), ALoc.LDim() );
+    A = ASTAR;
+    for( auto uplo : uplos )
+    {
+        auto AChol( A );
+        Cholesky( uplo, AChol );
+        CheckEstimate
+        ( cholesky::OneConditionEstimate( OneNorm(A), uplo, AChol ),
+          OneCondition(A), factor,
+          uplo == LOWER ? "Cholesky, lower" : "Cholesky, upper", print );
+    }
+
+    MakeIndefinite( ALoc, n );
+    Synchronize( ALoc, g.Comm() );
+    ASTAR.LockedAttach( n, n, g, 0, 0, ALoc.LockedBuffer(), ALoc.LDim() );
+    A = ASTAR;
+    DistMatrix<F,MD,STAR> dSub( g );
+    auto ALDL( A );
+    LDL( ALDL, dSub, p, true );
+    CheckEstimate
+    ( ldl::OneConditionEstimate( OneNorm(A), ALDL, dSub, p, true ),
+      OneCondition(A), factor, "LDL^H", print );
+}
+
+// An indefinite 2D Helmholtz operator, which is factored without pivoting
+void TestSparse( mpi::Comm comm, Int nx, double shift, double factor )
+{
+    const int commRank = mpi::Rank( comm );
+    const bool print = ( commRank == 0 );
+
+    if( print )
+        cout << " Sequential sparse LDL^T:" << endl;
+    double seqEst = 0, seqExact = 0;
+    if( print )
+    {
+        SparseMatrix<double> A;
+        Helmholtz( A, nx, nx, shift );
+        vector<Int> map, invMap;
+        ldl::Separator sep;
+        ldl::NodeInfo info;
+        ldl::NaturalNestedDissection( nx, nx, 1, A.Graph(), map, sep, info );
+        InvertMap( map, invMap );
+        ldl::Front<double> front( A, map, info );
+        LDL( info, front, LDL_1D );
+        Matrix<double> ADense;
+        Copy( A, ADense );
+        seqEst =
+          ldl::OneConditionEstimate( OneNorm(ADense), invMap, info, front );
+        seqExact = OneCondition( ADense );
+    }
+    // Only the root checks the sequential estimate, but every process must
+    // fail along with it
+    mpi::Broadcast( seqEst, 0, comm );
+    mpi::Broadcast( seqExact, 0, comm );
+    CheckEstimate( seqEst, seqExact, factor, "estimate", print );
+
+    if( print )
+        cout << " Distributed sparse LDL^T:" << endl;
+    DistSparseMatrix<double> A( comm );
+    Helmholtz( A, nx, nx, shift );
+    DistMap map, invMap;
+    ldl::DistSeparator sep;
+    ldl::DistNodeInfo info;
+    ldl::NaturalNestedDissection( nx, nx, 1, A.DistGraph(), map, sep, info );
+    InvertMap( map, invMap );
+    ldl::DistFront<double> front( A, map, sep, info );
+    LDL( info, front, LDL_1D );
+    DistMatrix<double> ADense( DefaultGrid() );
+    Copy( A, ADense );
+    CheckEstimate
+    ( ldl::OneConditionEstimate( OneNorm(ADense), invMap, info, front ),
+      OneCondition( ADense ), factor, "estimate", print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of dense matrices",60);
+        const Int nx = Input("--nx","width of the Helmholtz grid",12);
+        const double shift = Input("--shift","Helmholtz shift",30.);
+        const double factor =
+          Input("--factor","allowed underestimation factor",10.);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        const Grid& g = DefaultGrid();
+        const bool print = ( commRank == 0 );
+        if( print )
+            cout << "Testing with doubles:" << endl;
+        TestSequential<double>( comm, n, factor, print );
+        TestDistributed<double>( g, n, factor, print );
+        if( print )
+            cout << "Testing with double-precision complex:" << endl;
+        TestSequential<Complex<double>>( comm, n, factor, print );
+        TestDistributed<Complex<double>>( g, n, factor, print );
+        if( print )
+            cout << "Testing with sparse matrices:" << endl;
+        TestSparse( comm, nx, shift, factor );
+        if( print )
+            cout << "PASSED" << endl;
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
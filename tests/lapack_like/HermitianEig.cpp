@@ -90,6 +90,130 @@ void TestHermitianEig
         TestCorrectness( print, uplo, AOrig, A, w, Z );
 }
 
+// The sequential drivers otherwise call LAPACK directly
+template<typename F>
+void TestSequentialTwoStage
+( UpperOrLower uplo, Int m, SortType sort,
+  const HermitianEigSubset<Base<F>> subset,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    typedef Base<F> Real;
+    Matrix<F> A, AOrig, Z;
+    Matrix<Real> w, wOnly;
+    HermitianUniformSpectrum( A, m, -10, 10 );
+    AOrig = A;
+    HermitianEig( uplo, A, w, Z, sort, subset, ctrl );
+    A = AOrig;
+    HermitianEig( uplo, A, wOnly, sort, subset, ctrl );
+
+    const Int k = Z.Width();
+    Matrix<F> X;
+    Identity( X, k, k );
+    Herk( uplo, ADJOINT, Real(-1), Z, Real(1), X );
+    const Real orthError = HermitianFrobeniusNorm( uplo, X );
+    Zeros( X, m, k );
+    Hemm( LEFT, uplo, F(1), AOrig, Z, F(0), X );
+    auto ZW( Z );
+    DiagonalScale( RIGHT, NORMAL, w, ZW );
+    X -= ZW;
+    const Real frobNormA = HermitianFrobeniusNorm( uplo, AOrig );
+    const Real relResidual = FrobeniusNorm( X ) / frobNormA;
+    wOnly -= w;
+    const Real eigvalError = MaxNorm( wOnly ) / frobNormA;
+    cout << "    ||Z^H Z - I||_F  = " << orthError << "\n"
+         << "    ||A Z - Z W||_F / ||A||_F = " << relResidual << "\n"
+         << "    ||w - wOnly||_max / ||A||_F = " << eigvalError << endl;
+
+    const Real tol = 100*m*Epsilon<Real>();
+    if( k != w.Height() || orthError > tol || relResidual > tol || 
+        eigvalError > tol )
+        LogicError("Sequential two-stage HermitianEig was inaccurate");
+}
+
+// Compare subspace iteration over a window of the spectrum against the
+// eigenvalues from the tridiagonal approach. Windows whose bases would be
+// too wide must fall back to the tridiagonal approach.
+template<typename F>
+void TestSubspace
+( UpperOrLower uplo, Int m, const Grid& g,
+  const HermitianEigSubset<Base<F>>& subset, HermitianEigCtrl<F> ctrl,
+  const string& label )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), AOrig(g), Z(g);
+    DistMatrix<Real,VR,STAR> w(g), wFull(g);
+    HermitianUniformSpectrum( A, m, -10, 10 );
+    AOrig = A;
+    HermitianEig( uplo, A, wFull, ASCENDING );
+
+    A = AOrig;
+    ctrl.useSubspace = true;
+    HermitianEig( uplo, A, w, Z, ASCENDING, subset, ctrl );
+    const Int k = w.Height();
+
+    // Find the offset of the window within the full spectrum
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR( w ), wFull_STAR_STAR( wFull );
+    Int offset = 0;
+    if( subset.indexSubset )
+        offset = subset.lowerIndex;
+    else
+        while( offset < m && 
+               wFull_STAR_STAR.GetLocal(offset,0) <= subset.lowerBound )
+            ++offset;
+    Real eigError = 0;
+    for( Int j=0; j<k; ++j )
+        eigError = 
+          Max( eigError, 
+               Abs(w_STAR_STAR.GetLocal(j,0)-
+                   wFull_STAR_STAR.GetLocal(offset+j,0)) );
+
+    DistMatrix<F> X(g);
+    Identity( X, k, k );
+    Herk( LOWER, ADJOINT, Real(-1), Z, Real(1), X );
+    const Real orthError = HermitianFrobeniusNorm( LOWER, X );
+    Zeros( X, m, k );
+    Hemm( LEFT, uplo, F(1), AOrig, Z, F(0), X );
+    DistMatrix<F> ZW( Z );
+    DiagonalScale( RIGHT, NORMAL, w, ZW );
+    X -= ZW;
+    const Real oneNormA = HermitianOneNorm( uplo, AOrig );
+    const Real relResidual = FrobeniusNorm( X ) / oneNormA;
+    if( g.Rank() == 0 )
+        cout << "  " << label << ": " << k << " eigenpairs\n"
+             << "    max eigenvalue error = " << eigError << "\n"
+             << "    ||Z^H Z - I||_F = " << orthError << "\n"
+             << "    ||A Z - Z W||_F / ||A||_1 = " << relResidual << endl;
+
+    const Int expected =
+      ( subset.indexSubset ? subset.upperIndex-subset.lowerIndex+1 : k );
+    const Real tol = Sqrt(Real(k))*m*Epsilon<Real>();
+    if( k != expected || k == 0 || eigError > 100*tol*oneNormA || 
+        orthError > 100*tol || relResidual > 100*tol )
+        LogicError(label,": subspace iteration was inaccurate");
+}
+
+template<typename F>
+void TestSubspaceWindows
+( UpperOrLower uplo, Int m, const Grid& g, const HermitianEigCtrl<F>& ctrl )
+{
+    HermitianEigSubset<Base<F>> subset;
+    subset.indexSubset = true;
+    subset.lowerIndex = 0;
+    subset.upperIndex = m/20;
+    TestSubspace( uplo, m, g, subset, ctrl, "bottom of the spectrum" );
+    subset.lowerIndex = m-1-m/20;
+    subset.upperIndex = m-1;
+    TestSubspace( uplo, m, g, subset, ctrl, "top of the spectrum" );
+    subset.lowerIndex = 0;
+    subset.upperIndex = m/2;
+    TestSubspace( uplo, m, g, subset, ctrl, "wide window" );
+    subset.indexSubset = false;
+    subset.rangeSubset = true;
+    subset.lowerBound = -10;
+    subset.upperBound = -9;
+    TestSubspace( uplo, m, g, subset, ctrl, "range (-10,-9]" );
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -119,6 +243,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int bandwidth =
+          Input("--bandwidth","bandwidth of two-stage reduction",8);
         const bool avoidTrmv = 
             Input("--avoidTrmv","avoid Trmv based Symv",true);
         const bool testCorrectness = Input
@@ -212,6 +338,37 @@ main( int argc, char* argv[] )
             ( testCorrectness, print, onlyEigvals, clustered, 
               uplo, m, sort, g, subset, ctrl_z );
 
+        if( commRank == 0 )
+            cout << "Two-stage tridiag algorithms:" << endl;
+        ctrl_d.tridiagCtrl.twoStage = ctrl_z.tridiagCtrl.twoStage = true;
+        ctrl_d.tridiagCtrl.bandwidth = ctrl_z.tridiagCtrl.bandwidth = bandwidth;
+        if( testReal )
+            TestHermitianEig<double>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset, ctrl_d );
+        if( testCpx )
+            TestHermitianEig<Complex<double>>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset, ctrl_z );
+        if( commRank == 0 )
+        {
+            cout << "Sequential two-stage tridiag algorithms:" << endl;
+            if( testReal )
+                TestSequentialTwoStage<double>
+                ( uplo, m, sort, subset, ctrl_d );
+            if( testCpx )
+                TestSequentialTwoStage<Complex<double>>
+                ( uplo, m, sort, subset, ctrl_z );
+        }
+        ctrl_d.tridiagCtrl.twoStage = ctrl_z.tridiagCtrl.twoStage = false;
+
+        if( commRank == 0 )
+            cout << "Subspace iteration:" << endl;
+        if( testReal )
+            TestSubspaceWindows<double>( uplo, m, g, ctrl_d );
+        if( testCpx )
+            TestSubspaceWindows<Complex<double>>( uplo, m, g, ctrl_z );
+
         // Also test with non-standard distributions
         if( commRank == 0 )
             cout << "Nonstandard distributions:" << endl;
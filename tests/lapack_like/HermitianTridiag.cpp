@@ -16,7 +16,8 @@ void TestCorrectness
   const DistMatrix<F>& A, 
   const DistMatrix<F,STAR,STAR>& t,
         DistMatrix<F>& AOrig,
-  bool print, bool display )
+  bool print, bool display,
+  const herm_tridiag::BulgeChase<F>* chase=nullptr )
 {
     typedef Base<F> Real;
     const Grid& g = A.Grid();
@@ -26,6 +27,15 @@ void TestCorrectness
     if( g.Rank() == 0 )
         cout << "Testing error..." << endl;
 
+    // Two-stage reductions also apply their bulge-chasing reflectors
+    auto applyQ = [&]( LeftOrRight side, Orientation orient, DistMatrix<F>& B )
+    {
+        if( chase == nullptr )
+            herm_tridiag::ApplyQ( side, uplo, orient, A, t, B );
+        else
+            herm_tridiag::ApplyQ( side, uplo, orient, A, t, *chase, B );
+    };
+
     // Grab the diagonal and subdiagonal of the symmetric tridiagonal matrix
     Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
     auto d = GetRealPartOfDiagonal(A);
@@ -51,8 +61,8 @@ void TestCorrectness
         Display( B, "Tridiagonal" );
 
     // Reverse the accumulated Householder transforms, ignoring symmetry
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, t, B );
+    applyQ( LEFT, NORMAL, B );
+    applyQ( RIGHT, ADJOINT, B );
     if( print )
         Print( B, "Rotated tridiagonal" );
     if( display )
@@ -71,13 +81,13 @@ void TestCorrectness
 
     // Compute || I - Q Q^H ||
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, t, B );
+    applyQ( RIGHT, ADJOINT, B );
     DistMatrix<F> QHAdj( g );
     Adjoint( B, QHAdj );
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, B );
+    applyQ( LEFT, NORMAL, B );
     QHAdj -= B;
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, t, B );
+    applyQ( RIGHT, ADJOINT, B );
     ShiftDiagonal( B, F(-1) );
     const Real infNormQError = InfinityNorm( B );
     const Real frobNormQError = FrobeniusNorm( B ); 
@@ -97,7 +107,7 @@ template<typename F>
 void TestHermitianTridiag
 ( UpperOrLower uplo, Int m, const Grid& g, 
   bool testCorrectness, bool print, bool display, 
-  const HermitianTridiagCtrl<F>& ctrl )
+  const HermitianTridiagCtrl<F>& ctrl, bool twoStage=false )
 {
     DistMatrix<F> A(g), AOrig(g);
     DistMatrix<F,STAR,STAR> t(g);
@@ -127,7 +137,11 @@ void TestHermitianTridiag
     }
     mpi::Barrier( g.Comm() );
     const double startTime = mpi::Time();
-    HermitianTridiag( uplo, A, t, ctrl );
+    herm_tridiag::BulgeChase<F> chase;
+    if( twoStage )
+        HermitianTridiag( uplo, A, t, chase, ctrl.bandwidth );
+    else
+        HermitianTridiag( uplo, A, t, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -149,7 +163,8 @@ void TestHermitianTridiag
         Display( t, "t after HermitianTridiag" );
     }
     if( testCorrectness )
-        TestCorrectness( uplo, A, t, AOrig, print, display );
+        TestCorrectness
+        ( uplo, A, t, AOrig, print, display, twoStage ? &chase : nullptr );
 }
 
 int 
@@ -168,6 +183,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int bandwidth =
+          Input("--bandwidth","bandwidth of two-stage reduction",8);
         const bool avoidTrmv = 
             Input("--avoidTrmv","avoid Trmv local Symv",true);
         const bool testCorrectness = Input
@@ -227,6 +244,29 @@ main( int argc, char* argv[] )
         if( testCpx )
             TestHermitianTridiag<Complex<double>>
             ( uplo, m, g, testCorrectness, print, display, ctrl_z );
+
+        // Requesting a two-stage reduction without a BulgeChase falls back
+        // to the one-stage reduction
+        if( commRank == 0 )
+            cout << "Two-stage request through the one-stage interface:" 
+                 << endl;
+        ctrl_d.twoStage = ctrl_z.twoStage = true;
+        ctrl_d.bandwidth = ctrl_z.bandwidth = bandwidth;
+        if( testReal )
+            TestHermitianTridiag<double>
+            ( uplo, m, g, testCorrectness, print, display, ctrl_d );
+        if( testCpx )
+            TestHermitianTridiag<Complex<double>>
+            ( uplo, m, g, testCorrectness, print, display, ctrl_z );
+
+        if( commRank == 0 )
+            cout << "Two-stage algorithm:" << endl;
+        if( testReal )
+            TestHermitianTridiag<double>
+            ( uplo, m, g, testCorrectness, print, display, ctrl_d, true );
+        if( testCpx )
+            TestHermitianTridiag<Complex<double>>
+            ( uplo, m, g, testCorrectness, print, display, ctrl_z, true );
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -65,7 +65,8 @@ void TestCorrectness
 template<typename F,Dist UPerm> 
 void TestLU
 ( Int m, const Grid& g, Int pivoting, 
-  bool testCorrectness, bool forceGrowth, bool print )
+  bool testCorrectness, bool forceGrowth, bool print,
+  bool blockCyclic=false, Int mb=32 )
 {
     DistMatrix<F> A(g), AOrig(g);
     DistMatrix<Int,UPerm,STAR> p(g), q(g);
@@ -96,7 +97,14 @@ void TestLU
     }
     mpi::Barrier( g.Comm() );
     const double startTime = mpi::Time();
-    if( pivoting == 0 )
+    if( blockCyclic )
+    {
+        BlockDistMatrix<F> ABlock( m, m, g, mb, mb );
+        ABlock = A;
+        LU( ABlock, p );
+        A = ABlock;
+    }
+    else if( pivoting == 0 )
         LU( A );
     else if( pivoting == 1 )
         LU( A, p );
@@ -149,6 +157,7 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int mb = Input("--mb","block-cyclic distribution blocksize",32);
         const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
@@ -180,11 +189,21 @@ main( int argc, char* argv[] )
         if( commRank == 0 )
             cout << "Testing with doubles:" << endl;
         TestLU<double,VC>( m, g, pivot, testCorrectness, forceGrowth, print );
+        if( commRank == 0 )
+            cout << "Testing block-cyclic partial pivoting with doubles:" 
+                 << endl;
+        TestLU<double,VC>
+        ( m, g, 1, testCorrectness, forceGrowth, print, true, mb );
 
         if( commRank == 0 )
             cout << "Testing with double-precision complex:" << endl;
         TestLU<Complex<double>,VC>
         ( m, g, pivot, testCorrectness, forceGrowth, print );
+        if( commRank == 0 )
+            cout << "Testing block-cyclic partial pivoting with "
+                    "double-precision complex:" << endl;
+        TestLU<Complex<double>,VC>
+        ( m, g, 1, testCorrectness, forceGrowth, print, true, mb );
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,179 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Check that 'perm' is a permutation which orders the left part, then the
+// right part, and then the separator, and that no edge connects the left and
+// right parts
+void CheckSeparator
+( const vector<Int>& sources, const vector<Int>& targets,
+  const vector<Int>& perm, Int leftSize, Int rightSize, Int sepSize,
+  Int maxSepSize, const string& label )
+{
+    const Int numSources = perm.size();
+    if( leftSize+rightSize+sepSize != numSources )
+        LogicError(label,": the part sizes do not sum to ",numSources);
+    vector<Int> hits( numSources, 0 );
+    for( const Int i : perm )
+    {
+        if( i < 0 || i >= numSources || hits[i]++ != 0 )
+            LogicError(label,": the ordering is not a permutation");
+    }
+    const Int numEdges = sources.size();
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int s = perm[sources[e]];
+        const Int t = perm[targets[e]];
+        if( (s < leftSize && t >= leftSize && t < leftSize+rightSize) ||
+            (t < leftSize && s >= leftSize && s < leftSize+rightSize) )
+            LogicError
+            (label,": edge (",sources[e],",",targets[e],
+             ") connects the two parts");
+    }
+    if( sepSize > maxSepSize )
+        LogicError
+        (label,": the separator had ",sepSize," vertices, but at most ",
+         maxSepSize," were expected");
+    if( Max(leftSize,rightSize) > 3*(numSources-sepSize)/4+1 )
+        LogicError
+        (label,": the parts of sizes ",leftSize," and ",rightSize,
+         " are imbalanced");
+}
+
+// The 7-point stencil over an n x n x n grid
+void GridEdges( Int n, vector<Int>& sources, vector<Int>& targets )
+{
+    sources.resize( 0 );
+    targets.resize( 0 );
+    for( Int i=0; i<n*n*n; ++i )
+    {
+        const Int x = i % n;
+        const Int y = (i/n) % n;
+        const Int z = i/(n*n);
+        const Int neighbors[6] =
+          { x != 0   ? i-1   : -1, x != n-1 ? i+1   : -1,
+            y != 0   ? i-n   : -1, y != n-1 ? i+n   : -1,
+            z != 0   ? i-n*n : -1, z != n-1 ? i+n*n : -1 };
+        for( Int k=0; k<6; ++k )
+        {
+            if( neighbors[k] >= 0 )
+            {
+                sources.push_back( i );
+                targets.push_back( neighbors[k] );
+            }
+        }
+    }
+}
+
+// A star whose last vertex is connected to all of the others, which heavy-edge
+// matching barely coarsens
+void StarEdges( Int numLeaves, vector<Int>& sources, vector<Int>& targets )
+{
+    sources.resize( 0 );
+    targets.resize( 0 );
+    for( Int i=0; i<numLeaves; ++i )
+    {
+        sources.push_back( i );
+        targets.push_back( numLeaves );
+    }
+    for( Int i=0; i<numLeaves; ++i )
+    {
+        sources.push_back( numLeaves );
+        targets.push_back( i );
+    }
+}
+
+void TestGraph
+( Int numSources, const vector<Int>& sources, const vector<Int>& targets,
+  Int maxSepSize, const string& label, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const Int numEdges = sources.size();
+    BisectCtrl ctrl;
+    ctrl.native = true;
+
+    if( commRank == 0 )
+    {
+        Graph graph( numSources );
+        graph.Reserve( numEdges );
+        for( Int e=0; e<numEdges; ++e )
+            graph.QueueConnection( sources[e], targets[e] );
+        graph.ProcessQueues();
+
+        vector<Int> perm;
+        Int leftSize, rightSize;
+        const Int sepSize =
+          MultilevelBisect( graph, perm, leftSize, rightSize, ctrl );
+        cout << "  sequential " << label << ": " << leftSize << ", "
+             << rightSize << ", and " << sepSize << " vertices" << endl;
+        CheckSeparator
+        ( sources, targets, perm, leftSize, rightSize, sepSize, maxSepSize,
+          "Sequential "+label );
+    }
+
+    DistGraph graph( numSources, comm );
+    const Int firstLocal = graph.FirstLocalSource();
+    const Int numLocal = graph.NumLocalSources();
+    graph.Reserve( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+        if( sources[e] >= firstLocal && sources[e] < firstLocal+numLocal )
+            graph.QueueLocalConnection( sources[e]-firstLocal, targets[e] );
+    graph.ProcessQueues();
+
+    DistMap distPerm;
+    Int leftSize, rightSize;
+    const Int sepSize =
+      MultilevelBisect( graph, distPerm, leftSize, rightSize, ctrl );
+
+    // Gather the permutation onto every process
+    vector<int> sizes( commSize ), offs;
+    const int localSize = distPerm.NumLocalSources();
+    mpi::AllGather( &localSize, 1, sizes.data(), 1, comm );
+    Scan( sizes, offs );
+    vector<Int> perm( numSources );
+    mpi::AllGather
+    ( distPerm.Map().data(), localSize,
+      perm.data(), sizes.data(), offs.data(), comm );
+    if( commRank == 0 )
+        cout << "  distributed " << label << ": " << leftSize << ", "
+             << rightSize << ", and " << sepSize << " vertices" << endl;
+    CheckSeparator
+    ( sources, targets, perm, leftSize, rightSize, sepSize, maxSepSize,
+      "Distributed "+label );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of n x n x n grid",20);
+        const Int numLeaves =
+          Input("--numLeaves","number of leaves of the star",30000);
+        ProcessInput();
+        PrintInputReport();
+
+        vector<Int> sources, targets;
+        GridEdges( n, sources, targets );
+        TestGraph( n*n*n, sources, targets, 3*n*n, "grid", comm );
+
+        StarEdges( numLeaves, sources, targets );
+        TestGraph( numLeaves+1, sources, targets, 1, "star", comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Check that A = Q P, where Q has orthonormal columns and P is n x n
+template<typename F,class MatrixType>
+void CheckPolar
+( const MatrixType& A, const MatrixType& Q, const MatrixType& P,
+  Base<F> tol, const string& label, bool print )
+{
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    if( P.Height() != n || P.Width() != n )
+        LogicError
+        (label,": P was ",P.Height()," x ",P.Width()," rather than ",n," x ",n);
+
+    MatrixType E( A );
+    Gemm( NORMAL, NORMAL, F(-1), Q, P, F(1), E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( A );
+
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), E );
+    const Real orthError = HermitianFrobeniusNorm( LOWER, E );
+
+    if( print )
+        cout << "  " << label << ":\n"
+             << "    || A - Q P ||_F / || A ||_F = " << relError << "\n"
+             << "    || Q^H Q - I ||_F = " << orthError << endl;
+    if( relError > tol || orthError > tol )
+        LogicError(label,": the polar decomposition was inaccurate");
+}
+
+template<typename F,class MatrixType>
+void TestGeneral
+( const MatrixType& A, bool qdwh, Base<F> tol, const string& label,
+  bool print )
+{
+    MatrixType Q( A ), P( A );
+    PolarCtrl ctrl;
+    ctrl.qdwh = qdwh;
+    Polar( Q, P, ctrl );
+    if( qdwh && ctrl.numIts == 0 )
+        LogicError(label,": QDWH did not run");
+    CheckPolar<F>
+    ( A, Q, P, tol, label+( qdwh ? " (QDWH)" : " (SVD)" ), print );
+}
+
+template<typename F,class MatrixType>
+void TestHermitian
+( const MatrixType& A, Base<F> tol, const string& label, bool print )
+{
+    MatrixType Q( A ), P( A );
+    PolarCtrl ctrl;
+    ctrl.qdwh = true;
+    HermitianPolar( LOWER, Q, P, ctrl );
+    MakeHermitian( LOWER, P );
+    CheckPolar<F>( A, Q, P, tol, label+" (Hermitian QDWH)", print );
+}
+
+template<typename F>
+void TestPolar( const Grid& g, Int m, Int n, bool print )
+{
+    typedef Base<F> Real;
+    const Real tol = 1000*m*Epsilon<Real>();
+
+    // QDWH only supports square distributed matrices
+    DistMatrix<F> A(g), H(g);
+    Uniform( A, n, n );
+    TestGeneral<F>( A, true, tol, "Distributed", print );
+    TestGeneral<F>( A, false, tol, "Distributed", print );
+    Uniform( H, n, n );
+    MakeHermitian( LOWER, H );
+    TestHermitian<F>( H, tol, "Distributed", print );
+
+    // Every process redundantly checks the same sequential decompositions
+    DistMatrix<F> B(g);
+    Uniform( B, m, n );
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B ),
+                            H_STAR_STAR( H );
+    TestGeneral<F>( A_STAR_STAR.Matrix(), true, tol, "Square", print );
+    TestGeneral<F>( B_STAR_STAR.Matrix(), true, tol, "Tall", print );
+    TestGeneral<F>( B_STAR_STAR.Matrix(), false, tol, "Tall", print );
+    TestHermitian<F>( H_STAR_STAR.Matrix(), tol, "Sequential", print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of tall matrices",60);
+        const Int n = Input("--width","width of matrices",40);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        const bool print = ( commRank == 0 );
+        if( print )
+            cout << "Testing with doubles:" << endl;
+        TestPolar<double>( g, m, n, print );
+        if( print )
+            cout << "Testing with double-precision complex:" << endl;
+        TestPolar<Complex<double>>( g, m, n, print );
+        if( print )
+            cout << "PASSED" << endl;
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// The pseudospectral estimates from implicitly-restarted Arnoldi (IRA),
+// Lanczos, and the power method are compared against the inverses of the
+// smallest singular values of U - z I
+
+template<typename Real>
+void ExactInvNorms
+( const Matrix<Complex<Real>>& U, const Matrix<Complex<Real>>& shifts,
+  Matrix<Real>& invNorms )
+{
+    typedef Complex<Real> C;
+    const Int n = U.Height();
+    const Int numShifts = shifts.Height();
+    invNorms.Resize( numShifts, 1 );
+    Matrix<C> B;
+    Matrix<Real> s;
+    for( Int j=0; j<numShifts; ++j )
+    {
+        B = U;
+        ShiftDiagonal( B, -shifts.Get(j,0) );
+        SVD( B, s );
+        invNorms.Set( j, 0, Real(1)/s.Get(n-1,0) );
+    }
+}
+
+template<typename Real>
+Real MaxRelDiff( const Matrix<Real>& estimates, const Matrix<Real>& exact )
+{
+    Real maxRelDiff = 0;
+    for( Int j=0; j<exact.Height(); ++j )
+        maxRelDiff =
+          Max( maxRelDiff,
+               Abs(estimates.Get(j,0)-exact.Get(j,0))/exact.Get(j,0) );
+    return maxRelDiff;
+}
+
+template<typename Real>
+void TestPseudospectra
+( Int n, Int numShifts, Int basisSize, Real tol, bool print, const Grid& g )
+{
+    typedef Complex<Real> C;
+    const Int commRank = g.Rank();
+
+    DistMatrix<C> U(g);
+    Uniform( U, n, n );
+    MakeTrapezoidal( UPPER, U );
+    DistMatrix<C,VR,STAR> shifts(g);
+    Uniform( shifts, numShifts, 1, C(0), Real(2) );
+    if( print )
+    {
+        Print( U, "U" );
+        Print( shifts, "shifts" );
+    }
+
+    DistMatrix<C,CIRC,CIRC> U_CIRC_CIRC( U ), shifts_CIRC_CIRC( shifts );
+    Matrix<Real> exact;
+    if( commRank == 0 )
+        ExactInvNorms
+        ( U_CIRC_CIRC.Matrix(), shifts_CIRC_CIRC.Matrix(), exact );
+    else
+        Zeros( exact, numShifts, 1 );
+    mpi::Broadcast( exact.Buffer(), numShifts, 0, g.Comm() );
+
+    PseudospecCtrl<Real> psCtrl;
+    psCtrl.tol = Real(1e-10);
+    psCtrl.maxIts = 2000;
+    const char* names[3] = { "IRA", "Lanczos", "power method" };
+    for( Int variant=0; variant<3; ++variant )
+    {
+        psCtrl.arnoldi = ( variant < 2 );
+        psCtrl.basisSize = ( variant == 0 ? basisSize : 1 );
+
+        // Sequential
+        Matrix<Real> invNorms;
+        Matrix<Int> itCounts;
+        Real seqDiff = 0;
+        if( commRank == 0 )
+        {
+            itCounts = TriangularSpectralCloud
+            ( U_CIRC_CIRC.Matrix(), shifts_CIRC_CIRC.Matrix(), invNorms,
+              psCtrl );
+            seqDiff = MaxRelDiff( invNorms, exact );
+            cout << "  sequential " << names[variant]
+                 << ": max relative deviation=" << seqDiff << endl;
+        }
+        // Fail on every process rather than leaving the others waiting in
+        // the distributed computation
+        mpi::Broadcast( seqDiff, 0, g.Comm() );
+        if( seqDiff > tol )
+            LogicError("Sequential ",names[variant]," deviated by ",seqDiff);
+
+        // Distributed
+        DistMatrix<Real,VR,STAR> distInvNorms(g);
+        TriangularSpectralCloud( U, shifts, distInvNorms, psCtrl );
+        DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( distInvNorms );
+        const Real distDiff =
+          MaxRelDiff( invNorms_STAR_STAR.Matrix(), exact );
+        if( commRank == 0 )
+            cout << "  distributed " << names[variant]
+                 << ": max relative deviation=" << distDiff << endl;
+        if( distDiff > tol )
+            LogicError
+            ("Distributed ",names[variant]," deviated by ",distDiff);
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--size","height of matrix",40);
+        const Int numShifts = Input("--numShifts","number of shifts",20);
+        const Int basisSize = Input("--basisSize","num Arnoldi vectors",10);
+        const double tol =
+          Input("--tol","tolerated relative deviation from SVD",1e-3);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestPseudospectra<double>( n, numShifts, basisSize, tol, print, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
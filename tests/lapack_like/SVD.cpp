@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A, const DistMatrix<F>& U,
+  const DistMatrix<Base<F>,VR,STAR>& s, const DistMatrix<F>& V,
+  double tolRatio, const string& label )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int k = s.Height();
+
+    // || U^H U - I ||_F and || V^H V - I ||_F
+    DistMatrix<F> X(g);
+    Identity( X, k, k );
+    Herk( LOWER, ADJOINT, Real(-1), U, Real(1), X );
+    const Real UOrthError = HermitianFrobeniusNorm( LOWER, X );
+    Identity( X, k, k );
+    Herk( LOWER, ADJOINT, Real(-1), V, Real(1), X );
+    const Real VOrthError = HermitianFrobeniusNorm( LOWER, X );
+
+    // || A - U diag(s) V^H ||_F / || A ||_F
+    auto US( U );
+    DiagonalScale( RIGHT, NORMAL, s, US );
+    X = A;
+    Gemm( NORMAL, ADJOINT, F(-1), US, V, F(1), X );
+    const Real frobNormA = FrobeniusNorm( A );
+    const Real relError = FrobeniusNorm( X ) / frobNormA;
+
+    if( g.Rank() == 0 )
+        cout << "  " << label << ":\n"
+             << "    || U^H U - I ||_F = " << UOrthError << "\n"
+             << "    || V^H V - I ||_F = " << VOrthError << "\n"
+             << "    || A - U S V^H ||_F / || A ||_F = " << relError << endl;
+    const Real tol = tolRatio*Max(A.Height(),A.Width())*Epsilon<Real>();
+    if( UOrthError > tol || VOrthError > tol || relError > tol )
+        LogicError(label,": the SVD was inaccurate");
+}
+
+template<typename F>
+void TestSVD( Int m, Int n, Int rank, const Grid& g, double tolRatio )
+{
+    DistMatrix<F> A(g);
+    if( rank < Min(m,n) )
+    {
+        // A low-rank matrix has a cluster of (numerically) zero singular
+        // values, whose Golub-Kahan eigenvectors do not split
+        DistMatrix<F> X(g), Y(g);
+        Uniform( X, m, rank );
+        Uniform( Y, n, rank );
+        Zeros( A, m, n );
+        Gemm( NORMAL, ADJOINT, F(1), X, Y, F(0), A );
+    }
+    else
+        Uniform( A, m, n );
+
+    DistMatrix<F> U( A ), V(g);
+    DistMatrix<Base<F>,VR,STAR> s(g);
+    SVD( U, s, V );
+
+    ostringstream label;
+    label << m << " x " << n << " matrix of rank " << Min(rank,Min(m,n));
+    TestCorrectness( A, U, s, V, tolRatio, label.str() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",80);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const double tolRatio =
+          Input("--tolRatio","tolerated error over max(m,n) eps",100.);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestSVD<double>( m, n, n, g, tolRatio );
+        TestSVD<double>( n, m, n, g, tolRatio );
+        TestSVD<double>( m, n, n/4, g, tolRatio );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestSVD<Complex<double>>( m, n, n, g, tolRatio );
+        TestSVD<Complex<double>>( n, m, n, g, tolRatio );
+        TestSVD<Complex<double>>( m, n, n/4, g, tolRatio );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
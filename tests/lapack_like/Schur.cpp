@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Real Schur forms are quasi-triangular, with 2 x 2 diagonal blocks for the
+// complex conjugate pairs of eigenvalues, while complex Schur forms are
+// upper triangular
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A, const DistMatrix<F>& T, const DistMatrix<F>& Q,
+  const AbstractDistMatrix<Complex<Base<F>>>& w, double tolRatio,
+  const string& label )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+
+    DistMatrix<F,STAR,STAR> T_STAR_STAR( T );
+    const Matrix<F>& TLoc = T_STAR_STAR.Matrix();
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=j+1; i<n; ++i )
+        {
+            if( TLoc.Get(i,j) == F(0) )
+                continue;
+            if( IsComplex<F>::val || i > j+1 )
+                LogicError(label,": T(",i,",",j,") was nonzero");
+            if( j > 0 && TLoc.Get(j,j-1) != F(0) )
+                LogicError(label,": consecutive nonzero subdiagonal entries");
+        }
+    }
+
+    // || Q^H Q - I ||_F
+    DistMatrix<F> X(g);
+    Identity( X, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), X );
+    const Real orthError = HermitianFrobeniusNorm( LOWER, X );
+
+    // || A - Q T Q^H ||_F / || A ||_F
+    DistMatrix<F> QT(g);
+    Zeros( QT, n, n );
+    Gemm( NORMAL, NORMAL, F(1), Q, T, F(0), QT );
+    X = A;
+    Gemm( NORMAL, ADJOINT, F(-1), QT, Q, F(1), X );
+    const Real frobNormA = FrobeniusNorm( A );
+    const Real relError = FrobeniusNorm( X ) / frobNormA;
+
+    // The eigenvalues must sum to the trace of A
+    DistMatrix<Complex<Real>,STAR,STAR> w_STAR_STAR( w );
+    Complex<Real> traceError = 0;
+    for( Int i=0; i<n; ++i )
+        traceError += w_STAR_STAR.GetLocal(i,0) - A.Get(i,i);
+    const Real relTraceError = Abs(traceError) / frobNormA;
+
+    if( g.Rank() == 0 )
+        cout << "  " << label << ":\n"
+             << "    || Q^H Q - I ||_F = " << orthError << "\n"
+             << "    || A - Q T Q^H ||_F / || A ||_F = " << relError << "\n"
+             << "    | sum(w) - tr(A) | / || A ||_F = " << relTraceError
+             << endl;
+    const Real tol = tolRatio*n*Epsilon<Real>();
+    if( orthError > tol || relError > tol || relTraceError > tol )
+        LogicError(label,": the Schur decomposition was inaccurate");
+}
+
+template<typename F>
+void TestSchur
+( Int n, const Grid& g, const SchurCtrl<Base<F>>& ctrl, double tolRatio,
+  const string& label )
+{
+    DistMatrix<F> A(g);
+    Gaussian( A, n, n );
+
+    DistMatrix<F> T( A ), Q(g);
+    DistMatrix<Complex<Base<F>>,VR,STAR> w(g);
+    Schur( T, w, Q, true, ctrl );
+    TestCorrectness( A, T, Q, w, tolRatio, label );
+}
+
+template<typename F>
+void TestBlockSchur
+( Int n, Int mb, const Grid& g, const SchurCtrl<Base<F>>& ctrl,
+  double tolRatio, const string& label )
+{
+    DistMatrix<F> A(g);
+    Gaussian( A, n, n );
+
+    BlockDistMatrix<F> TBlock( n, n, g, mb, mb ), QBlock( n, n, g, mb, mb );
+    TBlock = A;
+    DistMatrix<Complex<Base<F>>,VR,STAR> w(g);
+    Schur( TBlock, w, QBlock, true, ctrl );
+    DistMatrix<F> T( TBlock ), Q( QBlock );
+    TestCorrectness( A, T, Q, w, tolRatio, label );
+}
+
+template<typename F>
+void TestAll
+( Int n, Int mb, const Grid& g, const SchurCtrl<Base<F>>& ctrlOrig,
+  double tolRatio )
+{
+    auto ctrl = ctrlOrig;
+    TestSchur<F>( n, g, ctrl, tolRatio, "multishift QR" );
+    ctrl.qrCtrl.distAED = true;
+    TestSchur<F>( n, g, ctrl, tolRatio, "multishift QR with distributed AED" );
+    ctrl.qrCtrl.distAED = false;
+    ctrl.qrCtrl.minMultishiftSize = n;
+    TestSchur<F>( n, g, ctrl, tolRatio, "redundant QR" );
+    TestBlockSchur<F>
+    ( n, mb, g, ctrlOrig, tolRatio, "block-cyclic multishift QR" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--size","height of matrix",200);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const Int mb = Input("--mb","block-cyclic distribution blocksize",32);
+        const Int minMultishiftSize =
+          Input("--minMultishiftSize","smallest multishift block",75);
+        const double tolRatio =
+          Input("--tolRatio","tolerated error over n eps",100.);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        SchurCtrl<double> ctrl;
+        ctrl.qrCtrl.minMultishiftSize = minMultishiftSize;
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestAll<double>( n, mb, g, ctrl, tolRatio );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestAll<Complex<double>>( n, mb, g, ctrl, tolRatio );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Form S diag(d) inv(S)
+template<typename F>
+void Similarity
+( const DistMatrix<F>& S, const DistMatrix<F>& SInv, const DistMatrix<F>& d,
+  DistMatrix<F>& A )
+{
+    DistMatrix<F> SD( S );
+    DiagonalScale( RIGHT, NORMAL, d, SD );
+    Gemm( NORMAL, NORMAL, F(1), SD, SInv, A );
+}
+
+// Check that X is an involution which matches sign(A) = XExact and that
+// N = X A matches NExact
+template<typename F,class MatrixType>
+void CheckSign
+( const MatrixType& X, const MatrixType& XExact,
+  const MatrixType& N, const MatrixType& NExact,
+  Base<F> tol, const string& label, bool print )
+{
+    typedef Base<F> Real;
+    const Int n = X.Height();
+    MatrixType E( X );
+    Identity( E, n, n );
+    Gemm( NORMAL, NORMAL, F(1), X, X, F(-1), E );
+    const Real invError = FrobeniusNorm( E );
+
+    E = X;
+    Axpy( F(-1), XExact, E );
+    const Real signError = FrobeniusNorm( E ) / FrobeniusNorm( XExact );
+
+    E = N;
+    Axpy( F(-1), NExact, E );
+    const Real NError = FrobeniusNorm( E ) / FrobeniusNorm( NExact );
+
+    if( print )
+        cout << "  " << label << ":\n"
+             << "    || sign(A)^2 - I ||_F = " << invError << "\n"
+             << "    || sign(A) - S sign(D) inv(S) ||_F / || sign(A) ||_F = "
+             << signError << "\n"
+             << "    || N - S |D| inv(S) ||_F / || N ||_F = " << NError
+             << endl;
+    if( invError > tol || signError > tol || NError > tol )
+        LogicError(label,": the matrix sign function was inaccurate");
+}
+
+template<typename F,class MatrixType>
+void TestNewton
+( const MatrixType& A, const MatrixType& XExact, const MatrixType& NExact,
+  bool newtonSchulz, Base<F> tol, const string& label, bool print )
+{
+    SignCtrl<Base<F>> ctrl;
+    ctrl.newtonSchulz = newtonSchulz;
+    MatrixType X( A ), N( A );
+    Sign( X, N, ctrl );
+    CheckSign<F>
+    ( X, XExact, N, NExact, tol,
+      label+( newtonSchulz ? " (Newton-Schulz)" : " (Newton)" ), print );
+}
+
+template<typename F>
+void TestSign( const Grid& g, Int n, bool print )
+{
+    typedef Base<F> Real;
+    const Real tol = 1000*n*Epsilon<Real>();
+
+    // A = S D inv(S), where S is a well-conditioned perturbation of the
+    // identity and D has eigenvalues of both signs bounded away from zero
+    DistMatrix<F> S(g), SInv(g), d(g), dSign(g), dAbs(g);
+    Uniform( S, n, n );
+    S *= F(Real(1)/10);
+    ShiftDiagonal( S, F(1) );
+    SInv = S;
+    Inverse( SInv );
+    Zeros( d, n, 1 );
+    Zeros( dSign, n, 1 );
+    Zeros( dAbs, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        const Real sgn = ( j % 3 == 0 ? Real(-1) : Real(1) );
+        const Real magnitude = Real(1) + Real(10*j)/n;
+        d.Set( j, 0, sgn*magnitude );
+        dSign.Set( j, 0, sgn );
+        dAbs.Set( j, 0, magnitude );
+    }
+    DistMatrix<F> A(g), XExact(g), NExact(g);
+    Similarity( S, SInv, d, A );
+    Similarity( S, SInv, dSign, XExact );
+    Similarity( S, SInv, dAbs, NExact );
+
+    TestNewton<F>( A, XExact, NExact, false, tol, "Distributed", print );
+    TestNewton<F>( A, XExact, NExact, true, tol, "Distributed", print );
+
+    // Every process redundantly checks the same sequential iterations
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), XExact_STAR_STAR( XExact ),
+                            NExact_STAR_STAR( NExact );
+    TestNewton<F>
+    ( A_STAR_STAR.Matrix(), XExact_STAR_STAR.Matrix(),
+      NExact_STAR_STAR.Matrix(), false, tol, "Sequential", print );
+    TestNewton<F>
+    ( A_STAR_STAR.Matrix(), XExact_STAR_STAR.Matrix(),
+      NExact_STAR_STAR.Matrix(), true, tol, "Sequential", print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--size","size of matrices",40);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        const bool print = ( commRank == 0 );
+        if( print )
+            cout << "Testing with doubles:" << endl;
+        TestSign<double>( g, n, print );
+        if( print )
+            cout << "Testing with double-precision complex:" << endl;
+        TestSign<Complex<double>>( g, n, print );
+        if( print )
+            cout << "PASSED" << endl;
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
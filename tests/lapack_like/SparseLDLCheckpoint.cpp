@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+bool FileExists( const string& filename )
+{
+    ifstream file( filename.c_str() );
+    return file.is_open();
+}
+
+// Factor A with the given analysis and solve against Y
+void FactorAndSolve
+( const DistSparseMatrix<double>& A, const DistMap& map,
+  const ldl::DistSeparator& sep, const ldl::DistNodeInfo& info,
+  DistMultiVec<double>& Y )
+{
+    DistMap invMap;
+    InvertMap( map, invMap );
+    ldl::DistFront<double> front( A, map, sep, info );
+    LDL( info, front, LDL_2D );
+    ldl::SolveAfter( invMap, info, front, Y );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of n x n x n grid",12);
+        const string basename =
+          Input("--basename","basename of the checkpoint","LDLAnalysis");
+        ProcessInput();
+        PrintInputReport();
+
+        DistSparseMatrix<double> A(comm);
+        Laplacian( A, n, n, n );
+        A *= -1;
+        DistMap map;
+        ldl::DistSeparator sep;
+        ldl::DistNodeInfo info;
+        ldl::NestedDissection( A.DistGraph(), map, sep, info );
+
+        // The checkpoint is renamed from its temporary file once written
+        ldl::SaveAnalysis( basename, map, sep, info );
+        const string filename = checkpoint::Filename( basename, comm );
+        const Int missing =
+          ( !FileExists(filename) || FileExists(filename+".tmp") );
+        if( mpi::AllReduce( missing, mpi::MAX, comm ) != 0 )
+            LogicError("The analysis checkpoint was not renamed into place");
+
+        DistMap mapLoaded;
+        ldl::DistSeparator sepLoaded;
+        ldl::DistNodeInfo infoLoaded;
+        ldl::LoadAnalysis
+        ( basename, comm, mapLoaded, sepLoaded, infoLoaded );
+        const Int mapDiffers =
+          ( mapLoaded.NumSources() != map.NumSources() ||
+            mapLoaded.Map() != map.Map() );
+        if( mpi::AllReduce( mapDiffers, mpi::MAX, comm ) != 0 )
+            LogicError("The loaded reordering differed from the saved one");
+        if( infoLoaded.size != info.size || infoLoaded.off != info.off ||
+            infoLoaded.lowerStruct != info.lowerStruct )
+            LogicError("The loaded root separator differed from the saved one");
+        if( commRank == 0 )
+            cout << "Loaded a root separator of size " << infoLoaded.size
+                 << endl;
+
+        // Factorizations from the original and loaded analyses should agree
+        const Int N = A.Height();
+        DistMultiVec<double> X(comm), Y(comm), YLoaded(comm);
+        Uniform( X, N, 2 );
+        Zeros( Y, N, 2 );
+        Multiply( NORMAL, 1., A, X, 0., Y );
+        YLoaded = Y;
+        FactorAndSolve( A, map, sep, info, Y );
+        FactorAndSolve( A, mapLoaded, sepLoaded, infoLoaded, YLoaded );
+        Axpy( -1., Y, YLoaded );
+        const double solveDiff = FrobeniusNorm( YLoaded )/FrobeniusNorm( Y );
+        Axpy( -1., X, Y );
+        const double relError = FrobeniusNorm( Y )/FrobeniusNorm( X );
+        if( commRank == 0 )
+            cout << "Relative error=" << relError
+                 << ", relative difference of the solves=" << solveDiff
+                 << endl;
+        if( relError > 1e-8 || solveDiff > 1e-12 )
+            LogicError("The solve with the loaded analysis was inaccurate");
+
+        // A checkpoint may not be loaded by a different number of processes
+        if( commSize > 1 )
+        {
+            bool threw = false;
+            try
+            {
+                ldl::LoadAnalysis
+                ( basename, mpi::COMM_SELF, mapLoaded, sepLoaded, infoLoaded );
+            }
+            catch( std::exception& e ) { threw = true; }
+            if( !threw )
+                LogicError("Loading with the wrong number of processes worked");
+        }
+
+        std::remove( filename.c_str() );
+        if( commRank == 0 )
+            cout << "PASSED" << endl;
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
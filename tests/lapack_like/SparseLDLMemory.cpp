@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// The memory predictions are estimates (they ignore allocator overhead and
+// small metadata), so they are compared against the entries which are
+// actually stored in the fronts to within a relative tolerance. The budgeted
+// factorizations must either stream their fronts and still solve accurately
+// or refuse to start.
+
+void CheckPrediction
+( const ldl::FactorMemory& pred, double initialBytes, double factorBytes,
+  double tol, const string& label )
+{
+    if( pred.initial > pred.factor || pred.factor > pred.peak ||
+        pred.streamedPeak > pred.peak || pred.update <= 0 )
+        LogicError(label,": the predictions were inconsistent");
+    const double initialDiff = Abs(pred.initial-initialBytes)/initialBytes;
+    if( initialDiff > tol )
+        LogicError
+        (label,": predicted ",pred.initial," bytes of unfactored fronts, but ",
+         initialBytes," were stored");
+    // The factored bytes do not include the diagonals
+    const double factorDiff = (pred.factor-factorBytes)/factorBytes;
+    if( factorDiff < 0 || factorDiff > tol )
+        LogicError
+        (label,": predicted ",pred.factor," bytes of factored fronts, but ",
+         factorBytes," were stored");
+}
+
+void TestSequential( Int n, double tol )
+{
+    SparseMatrix<double> A;
+    Laplacian( A, n, n, n );
+    A *= -1;
+    vector<Int> map, invMap;
+    ldl::Separator sep;
+    ldl::NodeInfo info;
+    ldl::NaturalNestedDissection( n, n, n, A.Graph(), map, sep, info );
+    InvertMap( map, invMap );
+
+    const auto pred = ldl::PredictMemory<double>( info, LDL_1D );
+    cout << "  sequential: initial=" << pred.initial
+         << ", factor=" << pred.factor << ", peak=" << pred.peak
+         << ", streamed peak=" << pred.streamedPeak << endl;
+
+    ldl::Front<double> front( A, map, info );
+    const double initialBytes = front.NumEntries()*sizeof(double);
+    LDL( info, front, LDL_1D );
+    const double factorBytes = front.NumEntries()*sizeof(double);
+    CheckPrediction( pred, initialBytes, factorBytes, tol, "Sequential" );
+
+    // A budget which requires streaming
+    ldl::FactorMemoryCtrl ctrl;
+    ctrl.budget = (pred.streamedPeak+pred.peak)/2;
+    front.Pull( A, map, info );
+    LDL( info, front, LDL_1D, ctrl );
+    const Int N = A.Height();
+    Matrix<double> X, Y;
+    Uniform( X, N, 1 );
+    Zeros( Y, N, 1 );
+    Multiply( NORMAL, 1., A, X, 0., Y );
+    ldl::SolveAfter( invMap, info, front, Y );
+    Y -= X;
+    const double relError = FrobeniusNorm( Y ) / FrobeniusNorm( X );
+    cout << "  sequential streamed solve: relative error=" << relError << endl;
+    if( relError > 1e-8 )
+        LogicError("Streamed sequential solve had relative error ",relError);
+
+    // A budget which cannot be met
+    ctrl.budget = pred.streamedPeak/2;
+    front.Pull( A, map, info );
+    bool threw = false;
+    try { LDL( info, front, LDL_1D, ctrl ); }
+    catch( exception& e ) { threw = true; }
+    if( !threw )
+        LogicError("An insufficient budget was not detected");
+}
+
+void TestDistributed( Int n, double tol, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    DistSparseMatrix<double> A(comm);
+    Laplacian( A, n, n, n );
+    A *= -1;
+    ldl::DistNodeInfo info;
+    ldl::DistSeparator sep;
+    DistMap map, invMap;
+    ldl::NaturalNestedDissection( n, n, n, A.DistGraph(), map, sep, info );
+    InvertMap( map, invMap );
+
+    const auto pred = ldl::PredictMemory<double>( info, LDL_2D );
+    ldl::DistFront<double> front( A, map, sep, info );
+    const double initialBytes = front.NumLocalEntries()*sizeof(double);
+    LDL( info, front, LDL_2D );
+    const double factorBytes = front.NumLocalEntries()*sizeof(double);
+    const double maxPeak = mpi::AllReduce( pred.peak, mpi::MAX, comm );
+    if( commRank == 0 )
+        cout << "  distributed: max peak=" << maxPeak << endl;
+    CheckPrediction( pred, initialBytes, factorBytes, tol, "Distributed" );
+
+    ldl::FactorMemoryCtrl ctrl;
+    const double maxStreamedPeak =
+      mpi::AllReduce( pred.streamedPeak, mpi::MAX, comm );
+    ctrl.budget = maxStreamedPeak/2;
+    front.Pull( A, map, sep, info );
+    bool threw = false;
+    try { LDL( info, front, LDL_2D, ctrl ); }
+    catch( exception& e ) { threw = true; }
+    if( !threw )
+        LogicError("An insufficient budget was not detected");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of n x n x n grid",16);
+        const double tol =
+          Input("--tol","tolerated relative deviation of predictions",0.1);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+            TestSequential( n, tol );
+        TestDistributed( n, tol, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
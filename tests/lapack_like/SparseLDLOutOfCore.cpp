@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Several out-of-core factorizations are kept alive at once: two sequential
+// factorizations on every process (which all share the default scratch
+// basename) and a distributed factorization. Since each keeps its fronts in
+// its own scratch file, every solve must be as accurate as an in-core solve.
+
+struct SeqProblem
+{
+    SparseMatrix<double> A;
+    vector<Int> map, invMap;
+    ldl::Separator sep;
+    ldl::NodeInfo info;
+    ldl::Front<double> front;
+};
+
+void SetupSequential
+( SeqProblem& prob, Int n, double scale, const ldl::FactorMemoryCtrl& ctrl )
+{
+    Laplacian( prob.A, n, n, n );
+    prob.A *= -scale;
+    ldl::NaturalNestedDissection
+    ( n, n, n, prob.A.Graph(), prob.map, prob.sep, prob.info );
+    InvertMap( prob.map, prob.invMap );
+    prob.front.Pull( prob.A, prob.map, prob.info );
+    LDL( prob.info, prob.front, LDL_1D, ctrl );
+}
+
+double SolveError( const SeqProblem& prob, Int numRHS )
+{
+    const Int N = prob.A.Height();
+    Matrix<double> X, Y;
+    Uniform( X, N, numRHS );
+    Zeros( Y, N, numRHS );
+    Multiply( NORMAL, 1., prob.A, X, 0., Y );
+    ldl::SolveAfter( prob.invMap, prob.info, prob.front, Y );
+    Y -= X;
+    return FrobeniusNorm( Y ) / FrobeniusNorm( X );
+}
+
+double SolveError
+( const DistSparseMatrix<double>& A, const DistMap& invMap,
+  const ldl::DistNodeInfo& info, const ldl::DistFront<double>& front,
+  Int numRHS )
+{
+    const Int N = A.Height();
+    DistMultiVec<double> X( N, numRHS, A.Comm() ), Y( N, numRHS, A.Comm() );
+    MakeUniform( X );
+    Zero( Y );
+    Multiply( NORMAL, 1., A, X, 0., Y );
+    ldl::SolveAfter( invMap, info, front, Y );
+    Y -= X;
+    return FrobeniusNorm( Y ) / FrobeniusNorm( X );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of n x n x n grid",12);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const double tol = Input("--tol","tolerated relative error",1e-8);
+        ProcessInput();
+        PrintInputReport();
+
+        ldl::FactorMemoryCtrl ctrl;
+        ctrl.outOfCore = true;
+
+        // Both sequential factorizations are complete before either is used
+        SeqProblem first, second;
+        SetupSequential( first, n, 1., ctrl );
+        SetupSequential( second, n+1, 2., ctrl );
+
+        DistSparseMatrix<double> A(comm);
+        Laplacian( A, n, n, n );
+        A *= -3;
+        ldl::DistNodeInfo info;
+        ldl::DistSeparator sep;
+        DistMap map, invMap;
+        ldl::NaturalNestedDissection( n, n, n, A.DistGraph(), map, sep, info );
+        InvertMap( map, invMap );
+        ldl::DistFront<double> front( A, map, sep, info );
+        LDL( info, front, LDL_1D, ctrl );
+
+        // Alternate between the factorizations
+        for( Int pass=0; pass<2; ++pass )
+        {
+            const double errors[3] =
+              { SolveError( first, numRHS ),
+                SolveError( second, numRHS ),
+                SolveError( A, invMap, info, front, numRHS ) };
+            const char* names[3] =
+              { "first sequential", "second sequential", "distributed" };
+            for( Int k=0; k<3; ++k )
+            {
+                const double maxError =
+                  mpi::AllReduce( errors[k], mpi::MAX, comm );
+                if( commRank == 0 )
+                    cout << "  pass " << pass << ", " << names[k]
+                         << " factorization: relative error=" << maxError
+                         << endl;
+                if( maxError > tol )
+                    LogicError
+                    ("Relative error of the ",names[k]," factorization was ",
+                     maxError);
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Selective inversion should never be chosen when messages are free, should
+// pay off immediately when they are arbitrarily expensive, and the predicted
+// break-even point should be identical on every process, nonincreasing in
+// the message latency, and either -1 or positive (even when the savings are
+// arbitrarily small). Factorizations using the policy must still solve
+// accurately.
+
+Int CheckedBreakEven
+( const ldl::DistNodeInfo& info, const ldl::SelInvCtrl& ctrl )
+{
+    const Int breakEven = ldl::SelInvBreakEven( info, ctrl );
+    if( breakEven == 0 || breakEven < -1 )
+        LogicError("Invalid break-even point of ",breakEven);
+    if( mpi::AllReduce( breakEven, mpi::MIN, info.comm ) !=
+        mpi::AllReduce( breakEven, mpi::MAX, info.comm ) )
+        LogicError("The break-even points differed between processes");
+    return breakEven;
+}
+
+void TestPolicy( const ldl::DistNodeInfo& info, Int numRHS )
+{
+    const int commRank = mpi::Rank( info.comm );
+    const bool distributed = ( info.child != nullptr );
+    ldl::SelInvCtrl ctrl;
+    ctrl.numRHS = numRHS;
+
+    ctrl.latencyFlops = 0;
+    if( CheckedBreakEven( info, ctrl ) != -1 ||
+        ldl::SelInvFrontType( info, LDL_1D, ctrl ) != LDL_1D )
+        LogicError("Selective inversion was chosen with free messages");
+
+    ctrl.latencyFlops = 1e30;
+    const Int expensive = CheckedBreakEven( info, ctrl );
+    if( commRank == 0 )
+        cout << "  break-even with expensive messages: " << expensive << endl;
+    if( expensive != ( distributed ? 1 : -1 ) )
+        LogicError("Unexpected break-even point of ",expensive);
+    if( distributed &&
+        ( ldl::SelInvFrontType( info, LDL_1D, ctrl ) != LDL_SELINV_1D ||
+          ldl::SelInvFrontType( info, LDL_INTRAPIV_2D, ctrl ) !=
+          LDL_INTRAPIV_SELINV_2D ) )
+        LogicError("Selective inversion was not chosen");
+    if( ldl::SelInvFrontType( info, LDL_SELINV_2D, ctrl ) != LDL_SELINV_2D ||
+        ldl::SelInvFrontType( info, BLOCK_LDL_2D, ctrl ) != BLOCK_LDL_2D )
+        LogicError("SelInvFrontType modified an incompatible front type");
+    if( !distributed )
+        return;
+
+    // Bisect for the latency at which the savings become positive, as the
+    // break-even point grows without bound as it is approached from above
+    double lower = 0, upper = 1e30;
+    Int lastBreakEven = expensive;
+    for( Int it=0; it<200; ++it )
+    {
+        ctrl.latencyFlops = (lower+upper)/2;
+        const Int breakEven = CheckedBreakEven( info, ctrl );
+        if( breakEven == -1 )
+            lower = ctrl.latencyFlops;
+        else
+        {
+            if( breakEven < lastBreakEven )
+                LogicError("The break-even point decreased with the latency");
+            lastBreakEven = breakEven;
+            upper = ctrl.latencyFlops;
+        }
+    }
+    if( commRank == 0 )
+        cout << "  savings begin at a latency of " << upper << " flops, with a "
+             << "break-even point of " << lastBreakEven << endl;
+}
+
+void TestSolve
+( const DistSparseMatrix<double>& A, const DistMap& map, const DistMap& invMap,
+  const ldl::DistSeparator& sep, const ldl::DistNodeInfo& info,
+  LDLFrontType type, Int numRHS, double tol )
+{
+    const int commRank = mpi::Rank( A.Comm() );
+    const bool distributed = ( info.child != nullptr );
+    ldl::SelInvCtrl ctrl;
+    ctrl.numSolves = 10;
+    ctrl.numRHS = numRHS;
+    ctrl.latencyFlops = 1e30;
+
+    ldl::DistFront<double> front( A, map, sep, info );
+    LDL( info, front, type, ctrl );
+    const LDLFrontType expected = ( distributed ? AppendSelInv(type) : type );
+    if( front.type != expected )
+        LogicError("The factored front type was ",Int(front.type));
+
+    DistMultiVec<double> X(A.Comm()), Y(A.Comm());
+    Uniform( X, A.Height(), numRHS );
+    Zeros( Y, A.Height(), numRHS );
+    Multiply( NORMAL, 1., A, X, 0., Y );
+    ldl::SolveAfter( invMap, info, front, Y );
+    Y -= X;
+    const double relError = FrobeniusNorm( Y ) / FrobeniusNorm( X );
+    if( commRank == 0 )
+        cout << "  front type " << Int(front.type) << ": relative error="
+             << relError << endl;
+    if( relError > tol )
+        LogicError("Solve after selective inversion had error ",relError);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of n x n x n grid",16);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",4);
+        const double tol = Input("--tol","tolerated relative error",1e-8);
+        ProcessInput();
+        PrintInputReport();
+
+        DistSparseMatrix<double> A(comm);
+        Laplacian( A, n, n, n );
+        A *= -1;
+        ldl::DistNodeInfo info;
+        ldl::DistSeparator sep;
+        DistMap map, invMap;
+        ldl::NaturalNestedDissection( n, n, n, A.DistGraph(), map, sep, info );
+        InvertMap( map, invMap );
+
+        TestPolicy( info, numRHS );
+        TestSolve( A, map, invMap, sep, info, LDL_1D, numRHS, tol );
+        TestSolve( A, map, invMap, sep, info, LDL_INTRAPIV_2D, numRHS, tol );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
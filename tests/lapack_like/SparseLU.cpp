@@ -0,0 +1,221 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Row i of a central-difference discretization of the 2D convection-diffusion
+// operator -Laplacian(u) + beta . grad(u) on an nx x ny grid. If 'tinyPivot'
+// is nonzero, the operator is instead a weak multiple of its off-diagonal
+// coupling added to 2 x 2 rotations between the pairs of unknowns (2k,2k+1),
+// with every diagonal entry equal to 'tinyPivot'. Such a matrix is well
+// conditioned, but the first pivot of every leaf front is tiny.
+template<class QueueFunc>
+void QueueRow
+( Int i, Int nx, Int ny, double beta, double tinyPivot, QueueFunc queue )
+{
+    const Int n = nx*ny;
+    const Int x = i % nx;
+    const Int y = i / nx;
+    const double hInv = nx+1;
+    double diffusion = hInv*hInv;
+    double convection = beta*hInv/2;
+    if( tinyPivot != 0. )
+    {
+        const double scale = 0.02/diffusion;
+        diffusion *= scale;
+        convection *= scale;
+        // An unpaired last unknown is given a unit diagonal
+        const Int partner = ( i % 2 == 0 ? i+1 : i-1 );
+        if( partner < n )
+        {
+            queue( i, i, tinyPivot );
+            queue( i, partner, ( i % 2 == 0 ? 1. : -1. ) );
+        }
+        else
+            queue( i, i, 1. );
+    }
+    else
+        queue( i, i, 4*diffusion );
+    if( x != 0 )
+        queue( i, i-1, -diffusion-convection );
+    if( x != nx-1 )
+        queue( i, i+1, -diffusion+convection );
+    if( y != 0 )
+        queue( i, i-nx, -diffusion-convection );
+    if( y != ny-1 )
+        queue( i, i+nx, -diffusion+convection );
+}
+
+void Generate
+( SparseMatrix<double>& A, Int nx, Int ny, double beta, double tinyPivot )
+{
+    const Int n = nx*ny;
+    Zeros( A, n, n );
+    A.Reserve( 6*n );
+    auto queue = [&]( Int i, Int j, double value )
+                 { A.QueueUpdate( i, j, value ); };
+    for( Int i=0; i<n; ++i )
+        QueueRow( i, nx, ny, beta, tinyPivot, queue );
+    A.ProcessQueues();
+}
+
+void Generate
+( DistSparseMatrix<double>& A, Int nx, Int ny, double beta, double tinyPivot )
+{
+    const Int n = nx*ny;
+    Zeros( A, n, n );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 6*localHeight );
+    auto queue = [&]( Int i, Int j, double value )
+                 { A.QueueLocalUpdate( i-firstLocalRow, j, value ); };
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        QueueRow( firstLocalRow+iLoc, nx, ny, beta, tinyPivot, queue );
+    A.ProcessLocalQueues();
+}
+
+// Every process factors and solves the same sequential system (with its own
+// right-hand sides) so that a failure on any process is seen by all of them
+void TestSequential
+( mpi::Comm comm, Int nx, Int ny, double beta, double tinyPivot,
+  Int numRHS, double tol, const string& label )
+{
+    const bool print = ( mpi::Rank(comm) == 0 );
+    SparseMatrix<double> A;
+    Generate( A, nx, ny, beta, tinyPivot );
+    const Int n = A.Height();
+
+    // The pattern of A is symmetric, so its graph can be reordered directly
+    ldl::NodeInfo info;
+    ldl::Separator rootSep;
+    vector<Int> map, invMap;
+    ldl::NestedDissection( A.Graph(), map, rootSep, info );
+    InvertMap( map, invMap );
+    ldl::Front<double> L, U;
+    lu::Pull( A, map, info, L, U );
+    LUStaticPivotCtrl<double> ctrl;
+    const Int numReplaced = LU( info, L, U, ctrl );
+
+    Matrix<double> X, Y;
+    Uniform( X, n, numRHS );
+    Zeros( Y, n, numRHS );
+    Multiply( NORMAL, 1., A, X, 0., Y );
+    const Int numRefineIts = lu::SolveWithIterativeRefinement
+      ( A, invMap, info, L, U, Y, ctrl.minReductionFactor, ctrl.maxRefineIts );
+    Y -= X;
+    const double relError = FrobeniusNorm( Y ) / FrobeniusNorm( X );
+
+    // The same solve through LinearSolve
+    Zeros( Y, n, numRHS );
+    Multiply( NORMAL, 1., A, X, 0., Y );
+    LinearSolve( A, Y, ctrl );
+    Y -= X;
+    const double linRelError = FrobeniusNorm( Y ) / FrobeniusNorm( X );
+
+    const double maxError =
+      mpi::AllReduce( Max(relError,linRelError), mpi::MAX, comm );
+    const Int minReplaced = mpi::AllReduce( numReplaced, mpi::MIN, comm );
+    const Int maxReplaced = mpi::AllReduce( numReplaced, mpi::MAX, comm );
+    if( print )
+        cout << "  " << label << ": " << numReplaced << " replaced pivots, "
+             << numRefineIts << " refinement iterations, "
+             << "max relative error=" << maxError << endl;
+    if( tinyPivot != 0. && minReplaced == 0 )
+        LogicError(label,": no tiny pivots were replaced");
+    if( tinyPivot == 0. && maxReplaced != 0 )
+        LogicError(label,": ",maxReplaced," pivots were unexpectedly replaced");
+    if( maxError > tol )
+        LogicError(label,": relative error of ",maxError," exceeded ",tol);
+}
+
+void TestDistributed
+( mpi::Comm comm, Int nx, Int ny, double beta, double tinyPivot,
+  Int numRHS, double tol, const string& label )
+{
+    const bool print = ( mpi::Rank(comm) == 0 );
+    DistSparseMatrix<double> A(comm);
+    Generate( A, nx, ny, beta, tinyPivot );
+    const Int n = A.Height();
+
+    ldl::DistNodeInfo info;
+    ldl::DistSeparator rootSep;
+    DistMap map, invMap;
+    ldl::NestedDissection( A.DistGraph(), map, rootSep, info );
+    InvertMap( map, invMap );
+    ldl::DistFront<double> L, U;
+    lu::Pull( A, map, rootSep, info, L, U );
+    LUStaticPivotCtrl<double> ctrl;
+    const Int numReplaced = LU( info, L, U, ctrl );
+
+    DistMultiVec<double> X(comm), Y(comm);
+    Uniform( X, n, numRHS );
+    Zeros( Y, n, numRHS );
+    Multiply( NORMAL, 1., A, X, 0., Y );
+    const Int numRefineIts = lu::SolveWithIterativeRefinement
+      ( A, invMap, info, L, U, Y, ctrl.minReductionFactor, ctrl.maxRefineIts );
+    Axpy( -1., X, Y );
+    const double relError = FrobeniusNorm( Y ) / FrobeniusNorm( X );
+
+    Zeros( Y, n, numRHS );
+    Multiply( NORMAL, 1., A, X, 0., Y );
+    LinearSolve( A, Y, ctrl );
+    Axpy( -1., X, Y );
+    const double linRelError = FrobeniusNorm( Y ) / FrobeniusNorm( X );
+
+    const double maxError = Max( relError, linRelError );
+    if( print )
+        cout << "  " << label << ": " << numReplaced << " replaced pivots, "
+             << numRefineIts << " refinement iterations, "
+             << "max relative error=" << maxError << endl;
+    if( tinyPivot != 0. && numReplaced == 0 )
+        LogicError(label,": no tiny pivots were replaced");
+    if( tinyPivot == 0. && numReplaced != 0 )
+        LogicError(label,": ",numReplaced," pivots were unexpectedly replaced");
+    if( maxError > tol )
+        LogicError(label,": relative error of ",maxError," exceeded ",tol);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nx = Input("--nx","first grid dimension",30);
+        const Int ny = Input("--ny","second grid dimension",30);
+        const double beta = Input("--beta","convection strength",100.);
+        const double tinyPivot = Input("--tinyPivot","tiny pivot",1e-14);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const double tol = Input("--tol","tolerated relative error",1e-9);
+        ProcessInput();
+        PrintInputReport();
+
+        TestSequential
+        ( comm, nx, ny, beta, 0., numRHS, tol,
+          "Sequential convection-diffusion" );
+        TestDistributed
+        ( comm, nx, ny, beta, 0., numRHS, tol,
+          "Distributed convection-diffusion" );
+        TestSequential
+        ( comm, nx, ny, beta, tinyPivot, numRHS, tol,
+          "Sequential with tiny pivots" );
+        TestDistributed
+        ( comm, nx, ny, beta, tinyPivot, numRHS, tol,
+          "Distributed with tiny pivots" );
+        if( mpi::Rank(comm) == 0 )
+            cout << "PASSED" << endl;
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,192 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// The sparse least squares problems stack a 2D Laplacian on top of a sparse
+// coupling block, so that A is 2 n^2 x n^2 with full column rank. The
+// solutions are checked through the normal equations, A^H (B - A X) = 0.
+
+void QueueEntries
+( Int n, Int firstRow, Int numRows,
+  function<void(Int,Int,double)> queue )
+{
+    const Int N = n*n;
+    for( Int i=firstRow; i<firstRow+numRows; ++i )
+    {
+        if( i < N )
+        {
+            const Int x = i % n;
+            const Int y = i / n;
+            queue( i, i, 4. );
+            if( x != 0 )   queue( i, i-1, -1. );
+            if( x != n-1 ) queue( i, i+1, -1. );
+            if( y != 0 )   queue( i, i-n, -1. );
+            if( y != n-1 ) queue( i, i+n, -1. );
+        }
+        else
+        {
+            const Int j = i - N;
+            queue( i, j, 1.+(j%7)/7. );
+            queue( i, (7*j+3)%N, 0.5 );
+        }
+    }
+}
+
+double NormalEqError
+( const SparseMatrix<double>& A, const Matrix<double>& B,
+  const Matrix<double>& X )
+{
+    auto R = B;
+    Multiply( NORMAL, -1., A, X, 1., R );
+    Matrix<double> Z;
+    Zeros( Z, A.Width(), B.Width() );
+    Multiply( ADJOINT, 1., A, R, 0., Z );
+    const double ANorm = FrobeniusNorm( A );
+    return FrobeniusNorm( Z ) / (ANorm*ANorm*FrobeniusNorm( X ));
+}
+
+double NormalEqError
+( const DistSparseMatrix<double>& A, const DistMultiVec<double>& B,
+  const DistMultiVec<double>& X )
+{
+    DistMultiVec<double> R( A.Comm() ), Z( A.Comm() );
+    R = B;
+    Multiply( NORMAL, -1., A, X, 1., R );
+    Zeros( Z, A.Width(), B.Width() );
+    Multiply( ADJOINT, 1., A, R, 0., Z );
+    const double ANorm = FrobeniusNorm( A );
+    return FrobeniusNorm( Z ) / (ANorm*ANorm*FrobeniusNorm( X ));
+}
+
+void TestSequential( Int n, Int numRHS, double tol )
+{
+    const Int N = n*n;
+    SparseMatrix<double> A;
+    Zeros( A, 2*N, N );
+    A.Reserve( 7*N );
+    QueueEntries
+    ( n, 0, 2*N,
+      [&]( Int i, Int j, double value ) { A.QueueUpdate( i, j, value ); } );
+    A.ProcessQueues();
+    Matrix<double> B;
+    Uniform( B, 2*N, numRHS );
+
+    // The factorization and solve
+    vector<Int> map, invMap;
+    ldl::NodeInfo info;
+    ldl::Separator sep;
+    qr::NestedDissection( A, map, sep, info );
+    InvertMap( map, invMap );
+    qr::SparseFront<double> front;
+    QR( A, map, info, front );
+    Matrix<double> X;
+    qr::SolveAfter( invMap, info, front, B, X );
+    const double qrError = NormalEqError( A, B, X );
+    cout << "  sparse QR: normal equation error=" << qrError << endl;
+    if( qrError > tol )
+        LogicError("Sparse QR had a normal equation error of ",qrError);
+
+    // The equilibrated driver
+    LeastSquaresCtrl<double> ctrl;
+    ctrl.useQR = true;
+    LeastSquares( NORMAL, A, B, X, ctrl );
+    const double lsError = NormalEqError( A, B, X );
+    cout << "  LeastSquares with QR: normal equation error=" << lsError
+         << endl;
+    if( lsError > tol )
+        LogicError("LeastSquares had a normal equation error of ",lsError);
+
+    // Rank-deficient matrices: a column which is zero and a column which
+    // duplicates another
+    for( Int k=0; k<2; ++k )
+    {
+        SparseMatrix<double> ADef;
+        Zeros( ADef, 2*N, N+1 );
+        ADef.Reserve( 7*N+2*N );
+        QueueEntries
+        ( n, 0, 2*N,
+          [&]( Int i, Int j, double value )
+          {
+              ADef.QueueUpdate( i, j, value );
+              if( k == 1 && j == N/2 )
+                  ADef.QueueUpdate( i, N, value );
+          } );
+        ADef.ProcessQueues();
+        bool threw = false;
+        try { LeastSquares( NORMAL, ADef, B, X, ctrl ); }
+        catch( exception& e ) { threw = true; }
+        if( !threw )
+            LogicError("A rank-deficient matrix was not detected");
+    }
+    cout << "  rank-deficient matrices were detected" << endl;
+}
+
+void TestDistributed( Int n, Int numRHS, double tol, mpi::Comm comm )
+{
+    const Int N = n*n;
+    DistSparseMatrix<double> A(comm);
+    Zeros( A, 2*N, N );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 7*localHeight );
+    QueueEntries
+    ( n, firstLocalRow, localHeight,
+      [&]( Int i, Int j, double value )
+      { A.QueueLocalUpdate( i-firstLocalRow, j, value ); } );
+    A.ProcessQueues();
+    DistMultiVec<double> B(comm), X(comm);
+    Uniform( B, 2*N, numRHS );
+
+    // The sparse QR is not distributed, so requesting it must fail rather
+    // than silently falling back to the augmented system
+    LeastSquaresCtrl<double> ctrl;
+    ctrl.useQR = true;
+    bool threw = false;
+    try { LeastSquares( NORMAL, A, B, X, ctrl ); }
+    catch( std::logic_error& e ) { threw = true; }
+    if( !threw )
+        LogicError("Distributed LeastSquares accepted useQR");
+
+    ctrl.useQR = false;
+    LeastSquares( NORMAL, A, B, X, ctrl );
+    const double error = NormalEqError( A, B, X );
+    if( mpi::Rank(comm) == 0 )
+        cout << "  distributed LeastSquares: normal equation error=" << error
+             << endl;
+    if( error > tol )
+        LogicError
+        ("Distributed LeastSquares had a normal equation error of ",error);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of n x n grid",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const double tol =
+          Input("--tol","tolerated relative normal equation error",1e-8);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+            TestSequential( n, numRHS, tol );
+        TestDistributed( n, numRHS, tol, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// The test matrices are 2D Laplacians which have been symmetrically scaled by
+// powers of ten, so that the row max norms initially vary by eight orders of
+// magnitude. After equilibration, A should equal D^{-1} A_orig D^{-1} and
+// its row max norms should be near one.
+
+void QueueEntries
+( Int n, Int firstRow, Int numRows,
+  function<void(Int,Int,double)> queue )
+{
+    auto scale = []( Int i ) { return Pow(10.,double(i%5)-2.); };
+    for( Int i=firstRow; i<firstRow+numRows; ++i )
+    {
+        const Int x = i % n;
+        const Int y = i / n;
+        queue( i, i, 4.*scale(i)*scale(i) );
+        if( x != 0 )   queue( i, i-1, -scale(i)*scale(i-1) );
+        if( x != n-1 ) queue( i, i+1, -scale(i)*scale(i+1) );
+        if( y != 0 )   queue( i, i-n, -scale(i)*scale(i-n) );
+        if( y != n-1 ) queue( i, i+n, -scale(i)*scale(i+n) );
+    }
+}
+
+// Return max_e | d(i) d(j) AEquil(i,j) - A(i,j) | / | A(i,j) | and the
+// maximum of | 1 - max_j | AEquil(i,j) | | over the rows
+pair<double,double> Errors
+( const DistSparseMatrix<double>& A, const DistSparseMatrix<double>& AEquil,
+  const DistMultiVec<double>& d )
+{
+    auto AScaled( AEquil );
+    DiagonalScale( LEFT, NORMAL, d, AScaled );
+    DiagonalScale( RIGHT, NORMAL, d, AScaled );
+    double relError = 0;
+    vector<double> rowMax( A.LocalHeight(), 0 );
+    for( Int e=0; e<A.NumLocalEntries(); ++e )
+    {
+        relError =
+          Max( relError, Abs(AScaled.Value(e)-A.Value(e))/Abs(A.Value(e)) );
+        const Int iLoc = A.Row(e) - A.FirstLocalRow();
+        rowMax[iLoc] = Max( rowMax[iLoc], Abs(AEquil.Value(e)) );
+    }
+    double deviation = 0;
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        deviation = Max( deviation, Abs(1-rowMax[iLoc]) );
+    return make_pair
+    ( mpi::AllReduce( relError, mpi::MAX, A.Comm() ),
+      mpi::AllReduce( deviation, mpi::MAX, A.Comm() ) );
+}
+
+void TestSequential
+( Int n, const Matrix<double>& dDist, double tol )
+{
+    const Int N = n*n;
+    SparseMatrix<double> A;
+    Zeros( A, N, N );
+    A.Reserve( 5*N );
+    QueueEntries
+    ( n, 0, N,
+      [&]( Int i, Int j, double value ) { A.QueueUpdate( i, j, value ); } );
+    A.ProcessQueues();
+
+    auto AEquil( A );
+    Matrix<double> d;
+    SymmetricRuizEquil( AEquil, d );
+
+    // The sequential and distributed sweeps perform the same operations
+    double maxDiff = 0;
+    for( Int i=0; i<N; ++i )
+        maxDiff = Max( maxDiff, Abs(d.Get(i,0)-dDist.Get(i,0))/d.Get(i,0) );
+    cout << "  sequential/distributed scaling difference: " << maxDiff << endl;
+    if( maxDiff > tol )
+        LogicError("The sequential and distributed scalings differ");
+}
+
+void TestDistributed( Int n, double tol, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    const Int N = n*n;
+    DistSparseMatrix<double> A(comm);
+    Zeros( A, N, N );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 5*localHeight );
+    QueueEntries
+    ( n, firstLocalRow, localHeight,
+      [&]( Int i, Int j, double value )
+      { A.QueueLocalUpdate( i-firstLocalRow, j, value ); } );
+    A.ProcessQueues();
+
+    auto AEquil( A );
+    DistMultiVec<double> d(comm);
+    SymmetricRuizEquil( AEquil, d, commRank==0 );
+    auto errors = Errors( A, AEquil, d );
+    if( commRank == 0 )
+        cout << "  cold start: relative entry error=" << errors.first
+             << ", row max norm deviation=" << errors.second << endl;
+    if( errors.first > tol )
+        LogicError("Cold start did not satisfy AEquil = D^{-1} A D^{-1}");
+    if( errors.second > 0.5 )
+        LogicError("Cold start row max norm deviation was ",errors.second);
+
+    // Warm-starting from the previous scaling should immediately satisfy the
+    // stopping criterion (or improve upon it) while preserving the relation
+    const double coldDeviation = errors.second;
+    auto AWarm( A );
+    auto dWarm( d );
+    SymmetricRuizEquil( AWarm, dWarm, commRank==0, true );
+    errors = Errors( A, AWarm, dWarm );
+    if( commRank == 0 )
+        cout << "  warm start: relative entry error=" << errors.first
+             << ", row max norm deviation=" << errors.second << endl;
+    if( errors.first > tol )
+        LogicError("Warm start did not satisfy AEquil = D^{-1} A D^{-1}");
+    if( errors.second > coldDeviation+tol )
+        LogicError("Warm start increased the row max norm deviation");
+
+    // A mismatched warm-start vector should be ignored
+    auto AReset( A );
+    DistMultiVec<double> dReset(comm);
+    Ones( dReset, N+1, 1 );
+    SymmetricRuizEquil( AReset, dReset, false, true );
+    errors = Errors( A, AReset, dReset );
+    if( errors.first > tol )
+        LogicError("A mismatched warm start was not reset");
+
+    if( commRank == 0 )
+    {
+        Matrix<double> dRoot;
+        CopyFromRoot( d, dRoot );
+        TestSequential( n, dRoot, tol );
+    }
+    else
+        CopyFromNonRoot( d );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of n x n grid",30);
+        const double tol = Input("--tol","tolerated relative error",1e-12);
+        ProcessInput();
+        PrintInputReport();
+
+        TestDistributed( n, tol, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
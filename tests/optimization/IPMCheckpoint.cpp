@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+bool FileExists( const string& filename )
+{
+    ifstream file( filename.c_str() );
+    return file.is_open();
+}
+
+// The relative difference between two iterates
+double RelDiff( const DistMultiVec<double>& x, const DistMultiVec<double>& y )
+{
+    DistMultiVec<double> e( x );
+    Axpy( -1., y, e );
+    return FrobeniusNorm( e ) / Max( FrobeniusNorm(x), 1. );
+}
+
+// A feasible and bounded affine LP,
+//
+//   min c^T x, s.t. A x = b, x >= 0,
+//
+// where A is a sparse m x n matrix with a dominant leading m x m diagonal,
+// b = A 1, and c > 0 (so that z = c is dual feasible)
+void GenerateLP
+( Int m, Int n,
+  DistSparseMatrix<double>& A, DistSparseMatrix<double>& G,
+  DistMultiVec<double>& b, DistMultiVec<double>& c, DistMultiVec<double>& h )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 3*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, 4. );
+        A.QueueLocalUpdate( iLoc, i+m, SampleUniform<double>(-1,1) );
+        A.QueueLocalUpdate( iLoc, (7*i+3) % n, SampleUniform<double>(-1,1) );
+    }
+    A.ProcessLocalQueues();
+
+    // G = -I and h = 0 enforce x >= 0
+    Identity( G, n, n );
+    G *= -1;
+    Zeros( h, n, 1 );
+
+    DistMultiVec<double> ones( A.Comm() );
+    Ones( ones, n, 1 );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, 1., A, ones, 0., b );
+    Uniform( c, n, 1, 1.5, 0.5 );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--m","number of equality constraints",200);
+        const Int n = Input("--n","number of variables",500);
+        const Int freq = Input("--freq","checkpoint frequency",2);
+        const Int stopIt = Input("--stopIt","iteration to interrupt at",4);
+        const string basename =
+          Input("--basename","basename of the checkpoints","IPM");
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // A round trip of an iterate through SaveIPMIterate/LoadIPMIterate
+        const string iterateBase = basename+"-iterate";
+        const string iterateFile = checkpoint::Filename( iterateBase, comm );
+        DistMultiVec<double> x(comm), y(comm), z(comm), s(comm);
+        Uniform( x, n, 1 );
+        Uniform( y, m, 1 );
+        Uniform( z, n, 1 );
+        Uniform( s, n, 1 );
+        SaveIPMIterate( iterateBase, 7, x, y, z, s );
+        const Int missing =
+          ( !FileExists(iterateFile) || FileExists(iterateFile+".tmp") );
+        if( mpi::AllReduce( missing, mpi::MAX, comm ) != 0 )
+            LogicError("The iterate checkpoint was not renamed into place");
+        DistMultiVec<double> xLoad(comm), yLoad(comm), zLoad(comm),
+                             sLoad(comm);
+        const Int loadedIt =
+          LoadIPMIterate( iterateBase, xLoad, yLoad, zLoad, sLoad );
+        const double roundTripDiff =
+          Max( Max( RelDiff(x,xLoad), RelDiff(y,yLoad) ),
+               Max( RelDiff(z,zLoad), RelDiff(s,sLoad) ) );
+        if( loadedIt != 7 || roundTripDiff != 0. )
+            LogicError("The loaded iterate differed from the saved one");
+        bool threw = false;
+        try { LoadIPMIterate( iterateBase, xLoad, yLoad, zLoad ); }
+        catch( std::exception& e ) { threw = true; }
+        if( !threw )
+            LogicError("An iterate with the wrong number of vectors loaded");
+        if( commRank == 0 )
+            cout << "Iterate round trip: PASSED" << endl;
+
+        DistSparseMatrix<double> A(comm), G(comm);
+        DistMultiVec<double> b(comm), c(comm), h(comm);
+        GenerateLP( m, n, A, G, b, c, h );
+
+        // An uninterrupted reference solve
+        lp::affine::Ctrl<double> ctrl;
+        ctrl.mehrotraCtrl.print = progress;
+        DistMultiVec<double> xRef(comm), yRef(comm), zRef(comm), sRef(comm);
+        LP( A, G, b, c, h, xRef, yRef, zRef, sRef, ctrl );
+        const double objRef = Dot( c, xRef );
+
+        // Interrupt a checkpointed solve by limiting the number of iterations
+        ctrl.mehrotraCtrl.checkpointFreq = freq;
+        ctrl.mehrotraCtrl.checkpointBase = basename;
+        const Int maxIts = ctrl.mehrotraCtrl.maxIts;
+        ctrl.mehrotraCtrl.maxIts = stopIt;
+        try { LP( A, G, b, c, h, x, y, z, s, ctrl ); }
+        catch( std::exception& e ) { }
+        const Int checkpointIt =
+          LoadIPMIterate( iterateBase, xLoad, yLoad, zLoad, sLoad );
+        if( checkpointIt != (stopIt/freq)*freq )
+            LogicError
+            ("The last checkpoint was of iteration ",checkpointIt,
+             " rather than ",(stopIt/freq)*freq);
+
+        // Resume from the checkpoint and compare against the reference
+        ctrl.mehrotraCtrl.maxIts = maxIts;
+        ctrl.mehrotraCtrl.resume = true;
+        LP( A, G, b, c, h, x, y, z, s, ctrl );
+        const double obj = Dot( c, x );
+        DistMultiVec<double> r( b );
+        Multiply( NORMAL, -1., A, x, 1., r );
+        const double objDiff = Abs(obj-objRef) / Abs(objRef);
+        const double primalInfeas = FrobeniusNorm( r ) / FrobeniusNorm( b );
+        if( commRank == 0 )
+            cout << "Resumed from iteration " << checkpointIt << ": "
+                 << "objective=" << obj << ", reference=" << objRef
+                 << ", || b - A x ||_2 / || b ||_2=" << primalInfeas << endl;
+        if( objDiff > 1e-6 || primalInfeas > 1e-6 )
+            LogicError("The resumed solve did not match the reference");
+
+        const string analysisFile =
+          checkpoint::Filename( basename+"-analysis", comm );
+        std::remove( iterateFile.c_str() );
+        std::remove( analysisFile.c_str() );
+        if( commRank == 0 )
+            cout << "PASSED" << endl;
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// A rank-r matrix with singular values on the order of sqrt(m n) plus Gaussian
+// noise of (spectral) norm roughly noise*(sqrt(m)+sqrt(n))
+template<typename F>
+void LowRankPlusNoise
+( DistMatrix<F>& A, Int m, Int n, Int r, Base<F> noise )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<F> X(g), Y(g);
+    Gaussian( X, m, r );
+    Gaussian( Y, n, r );
+    Gaussian( A, m, n, F(0), noise );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, F(1), A );
+}
+
+// The randomized SVT must retain the same number of singular triplets as the
+// exact SVT and return orthonormal right singular vectors
+template<typename F>
+void CheckRandomized
+( Int rank, Int exactRank, const DistMatrix<F>& V, Base<F> tol,
+  const string& label, bool print )
+{
+    typedef Base<F> Real;
+    if( print )
+        cout << "  " << label << ": rank=" << rank
+             << ", exact rank=" << exactRank << endl;
+    if( rank != exactRank )
+        LogicError(label,": rank was ",rank," rather than ",exactRank);
+    if( V.Width() != rank )
+        LogicError(label,": V had ",V.Width()," columns rather than ",rank);
+
+    DistMatrix<F> E(V.Grid());
+    Identity( E, rank, rank );
+    Herk( LOWER, ADJOINT, Real(-1), V, Real(1), E );
+    const Real orthError = HermitianFrobeniusNorm( LOWER, E );
+    if( print )
+        cout << "    || V^H V - I ||_F = " << orthError << endl;
+    if( orthError > tol )
+        LogicError(label,": V was not orthonormal (",orthError,")");
+}
+
+template<typename F>
+void TestRandomized
+( const Grid& g, Int m, Int n, Int r, Base<F> noise, Base<F> tau,
+  Int numPowerIts, bool print )
+{
+    typedef Base<F> Real;
+    const Real tol = Sqrt(Epsilon<Real>());
+
+    DistMatrix<F> A(g);
+    LowRankPlusNoise( A, m, n, r, noise );
+
+    // The exact singular value soft-thresholding
+    DistMatrix<F> AExact( A );
+    const Int exactRank = SVT( AExact, tau );
+    const Real exactFrob = FrobeniusNorm( AExact );
+
+    // A cold start with a single oversampled column begins with a sketch of
+    // width one, which must repeatedly be doubled to reach the rank
+    DistMatrix<F> ARand( A ), V(g);
+    const Int coldRank = svt::Randomized( ARand, tau, V, 1, numPowerIts );
+    CheckRandomized( coldRank, exactRank, V, tol, "Cold start", print );
+    ARand -= AExact;
+    Real relError = FrobeniusNorm( ARand ) / exactFrob;
+    if( print )
+        cout << "    || SVT(A) - RSVT(A) ||_F / || SVT(A) ||_F = "
+             << relError << endl;
+    if( relError > tol )
+        LogicError("Cold-started randomized SVT had relative error ",relError);
+
+    // Warm-start with the retained subspace for a slightly perturbed matrix,
+    // which should be captured by a single sketch
+    DistMatrix<F> P(g);
+    Gaussian( P, m, n, F(0), noise/10 );
+    A += P;
+    AExact = A;
+    const Int warmExactRank = SVT( AExact, tau );
+    ARand = A;
+    const Int warmRank = svt::Randomized( ARand, tau, V, 1, numPowerIts );
+    CheckRandomized( warmRank, warmExactRank, V, tol, "Warm start", print );
+    ARand -= AExact;
+    relError = FrobeniusNorm( ARand ) / FrobeniusNorm( AExact );
+    if( print )
+        cout << "    || SVT(A) - RSVT(A) ||_F / || SVT(A) ||_F = "
+             << relError << endl;
+    if( relError > tol )
+        LogicError("Warm-started randomized SVT had relative error ",relError);
+
+    // The sequential implementation, with the same (redundant) matrix on
+    // every process; since the sketches differ between processes, a failure
+    // on any of them must be reported by all of them
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), AExact_STAR_STAR( AExact );
+    auto& ALoc = A_STAR_STAR.Matrix();
+    Matrix<F> VLoc;
+    const Int seqRank = svt::Randomized( ALoc, tau, VLoc, 1, numPowerIts );
+    ALoc -= AExact_STAR_STAR.Matrix();
+    relError =
+      FrobeniusNorm( ALoc ) / FrobeniusNorm( AExact_STAR_STAR.Matrix() );
+    const Int seqWrong = ( seqRank != warmExactRank || relError > tol );
+    if( print )
+        cout << "  Sequential: rank=" << seqRank << "\n"
+             << "    || SVT(A) - RSVT(A) ||_F / || SVT(A) ||_F = "
+             << relError << endl;
+    if( mpi::AllReduce( seqWrong, mpi::MAX, g.Comm() ) != 0 )
+        LogicError("Sequential randomized SVT was incorrect");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",80);
+        const Int n = Input("--width","width of matrix",60);
+        const Int r = Input("--rank","rank of the signal",5);
+        const double noise = Input("--noise","noise standard deviation",1e-3);
+        const double tau = Input("--tau","soft-threshold parameter",0.5);
+        const Int numPowerIts = Input("--numPowerIts","power iterations",2);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        const bool print = ( commRank == 0 );
+        if( print )
+            cout << "Testing with doubles:" << endl;
+        TestRandomized<double>( g, m, n, r, noise, tau, numPowerIts, print );
+        if( print )
+            cout << "Testing with double-precision complex:" << endl;
+        TestRandomized<Complex<double>>
+        ( g, m, n, r, noise, tau, numPowerIts, print );
+        if( print )
+            cout << "PASSED" << endl;
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}